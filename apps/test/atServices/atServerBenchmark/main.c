@@ -0,0 +1,269 @@
+/**
+ * Benchmark of the AT command round trip throughput of the AT server, over a pseudo-terminal
+ * pair.
+ *
+ * The AT server runs in its own thread on the slave side of the pseudo-terminal, and the main
+ * thread acts as the host on the master side: it sends an AT command, and waits for its final
+ * result code before sending the next one.
+ *
+ * Two commands answer the same list-style response:
+ *  - AT+LINES sends each line with le_atServer_SendIntermediateResponse(), then the final result
+ *    code with le_atServer_SendFinalResultCode(),
+ *  - AT+BATCH sends all of them at once with le_atServer_SendResponses().
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include <termios.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of round trips per command, and number of lines in the responses.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ITERATION_COUNT     2000
+#define LINE_COUNT          10
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time to wait for the server, in milliseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SERVER_TIMEOUT      10000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host side buffer size.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DSIZE               1024
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Final result code terminating each answer.
+ */
+//--------------------------------------------------------------------------------------------------
+#define FINAL_RSP           "\r\nOK\r\n"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Semaphore posted once the server is ready.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_sem_Ref_t ServerReadySemRef;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lines of the response, as sent with le_atServer_SendResponses().
+ */
+//--------------------------------------------------------------------------------------------------
+static char Lines[LINE_COUNT * 32];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * AT+LINES handler: one call per line.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LinesCmdHandler
+(
+    le_atServer_CmdRef_t commandRef,
+    le_atServer_Type_t type,
+    uint32_t parametersNumber,
+    void* contextPtr
+)
+{
+    char rsp[LE_ATDEFS_RESPONSE_MAX_BYTES];
+    int i;
+
+    for (i = 0; i < LINE_COUNT; i++)
+    {
+        snprintf(rsp, sizeof(rsp), "+BENCH: %d,\"line\"", i);
+        LE_ASSERT_OK(le_atServer_SendIntermediateResponse(commandRef, rsp));
+    }
+
+    LE_ASSERT_OK(le_atServer_SendFinalResultCode(commandRef, LE_ATSERVER_OK, "", 0));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * AT+BATCH handler: a single call.
+ */
+//--------------------------------------------------------------------------------------------------
+static void BatchCmdHandler
+(
+    le_atServer_CmdRef_t commandRef,
+    le_atServer_Type_t type,
+    uint32_t parametersNumber,
+    void* contextPtr
+)
+{
+    LE_ASSERT_OK(le_atServer_SendResponses(commandRef, Lines, LE_ATSERVER_OK, "", 0));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * AT server thread: opens the slave side of the pseudo-terminal, and subscribes the commands.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* AtServerThread
+(
+    void* contextPtr
+)
+{
+    int fd = *((int*)contextPtr);
+    le_atServer_DeviceRef_t devRef;
+    le_atServer_CmdRef_t cmdRef;
+
+    devRef = le_atServer_Open(fd);
+    LE_ASSERT(devRef != NULL);
+
+    cmdRef = le_atServer_Create("AT+LINES");
+    LE_ASSERT(cmdRef != NULL);
+    LE_ASSERT(le_atServer_AddCommandHandler(cmdRef, LinesCmdHandler, NULL) != NULL);
+
+    cmdRef = le_atServer_Create("AT+BATCH");
+    LE_ASSERT(cmdRef != NULL);
+    LE_ASSERT(le_atServer_AddCommandHandler(cmdRef, BatchCmdHandler, NULL) != NULL);
+
+    le_sem_Post(ServerReadySemRef);
+
+    le_event_RunLoop();
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open a pseudo-terminal pair in raw mode, and return the master side fd.
+ */
+//--------------------------------------------------------------------------------------------------
+static int OpenPty
+(
+    int* slaveFdPtr     ///< [OUT] Slave side fd
+)
+{
+    struct termios term;
+    int masterFd;
+
+    masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+    LE_ASSERT(masterFd != -1);
+    LE_ASSERT(grantpt(masterFd) == 0);
+    LE_ASSERT(unlockpt(masterFd) == 0);
+
+    *slaveFdPtr = open(ptsname(masterFd), O_RDWR | O_NOCTTY);
+    LE_ASSERT(*slaveFdPtr != -1);
+
+    // No echo nor line processing by the terminal: the AT server does it.
+    LE_ASSERT(tcgetattr(*slaveFdPtr, &term) == 0);
+    cfmakeraw(&term);
+    LE_ASSERT(tcsetattr(*slaveFdPtr, TCSANOW, &term) == 0);
+
+    return masterFd;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send an AT command on the host side, and read its answer up to the final result code.
+ *
+ * @return the number of reads needed to get the answer.
+ */
+//--------------------------------------------------------------------------------------------------
+static int RoundTrip
+(
+    int fd,
+    const char* cmdPtr,
+    char* rspPtr        ///< [OUT] Answer, of DSIZE bytes
+)
+{
+    struct pollfd pollFd = { .fd = fd, .events = POLLIN };
+    char cmd[LE_ATDEFS_COMMAND_MAX_BYTES];
+    size_t len = 0;
+    int readCount = 0;
+
+    snprintf(cmd, sizeof(cmd), "%s\r", cmdPtr);
+    LE_ASSERT(write(fd, cmd, strlen(cmd)) == (ssize_t)strlen(cmd));
+
+    while ((len < strlen(FINAL_RSP)) || strcmp(rspPtr + len - strlen(FINAL_RSP), FINAL_RSP))
+    {
+        LE_ASSERT(poll(&pollFd, 1, SERVER_TIMEOUT) == 1);
+
+        ssize_t count = read(fd, rspPtr + len, DSIZE - 1 - len);
+        LE_ASSERT(count > 0);
+
+        len += count;
+        rspPtr[len] = '\0';
+        readCount++;
+    }
+
+    return readCount;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run the round trips of a command, and log the throughput.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Run
+(
+    int fd,
+    const char* cmdPtr,
+    char* rspPtr        ///< [OUT] Last answer, of DSIZE bytes
+)
+{
+    le_clk_Time_t start = le_clk_GetRelativeTime();
+    uint64_t readCount = 0;
+    int i;
+
+    for (i = 0; i < ITERATION_COUNT; i++)
+    {
+        readCount += RoundTrip(fd, cmdPtr, rspPtr);
+    }
+
+    le_clk_Time_t duration = le_clk_Sub(le_clk_GetRelativeTime(), start);
+    uint64_t durationUs = (uint64_t)duration.sec * 1000000 + duration.usec;
+
+    LE_INFO("%-10s %8"PRIu64" us, %6"PRIu64" commands/s, %"PRIu64".%02"PRIu64" reads/command",
+            cmdPtr, durationUs, (uint64_t)ITERATION_COUNT * 1000000 / (durationUs ? durationUs : 1),
+            readCount / ITERATION_COUNT, readCount * 100 / ITERATION_COUNT % 100);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * main of the benchmark
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+    static char linesRsp[DSIZE];
+    static char batchRsp[DSIZE];
+    static int slaveFd;
+    size_t len = 0;
+    int masterFd;
+    int i;
+
+    LE_INFO("======== AT server benchmark started ========");
+
+    for (i = 0; i < LINE_COUNT; i++)
+    {
+        len += snprintf(Lines + len, sizeof(Lines) - len, "%s+BENCH: %d,\"line\"",
+                        i ? "\n" : "", i);
+    }
+
+    masterFd = OpenPty(&slaveFd);
+
+    ServerReadySemRef = le_sem_Create("ServerReadySem", 0);
+    le_thread_Start(le_thread_Create("AtServer", AtServerThread, &slaveFd));
+
+    le_clk_Time_t timeout = { .sec = SERVER_TIMEOUT / 1000 };
+    LE_ASSERT_OK(le_sem_WaitWithTimeOut(ServerReadySemRef, timeout));
+
+    Run(masterFd, "AT+LINES", linesRsp);
+    Run(masterFd, "AT+BATCH", batchRsp);
+
+    // Both commands answer the same
+    LE_ASSERT(strcmp(linesRsp, batchRsp) == 0);
+
+    LE_INFO("======== AT server benchmark finished ========");
+    exit(EXIT_SUCCESS);
+}
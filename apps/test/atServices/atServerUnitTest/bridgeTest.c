@@ -9,6 +9,14 @@
 #include "interfaces.h"
 #include "defs.h"
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time to wait for the bytes relayed to the modem, in milliseconds
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+#define MODEM_TIMEOUT   10000
+
 //--------------------------------------------------------------------------------------------------
 /**
  * AT command description structure
@@ -106,6 +114,8 @@ static const le_atClient_DeviceRef_t  AtClientDeviceRef = (le_atClient_DeviceRef
 static le_atClient_UnsolicitedResponseHandlerFunc_t UnsolHandler = NULL;
 static void* UnsolHandlerContextPtr = NULL;
 static int FdAtClient = -1;
+static int FdModem = -1;
+static le_atServer_DeviceRef_t SecondDevRef = NULL;
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -607,3 +617,330 @@ le_result_t Testle_atServer_Bridge
 
     return ret;
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the passthrough bridge, with a socket pair standing for the modem
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartPassthroughBridge
+(
+    void *param1Ptr,
+    void *param2Ptr
+)
+{
+    int fds[2];
+
+    LE_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    FdModem = fds[1];
+
+    le_atServer_BridgeRef_t bridgeRef = le_atServer_OpenPassthroughBridge(fds[0]);
+    LE_ASSERT(bridgeRef != NULL);
+    *(le_atServer_BridgeRef_t*) param1Ptr = bridgeRef;
+    le_atServer_DeviceRef_t devRef = param2Ptr;
+
+    LE_ASSERT_OK(le_atServer_AddDeviceToBridge(devRef, bridgeRef));
+
+    le_sem_Post(BridgeSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stop the passthrough bridge: the modem is monitored by the AT server thread, so the bridge has
+ * to be closed from it.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void StopPassthroughBridge
+(
+    void *param1Ptr,
+    void *param2Ptr
+)
+{
+    le_atServer_BridgeRef_t bridgeRef = param1Ptr;
+    le_atServer_DeviceRef_t devRef = param2Ptr;
+
+    LE_ASSERT(le_atServer_CloseBridge(bridgeRef) == LE_BUSY);
+    LE_ASSERT_OK(le_atServer_RemoveDeviceFromBridge(devRef, bridgeRef));
+    LE_ASSERT_OK(le_atServer_CloseBridge(bridgeRef));
+
+    le_sem_Post(BridgeSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open a second device on the passthrough bridge, with a socket pair standing for its host
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void OpenPassthroughDevice
+(
+    void *param1Ptr,
+    void *param2Ptr
+)
+{
+    le_atServer_BridgeRef_t bridgeRef = param1Ptr;
+    int fds[2];
+
+    LE_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    *(int*) param2Ptr = fds[1];
+
+    SecondDevRef = le_atServer_Open(fds[0]);
+    LE_ASSERT(SecondDevRef != NULL);
+    LE_ASSERT_OK(le_atServer_AddDeviceToBridge(SecondDevRef, bridgeRef));
+
+    le_sem_Post(BridgeSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close a device of the passthrough bridge while it is in data mode
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ClosePassthroughDevice
+(
+    void *param1Ptr,
+    void *param2Ptr
+)
+{
+    LE_ASSERT_OK(le_atServer_Close(SecondDevRef));
+    SecondDevRef = NULL;
+
+    le_sem_Post(BridgeSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read bytes on a file descriptor and check them.
+ *
+ * @return
+ *      - LE_TIMEOUT when the bytes are not received
+ *      - LE_FAULT when the bytes are not the expected ones
+ *      - LE_OK when function succeed
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReadAndTest
+(
+    int fd,
+    const char* expectedPtr
+)
+{
+    struct pollfd pollFd = { .fd = fd, .events = POLLIN };
+    char buf[LE_ATDEFS_COMMAND_MAX_BYTES];
+    size_t len = 0;
+
+    memset(buf, 0, sizeof(buf));
+
+    while (len < strlen(expectedPtr))
+    {
+        if (poll(&pollFd, 1, MODEM_TIMEOUT) != 1)
+        {
+            LE_ERROR("Timed out waiting for the relayed bytes");
+            return LE_TIMEOUT;
+        }
+
+        ssize_t size = read(fd, buf + len, sizeof(buf) - 1 - len);
+        LE_ASSERT(size > 0);
+        len += size;
+    }
+
+    if (strcmp(buf, expectedPtr))
+    {
+        LE_ERROR("fd %d received %s, expected %s", fd, buf, expectedPtr);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send bytes from the host, check the bytes received by the modem, answer them and check the
+ * bytes received by the host.
+ *
+ * @return
+ *      - LE_FAULT when function failed
+ *      - LE_OK when function succeed
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t RelayAndTest
+(
+    int socketFd,
+    int epollFd,
+    const char* hostPtr,            ///< bytes sent by the host
+    const char* modemPtr,           ///< bytes expected by the modem
+    const char* modemRspPtr,        ///< bytes sent by the modem
+    const char* hostRspPtr          ///< bytes expected by the host
+)
+{
+    le_result_t res;
+
+    LE_ASSERT(write(socketFd, hostPtr, strlen(hostPtr)) == (ssize_t)strlen(hostPtr));
+
+    res = ReadAndTest(FdModem, modemPtr);
+    if (LE_OK != res)
+    {
+        return res;
+    }
+
+    LE_ASSERT(write(FdModem, modemRspPtr, strlen(modemRspPtr)) == (ssize_t)strlen(modemRspPtr));
+
+    return TestResponses(socketFd, epollFd, hostRspPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to test the AT server passthrough bridge feature.
+ *
+ * APIs tested:
+ * - le_atServer_OpenPassthroughBridge
+ * - le_atServer_Close
+ * - le_atServer_CloseBridge
+ * - le_atServer_AddDeviceToBridge
+ * - le_atServer_RemoveDeviceFromBridge
+ *
+ * @return
+ *      - LE_FAULT when function failed
+ *      - LE_OK when function succeed
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t Testle_atServer_PassthroughBridge
+(
+    int socketFd,
+    int epollFd,
+    SharedData_t* sharedDataPtr
+)
+{
+    LE_INFO("======== Test AT server passthrough bridge API ========");
+    le_atServer_BridgeRef_t bridgeRef = NULL;
+
+    le_event_QueueFunctionToThread( sharedDataPtr->atServerThread,
+                                    StartPassthroughBridge,
+                                    (void*) &bridgeRef,
+                                    (void*) sharedDataPtr->devRef);
+
+    le_sem_Wait(BridgeSemaphore);
+
+    // Unknown command: relayed as is, up to the final result code
+    LE_ASSERT_OK(RelayAndTest(socketFd, epollFd,
+                              "AT+CSQ\r",
+                              "AT+CSQ\r",
+                              "\r\n+CSQ: 20,99\r\n\r\nOK\r\n",
+                              "\r\n+CSQ: 20,99\r\n\r\nOK\r\n"));
+
+    LE_ASSERT_OK(RelayAndTest(socketFd, epollFd,
+                              "AT+CPIN?\r",
+                              "AT+CPIN?\r",
+                              "\r\n+CME ERROR: 10\r\n",
+                              "\r\n+CME ERROR: 10\r\n"));
+
+    // Known command first: the rest of the command line is relayed
+    LE_ASSERT_OK(RelayAndTest(socketFd, epollFd,
+                              "AT+ABCD?;+CSQ;+CREG?\r",
+                              "AT+CSQ;+CREG?\r",
+                              "\r\n+CSQ: 20,99\r\n\r\n+CREG: 0,1\r\n\r\nOK\r\n",
+                              "\r\n+ABCD TYPE: READ\r\n"
+                              "\r\n+CSQ: 20,99\r\n\r\n+CREG: 0,1\r\n\r\nOK\r\n"));
+
+    // Data mode, until NO CARRIER
+    LE_ASSERT_OK(RelayAndTest(socketFd, epollFd,
+                              "AT+CGDATA=\"PPP\",1\r",
+                              "AT+CGDATA=\"PPP\",1\r",
+                              "\r\nCONNECT\r\n",
+                              "\r\nCONNECT\r\n"));
+
+    LE_ASSERT_OK(RelayAndTest(socketFd, epollFd,
+                              "AT+CSQ\r~data~",
+                              "AT+CSQ\r~data~",
+                              "~data~\r\nNO CARRIER\r\n",
+                              "~data~\r\nNO CARRIER\r\n"));
+
+    // Data mode, until the escape sequence
+    LE_ASSERT_OK(RelayAndTest(socketFd, epollFd,
+                              "ATO\r",
+                              "ATO\r",
+                              "\r\nCONNECT 115200\r\n~data~",
+                              "\r\nCONNECT 115200\r\n~data~"));
+
+    LE_ASSERT_OK(RelayAndTest(socketFd, epollFd,
+                              "+++",
+                              "+++",
+                              "\r\nOK\r\n",
+                              "\r\nOK\r\n"));
+
+    // Known commands are still treated by the server
+    LE_ASSERT_OK(SendCommandsAndTest(socketFd, epollFd, "AT+ABCD?",
+                                     "\r\n+ABCD TYPE: READ\r\n"
+                                     "\r\nOK\r\n"));
+
+    // Modem lines out of a command line are unsolicited responses
+    const char unsolRsp[] = "\r\n+CREG: 1\r\n";
+    LE_ASSERT(write(FdModem, unsolRsp, sizeof(unsolRsp) - 1) == (ssize_t)sizeof(unsolRsp) - 1);
+    LE_ASSERT_OK(TestResponses(socketFd, epollFd, unsolRsp));
+
+    // Closing the device in data mode releases the modem for the other devices
+    int hostFd = -1;
+    const char dataCmd[] = "AT+CGDATA=1\r";
+    const char connectRsp[] = "\r\nCONNECT\r\n";
+
+    le_event_QueueFunctionToThread( sharedDataPtr->atServerThread,
+                                    OpenPassthroughDevice,
+                                    (void*) bridgeRef,
+                                    (void*) &hostFd);
+
+    le_sem_Wait(BridgeSemaphore);
+
+    LE_ASSERT(write(hostFd, dataCmd, sizeof(dataCmd) - 1) == (ssize_t)sizeof(dataCmd) - 1);
+    LE_ASSERT_OK(ReadAndTest(FdModem, dataCmd));
+    LE_ASSERT(write(FdModem, connectRsp, sizeof(connectRsp) - 1) ==
+              (ssize_t)sizeof(connectRsp) - 1);
+    LE_ASSERT_OK(ReadAndTest(hostFd, connectRsp));
+
+    le_event_QueueFunctionToThread( sharedDataPtr->atServerThread,
+                                    ClosePassthroughDevice,
+                                    NULL,
+                                    NULL);
+
+    le_sem_Wait(BridgeSemaphore);
+
+    close(hostFd);
+
+    LE_ASSERT_OK(RelayAndTest(socketFd, epollFd,
+                              "AT+CSQ\r",
+                              "AT+CSQ\r",
+                              "\r\n+CSQ: 20,99\r\n\r\nOK\r\n",
+                              "\r\n+CSQ: 20,99\r\n\r\nOK\r\n"));
+
+    // Modem hung up in data mode: the bytes already sent are relayed, then NO CARRIER ends it
+    LE_ASSERT_OK(RelayAndTest(socketFd, epollFd,
+                              dataCmd,
+                              dataCmd,
+                              connectRsp,
+                              connectRsp));
+
+    const char lastData[] = "~data~";
+    LE_ASSERT(write(FdModem, lastData, sizeof(lastData) - 1) == (ssize_t)sizeof(lastData) - 1);
+    close(FdModem);
+    LE_ASSERT_OK(TestResponses(socketFd, epollFd, "~data~\r\nNO CARRIER\r\n"));
+
+    // Known commands are still treated by the server, unknown ones fail
+    LE_ASSERT_OK(SendCommandsAndTest(socketFd, epollFd, "AT+ABCD?",
+                                     "\r\n+ABCD TYPE: READ\r\n"
+                                     "\r\nOK\r\n"));
+
+    LE_ASSERT_OK(SendCommandsAndTest(socketFd, epollFd, "AT+CSQ",
+                                     "\r\nERROR\r\n"));
+
+    le_event_QueueFunctionToThread( sharedDataPtr->atServerThread,
+                                    StopPassthroughBridge,
+                                    (void*) bridgeRef,
+                                    (void*) sharedDataPtr->devRef);
+
+    le_sem_Wait(BridgeSemaphore);
+
+    LE_INFO("======== AT server passthrough bridge API test success ========");
+
+    return LE_OK;
+}
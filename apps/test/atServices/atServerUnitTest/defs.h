@@ -76,4 +76,17 @@ le_result_t Testle_atServer_Bridge
     SharedData_t* sharedDataPtr
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to test the AT server passthrough bridge feature.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t Testle_atServer_PassthroughBridge
+(
+    int socketFd,
+    int epollFd,
+    SharedData_t* sharedDataPtr
+);
+
 #endif /* defs.h */
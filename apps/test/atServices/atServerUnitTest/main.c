@@ -214,6 +214,25 @@ static void* AtHost
                 "+ABCD PARAM 0: 5\r\n"
                 "\r\nOK\r\n"));
 
+    LE_ASSERT_OK(SendCommandsAndTest(socketFd, epollFd, "AT+LIST;+LIST=?;+ABCD",
+                "\r\n+LIST: 1,\"first\"\r\n"
+                "+LIST: 2,\"second\"\r\n"
+                "+LIST: 3,\"third\"\r\n"
+                "\r\n+ABCD TYPE: ACT\r\n"
+                "\r\nOK\r\n"));
+
+    LE_ASSERT_OK(SendCommandsAndTest(socketFd, epollFd, "AT+LIST?",
+                "\r\n+LIST: unsupported\r\n"
+                "\r\nERROR\r\n"));
+
+    LE_ASSERT_OK(SendCommandsAndTest(socketFd, epollFd, "AT+PARAMS=1,\"abc\",,5",
+                "\r\n+PARAMS TYPE: PARA\r\n"
+                "+PARAMS PARAM 0: 1\r\n"
+                "+PARAMS PARAM 1: abc\r\n"
+                "+PARAMS PARAM 2: \r\n"
+                "+PARAMS PARAM 3: 5\r\n"
+                "\r\nOK\r\n"));
+
     LE_ASSERT_OK(SendCommandsAndTest(socketFd, epollFd,"AT&FE0V1&C1&D2S95=47S0=0",
                 "\r\n&F TYPE: ACT\r\n"
                 "\r\nE TYPE: PARA\r\n"
@@ -296,6 +315,7 @@ static void* AtHost
 
     // Test bridge feature
     LE_ASSERT_OK(Testle_atServer_Bridge(socketFd, epollFd, sharedDataPtr));
+    LE_ASSERT_OK(Testle_atServer_PassthroughBridge(socketFd, epollFd, sharedDataPtr));
 
     LE_ASSERT_OK(SendCommandsAndTest(socketFd, epollFd, "AT+DEL="
                 "\"AT\",\"ATI\",\"AT+CBC\",\"AT+ABCD\",\"ATA\",\"AT&F\","
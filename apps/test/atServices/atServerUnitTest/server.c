@@ -965,6 +965,102 @@ static void CleanUp
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * List command handler
+ *
+ * sends a list-style response with its final result code at once
+ *
+ * tested APIs:
+ *      le_atServer_SendResponses
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ListCmdHandler
+(
+    le_atServer_CmdRef_t commandRef,
+    le_atServer_Type_t type,
+    uint32_t parametersNumber,
+    void* contextPtr
+)
+{
+    switch (type)
+    {
+        case LE_ATSERVER_TYPE_ACT:
+            LE_ASSERT_OK(le_atServer_SendResponses(commandRef,
+                                                   "+LIST: 1,\"first\"\n"
+                                                   "+LIST: 2,\"second\"\n"
+                                                   "+LIST: 3,\"third\"",
+                                                   LE_ATSERVER_OK, "", 0));
+            break;
+
+        case LE_ATSERVER_TYPE_TEST:
+            // no intermediate response
+            LE_ASSERT_OK(le_atServer_SendResponses(commandRef, "", LE_ATSERVER_OK, "", 0));
+            break;
+
+        default:
+            LE_ASSERT_OK(le_atServer_SendResponses(commandRef, "+LIST: unsupported",
+                                                   LE_ATSERVER_ERROR, LE_ATDEFS_CME_ERROR, 3));
+            break;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * AT command handler receiving the parameters
+ *
+ * checks the packed parameters against the ones retrieved one by one, and sends them in
+ * intermediate responses
+ *
+ * tested APIs:
+ *      le_atServer_AddCommandWithParamsHandler
+ *      le_atServer_GetParameter
+ *      le_atServer_SendIntermediateResponse
+ *      le_atServer_SendFinalResultCode
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ParamsCmdHandler
+(
+    le_atServer_CmdRef_t commandRef,
+    le_atServer_Type_t type,
+    uint32_t parametersNumber,
+    const uint8_t* parametersPtr,
+    size_t parametersSize,
+    void* contextPtr
+)
+{
+    char rsp[LE_ATDEFS_RESPONSE_MAX_BYTES];
+    char param[LE_ATDEFS_PARAMETER_MAX_BYTES];
+    const char* paramPtr = (const char*)parametersPtr;
+    size_t offset = 0;
+    uint32_t i;
+
+    LE_ASSERT(type == LE_ATSERVER_TYPE_PARA);
+    LE_ASSERT(le_atServer_SendIntermediateResponse(commandRef, "+PARAMS TYPE: PARA") == LE_OK);
+
+    for (i = 0; i < parametersNumber; i++)
+    {
+        LE_ASSERT(offset < parametersSize);
+        LE_ASSERT_OK(le_atServer_GetParameter(commandRef,
+                                              i,
+                                              param,
+                                              LE_ATDEFS_PARAMETER_MAX_BYTES));
+        LE_ASSERT(strcmp(paramPtr + offset, param) == 0);
+
+        snprintf(rsp, LE_ATDEFS_RESPONSE_MAX_BYTES, "+PARAMS PARAM %d: %s", i, paramPtr + offset);
+        LE_ASSERT(le_atServer_SendIntermediateResponse(commandRef, rsp) == LE_OK);
+
+        offset += strlen(paramPtr + offset) + 1;
+    }
+
+    // all the parameters are packed
+    LE_ASSERT(offset == parametersSize);
+
+    LE_ASSERT_OK(le_atServer_SendFinalResultCode(commandRef, LE_ATSERVER_OK, "", 0));
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * server function
@@ -976,6 +1072,7 @@ static void CleanUp
  *      le_atServer_Open
  *      le_atServer_Create
  *      le_atServer_AddCommandHandler
+ *      le_atServer_AddCommandWithParamsHandler
  *
  */
 //--------------------------------------------------------------------------------------------------
@@ -1084,6 +1181,11 @@ void AtServer
             .cmdRef = NULL,
             .handlerPtr = ErrorCodeCmdHandler,
         },
+        {
+            .atCmdPtr = "AT+LIST",
+            .cmdRef = NULL,
+            .handlerPtr = ListCmdHandler,
+        },
     };
 
     LE_INFO("Server Started");
@@ -1137,5 +1239,16 @@ void AtServer
         i++;
     }
 
+    // AT command subscription with the parameters in the handler
+    le_atServer_CmdRef_t paramsCmdRef = le_atServer_Create("AT+PARAMS");
+    LE_ASSERT(paramsCmdRef != NULL);
+
+    LE_ASSERT(le_atServer_AddCommandWithParamsHandler(paramsCmdRef,
+                                                      ParamsCmdHandler,
+                                                      (void *)&AtSession) != NULL);
+
+    // only one handler per command
+    LE_ASSERT(le_atServer_AddCommandHandler(paramsCmdRef, AtCmdHandler, NULL) == NULL);
+
     le_sem_Post(sharedDataPtr->semRef);
 }
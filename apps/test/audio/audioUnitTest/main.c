@@ -751,6 +751,104 @@ void Testle_audio_PlayFile
     LE_ASSERT(le_sem_GetValue(ThreadSemaphore) == 0);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test the play WAV file functionality.
+ * A WAV file is built with a chunk following its data chunk, and played. Its PCM samples are read
+ * directly from the file and captured into the pa_pcm_simu. The event "LE_AUDIO_MEDIA_ENDED" must
+ * be received at the end of the data chunk, then the test checks the received data.
+ *
+ * API tested:
+ * - le_audio_PlayFile
+ * - le_audio_AddMediaHandler
+ *
+ * Exit if failed
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+void Testle_audio_PlayWavFile
+(
+    void
+)
+{
+    unlink("test.wav");
+
+    le_audio_StreamRef_t playbackStreamRef = NULL;
+    WavHeader_t hdr;
+    const uint8_t trailer[] = { 'L', 'I', 'S', 'T', 4, 0, 0, 0, 'I', 'N', 'F', 'O' };
+
+    memcpy(&hdr.riffId, "RIFF", sizeof(hdr.riffId));
+    hdr.riffSize = sizeof(hdr) - sizeof(hdr.riffId) - sizeof(hdr.riffSize) + BUFFER_LEN +
+                   sizeof(trailer);
+    memcpy(&hdr.riffFmt, "WAVE", sizeof(hdr.riffFmt));
+    memcpy(&hdr.fmtId, "fmt ", sizeof(hdr.fmtId));
+    hdr.fmtSize = 16;
+    hdr.audioFormat = 1;
+    hdr.channelsCount = 1;
+    hdr.sampleRate = 16000;
+    hdr.bitsPerSample = 16;
+    hdr.byteRate = (hdr.sampleRate * hdr.channelsCount * hdr.bitsPerSample) / 8;
+    hdr.blockAlign = hdr.channelsCount * hdr.bitsPerSample / 8;
+    memcpy(&hdr.dataId, "data", sizeof(hdr.dataId));
+    hdr.dataSize = BUFFER_LEN;
+
+    // Create a WAV file, with a chunk after the data chunk which must not be played
+    int fd = open("./test.wav", O_CREAT | O_WRONLY, S_IRUSR | S_IWUSR );
+    LE_ASSERT(fd != -1);
+
+    LE_ASSERT(write(fd, &hdr, sizeof(hdr)) == sizeof(hdr));
+    LE_ASSERT(write(fd, Buffer, BUFFER_LEN) == BUFFER_LEN);
+    LE_ASSERT(write(fd, trailer, sizeof(trailer)) == sizeof(trailer));
+
+    close(fd);
+
+    // Try to play the file
+    FileFd = open("./test.wav", O_RDONLY);
+    LE_ASSERT(FileFd != -1);
+
+    // Init the pcm buffer in pa_pcm_simu side.
+    pa_pcmSimu_InitData(BUFFER_LEN);
+
+    // Open the player stream
+    playbackStreamRef = le_audio_OpenPlayer();
+    LE_ASSERT(playbackStreamRef != NULL);
+
+    // Set the test case
+    TestCase = TEST_PLAY_FILES;
+
+    // Create the test thread which will execute le_audio_PlayFile and le_audio_AddMediaHandler
+    CreateTestThread(playbackStreamRef);
+
+    // Wait the event LE_AUDIO_MEDIA_ENDED
+    le_sem_Wait(ThreadSemaphore);
+    LE_ASSERT(TestCase == TEST_LAST);
+
+    // Closing the fd is unncessary since the messaging infrastructure underneath
+    // le_audio_PlayFile would close it.
+
+    // Get the buffer address of the received data in the pa_pcm_simu
+    uint8_t* sentPcmPtr = pa_pcmSimu_GetDataPtr();
+
+    // Check data
+    LE_ASSERT(memcmp(Buffer, sentPcmPtr, BUFFER_LEN) == 0);
+
+    // Release buffer in pa_pcm_simu
+    pa_pcmSimu_ReleaseData();
+
+    // Stop the test thread
+    le_thread_Cancel(TestThreadRef);
+    le_thread_Join(TestThreadRef,NULL);
+
+    // Close the player stream
+    le_audio_Close(playbackStreamRef);
+
+    // Delete the created file
+    unlink("test.wav");
+
+    // Check that no more call of the semaphore
+    LE_ASSERT(le_sem_GetValue(ThreadSemaphore) == 0);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Test the capture samples functionality.
@@ -1248,6 +1346,9 @@ COMPONENT_INIT
     LE_INFO("======== Test play file ========");
     Testle_audio_PlayFile();
 
+    LE_INFO("======== Test play WAV file ========");
+    Testle_audio_PlayWavFile();
+
     LE_INFO("======== Test play to invalid destination ========");
     Testle_audio_PlayInvalid();
 
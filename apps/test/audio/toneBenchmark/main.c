@@ -0,0 +1,201 @@
+/**
+ * Benchmark of the DTMF synthesis of the media service.
+ *
+ * It compares the CPU time taken to generate one second of each DTMF:
+ *  - with two calls to sin() per sample, as the tones were generated before,
+ *  - with the tone generator, which computes the sine waves by recurrence.
+ *
+ * It also checks that both give the same samples, within a few units of rounding errors.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "toneGenerator.h"
+#include <math.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sample rate of the DTMFs, and number of seconds generated for each of them.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SAMPLE_RATE         16000
+#define ITERATION_COUNT     50
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Amplitude of each frequency of the DTMFs, in percent.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DTMF_AMPLITUDE      40
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum difference allowed between the samples of both methods.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_SAMPLE_ERROR    2
+
+#if !defined (PI)
+#define PI 3.14159265358979323846264338327
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Frequencies of the DTMFs.
+ */
+//--------------------------------------------------------------------------------------------------
+static const uint32_t LowFreqs[] = { 697, 770, 852, 941 };
+static const uint32_t HighFreqs[] = { 1209, 1336, 1477, 1633 };
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Samples of one second of tone, for each method.
+ */
+//--------------------------------------------------------------------------------------------------
+static int16_t SinSamples[SAMPLE_RATE];
+static int16_t ToneSamples[SAMPLE_RATE];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate a tone with two calls to sin() per sample.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SinDual
+(
+    int16_t*  bufferPtr,
+    uint32_t  samplesCount,
+    uint32_t  firstSample,
+    uint32_t  freq1,
+    uint32_t  freq2
+)
+{
+    double d1 = 1.0 * freq1 / SAMPLE_RATE;
+    double d2 = 1.0 * freq2 / SAMPLE_RATE;
+    uint32_t i;
+
+    for (i = firstSample; i < firstSample + samplesCount; i++)
+    {
+        int16_t s1 = (int16_t)(32767 * DTMF_AMPLITUDE / 100.0f * sin(2 * PI * d1 * i));
+        int16_t s2 = (int16_t)(32767 * DTMF_AMPLITUDE / 100.0f * sin(2 * PI * d2 * i));
+
+        *(bufferPtr++) = s1 + s2;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the CPU time used by the calling thread, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetCpuTimeUs
+(
+    void
+)
+{
+    struct timespec ts;
+
+    LE_ASSERT(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate one second of each DTMF with a method, and return the CPU time taken per second of
+ * audio, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t Run
+(
+    bool useToneGenerator
+)
+{
+    uint64_t start = GetCpuTimeUs();
+    int n;
+    int low;
+    int high;
+
+    for (n = 0; n < ITERATION_COUNT; n++)
+    {
+        for (low = 0; low < NUM_ARRAY_MEMBERS(LowFreqs); low++)
+        {
+            for (high = 0; high < NUM_ARRAY_MEMBERS(HighFreqs); high++)
+            {
+                if (useToneGenerator)
+                {
+                    toneGenerator_Dual(ToneSamples, SAMPLE_RATE, n * SAMPLE_RATE, SAMPLE_RATE,
+                                       LowFreqs[low], DTMF_AMPLITUDE,
+                                       HighFreqs[high], DTMF_AMPLITUDE);
+                }
+                else
+                {
+                    SinDual(SinSamples, SAMPLE_RATE, n * SAMPLE_RATE,
+                            LowFreqs[low], HighFreqs[high]);
+                }
+            }
+        }
+    }
+
+    return (GetCpuTimeUs() - start) /
+           (ITERATION_COUNT * NUM_ARRAY_MEMBERS(LowFreqs) * NUM_ARRAY_MEMBERS(HighFreqs));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that both methods give the same samples, including when a tone is generated by several
+ * calls of odd lengths.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckSamples
+(
+    void
+)
+{
+    static const uint32_t lengths[] = { 1, 3, 4, 5, 1021, SAMPLE_RATE };
+    int low;
+    int high;
+    int i;
+
+    for (low = 0; low < NUM_ARRAY_MEMBERS(LowFreqs); low++)
+    {
+        for (high = 0; high < NUM_ARRAY_MEMBERS(HighFreqs); high++)
+        {
+            uint32_t first = 0;
+
+            for (i = 0; i < NUM_ARRAY_MEMBERS(lengths); i++)
+            {
+                uint32_t j;
+
+                SinDual(SinSamples, lengths[i], first, LowFreqs[low], HighFreqs[high]);
+                toneGenerator_Dual(ToneSamples, lengths[i], first, SAMPLE_RATE,
+                                   LowFreqs[low], DTMF_AMPLITUDE,
+                                   HighFreqs[high], DTMF_AMPLITUDE);
+
+                for (j = 0; j < lengths[i]; j++)
+                {
+                    LE_ASSERT(abs(SinSamples[j] - ToneSamples[j]) <= MAX_SAMPLE_ERROR);
+                }
+
+                first += lengths[i];
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * main of the benchmark
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+    LE_INFO("======== Tone benchmark started ========");
+
+    CheckSamples();
+
+    LE_INFO("%-16s %6"PRIu64" us of CPU per second of audio", "sin() per sample:", Run(false));
+    LE_INFO("%-16s %6"PRIu64" us of CPU per second of audio", "Tone generator:", Run(true));
+
+    LE_INFO("======== Tone benchmark finished ========");
+    exit(EXIT_SUCCESS);
+}
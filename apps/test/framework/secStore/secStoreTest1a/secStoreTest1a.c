@@ -9,8 +9,162 @@
 #define SECRET_ITEM             "secret"
 #define SECRET_STRING           "My secret data"
 
+#define PROBE_ITEM              "adminProbe"
+#define ADMIN_ITEM              "adminItem"
+
 static char loopString[900] = "1234567890";
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Searches the secure storage tree, through the admin interface, for the directory containing the
+ * item PROBE_ITEM with the given content.  This is this app's area.
+ *
+ * @return
+ *      true if the area was found, false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool FindArea
+(
+    const char* dirPath,        ///< [IN] Directory to search.
+    const char* probePtr,       ///< [IN] Content of the probe item.
+    int depth,                  ///< [IN] Maximum number of directory levels to descend.
+    char* areaPath,             ///< [OUT] Path of the app's area.
+    size_t areaPathSize         ///< [IN] Size of the area path buffer.
+)
+{
+    bool isFound = false;
+    secStoreAdmin_IterRef_t iterRef = secStoreAdmin_CreateIter(dirPath);
+
+    if (iterRef == NULL)
+    {
+        return false;
+    }
+
+    while ((!isFound) && (secStoreAdmin_Next(iterRef) == LE_OK))
+    {
+        bool isDir;
+        char entryName[SECSTOREADMIN_MAX_PATH_BYTES];
+        char entryPath[SECSTOREADMIN_MAX_PATH_BYTES] = "";
+
+        if ( (secStoreAdmin_GetEntry(iterRef, entryName, sizeof(entryName), &isDir) != LE_OK) ||
+             (le_path_Concat("/", entryPath, sizeof(entryPath), dirPath, entryName, NULL)
+                != LE_OK) )
+        {
+            continue;
+        }
+
+        if (isDir)
+        {
+            if (depth > 0)
+            {
+                isFound = FindArea(entryPath, probePtr, depth - 1, areaPath, areaPathSize);
+            }
+        }
+        else if (strcmp(entryName, PROBE_ITEM) == 0)
+        {
+            char buf[100] = "";
+            size_t bufSize = sizeof(buf) - 1;
+
+            if ( (secStoreAdmin_Read(entryPath, (uint8_t*)buf, &bufSize) == LE_OK) &&
+                 (strcmp(buf, probePtr) == 0) )
+            {
+                LE_ASSERT(le_utf8_Copy(areaPath, dirPath, areaPathSize, NULL) == LE_OK);
+                isFound = true;
+            }
+        }
+    }
+
+    secStoreAdmin_DeleteIter(iterRef);
+
+    return isFound;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks that the usage accounted against the limit stays correct when this app's area is
+ * modified behind its back by an admin write, and after the usage is rescanned.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestAdminUsage
+(
+    int limit                   ///< [IN] Secure storage limit of the app.
+)
+{
+    // Locate this app's area from a probe item with a content unique to this run.
+    char probe[100];
+    char areaPath[SECSTOREADMIN_MAX_PATH_BYTES];
+    char adminPath[SECSTOREADMIN_MAX_PATH_BYTES] = "";
+
+    snprintf(probe, sizeof(probe), "secStoreTest1a probe %d", (int)getpid());
+
+    le_result_t result = le_secStore_Write(PROBE_ITEM, (uint8_t*)probe, strlen(probe) + 1);
+    LE_FATAL_IF(result != LE_OK, "Could not write probe item.  %s.", LE_RESULT_TXT(result));
+
+    LE_FATAL_IF(!FindArea("/", probe, 4, areaPath, sizeof(areaPath)),
+                "Could not find the app's area in secure storage.");
+    LE_INFO("App's area is '%s'.", areaPath);
+
+    result = le_secStore_Delete(PROBE_ITEM);
+    LE_FATAL_IF(result != LE_OK, "Could not delete probe item.  %s.", LE_RESULT_TXT(result));
+
+    // Fill the area through the admin interface, leaving room for exactly one loop item.
+    static uint8_t adminBuf[LE_SECSTORE_MAX_ITEM_SIZE];
+    size_t adminSize = limit - sizeof(loopString);
+
+    LE_FATAL_IF((size_t)limit > sizeof(adminBuf), "Limit %d too large for this test.", limit);
+    memset(adminBuf, 'a', adminSize);
+
+    LE_ASSERT(le_path_Concat("/", adminPath, sizeof(adminPath), areaPath, ADMIN_ITEM, NULL)
+              == LE_OK);
+    result = secStoreAdmin_Write(adminPath, adminBuf, adminSize);
+    LE_FATAL_IF(result != LE_OK, "Could not write '%s'.  %s.", adminPath, LE_RESULT_TXT(result));
+
+    // The admin write must be accounted for.
+    result = le_secStore_Write("lastLoopItem", (uint8_t*)loopString, sizeof(loopString));
+    LE_FATAL_IF(result != LE_OK,
+                "Could not write up to the limit after admin write.  %s.", LE_RESULT_TXT(result));
+
+    result = le_secStore_Write("oneMore", (uint8_t*)loopString, 1);
+    LE_FATAL_IF(result != LE_NO_MEMORY,
+                "Should have failed due to a memory limit after admin write.  %s.",
+                LE_RESULT_TXT(result));
+
+    // Same accounting after a rescan, as done by 'secstore rescan'.
+    result = secStoreAdmin_RescanUsage();
+    LE_FATAL_IF(result != LE_OK, "Could not rescan usage.  %s.", LE_RESULT_TXT(result));
+
+    result = le_secStore_Write("oneMore", (uint8_t*)loopString, 1);
+    LE_FATAL_IF(result != LE_NO_MEMORY,
+                "Should have failed due to a memory limit after rescan.  %s.",
+                LE_RESULT_TXT(result));
+
+    result = le_secStore_Delete("lastLoopItem");
+    LE_FATAL_IF(result != LE_OK,
+                "Failed to delete item 'lastLoopItem'.  %s.", LE_RESULT_TXT(result));
+
+    result = le_secStore_Write("lastLoopItem", (uint8_t*)loopString, sizeof(loopString));
+    LE_FATAL_IF(result != LE_OK,
+                "Could not write up to the limit after rescan.  %s.", LE_RESULT_TXT(result));
+
+    // Clean up, the whole limit should be available again.
+    result = le_secStore_Delete("lastLoopItem");
+    LE_FATAL_IF(result != LE_OK,
+                "Failed to delete item 'lastLoopItem'.  %s.", LE_RESULT_TXT(result));
+
+    result = secStoreAdmin_Delete(adminPath);
+    LE_FATAL_IF(result != LE_OK, "Failed to delete '%s'.  %s.", adminPath, LE_RESULT_TXT(result));
+
+    result = le_secStore_Write("lastLoopItem", adminBuf, adminSize + sizeof(loopString));
+    LE_FATAL_IF(result != LE_OK,
+                "Could not write up to the limit after admin delete.  %s.", LE_RESULT_TXT(result));
+
+    result = le_secStore_Delete("lastLoopItem");
+    LE_FATAL_IF(result != LE_OK,
+                "Failed to delete item 'lastLoopItem'.  %s.", LE_RESULT_TXT(result));
+}
+
 COMPONENT_INIT
 {
     LE_INFO("=====================================================================");
@@ -76,6 +230,14 @@ COMPONENT_INIT
     LE_FATAL_IF(result != LE_NO_MEMORY,
                     "Should have failed due to a memory limit.  %s.", LE_RESULT_TXT(result));
 
+    // Overwriting an item with the same size should still fit within the limit.
+    if (numLoopItems > 0)
+    {
+        result = le_secStore_Write("loop0", (uint8_t*)loopString, sizeof(loopString));
+        LE_FATAL_IF(result != LE_OK,
+                    "Could not overwrite item at the limit.  %s.", LE_RESULT_TXT(result));
+    }
+
     // Delete item that does not exist.
     result = le_secStore_Delete("NonExistence");
     LE_FATAL_IF(result != LE_NOT_FOUND,
@@ -100,6 +262,17 @@ COMPONENT_INIT
         LE_INFO("Deleted %s", loopItemName);
     }
 
+    // The space of the deleted items should be available again.
+    result = le_secStore_Write("lastLoopItem", (uint8_t*)loopString, sizeof(loopString));
+    LE_FATAL_IF(result != LE_OK,
+                "Could not write to sec store after clean up.  %s.", LE_RESULT_TXT(result));
+
+    result = le_secStore_Delete("lastLoopItem");
+    LE_FATAL_IF(result != LE_OK,
+                "Failed to delete item 'lastLoopItem'.  %s.", LE_RESULT_TXT(result));
+
+    TestAdminUsage(limit);
+
     LE_INFO("============ SecStoreTest1a PASSED =============");
 
     exit(EXIT_SUCCESS);
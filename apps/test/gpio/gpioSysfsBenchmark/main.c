@@ -0,0 +1,261 @@
+/**
+ * Benchmark of the value accesses of the sysfs GPIO service, run against a fake sysfs tree so
+ * that no GPIO hardware is needed.
+ *
+ * For a set of pins, it compares the time taken to read and write them:
+ *  - one by one, through their sysfs paths (as done when the value file can't be kept open),
+ *  - one by one, through the value files kept open while the pins are in use,
+ *  - all at once, using the group functions.
+ *
+ * The fake tree is made of regular files, so the timings only show the cost of the accesses in
+ * the service, not the one of the GPIO driver.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "gpioSysfs.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of pins used, and number of times each of them is read and written.
+ */
+//--------------------------------------------------------------------------------------------------
+#define PIN_COUNT           8
+#define ITERATION_COUNT     2000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sessions of the fake clients.  The pins are in use by the first one.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CLIENT_SESSION_REF  ((le_msg_SessionRef_t)0x1001)
+#define OTHER_SESSION_REF   ((le_msg_SessionRef_t)0x1002)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * GPIO objects, indexed by pin number - 1.
+ */
+//--------------------------------------------------------------------------------------------------
+static struct gpioSysfs_Gpio Gpios[PIN_COUNT];
+static gpioSysfs_GpioRef_t GpioRefs[64];
+static char GpioNames[PIN_COUNT][8];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fetches the user credentials of the client at the far end of a given IPC session.
+ * (STUBBED FUNCTION)
+ *
+ * The client of the other session is in another process.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t MyGetClientUserCreds
+(
+    le_msg_SessionRef_t sessionRef,   ///< [in] Reference to the session.
+    uid_t*              userIdPtr,    ///< [out] Ptr to where the uid is to be stored on success.
+    pid_t*              processIdPtr  ///< [out] Ptr to where the pid is to be stored on success.
+)
+{
+    if (userIdPtr)
+    {
+        *userIdPtr = geteuid();
+    }
+
+    if (processIdPtr)
+    {
+        *processIdPtr = (sessionRef == OTHER_SESSION_REF) ? getpid() + 1 : getpid();
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a file of the fake sysfs tree.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WriteFakeFile
+(
+    const char* dirPath,
+    const char* name,
+    const char* contentPtr
+)
+{
+    char path[PATH_MAX];
+    FILE* fp;
+
+    snprintf(path, sizeof(path), "%s/%s", dirPath, name);
+    fp = fopen(path, "w");
+    LE_ASSERT(fp != NULL);
+    fputs(contentPtr, fp);
+    fclose(fp);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create the fake sysfs tree, with the attributes of each pin set for an active-high output.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CreateFakeSysfs
+(
+    void
+)
+{
+    char path[PATH_MAX];
+    int i;
+
+    LE_ASSERT(le_dir_MakePath(SYSFS_GPIO_PATH, S_IRWXU) == LE_OK);
+
+    for (i = 0; i < PIN_COUNT; i++)
+    {
+        snprintf(path, sizeof(path), "%s/gpio%d", SYSFS_GPIO_PATH, i + 1);
+        LE_ASSERT(le_dir_MakePath(path, S_IRWXU) == LE_OK);
+
+        WriteFakeFile(path, "value", "0\n");
+        WriteFakeFile(path, "direction", "out\n");
+        WriteFakeFile(path, "active_low", "0\n");
+        WriteFakeFile(path, "edge", "none\n");
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read and write each pin one by one, and return the time taken, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t RunPinByPin
+(
+    void
+)
+{
+    le_clk_Time_t start = le_clk_GetRelativeTime();
+    int n;
+    int i;
+
+    for (n = 0; n < ITERATION_COUNT; n++)
+    {
+        for (i = 0; i < PIN_COUNT; i++)
+        {
+            if ((n + i) % 2)
+            {
+                LE_ASSERT(gpioSysfs_Activate(GpioRefs[i]) == LE_OK);
+            }
+            else
+            {
+                LE_ASSERT(gpioSysfs_Deactivate(GpioRefs[i]) == LE_OK);
+            }
+        }
+
+        for (i = 0; i < PIN_COUNT; i++)
+        {
+            LE_ASSERT(gpioSysfs_ReadValue(GpioRefs[i]) == (gpioSysfs_Value_t)((n + i) % 2));
+        }
+    }
+
+    le_clk_Time_t duration = le_clk_Sub(le_clk_GetRelativeTime(), start);
+    return (uint64_t)duration.sec * 1000000 + duration.usec;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read and write all the pins at once, and return the time taken, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t RunGroup
+(
+    void
+)
+{
+    const uint64_t pinMask = (1ULL << PIN_COUNT) - 1;
+    le_clk_Time_t start = le_clk_GetRelativeTime();
+    uint64_t values;
+    int n;
+
+    for (n = 0; n < ITERATION_COUNT; n++)
+    {
+        uint64_t written = (n % 2) ? 0x55 : 0xAA;
+
+        LE_ASSERT(gpioSysfs_WriteGroup(GpioRefs, pinMask, written, CLIENT_SESSION_REF) == LE_OK);
+        LE_ASSERT(gpioSysfs_ReadGroup(GpioRefs, pinMask, CLIENT_SESSION_REF, &values) == LE_OK);
+        LE_ASSERT(values == (written & pinMask));
+    }
+
+    le_clk_Time_t duration = le_clk_Sub(le_clk_GetRelativeTime(), start);
+    return (uint64_t)duration.sec * 1000000 + duration.usec;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Log the time taken by a run.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogRun
+(
+    const char* name,
+    uint64_t durationUs
+)
+{
+    uint64_t accessCount = (uint64_t)ITERATION_COUNT * PIN_COUNT * 2;
+
+    LE_INFO("%-28s %8"PRIu64" us, %6"PRIu64" ns per pin access", name, durationUs,
+            durationUs * 1000 / accessCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * main of the benchmark
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+    gpioSysfs_Design_t gpioDesign;
+    uint64_t values;
+    int i;
+
+    LE_INFO("======== GPIO sysfs benchmark started ========");
+
+    CreateFakeSysfs();
+    gpioSysfs_Initialize(&gpioDesign);
+    LE_ASSERT(gpioDesign == SYSFS_GPIO_DESIGN_V1);
+
+    for (i = 0; i < PIN_COUNT; i++)
+    {
+        snprintf(GpioNames[i], sizeof(GpioNames[i]), "gpio%d", i + 1);
+        Gpios[i].pinNum = i + 1;
+        Gpios[i].gpioName = GpioNames[i];
+        Gpios[i].valueFd = -1;
+        GpioRefs[i] = &Gpios[i];
+    }
+
+    // Pins not in use can't be accessed as a group.
+    LE_ASSERT(gpioSysfs_ReadGroup(GpioRefs, 1, CLIENT_SESSION_REF, &values) == LE_NOT_PERMITTED);
+
+    LogRun("Pin by pin, through paths:", RunPinByPin());
+
+    for (i = 0; i < PIN_COUNT; i++)
+    {
+        gpioSysfs_SessionOpenHandlerFunc(CLIENT_SESSION_REF, GpioRefs[i]);
+        LE_ASSERT(Gpios[i].inUse);
+        LE_ASSERT(Gpios[i].valueFd >= 0);
+    }
+
+    LogRun("Pin by pin, through fds:", RunPinByPin());
+    LogRun("Group:", RunGroup());
+
+    // Pins must be in use by the calling process, and within the pins available.
+    LE_ASSERT(gpioSysfs_ReadGroup(GpioRefs, 1, OTHER_SESSION_REF, &values) == LE_NOT_PERMITTED);
+    LE_ASSERT(gpioSysfs_WriteGroup(GpioRefs, 1ULL << PIN_COUNT, 0, CLIENT_SESSION_REF)
+              == LE_NOT_PERMITTED);
+
+    for (i = 0; i < PIN_COUNT; i++)
+    {
+        gpioSysfs_SessionCloseHandlerFunc(CLIENT_SESSION_REF, GpioRefs[i]);
+        LE_ASSERT(Gpios[i].valueFd == -1);
+    }
+
+    le_dir_RemoveRecursive(SYSFS_GPIO_PATH);
+
+    LE_INFO("======== GPIO sysfs benchmark finished ========");
+    exit(EXIT_SUCCESS);
+}
@@ -15,6 +15,12 @@
  *   - HTTP:    app runProc httpTest httpTest -- 0 www.google.fr 80 /
  *   - HTTPS:   app runProc httpTest httpTest -- 1 m2mop.net 443 /s
  *
+ * The connection reuse and TLS session resumption checks expect a server keeping connections
+ * alive, e.g. the lighttpd server of the httpServer sample app:
+ *   - app runProc httpTest httpTest -- 0 <device address> 8080 /index.html
+ *   - app runProc httpTest httpTest -- 1 <device address> 8443 /index.html (its certificate has
+ *     to be signed by the one of defaultDerKey.c)
+ *
  * <hr>
  *
  * Copyright (C) Sierra Wireless Inc.
@@ -294,6 +300,77 @@ static void SendRequestRspCb
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that the requests of a session share one connection, and that a secure session resumes
+ * its TLS session once connected again.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_FAULT         Check failed
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t TestKeepAlive
+(
+    le_httpClient_Ref_t sessionRef,     ///< [IN] HTTP session context reference
+    char*               uriPtr,         ///< [IN] URI to request
+    bool                securityFlag    ///< [IN] True if the session is secure
+)
+{
+    uint32_t count = 0;
+    int i;
+
+    LE_INFO("Sending two HTTP GET commands on one connection...");
+    for (i = 0; i < 2; i++)
+    {
+        if (LE_OK != le_httpClient_SendRequest(sessionRef, HTTP_GET, uriPtr))
+        {
+            LE_ERROR("Unable to send request");
+            return LE_FAULT;
+        }
+    }
+
+    if ((LE_OK != le_httpClient_GetConnectionCount(sessionRef, &count)) || (count != 1))
+    {
+        LE_ERROR("%"PRIu32" connections opened, expected 1", count);
+        return LE_FAULT;
+    }
+
+    if (!securityFlag)
+    {
+        return LE_OK;
+    }
+
+    LE_INFO("Connecting again to resume the TLS session...");
+    if ((LE_OK != le_httpClient_Stop(sessionRef)) || (LE_OK != le_httpClient_Start(sessionRef)))
+    {
+        LE_ERROR("Unable to connect again");
+        return LE_FAULT;
+    }
+
+    if (LE_OK != le_httpClient_SendRequest(sessionRef, HTTP_GET, uriPtr))
+    {
+        LE_ERROR("Unable to send request");
+        return LE_FAULT;
+    }
+
+#if LE_CONFIG_SOCKET_LIB_TLS_SESSION_CACHE_MAX > 0
+    if (!le_httpClient_IsSessionResumed(sessionRef))
+    {
+        LE_ERROR("TLS session not resumed");
+        return LE_FAULT;
+    }
+#endif
+
+    if ((LE_OK != le_httpClient_GetConnectionCount(sessionRef, &count)) || (count != 1))
+    {
+        LE_ERROR("%"PRIu32" connections opened, expected 1", count);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Timer handler: On expiry, this function attempts to resume the suspended HTTP requests
@@ -456,6 +533,14 @@ COMPONENT_INIT
         goto end;
     }
 
+    LE_INFO("Keeping the connection alive between requests...");
+    status = le_httpClient_SetKeepAlive(sessionRef, true);
+    if (LE_OK != status)
+    {
+        LE_ERROR("Unable to keep the connection alive");
+        goto end;
+    }
+
     LE_INFO("Starting the HTTP session...");
     status = le_httpClient_Start(sessionRef);
     if (LE_OK != status)
@@ -464,6 +549,13 @@ COMPONENT_INIT
         goto end;
     }
 
+    status = TestKeepAlive(sessionRef, uriPtr, securityFlag);
+    if (LE_OK != status)
+    {
+        LE_ERROR("Keep-alive test failed");
+        goto end;
+    }
+
     LE_INFO("Sending synchronous HTTP requests %d times...", REQUESTS_LOOP);
     int i;
 
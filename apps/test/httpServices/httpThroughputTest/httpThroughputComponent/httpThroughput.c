@@ -0,0 +1,150 @@
+/**
+ * @file httpThroughput.c
+ *
+ * This module measures the throughput of the HTTP client component when the bodies are streamed
+ * through file descriptors, against a local HTTP server (e.g. lighttpd with mod_webdav enabled so
+ * that PUT requests are accepted).
+ *
+ * The resource is first downloaded into the file with a GET request, then uploaded back from it
+ * with a PUT request. Both requests use the same connection.
+ *
+ * Build:
+ * Use the following command to compile this test for Linux targets when using mkapp:
+ *   - CONFIG_SOCKET_LIB_USE_OPENSSL=y CONFIG_LINUX=y mkapp -t <target> httpThroughput.adef
+ *
+ * Usage:
+ *   - app runProc httpThroughput httpThroughput -- host port uri file
+ *
+ * <hr>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "le_httpClientLib.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timeout of each request in milliseconds
+ */
+//--------------------------------------------------------------------------------------------------
+#define REQUEST_TIMEOUT_MS    60000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Status code of the last response
+ */
+//--------------------------------------------------------------------------------------------------
+static int StatusCode;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Callback to retrieve the status code of the responses
+ */
+//--------------------------------------------------------------------------------------------------
+static void StatusCodeCb
+(
+    le_httpClient_Ref_t ref,        ///< [IN] HTTP session context reference
+    int                 code        ///< [IN] HTTP status code
+)
+{
+    StatusCode = code;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a request and log its throughput.
+ *
+ * @return
+ *  - LE_OK on success, with a 2xx status code
+ *  - LE_FAULT otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t RunRequest
+(
+    le_httpClient_Ref_t sessionRef, ///< [IN] HTTP session context reference
+    le_httpCommand_t    command,    ///< [IN] HTTP command
+    const char*         name,       ///< [IN] Name of the request in logs
+    char*               uriPtr,     ///< [IN] Resource URI
+    int                 fd          ///< [IN] File descriptor of the body
+)
+{
+    le_clk_Time_t start = le_clk_GetRelativeTime();
+    le_result_t status;
+    off_t length;
+
+    StatusCode = 0;
+    status = le_httpClient_SendRequest(sessionRef, command, uriPtr);
+
+    le_clk_Time_t duration = le_clk_Sub(le_clk_GetRelativeTime(), start);
+    uint64_t durationUs = (uint64_t)duration.sec * 1000000 + duration.usec;
+
+    if ((LE_OK != status) || (StatusCode < 200) || (StatusCode > 299))
+    {
+        LE_ERROR("%s failed: %s, status code %d", name, LE_RESULT_TXT(status), StatusCode);
+        return LE_FAULT;
+    }
+
+    length = lseek(fd, 0, SEEK_END);
+    LE_INFO("%-4s %10"PRIu64" bytes in %8"PRIu64" us, %6"PRIu64" kB/s", name, (uint64_t)length,
+            durationUs, (uint64_t)length * 1000 / (durationUs ? durationUs : 1));
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * main of the test
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+    le_httpClient_Ref_t sessionRef;
+    int fd;
+
+    if (le_arg_NumArgs() < 4)
+    {
+        LE_INFO("Usage: app runProc httpThroughput httpThroughput -- host port uri file");
+        exit(EXIT_FAILURE);
+    }
+
+    char* hostPtr       = (char*)le_arg_GetArg(0);
+    long portNumber     = strtol(le_arg_GetArg(1), NULL, 10);
+    char* uriPtr        = (char*)le_arg_GetArg(2);
+    const char* pathPtr = le_arg_GetArg(3);
+
+    if ((portNumber < 1) || (portNumber > USHRT_MAX))
+    {
+        LE_ERROR("Invalid port number. Accepted range: [1 .. %d]", USHRT_MAX);
+        exit(EXIT_FAILURE);
+    }
+
+    fd = open(pathPtr, O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+    LE_ASSERT(fd >= 0);
+
+    sessionRef = le_httpClient_Create(hostPtr, (uint16_t)portNumber);
+    LE_ASSERT(sessionRef != NULL);
+
+    LE_ASSERT_OK(le_httpClient_SetTimeout(sessionRef, REQUEST_TIMEOUT_MS));
+    LE_ASSERT_OK(le_httpClient_SetKeepAlive(sessionRef, true));
+    LE_ASSERT_OK(le_httpClient_SetStatusCodeCallback(sessionRef, StatusCodeCb));
+    LE_ASSERT_OK(le_httpClient_Start(sessionRef));
+
+    // Download the resource into the file
+    LE_ASSERT_OK(le_httpClient_SetBodyResponseFd(sessionRef, fd));
+    LE_ASSERT_OK(RunRequest(sessionRef, HTTP_GET, "GET", uriPtr, fd));
+    LE_ASSERT_OK(le_httpClient_SetBodyResponseFd(sessionRef, -1));
+
+    // Upload it back
+    off_t length = lseek(fd, 0, SEEK_END);
+    LE_ASSERT(lseek(fd, 0, SEEK_SET) == 0);
+    LE_ASSERT_OK(le_httpClient_SetBodyFd(sessionRef, fd, (size_t)length));
+    LE_ASSERT_OK(RunRequest(sessionRef, HTTP_PUT, "PUT", uriPtr, fd));
+
+    le_httpClient_Stop(sessionRef);
+    le_httpClient_Delete(sessionRef);
+    close(fd);
+
+    LE_INFO("======== HTTP throughput test finished ========");
+    exit(EXIT_SUCCESS);
+}
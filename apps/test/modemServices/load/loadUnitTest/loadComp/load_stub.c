@@ -0,0 +1,97 @@
+/**
+ * Stubs of the SMS, MRC and MDC parts of the load platform adaptor: each event is only stamped in
+ * the control block, without being reported.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "pa_load_local.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Init the SMS part of the load platform adaptor (STUBBED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_smsLoad_Init
+(
+    void
+)
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Init the MRC part of the load platform adaptor (STUBBED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mrcLoad_Init
+(
+    void
+)
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Init the MDC part of the load platform adaptor (STUBBED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mdcLoad_Init
+(
+    void
+)
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit an incoming SMS (STUBBED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_smsLoad_EmitNewMsg
+(
+    void
+)
+{
+    pa_load_StampEvent(MODEM_LOAD_SMS);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit a signal strength change (STUBBED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mrcLoad_EmitSignalStrength
+(
+    void
+)
+{
+    pa_load_StampEvent(MODEM_LOAD_SIGNAL);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit a network registration change (STUBBED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mrcLoad_EmitNetworkReg
+(
+    void
+)
+{
+    pa_load_StampEvent(MODEM_LOAD_NET_REG);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit a data session state change (STUBBED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mdcLoad_EmitSessionState
+(
+    void
+)
+{
+    pa_load_StampEvent(MODEM_LOAD_DATA_SESSION);
+}
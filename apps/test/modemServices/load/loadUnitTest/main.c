@@ -0,0 +1,101 @@
+/**
+ * This module implements the unit tests of the event generator of the load platform adaptor.
+ *
+ * The SMS, MRC and MDC parts of the platform adaptor are stubbed: each event is only stamped in
+ * the control block. The test sets the rate and burst size of the streams, lets the generator run,
+ * then checks the number of events emitted.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "pa_load_local.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Duration of a generation, in seconds.
+ */
+//--------------------------------------------------------------------------------------------------
+#define GENERATION_DURATION_SEC     2
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Event rate of the streams, in events per second.
+ */
+//--------------------------------------------------------------------------------------------------
+#define EVENT_RATE                  100
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Control block of the platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+static modemLoad_Block_t* BlockPtr;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate events on all the streams at EVENT_RATE, with a different burst size on each stream,
+ * and check the number of events emitted.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestBursts
+(
+    void
+)
+{
+    static const uint32_t burstSizes[MODEM_LOAD_STREAM_COUNT] = { 1, 2, 5, 7 };
+    uint32_t startCounts[MODEM_LOAD_STREAM_COUNT];
+    int stream;
+
+    for (stream = 0; stream < MODEM_LOAD_STREAM_COUNT; stream++)
+    {
+        startCounts[stream] = BlockPtr->streams[stream].emittedCount;
+        BlockPtr->streams[stream].burstSize = burstSizes[stream];
+        BlockPtr->streams[stream].ratePerSec = EVENT_RATE;
+    }
+
+    sleep(GENERATION_DURATION_SEC);
+
+    for (stream = 0; stream < MODEM_LOAD_STREAM_COUNT; stream++)
+    {
+        BlockPtr->streams[stream].ratePerSec = 0;
+    }
+
+    // Let the generator finish its current period
+    le_thread_Sleep(1);
+
+    for (stream = 0; stream < MODEM_LOAD_STREAM_COUNT; stream++)
+    {
+        uint32_t count = BlockPtr->streams[stream].emittedCount - startCounts[stream];
+        uint32_t expectedCount = GENERATION_DURATION_SEC * EVENT_RATE;
+
+        LE_INFO("Stream %d, burst size %" PRIu32 ": %" PRIu32 " events emitted", stream,
+                burstSizes[stream], count);
+
+        // Bursts are never split, and the generator keeps up with the rate
+        LE_ASSERT((count % burstSizes[stream]) == 0);
+        LE_ASSERT(count >= (expectedCount * 3) / 4);
+        LE_ASSERT(count <= ((expectedCount * 5) / 4) + burstSizes[stream]);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * main of the test
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+    BlockPtr = pa_load_GetBlock();
+    LE_ASSERT(BlockPtr != NULL);
+    LE_ASSERT(BlockPtr->magic == MODEM_LOAD_MAGIC);
+
+    LE_INFO("======== Start UnitTest of load PA generator ========");
+
+    LE_INFO("======== Test event rates with bursts ========");
+    TestBursts();
+
+    LE_INFO("======== UnitTest of load PA generator ends with SUCCESS ========");
+    exit(0);
+}
@@ -0,0 +1,668 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file main.c
+ *
+ * modemServices load harness.  Drives the load platform adaptor
+ * ($LEGATO_ROOT/components/modemServices/platformAdaptor/load) through its control block, and
+ * measures how the modemDaemon copes:
+ *
+ *  -# One phase per event stream (incoming SMS, signal strength, network registration, data
+ *     session state): the stream is generated at the configured rate for the configured duration,
+ *     then the events still in flight are drained.  Reports the events emitted, dropped by the
+ *     platform adaptor and received by this client, and the emission-to-client latency
+ *     percentiles.
+ *  -# Neighboring cells: compares the number of IPC requests and the latency of retrieving the
+ *     neighboring cells one field at a time, and with le_mrc_GetNeighborCellsSnapshot().
+ *  -# The usage of the main modemDaemon memory pools, as sampled by the platform adaptor.
+ *
+ * The settings are read from environment variables (see modemLoad.adef).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+#include "modemLoad.h"
+
+#include <sys/mman.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of latency samples per phase.  Further events are counted but not sampled.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SAMPLE_COUNT_MAX        100000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of neighboring cell rounds.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NEIGHBOR_ROUND_MAX      10000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prefix of the generated SMS payload, followed by the sequence number.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SMS_PAYLOAD_PREFIX      "LOAD "
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Event stream phases, indexed by modemLoad_Stream_t.
+ */
+//--------------------------------------------------------------------------------------------------
+static const struct
+{
+    const char* namePtr;        ///< Name printed with the results
+    const char* rateVarPtr;     ///< Environment variable holding the rate
+    uint32_t    defaultRate;    ///< Rate used if the variable is not set (events per second)
+}
+Phases[MODEM_LOAD_STREAM_COUNT] =
+{
+    { "SMS",         "MODEM_LOAD_SMS_RATE",          20 },
+    { "Signal",      "MODEM_LOAD_SIGNAL_RATE",       200 },
+    { "NetReg",      "MODEM_LOAD_NET_REG_RATE",      100 },
+    { "DataSession", "MODEM_LOAD_DATA_SESSION_RATE", 100 },
+};
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Settings, read from the environment.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t PhaseDurationMs;
+static uint32_t DrainMs;
+static uint32_t BurstSize;
+static uint32_t NeighborCellCount;
+static uint32_t NeighborRounds;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Control block shared with the load platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+static modemLoad_Block_t* BlockPtr;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of the current event stream phase.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CurrentStream = -1;
+static uint32_t StartEmittedCount;
+static uint32_t StartDroppedCount;
+static uint32_t RxCount;
+static uint32_t UnstampedCount;
+static uint32_t StrayCount;
+static uint32_t SampleCount;
+static le_timer_Ref_t PhaseTimer;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Latency samples of the current phase, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t LatencyUs[SAMPLE_COUNT_MAX];
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a numeric setting from the environment.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetSetting
+(
+    const char* namePtr,    ///< [IN] Name of the environment variable
+    uint64_t defaultValue   ///< [IN] Value used if the variable is not set
+)
+{
+    const char* valuePtr = getenv(namePtr);
+
+    if (valuePtr == NULL)
+    {
+        return defaultValue;
+    }
+
+    return strtoull(valuePtr, NULL, 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a relative time in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetTimeUs
+(
+    le_clk_Time_t time  ///< [IN] Relative time
+)
+{
+    return ((uint64_t) time.sec * 1000000) + (uint64_t) time.usec;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare two latency samples, for qsort().
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareLatency
+(
+    const void* aPtr,
+    const void* bPtr
+)
+{
+    uint32_t a = *((const uint32_t*) aPtr);
+    uint32_t b = *((const uint32_t*) bPtr);
+
+    return (a > b) - (a < b);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sort the latency samples, and print their mean and percentiles.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PrintLatency
+(
+    uint32_t* samplesPtr,   ///< [IN] Latency samples, in microseconds
+    uint32_t count          ///< [IN] Number of samples
+)
+{
+    uint64_t totalUs = 0;
+
+    if (count == 0)
+    {
+        printf("no latency sample\n");
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        totalUs += samplesPtr[i];
+    }
+
+    qsort(samplesPtr, count, sizeof(samplesPtr[0]), CompareLatency);
+
+    printf("latency (us) mean %" PRIu64 ", p50 %" PRIu32 ", p90 %" PRIu32 ", p99 %" PRIu32
+           ", max %" PRIu32 "\n",
+           totalUs / count,
+           samplesPtr[((count - 1) * 50) / 100],
+           samplesPtr[((count - 1) * 90) / 100],
+           samplesPtr[((count - 1) * 99) / 100],
+           samplesPtr[count - 1]);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record the reception of an event.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RecordEvent
+(
+    modemLoad_Stream_t stream,  ///< [IN] Event stream
+    uint32_t seq                ///< [IN] Sequence number of the event in its stream
+)
+{
+    uint64_t nowUs = GetTimeUs(le_clk_GetRelativeTime());
+    modemLoad_StreamCtrl_t* ctrlPtr = &BlockPtr->streams[stream];
+
+    // Late events of a previous phase, or state changes reported outside of the phases
+    if ((int) stream != CurrentStream)
+    {
+        StrayCount++;
+        return;
+    }
+
+    RxCount++;
+
+    // The emission time is overwritten once MODEM_LOAD_STAMP_COUNT newer events are emitted
+    uint32_t lag = ctrlPtr->emittedCount - seq;
+    if ((lag == 0) || (lag > MODEM_LOAD_STAMP_COUNT))
+    {
+        UnstampedCount++;
+        return;
+    }
+
+    if (SampleCount < SAMPLE_COUNT_MAX)
+    {
+        uint64_t emitTimeUs = ctrlPtr->emitTimeUs[seq % MODEM_LOAD_STAMP_COUNT];
+
+        LatencyUs[SampleCount++] = (uint32_t)(nowUs - emitTimeUs);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the sequence number of an event of a stream delivered in order and without loss.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t GetInOrderSeq
+(
+    modemLoad_Stream_t stream   ///< [IN] Event stream
+)
+{
+    return ((int) stream == CurrentStream) ? (StartEmittedCount + RxCount) : 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler for new SMS.  The sequence number is carried by the payload.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RxMessageHandler
+(
+    le_sms_MsgRef_t msgRef,
+    void* contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    uint8_t payload[LE_SMS_BINARY_MAX_BYTES + 1] = {0};
+    size_t payloadSize = LE_SMS_BINARY_MAX_BYTES;
+    uint32_t seq;
+
+    if ((le_sms_GetBinary(msgRef, payload, &payloadSize) == LE_OK) &&
+        (sscanf((const char*) payload, SMS_PAYLOAD_PREFIX "%" SCNu32, &seq) == 1))
+    {
+        RecordEvent(MODEM_LOAD_SMS, seq);
+    }
+    else
+    {
+        LE_WARN("Unexpected SMS payload");
+    }
+
+    // Free the simulated storage
+    le_sms_Delete(msgRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler for signal strength changes.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SignalStrengthChangeHandler
+(
+    int32_t ss,
+    void* contextPtr
+)
+{
+    LE_UNUSED(ss);
+    LE_UNUSED(contextPtr);
+
+    RecordEvent(MODEM_LOAD_SIGNAL, GetInOrderSeq(MODEM_LOAD_SIGNAL));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler for network registration changes.
+ */
+//--------------------------------------------------------------------------------------------------
+static void NetRegStateHandler
+(
+    le_mrc_NetRegState_t state,
+    void* contextPtr
+)
+{
+    LE_UNUSED(state);
+    LE_UNUSED(contextPtr);
+
+    RecordEvent(MODEM_LOAD_NET_REG, GetInOrderSeq(MODEM_LOAD_NET_REG));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler for data session state changes.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SessionStateHandler
+(
+    le_mdc_ProfileRef_t profileRef,
+    le_mdc_ConState_t state,
+    void* contextPtr
+)
+{
+    LE_UNUSED(profileRef);
+    LE_UNUSED(state);
+    LE_UNUSED(contextPtr);
+
+    RecordEvent(MODEM_LOAD_DATA_SESSION, GetInOrderSeq(MODEM_LOAD_DATA_SESSION));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Retrieve the neighboring cells one field at a time.
+ *
+ * @return
+ *      Number of IPC requests.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t GetNeighborCellsPerField
+(
+    void
+)
+{
+    le_mrc_NeighborCellsRef_t ngbrRef = le_mrc_GetNeighborCellsInfo();
+    uint32_t requestCount = 1;
+
+    if (ngbrRef == NULL)
+    {
+        return requestCount;
+    }
+
+    le_mrc_CellInfoRef_t cellRef = le_mrc_GetFirstNeighborCellInfo(ngbrRef);
+    requestCount++;
+
+    while (cellRef != NULL)
+    {
+        int32_t rsrq;
+        int32_t rsrp;
+
+        le_mrc_GetNeighborCellId(cellRef);
+        le_mrc_GetNeighborCellLocAreaCode(cellRef);
+        le_mrc_GetNeighborCellRxLevel(cellRef);
+        le_mrc_GetNeighborCellRat(cellRef);
+        le_mrc_GetNeighborCellLteIntraFreq(cellRef, &rsrq, &rsrp);
+        le_mrc_GetNeighborCellLteInterFreq(cellRef, &rsrq, &rsrp);
+        le_mrc_GetNeighborCellEarfcn(cellRef);
+        le_mrc_GetPhysicalNeighborLteCellId(cellRef);
+        requestCount += 8;
+
+        cellRef = le_mrc_GetNextNeighborCellInfo(ngbrRef);
+        requestCount++;
+    }
+
+    le_mrc_DeleteNeighborCellsInfo(ngbrRef);
+    requestCount++;
+
+    return requestCount;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Retrieve the neighboring cells with a snapshot.
+ *
+ * @return
+ *      Number of IPC requests.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t GetNeighborCellsSnapshot
+(
+    void
+)
+{
+    le_mrc_NeighborCellDetails_t cellList[LE_MRC_NEIGHBOR_CELLS_LIST_ENTRY_MAX];
+    size_t cellListSize = NUM_ARRAY_MEMBERS(cellList);
+    uint32_t totalCount = 0;
+    uint32_t requestCount = 1;
+
+    if (le_mrc_GetNeighborCellsSnapshot(cellList, &cellListSize, &totalCount) != LE_OK)
+    {
+        return requestCount;
+    }
+
+    // Larger lists are paged through a reference
+    if (totalCount > cellListSize)
+    {
+        le_mrc_NeighborCellsRef_t ngbrRef = le_mrc_GetNeighborCellsInfo();
+        requestCount++;
+
+        for (uint32_t startIndex = 0; (ngbrRef != NULL) && (startIndex < totalCount);
+             startIndex += cellListSize)
+        {
+            cellListSize = NUM_ARRAY_MEMBERS(cellList);
+            if (le_mrc_GetNeighborCellDetails(ngbrRef, startIndex, cellList, &cellListSize,
+                                              &totalCount) != LE_OK)
+            {
+                break;
+            }
+            requestCount++;
+        }
+
+        if (ngbrRef != NULL)
+        {
+            le_mrc_DeleteNeighborCellsInfo(ngbrRef);
+            requestCount++;
+        }
+    }
+
+    return requestCount;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run rounds of a neighboring cells retrieval method, and print their results.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunNeighborMethod
+(
+    const char* namePtr,                ///< [IN] Name of the method
+    uint32_t (*methodFunc)(void)        ///< [IN] Method, returning its number of IPC requests
+)
+{
+    uint64_t requestCount = 0;
+
+    for (uint32_t round = 0; round < NeighborRounds; round++)
+    {
+        le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+        requestCount += methodFunc();
+        LatencyUs[round] = (uint32_t) GetTimeUs(le_clk_Sub(le_clk_GetRelativeTime(), startTime));
+    }
+
+    printf("Neighbors %s: %" PRIu32 " cells, %" PRIu64 " requests per list, ",
+           namePtr,
+           NeighborCellCount,
+           requestCount / NeighborRounds);
+    PrintLatency(LatencyUs, NeighborRounds);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print the usage of the memory pools sampled by the platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PrintPoolStats
+(
+    void
+)
+{
+    uint32_t poolCount = BlockPtr->poolCount;
+
+    if (poolCount == 0)
+    {
+        printf("Pools: not available (pool names disabled)\n");
+        return;
+    }
+
+    for (uint32_t i = 0; (i < poolCount) && (i < MODEM_LOAD_POOL_MAX); i++)
+    {
+        modemLoad_PoolStats_t* statsPtr = &BlockPtr->pools[i];
+
+        if (statsPtr->name[0] == '\0')
+        {
+            continue;
+        }
+
+        printf("Pool %s: in use %" PRIu32 ", max %" PRIu32 ", free %" PRIu32
+               ", overflows %" PRIu32 ", allocs %" PRIu64 "\n",
+               statsPtr->name,
+               statsPtr->numBlocksInUse,
+               statsPtr->maxNumBlocksUsed,
+               statsPtr->numFree,
+               statsPtr->numOverflows,
+               statsPtr->numAllocs);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Last phases: neighboring cells and pool usage.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunFinalPhases
+(
+    void
+)
+{
+    if ((NeighborCellCount > 0) && (NeighborRounds > 0))
+    {
+        BlockPtr->neighborCellCount = NeighborCellCount;
+
+        RunNeighborMethod("per-field", GetNeighborCellsPerField);
+        RunNeighborMethod("snapshot", GetNeighborCellsSnapshot);
+    }
+
+    PrintPoolStats();
+
+    if (StrayCount > 0)
+    {
+        printf("Stray events (received outside of their phase): %" PRIu32 "\n", StrayCount);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the phase of a stream, or the final phases once all the streams are done.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartStreamPhase
+(
+    int stream      ///< [IN] Event stream
+)
+{
+    for (; stream < MODEM_LOAD_STREAM_COUNT; stream++)
+    {
+        uint32_t ratePerSec = (uint32_t) GetSetting(Phases[stream].rateVarPtr,
+                                                    Phases[stream].defaultRate);
+        if (ratePerSec == 0)
+        {
+            continue;
+        }
+
+        modemLoad_StreamCtrl_t* ctrlPtr = &BlockPtr->streams[stream];
+
+        CurrentStream = stream;
+        StartEmittedCount = ctrlPtr->emittedCount;
+        StartDroppedCount = ctrlPtr->droppedCount;
+        RxCount = 0;
+        UnstampedCount = 0;
+        SampleCount = 0;
+
+        ctrlPtr->burstSize = BurstSize;
+        ctrlPtr->ratePerSec = ratePerSec;
+
+        le_timer_SetMsInterval(PhaseTimer, PhaseDurationMs);
+        le_timer_SetContextPtr(PhaseTimer, NULL);
+        le_timer_Start(PhaseTimer);
+        return;
+    }
+
+    CurrentStream = -1;
+    RunFinalPhases();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Phase timer handler.  Stops the stream at the end of the phase, then prints the results at the
+ * end of the drain period and moves on to the next phase.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PhaseTimerHandler
+(
+    le_timer_Ref_t timerRef
+)
+{
+    modemLoad_StreamCtrl_t* ctrlPtr = &BlockPtr->streams[CurrentStream];
+
+    if (le_timer_GetContextPtr(timerRef) == NULL)
+    {
+        ctrlPtr->ratePerSec = 0;
+
+        le_timer_SetMsInterval(timerRef, DrainMs);
+        le_timer_SetContextPtr(timerRef, ctrlPtr);
+        le_timer_Start(timerRef);
+        return;
+    }
+
+    uint32_t emittedCount = ctrlPtr->emittedCount - StartEmittedCount;
+    uint32_t droppedCount = ctrlPtr->droppedCount - StartDroppedCount;
+
+    printf("%s: emitted %" PRIu32 ", dropped %" PRIu32 ", received %" PRIu32
+           " (%" PRIu64 " events/s), unstamped %" PRIu32 ", ",
+           Phases[CurrentStream].namePtr,
+           emittedCount,
+           droppedCount,
+           RxCount,
+           ((uint64_t) RxCount * 1000) / PhaseDurationMs,
+           UnstampedCount);
+    PrintLatency(LatencyUs, SampleCount);
+
+    StartStreamPhase(CurrentStream + 1);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map the control block of the load platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+static void MapBlock
+(
+    void
+)
+{
+    int fd = open(MODEM_LOAD_FILE_PATH, O_RDWR | O_CLOEXEC);
+
+    LE_FATAL_IF(fd < 0, "Unable to open %s (%m), is the load platform adaptor in use?",
+                MODEM_LOAD_FILE_PATH);
+
+    void* addrPtr = mmap(NULL, sizeof(modemLoad_Block_t), PROT_READ | PROT_WRITE, MAP_SHARED,
+                         fd, 0);
+    close(fd);
+
+    LE_FATAL_IF(addrPtr == MAP_FAILED, "Unable to map %s: %m", MODEM_LOAD_FILE_PATH);
+
+    BlockPtr = addrPtr;
+
+    LE_FATAL_IF(BlockPtr->magic != MODEM_LOAD_MAGIC, "Load platform adaptor not initialized");
+}
+
+COMPONENT_INIT
+{
+    PhaseDurationMs = (uint32_t) GetSetting("MODEM_LOAD_DURATION_MS", 10000);
+    DrainMs = (uint32_t) GetSetting("MODEM_LOAD_DRAIN_MS", 2000);
+    BurstSize = (uint32_t) GetSetting("MODEM_LOAD_BURST_SIZE", 1);
+    NeighborCellCount = (uint32_t) GetSetting("MODEM_LOAD_NEIGHBOR_CELLS", 16);
+    NeighborRounds = (uint32_t) GetSetting("MODEM_LOAD_NEIGHBOR_ROUNDS", 100);
+
+    LE_FATAL_IF(PhaseDurationMs == 0, "MODEM_LOAD_DURATION_MS must not be zero");
+    LE_FATAL_IF(NeighborCellCount > MODEM_LOAD_NEIGHBOR_CELL_MAX,
+                "MODEM_LOAD_NEIGHBOR_CELLS must be at most %d", MODEM_LOAD_NEIGHBOR_CELL_MAX);
+    LE_FATAL_IF(NeighborRounds > NEIGHBOR_ROUND_MAX,
+                "MODEM_LOAD_NEIGHBOR_ROUNDS must be at most %d", NEIGHBOR_ROUND_MAX);
+
+    MapBlock();
+
+    // Stop any stream left running by an interrupted run
+    for (int stream = 0; stream < MODEM_LOAD_STREAM_COUNT; stream++)
+    {
+        BlockPtr->streams[stream].ratePerSec = 0;
+    }
+    BlockPtr->dataProfileIndex = (uint32_t) GetSetting("MODEM_LOAD_DATA_PROFILE", 1);
+
+    le_mdc_ProfileRef_t profileRef = le_mdc_GetProfile(BlockPtr->dataProfileIndex);
+    LE_FATAL_IF(profileRef == NULL, "Unable to get profile %" PRIu32, BlockPtr->dataProfileIndex);
+
+    le_sms_AddRxMessageHandler(RxMessageHandler, NULL);
+    le_mrc_AddSignalStrengthChangeHandler(LE_MRC_RAT_LTE, -140, -40,
+                                          SignalStrengthChangeHandler, NULL);
+    le_mrc_AddNetRegStateEventHandler(NetRegStateHandler, NULL);
+    le_mdc_AddSessionStateHandler(profileRef, SessionStateHandler, NULL);
+
+    PhaseTimer = le_timer_Create("ModemLoadPhase");
+    le_timer_SetHandler(PhaseTimer, PhaseTimerHandler);
+
+    StartStreamPhase(0);
+}
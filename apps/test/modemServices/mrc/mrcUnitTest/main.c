@@ -509,6 +509,14 @@ void Testle_mrc_RegisterTest
 
     ngbrRef = le_mrc_GetNeighborCellsInfo();
     LE_ASSERT(!ngbrRef);
+
+    le_mrc_NeighborCellDetails_t cellList[LE_MRC_NEIGHBOR_CELLS_LIST_ENTRY_MAX];
+    size_t cellListSize = NUM_ARRAY_MEMBERS(cellList);
+    uint32_t totalCount = 0;
+    LE_ASSERT(LE_NOT_FOUND == le_mrc_GetNeighborCellsSnapshot(cellList,
+                                                              &cellListSize,
+                                                              &totalCount));
+    LE_ASSERT(0 == cellListSize);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1067,6 +1075,78 @@ static void Testle_mrc_PciScan
     LE_ASSERT(NULL == scanInfoRef);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * MRC PCI scan details, read by pages
+ * APIs tested:
+ * - le_mrc_PerformPciNetworkScan()
+ * - le_mrc_GetPciScanDetails()
+ * - le_mrc_DeletePciNetworkScan()
+ */
+//--------------------------------------------------------------------------------------------------
+static void Testle_mrc_PciScanDetails
+(
+    void
+)
+{
+    le_mrc_PciScanDetails_t scanList[3];
+    size_t scanListSize = 0;
+    uint32_t totalCount = 0;
+    uint32_t index = 0;
+    uint16_t expectedCellId = 0;
+    uint16_t plmnNbr = 0;
+    le_mrc_PciScanInformationListRef_t scanInfoListRef;
+
+    scanInfoListRef = le_mrc_PerformPciNetworkScan(LE_MRC_BITMASK_RAT_LTE);
+    LE_ASSERT(scanInfoListRef != NULL);
+
+    // Read the flattened list by pages smaller than a cell's PLMN list
+    do
+    {
+        scanListSize = NUM_ARRAY_MEMBERS(scanList);
+        LE_ASSERT(LE_OK == le_mrc_GetPciScanDetails(scanInfoListRef,
+                                                    index,
+                                                    scanList,
+                                                    &scanListSize,
+                                                    &totalCount));
+        LE_ASSERT(scanListSize > 0);
+
+        for (size_t i = 0; i < scanListSize; i++)
+        {
+            char expectedMcc[LE_MRC_MCC_BYTES] = {0};
+            char expectedMnc[LE_MRC_MNC_BYTES] = {0};
+
+            if (plmnNbr > expectedCellId)
+            {
+                expectedCellId++;
+                plmnNbr = 0;
+            }
+
+            snprintf(expectedMnc, sizeof(expectedMnc), "%d", plmnNbr);
+            snprintf(expectedMcc, sizeof(expectedMcc), "2%d", plmnNbr);
+            LE_ASSERT(expectedCellId == scanList[i].physicalCellId);
+            LE_ASSERT(0 == strncmp(expectedMnc, scanList[i].mnc, sizeof(scanList[i].mnc)));
+            LE_ASSERT(0 == strncmp(expectedMcc, scanList[i].mcc, sizeof(scanList[i].mcc)));
+            plmnNbr++;
+        }
+
+        index += scanListSize;
+    }
+    while (index < totalCount);
+
+    LE_ASSERT(index == totalCount);
+
+    scanListSize = NUM_ARRAY_MEMBERS(scanList);
+    LE_ASSERT(LE_OUT_OF_RANGE == le_mrc_GetPciScanDetails(scanInfoListRef,
+                                                          totalCount,
+                                                          scanList,
+                                                          &scanListSize,
+                                                          &totalCount));
+    LE_ASSERT(0 == scanListSize);
+
+    le_mrc_DeletePciNetworkScan(scanInfoListRef);
+}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -1169,6 +1249,8 @@ static void* TestThread
     Testle_mrc_JammingTest();
     LE_INFO("======== MRC PCI scan Test ========");
     Testle_mrc_PciScan();
+    LE_INFO("======== MRC PCI scan details Test ========");
+    Testle_mrc_PciScanDetails();
     LE_INFO("======== MRC PCI scan async Test ========");
     Testle_mrc_PciScanAsync();
 
@@ -7,6 +7,14 @@
 
 #include "legato.h"
 #include "interfaces.h"
+#include "pa_gnss.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of a simulated NMEA frame, including the terminating null byte.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_FRAME_MAX_BYTES    512
 
 
 //--------------------------------------------------------------------------------------------------
@@ -16,6 +24,24 @@
 //--------------------------------------------------------------------------------------------------
 static Client_t Client;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * NMEA handler registered by the GNSS service, and pool of the NMEA frames given to it.
+ */
+//--------------------------------------------------------------------------------------------------
+static pa_gnss_NmeaHandlerFunc_t NmeaHandler;
+static le_mem_PoolRef_t NmeaFramePool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Real PA function, replaced by __wrap_pa_gnss_AddNmeaHandler() at link time.
+ */
+//--------------------------------------------------------------------------------------------------
+le_event_HandlerRef_t __real_pa_gnss_AddNmeaHandler
+(
+    pa_gnss_NmeaHandlerFunc_t handler
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get the server service reference stub for le_gnss
@@ -124,3 +150,43 @@ le_msg_SessionEventHandlerRef_t MyAddServiceCloseHandler
 {
     return NULL;
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Register an handler for NMEA frames notifications, and keep it to report simulated frames.
+ * (WRAPPED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+le_event_HandlerRef_t __wrap_pa_gnss_AddNmeaHandler
+(
+    pa_gnss_NmeaHandlerFunc_t handler ///< [IN] The handler function.
+)
+{
+    NmeaHandler = handler;
+    return __real_pa_gnss_AddNmeaHandler(handler);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report a NMEA frame to the GNSS service, as the PA does. Must be called by the thread which
+ * initialized the GNSS service.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_gnss_ReportNmeaSimu
+(
+    const char* nmeaPtr     ///< [IN] The NMEA frame
+)
+{
+    LE_ASSERT(NULL != NmeaHandler);
+
+    if (NULL == NmeaFramePool)
+    {
+        NmeaFramePool = le_mem_CreatePool("NmeaFrameSimu", NMEA_FRAME_MAX_BYTES);
+    }
+
+    char* framePtr = le_mem_ForceAlloc(NmeaFramePool);
+    LE_ASSERT_OK(le_utf8_Copy(framePtr, nmeaPtr, NMEA_FRAME_MAX_BYTES, NULL));
+
+    // The handler releases the frame
+    NmeaHandler(framePtr);
+}
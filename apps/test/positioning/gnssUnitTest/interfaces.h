@@ -111,4 +111,15 @@ void le_gnss_SetClientSimu
     Client_t client
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report a NMEA frame to the GNSS service, as the PA does. Must be called by the thread which
+ * initialized the GNSS service.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_gnss_ReportNmeaSimu
+(
+    const char* nmeaPtr
+);
+
 #endif /* interfaces.h */
@@ -828,6 +828,600 @@ static void Testle_gnss_GetLastSampleRef
     LE_ASSERT(mypositionSampleRef != NULL);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tested APIs: le_gnss_GetFix(), le_gnss_GetLastFix()
+ *
+ * Verify that the fix gets the same data as the individual getters.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Testle_gnss_GetFix
+(
+   void
+)
+{
+    le_gnss_Fix_t fix;
+    le_gnss_Fix_t lastFix;
+    le_gnss_FixState_t state;
+    int32_t latitude;
+    int32_t longitude;
+    int32_t hAccuracy;
+    int32_t altitude;
+    int32_t vAccuracy;
+    uint16_t hours;
+    uint16_t minutes;
+    uint16_t seconds;
+    uint16_t milliseconds;
+
+    // Clear the padding bytes before comparing the structures
+    memset(&fix, 0, sizeof(fix));
+    memset(&lastFix, 0, sizeof(lastFix));
+
+    le_gnss_SampleRef_t positionSampleRef = le_gnss_GetLastSampleRef();
+    LE_ASSERT(NULL != positionSampleRef);
+
+    LE_ASSERT_OK(le_gnss_GetFix(positionSampleRef, &fix));
+
+    LE_ASSERT_OK(le_gnss_GetPositionState(positionSampleRef, &state));
+    LE_ASSERT(state == fix.fixState);
+
+    le_gnss_GetLocation(positionSampleRef, &latitude, &longitude, &hAccuracy);
+    LE_ASSERT(latitude == fix.latitude);
+    LE_ASSERT(longitude == fix.longitude);
+    LE_ASSERT(hAccuracy == fix.hAccuracy);
+
+    le_gnss_GetAltitude(positionSampleRef, &altitude, &vAccuracy);
+    LE_ASSERT(altitude == fix.altitude);
+    LE_ASSERT(vAccuracy == fix.vAccuracy);
+
+    le_gnss_GetTime(positionSampleRef, &hours, &minutes, &seconds, &milliseconds);
+    LE_ASSERT(hours == fix.hours);
+    LE_ASSERT(minutes == fix.minutes);
+    LE_ASSERT(seconds == fix.seconds);
+    LE_ASSERT(milliseconds == fix.milliseconds);
+
+    LE_ASSERT_OK(le_gnss_GetLastFix(&lastFix));
+    LE_ASSERT(0 == memcmp(&fix, &lastFix, sizeof(fix)));
+
+    le_gnss_ReleaseSampleRef(positionSampleRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fix batch test: thread, handler reference and the last batch received.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_thread_Ref_t              BatchThreadRef;
+static le_gnss_FixBatchHandlerRef_t FixBatchHandlerRef = NULL;
+static le_gnss_Fix_t                BatchFixList[LE_GNSS_FIX_BATCH_MAX];
+static size_t                       BatchFixCount = 0;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler function for fix batches: store the batch received.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void GnssFixBatchHandlerFunction
+(
+    const le_gnss_Fix_t* fixListPtr,
+    size_t fixListSize,
+    void* contextPtr
+)
+{
+    LE_ASSERT(fixListSize <= LE_GNSS_FIX_BATCH_MAX);
+
+    LOCK
+    memcpy(BatchFixList, fixListPtr, fixListSize * sizeof(le_gnss_Fix_t));
+    BatchFixCount = fixListSize;
+    UNLOCK
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fix batch thread: subscribe a fix batch handler of the given size and run an eventLoop.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void* FixBatchThread
+(
+    void* ctxPtr
+)
+{
+    LOCK
+    FixBatchHandlerRef = le_gnss_AddFixBatchHandler((uint32_t)(uintptr_t)ctxPtr,
+                                                    GnssFixBatchHandlerFunction,
+                                                    NULL);
+    LE_ASSERT(NULL != FixBatchHandlerRef);
+    UNLOCK
+    // Semaphore is used to synchronize the task execution with the core test
+    le_sem_Post(ThreadSemaphore);
+    le_event_RunLoop();
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fix batch thread: replace the fix batch handler by one of the given size.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReplaceFixBatchHandler
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    LOCK
+    le_gnss_RemoveFixBatchHandler(FixBatchHandlerRef);
+    FixBatchHandlerRef = NULL;
+
+    if (NULL != param1Ptr)
+    {
+        FixBatchHandlerRef = le_gnss_AddFixBatchHandler((uint32_t)(uintptr_t)param1Ptr,
+                                                        GnssFixBatchHandlerFunction,
+                                                        NULL);
+        LE_ASSERT(NULL != FixBatchHandlerRef);
+    }
+    UNLOCK
+    le_sem_Post(ThreadSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fix batch thread: post the semaphore once the events reported before are processed.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void SynchFixBatchThread
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    le_sem_Post(ThreadSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report a position event and wait until the fix batch thread has processed it.
+ *
+ * @return The number of fixes of the batch delivered for this event, 0 if none.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t ReportFixBatchEvent
+(
+    void
+)
+{
+    size_t fixCount;
+
+    LOCK
+    BatchFixCount = 0;
+    UNLOCK
+
+    pa_gnssSimu_ReportEvent();
+    le_event_QueueFunctionToThread(BatchThreadRef, SynchFixBatchThread, NULL, NULL);
+    SynchTest();
+
+    LOCK
+    fixCount = BatchFixCount;
+    UNLOCK
+
+    return fixCount;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tested APIs: le_gnss_AddFixBatchHandler(), le_gnss_RemoveFixBatchHandler()
+ *
+ * Verify that the fixes are delivered by batches of the requested size, the oldest first, and
+ * that the fixes buffered when the handler is removed are discarded.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Testle_gnss_FixBatchHandler
+(
+    void
+)
+{
+    const le_gnss_Resolution_t resList[] =
+    {
+        LE_GNSS_RES_ZERO_DECIMAL, LE_GNSS_RES_ONE_DECIMAL, LE_GNSS_RES_TWO_DECIMAL
+    };
+    const size_t batchSize = NUM_ARRAY_MEMBERS(resList);
+    int32_t vAccuracyList[NUM_ARRAY_MEMBERS(resList)];
+    int32_t altitude;
+    size_t i;
+
+    le_gnss_SetClientSimu(CLIENT1);
+
+    BatchThreadRef = le_thread_Create("FixBatchThread", FixBatchThread, (void*)batchSize);
+    le_thread_Start(BatchThreadRef);
+    SynchTest();
+
+    // The fixes are converted with the resolution set when they are buffered: use a different
+    // vertical accuracy resolution for each fix to tell them apart.
+    for (i = 0; i < batchSize; i++)
+    {
+        LE_ASSERT_OK(le_gnss_SetDataResolution(LE_GNSS_DATA_VACCURACY, resList[i]));
+
+        size_t fixCount = ReportFixBatchEvent();
+        LE_ASSERT(fixCount == ((i == batchSize - 1) ? batchSize : 0));
+
+        le_gnss_SampleRef_t positionSampleRef = le_gnss_GetLastSampleRef();
+        LE_ASSERT(NULL != positionSampleRef);
+        LE_ASSERT_OK(le_gnss_GetAltitude(positionSampleRef, &altitude, &vAccuracyList[i]));
+        le_gnss_ReleaseSampleRef(positionSampleRef);
+    }
+    LE_ASSERT(vAccuracyList[0] != vAccuracyList[batchSize - 1]);
+
+    for (i = 0; i < batchSize; i++)
+    {
+        LE_ASSERT(BatchFixList[i].vAccuracy == vAccuracyList[i]);
+    }
+
+    // The next batch starts empty
+    LE_ASSERT(0 == ReportFixBatchEvent());
+
+    // Fixes buffered when the handler is removed are not delivered to the next handler
+    le_event_QueueFunctionToThread(BatchThreadRef, ReplaceFixBatchHandler, (void*)1, NULL);
+    SynchTest();
+    LE_ASSERT(1 == ReportFixBatchEvent());
+    LE_ASSERT(BatchFixList[0].vAccuracy == vAccuracyList[batchSize - 1]);
+
+    // No more fixes once the handler is removed
+    le_event_QueueFunctionToThread(BatchThreadRef, ReplaceFixBatchHandler, NULL, NULL);
+    SynchTest();
+    LE_ASSERT(0 == ReportFixBatchEvent());
+
+    le_thread_Cancel(BatchThreadRef);
+}
+
+#if defined(LE_CONFIG_LINUX) && !defined(MK_CONFIG_DISABLE_AT_GNSS) && \
+    (LE_CONFIG_GNSS_NMEA_STREAM_MAX >= 2)
+//--------------------------------------------------------------------------------------------------
+/**
+ * NMEA stream tests: length of the simulated frames, without the terminating null byte, maximum
+ * number of attempts to read the frames written asynchronously by the GNSS service, and number of
+ * attempts without data after which a stream is considered fully read.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_FRAME_LEN          97
+#define NMEA_FRAME_SIZE         (NMEA_FRAME_LEN + 1)
+#define NMEA_READ_ATTEMPTS      200
+#define NMEA_IDLE_COUNT         2
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * NMEA stream tests: sequence number of the next frame reported, and buffer of the data read.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t NmeaFrameSeq = 0;
+static char     NmeaReadBuffer[4 * (LE_CONFIG_GNSS_NMEA_BUFFER_SIZE + 65536)];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build the simulated NMEA frame of a sequence number.
+ */
+//--------------------------------------------------------------------------------------------------
+static void BuildNmeaFrame
+(
+    uint32_t seq,                           ///< [IN] Sequence number of the frame
+    char     frame[NMEA_FRAME_SIZE]         ///< [OUT] Frame, with its terminating null byte
+)
+{
+    int len = snprintf(frame, NMEA_FRAME_SIZE, "$GPTST,%08" PRIu32 ",", seq);
+
+    memset(frame + len, 'A' + (seq % 26), NMEA_FRAME_LEN - len);
+    frame[NMEA_FRAME_LEN] = '\0';
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * GNSS service thread: report a simulated NMEA frame.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportNmeaFrame
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    le_gnss_ReportNmeaSimu((const char*)param1Ptr);
+    le_sem_Post(ThreadSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * GNSS service thread: open a NMEA stream.
+ */
+//--------------------------------------------------------------------------------------------------
+static void OpenNmeaStream
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    *((le_result_t*)param1Ptr) = le_gnss_OpenNmeaStream((int*)param2Ptr);
+    le_sem_Post(ThreadSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * GNSS service thread: post the semaphore once the events received before are processed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SynchNmeaThread
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    le_sem_Post(ThreadSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report the next simulated NMEA frames to the GNSS service.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportNmeaFrames
+(
+    uint32_t count      ///< [IN] Number of frames
+)
+{
+    char frame[NMEA_FRAME_SIZE];
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        BuildNmeaFrame(NmeaFrameSeq++, frame);
+        le_event_QueueFunctionToThread(AppThreadRef, ReportNmeaFrame, frame, NULL);
+        SynchTest();
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open a NMEA stream from the GNSS service thread.
+ *
+ * @return The result of le_gnss_OpenNmeaStream(). On success, the read end is non-blocking.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t OpenTestNmeaStream
+(
+    int* fdPtr          ///< [OUT] Read end of the NMEA stream
+)
+{
+    le_result_t result = LE_FAULT;
+
+    le_event_QueueFunctionToThread(AppThreadRef, OpenNmeaStream, &result, fdPtr);
+    SynchTest();
+
+    if (LE_OK == result)
+    {
+        LE_ASSERT(*fdPtr >= 0);
+        LE_ASSERT(0 == fcntl(*fdPtr, F_SETFL, fcntl(*fdPtr, F_GETFL) | O_NONBLOCK));
+    }
+    else
+    {
+        LE_ASSERT(-1 == *fdPtr);
+    }
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a NMEA stream until at least minSize bytes are read and the GNSS service has nothing more
+ * to write.
+ *
+ * @return The number of bytes read into NmeaReadBuffer.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t ReadNmeaStream
+(
+    int    fd,          ///< [IN] Read end of the NMEA stream
+    size_t minSize      ///< [IN] Number of bytes expected at least
+)
+{
+    size_t readSize = 0;
+    int idleCount = 0;
+    int attempts = 0;
+
+    while (attempts < NMEA_READ_ATTEMPTS)
+    {
+        ssize_t len = read(fd, NmeaReadBuffer + readSize, sizeof(NmeaReadBuffer) - readSize);
+
+        if (len > 0)
+        {
+            readSize += len;
+            LE_ASSERT(readSize < sizeof(NmeaReadBuffer));
+            idleCount = 0;
+            continue;
+        }
+
+        LE_ASSERT((len < 0) && (EAGAIN == errno));
+
+        if ((readSize >= minSize) && (idleCount >= NMEA_IDLE_COUNT))
+        {
+            break;
+        }
+
+        // Let the GNSS service handle POLLOUT and write the pending frames
+        le_event_QueueFunctionToThread(AppThreadRef, SynchNmeaThread, NULL, NULL);
+        SynchTest();
+        usleep(1000);
+        idleCount++;
+        attempts++;
+    }
+
+    return readSize;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that some data read on a NMEA stream are exactly the frames of the given sequence numbers.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckNmeaFrames
+(
+    const char* dataPtr,    ///< [IN] Data read
+    size_t      size,       ///< [IN] Size of the data
+    uint32_t    firstSeq,   ///< [IN] Sequence number of the first frame expected
+    uint32_t    count       ///< [IN] Number of frames expected
+)
+{
+    char frame[NMEA_FRAME_SIZE];
+    uint32_t i;
+
+    LE_ASSERT(size == (count * NMEA_FRAME_SIZE));
+
+    for (i = 0; i < count; i++)
+    {
+        BuildNmeaFrame(firstSeq + i, frame);
+        LE_ASSERT(0 == memcmp(dataPtr + (i * NMEA_FRAME_SIZE), frame, NMEA_FRAME_SIZE));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tested API: le_gnss_OpenNmeaStream()
+ *
+ * Verify that:
+ *  - two streams receive the same frames;
+ *  - a reader slower than the frames receives them all, in order, including when its pending
+ *    frames wrap around the end of the NMEA buffer and are written in two parts;
+ *  - a reader that never reads jumps to the oldest frame held once it reads again, and doesn't
+ *    stall the other readers;
+ *  - no more than LE_CONFIG_GNSS_NMEA_STREAM_MAX streams are opened at once.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Testle_gnss_NmeaStreams
+(
+    void
+)
+{
+    int fastFd = -1;
+    int slowFd = -1;
+    int fdList[LE_CONFIG_GNSS_NMEA_STREAM_MAX];
+    int extraFd;
+    char frame[NMEA_FRAME_SIZE];
+    uint32_t firstSeq;
+    uint32_t count;
+    size_t size;
+    int i;
+
+    le_gnss_SetClientSimu(CLIENT1);
+
+    LE_ASSERT(LE_FAULT == le_gnss_OpenNmeaStream(NULL));
+
+    LE_ASSERT_OK(OpenTestNmeaStream(&fastFd));
+    LE_ASSERT_OK(OpenTestNmeaStream(&slowFd));
+
+    // Make the pipe of the slow reader as small as possible, so that it fills up quickly
+    LE_ASSERT(fcntl(slowFd, F_SETPIPE_SZ, LE_CONFIG_GNSS_NMEA_BUFFER_SIZE) > 0);
+    int pipeSize = fcntl(slowFd, F_GETPIPE_SZ);
+    LE_ASSERT(pipeSize > 0);
+
+    // Both streams receive the same frames
+    firstSeq = NmeaFrameSeq;
+    ReportNmeaFrames(3);
+    size = ReadNmeaStream(fastFd, 3 * NMEA_FRAME_SIZE);
+    CheckNmeaFrames(NmeaReadBuffer, size, firstSeq, 3);
+    size = ReadNmeaStream(slowFd, 3 * NMEA_FRAME_SIZE);
+    CheckNmeaFrames(NmeaReadBuffer, size, firstSeq, 3);
+
+    // The slow reader reads a bit more than its pipe holds at once: the rest is kept in the NMEA
+    // buffer, and written when the pipe is drained. Over several rounds, the pending frames wrap
+    // around the end of the NMEA buffer. Nothing is lost, and the fast reader is never delayed.
+    count = (pipeSize + (LE_CONFIG_GNSS_NMEA_BUFFER_SIZE / 2)) / NMEA_FRAME_SIZE;
+    for (i = 0; i < 8; i++)
+    {
+        uint32_t j;
+
+        firstSeq = NmeaFrameSeq;
+        for (j = 0; j < count; j++)
+        {
+            ReportNmeaFrames(1);
+            size = ReadNmeaStream(fastFd, NMEA_FRAME_SIZE);
+            CheckNmeaFrames(NmeaReadBuffer, size, firstSeq + j, 1);
+        }
+
+        size = ReadNmeaStream(slowFd, count * NMEA_FRAME_SIZE);
+        CheckNmeaFrames(NmeaReadBuffer, size, firstSeq, count);
+    }
+
+    // The slow reader stops reading for more frames than its pipe and the NMEA buffer hold
+    count = 2 * (pipeSize + LE_CONFIG_GNSS_NMEA_BUFFER_SIZE) / NMEA_FRAME_SIZE;
+    firstSeq = NmeaFrameSeq;
+    for (i = 0; i < (int)count; i++)
+    {
+        ReportNmeaFrames(1);
+        size = ReadNmeaStream(fastFd, NMEA_FRAME_SIZE);
+        CheckNmeaFrames(NmeaReadBuffer, size, firstSeq + i, 1);
+    }
+
+    // It first gets the frames its pipe held, then jumps to the oldest frame of the NMEA buffer
+    // and gets all the frames up to the last one, each of them complete.
+    uint32_t heldCount = LE_CONFIG_GNSS_NMEA_BUFFER_SIZE / NMEA_FRAME_SIZE;
+    uint32_t lastSeq = NmeaFrameSeq - 1;
+    size_t tailSize = heldCount * NMEA_FRAME_SIZE;
+
+    // The pipe held at most pipeSize bytes, and less than one frame fewer: frames are written whole
+    size = ReadNmeaStream(slowFd, pipeSize + tailSize - (NMEA_FRAME_SIZE - 1));
+    LE_ASSERT(size > tailSize);
+    LE_ASSERT(size < (count * NMEA_FRAME_SIZE));
+    CheckNmeaFrames(NmeaReadBuffer + size - tailSize, tailSize, lastSeq - heldCount + 1,
+                    heldCount);
+
+    // The frames before the jump are the first ones, possibly ended by a truncated frame, which is
+    // terminated by a null byte.
+    size_t headSize = ((size - tailSize) / NMEA_FRAME_SIZE) * NMEA_FRAME_SIZE;
+    CheckNmeaFrames(NmeaReadBuffer, headSize, firstSeq, headSize / NMEA_FRAME_SIZE);
+    if (headSize < (size - tailSize))
+    {
+        size_t truncatedLen = size - tailSize - headSize - 1;
+
+        BuildNmeaFrame(firstSeq + (headSize / NMEA_FRAME_SIZE), frame);
+        LE_ASSERT(0 == memcmp(NmeaReadBuffer + headSize, frame, truncatedLen));
+        LE_ASSERT('\0' == NmeaReadBuffer[headSize + truncatedLen]);
+    }
+
+    // Both readers are in sync again
+    firstSeq = NmeaFrameSeq;
+    ReportNmeaFrames(1);
+    size = ReadNmeaStream(fastFd, NMEA_FRAME_SIZE);
+    CheckNmeaFrames(NmeaReadBuffer, size, firstSeq, 1);
+    size = ReadNmeaStream(slowFd, NMEA_FRAME_SIZE);
+    CheckNmeaFrames(NmeaReadBuffer, size, firstSeq, 1);
+
+    // No more than LE_CONFIG_GNSS_NMEA_STREAM_MAX streams
+    fdList[0] = fastFd;
+    fdList[1] = slowFd;
+    for (i = 2; i < LE_CONFIG_GNSS_NMEA_STREAM_MAX; i++)
+    {
+        LE_ASSERT_OK(OpenTestNmeaStream(&fdList[i]));
+    }
+    LE_ASSERT(LE_OVERFLOW == OpenTestNmeaStream(&extraFd));
+
+    // A stream closed by its reader is released: another one can be opened
+    for (i = 0; i < LE_CONFIG_GNSS_NMEA_STREAM_MAX; i++)
+    {
+        close(fdList[i]);
+    }
+    ReportNmeaFrames(1);
+
+    for (i = 0; (i < NMEA_READ_ATTEMPTS) && (LE_OVERFLOW == OpenTestNmeaStream(&fastFd)); i++)
+    {
+        usleep(1000);
+    }
+    LE_ASSERT(i < NMEA_READ_ATTEMPTS);
+    close(fastFd);
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Tested API: le_gnss_GetSbasConstellationCategory()
@@ -1274,6 +1868,9 @@ COMPONENT_INIT
     LE_INFO("======== GNSS Device Get LastSample ref ========");
     Testle_gnss_GetLastSampleRef();
 
+    LE_INFO("======== GNSS Get Fix ========");
+    Testle_gnss_GetFix();
+
     LE_INFO("======== GNSS Device SuplCertificate ========");
     Testle_gnss_SuplCertificate();
 
@@ -1295,9 +1892,18 @@ COMPONENT_INIT
     LE_INFO("======== GNSS LeapSeconds ========");
     Testle_gnss_GetLeapSeconds();
 
+#if defined(LE_CONFIG_LINUX) && !defined(MK_CONFIG_DISABLE_AT_GNSS) && \
+    (LE_CONFIG_GNSS_NMEA_STREAM_MAX >= 2)
+    LE_INFO("======== GNSS NMEA streams ========");
+    Testle_gnss_NmeaStreams();
+#endif
+
     LE_INFO("======== GNSS Remove Position Handler========");
     Testle_gnss_RemoveHandlers();
 
+    LE_INFO("======== GNSS Fix Batch Handler ========");
+    Testle_gnss_FixBatchHandler();
+
     LE_INFO("======== GNSS Test SUCCESS ========");
     exit(EXIT_SUCCESS);
 }
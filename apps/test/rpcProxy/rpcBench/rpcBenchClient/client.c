@@ -0,0 +1,321 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file client.c
+ *
+ * Client side of the RPC Proxy benchmark.  Runs three phases against the benchmark server on the
+ * far side, and prints their results:
+ *
+ *  -# Synchronous Echo requests, reporting the request/response latency percentiles.
+ *  -# A burst of asynchronous Tick events, reporting the event throughput.
+ *  -# A file stream, reporting its throughput.
+ *
+ * The size of each phase is set with environment variables (see rpcBenchClient.adef).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of Echo requests, bounding the size of the latency sample buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ECHO_COUNT_MAX          100000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the chunks written to the stream.
+ */
+//--------------------------------------------------------------------------------------------------
+#define STREAM_CHUNK_SIZE       4096
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Benchmark settings, read from the environment.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t EchoCount;
+static uint32_t EchoSize;
+static uint32_t EventCount;
+static uint64_t StreamBytes;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Echo latency samples, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t EchoLatencyUs[ECHO_COUNT_MAX];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of the event and stream phases.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t TickCount;
+static le_clk_Time_t PhaseStartTime;
+static rpcBench_TickHandlerRef_t TickHandlerRef;
+static rpcBench_StreamDoneHandlerRef_t StreamDoneHandlerRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a numeric setting from the environment.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetSetting
+(
+    const char* namePtr,    ///< [IN] Name of the environment variable
+    uint64_t defaultValue   ///< [IN] Value used if the variable is not set
+)
+{
+    const char* valuePtr = getenv(namePtr);
+
+    if (valuePtr == NULL)
+    {
+        return defaultValue;
+    }
+
+    return strtoull(valuePtr, NULL, 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the time elapsed since a given relative time, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetElapsedUs
+(
+    le_clk_Time_t startTime  ///< [IN] Relative start time
+)
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+
+    return ((uint64_t) elapsed.sec * 1000000) + (uint64_t) elapsed.usec;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare two latency samples, for qsort().
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareLatency
+(
+    const void* aPtr,
+    const void* bPtr
+)
+{
+    uint32_t a = *((const uint32_t*) aPtr);
+    uint32_t b = *((const uint32_t*) bPtr);
+
+    return (a > b) - (a < b);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a percentile of the sorted latency samples.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t GetPercentile
+(
+    uint32_t percentile  ///< [IN] Percentile (0 to 100)
+)
+{
+    return EchoLatencyUs[((EchoCount - 1) * percentile) / 100];
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Phase 1: synchronous Echo requests.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunEchoPhase
+(
+    void
+)
+{
+    uint8_t dataIn[RPCBENCH_MAX_PAYLOAD];
+    uint8_t dataOut[RPCBENCH_MAX_PAYLOAD];
+    uint64_t totalUs = 0;
+
+    for (uint32_t i = 0; i < EchoSize; i++)
+    {
+        dataIn[i] = (uint8_t) i;
+    }
+
+    for (uint32_t i = 0; i < EchoCount; i++)
+    {
+        size_t dataOutSize = sizeof(dataOut);
+        le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+        rpcBench_Echo(dataIn, EchoSize, dataOut, &dataOutSize);
+
+        EchoLatencyUs[i] = (uint32_t) GetElapsedUs(startTime);
+        totalUs += EchoLatencyUs[i];
+
+        LE_FATAL_IF((dataOutSize != EchoSize) || (memcmp(dataIn, dataOut, EchoSize) != 0),
+                    "Echo payload mismatch, request %" PRIu32, i);
+    }
+
+    qsort(EchoLatencyUs, EchoCount, sizeof(EchoLatencyUs[0]), CompareLatency);
+
+    printf("Echo: %" PRIu32 " requests of %" PRIu32 " bytes, latency (us) "
+           "mean %" PRIu64 ", p50 %" PRIu32 ", p90 %" PRIu32 ", p99 %" PRIu32 ", max %" PRIu32 "\n",
+           EchoCount,
+           EchoSize,
+           totalUs / EchoCount,
+           GetPercentile(50),
+           GetPercentile(90),
+           GetPercentile(99),
+           EchoLatencyUs[EchoCount - 1]);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Phase 3: file stream.  Finishes when the server reports the end of the stream.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StreamDoneHandler
+(
+    uint64_t byteCount,
+    void* contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    uint64_t elapsedUs = GetElapsedUs(PhaseStartTime);
+
+    rpcBench_RemoveStreamDoneHandler(StreamDoneHandlerRef);
+
+    // Bytes per microsecond is (10^6 / 2^20) MB/s; keep two decimals
+    uint64_t centiMBps = (elapsedUs != 0) ? (byteCount * 100000000 / 1048576) / elapsedUs : 0;
+
+    printf("Stream: %" PRIu64 " of %" PRIu64 " bytes in %" PRIu64 " us, "
+           "%" PRIu64 ".%02" PRIu64 " MB/s\n",
+           byteCount,
+           StreamBytes,
+           elapsedUs,
+           centiMBps / 100,
+           centiMBps % 100);
+
+    printf("Done.  Memory pool high-water marks are logged by the RPC Proxy with the link "
+           "statistics.\n");
+
+    exit(byteCount == StreamBytes ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the stream phase: hand the read end of a pipe to the server, and fill the pipe.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunStreamPhase
+(
+    void
+)
+{
+    static uint8_t chunk[STREAM_CHUNK_SIZE];
+    int pipeFds[2];
+
+    LE_FATAL_IF(pipe(pipeFds) != 0, "Unable to create pipe, errno %d", errno);
+
+    memset(chunk, 0xA5, sizeof(chunk));
+
+    StreamDoneHandlerRef = rpcBench_AddStreamDoneHandler(StreamDoneHandler, NULL);
+    PhaseStartTime = le_clk_GetRelativeTime();
+
+    // The read end is closed locally once sent
+    rpcBench_SetStreamFd(pipeFds[0]);
+
+    // Blocking writes: the RPC Proxy drains the pipe from its own process
+    uint64_t remaining = StreamBytes;
+    while (remaining > 0)
+    {
+        size_t size = (remaining < sizeof(chunk)) ? (size_t) remaining : sizeof(chunk);
+        ssize_t written = write(pipeFds[1], chunk, size);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            LE_ERROR("Stream write failed, errno %d", errno);
+            break;
+        }
+        remaining -= written;
+    }
+
+    close(pipeFds[1]);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Phase 2: asynchronous Tick events.  Moves on to the stream phase once all ticks are received.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TickHandler
+(
+    uint32_t seq,
+    void* contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    if (seq != TickCount)
+    {
+        LE_WARN("Out-of-order tick, expected %" PRIu32 ", received %" PRIu32, TickCount, seq);
+    }
+
+    if (++TickCount < EventCount)
+    {
+        return;
+    }
+
+    uint64_t elapsedUs = GetElapsedUs(PhaseStartTime);
+
+    rpcBench_RemoveTickHandler(TickHandlerRef);
+
+    printf("Events: %" PRIu32 " in %" PRIu64 " us, %" PRIu64 " events/s\n",
+           EventCount,
+           elapsedUs,
+           (elapsedUs != 0) ? ((uint64_t) EventCount * 1000000) / elapsedUs : 0);
+
+    RunStreamPhase();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the event phase.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunEventPhase
+(
+    void
+)
+{
+    TickCount = 0;
+    TickHandlerRef = rpcBench_AddTickHandler(TickHandler, NULL);
+
+    PhaseStartTime = le_clk_GetRelativeTime();
+    rpcBench_StartTicks(EventCount);
+}
+
+COMPONENT_INIT
+{
+    EchoCount = (uint32_t) GetSetting("RPC_BENCH_ECHO_COUNT", 1000);
+    EchoSize = (uint32_t) GetSetting("RPC_BENCH_ECHO_SIZE", 256);
+    EventCount = (uint32_t) GetSetting("RPC_BENCH_EVENT_COUNT", 10000);
+    StreamBytes = GetSetting("RPC_BENCH_STREAM_BYTES", 4 * 1024 * 1024);
+
+    LE_FATAL_IF((EchoCount == 0) || (EchoCount > ECHO_COUNT_MAX),
+                "RPC_BENCH_ECHO_COUNT must be between 1 and %d", ECHO_COUNT_MAX);
+    LE_FATAL_IF(EchoSize > RPCBENCH_MAX_PAYLOAD,
+                "RPC_BENCH_ECHO_SIZE must be at most %d", RPCBENCH_MAX_PAYLOAD);
+    LE_FATAL_IF(EventCount == 0, "RPC_BENCH_EVENT_COUNT must not be zero");
+
+    RunEchoPhase();
+    RunEventPhase();
+}
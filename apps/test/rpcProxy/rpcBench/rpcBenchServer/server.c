@@ -0,0 +1,243 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file server.c
+ *
+ * Server side of the RPC Proxy benchmark.  Implements the rpcBench API, which is bound to the
+ * benchmark client on the far side through the RPC Proxy.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the buffer used to drain the stream.
+ */
+//--------------------------------------------------------------------------------------------------
+#define STREAM_READ_BUFFER_SIZE     4096
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Events reported to the client.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_event_Id_t TickEventId;
+static le_event_Id_t StreamDoneEventId;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of bytes read from the current stream.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t StreamByteCount;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Return the payload unchanged.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcBench_Echo
+(
+    const uint8_t* dataInPtr,
+    size_t dataInSize,
+    uint8_t* dataOutPtr,
+    size_t* dataOutSizePtr
+)
+{
+    if (dataInSize > *dataOutSizePtr)
+    {
+        dataInSize = *dataOutSizePtr;
+    }
+
+    memcpy(dataOutPtr, dataInPtr, dataInSize);
+    *dataOutSizePtr = dataInSize;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * First layer handler for the Tick event.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FirstLayerTickHandler
+(
+    void* reportPtr,
+    void* secondLayerHandlerFunc
+)
+{
+    rpcBench_TickHandlerFunc_t clientHandlerFunc = secondLayerHandlerFunc;
+
+    clientHandlerFunc(*((uint32_t*) reportPtr), le_event_GetContextPtr());
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a handler for the Tick event.
+ */
+//--------------------------------------------------------------------------------------------------
+rpcBench_TickHandlerRef_t rpcBench_AddTickHandler
+(
+    rpcBench_TickHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    le_event_HandlerRef_t handlerRef =
+        le_event_AddLayeredHandler("TickHandler",
+                                   TickEventId,
+                                   FirstLayerTickHandler,
+                                   (le_event_HandlerFunc_t) handlerPtr);
+    le_event_SetContextPtr(handlerRef, contextPtr);
+
+    return (rpcBench_TickHandlerRef_t) handlerRef;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove a handler for the Tick event.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcBench_RemoveTickHandler
+(
+    rpcBench_TickHandlerRef_t handlerRef
+)
+{
+    le_event_RemoveHandler((le_event_HandlerRef_t) handlerRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report a burst of Tick events.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcBench_StartTicks
+(
+    uint32_t count
+)
+{
+    LE_INFO("Reporting %" PRIu32 " ticks", count);
+
+    for (uint32_t seq = 0; seq < count; seq++)
+    {
+        le_event_Report(TickEventId, &seq, sizeof(seq));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * First layer handler for the StreamDone event.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FirstLayerStreamDoneHandler
+(
+    void* reportPtr,
+    void* secondLayerHandlerFunc
+)
+{
+    rpcBench_StreamDoneHandlerFunc_t clientHandlerFunc = secondLayerHandlerFunc;
+
+    clientHandlerFunc(*((uint64_t*) reportPtr), le_event_GetContextPtr());
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a handler for the StreamDone event.
+ */
+//--------------------------------------------------------------------------------------------------
+rpcBench_StreamDoneHandlerRef_t rpcBench_AddStreamDoneHandler
+(
+    rpcBench_StreamDoneHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    le_event_HandlerRef_t handlerRef =
+        le_event_AddLayeredHandler("StreamDoneHandler",
+                                   StreamDoneEventId,
+                                   FirstLayerStreamDoneHandler,
+                                   (le_event_HandlerFunc_t) handlerPtr);
+    le_event_SetContextPtr(handlerRef, contextPtr);
+
+    return (rpcBench_StreamDoneHandlerRef_t) handlerRef;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove a handler for the StreamDone event.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcBench_RemoveStreamDoneHandler
+(
+    rpcBench_StreamDoneHandlerRef_t handlerRef
+)
+{
+    le_event_RemoveHandler((le_event_HandlerRef_t) handlerRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler for fdMonitor on the stream.  Drains the stream and reports its end.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StreamFdMonitorHandler
+(
+    int fd,
+    short events
+)
+{
+    static uint8_t buffer[STREAM_READ_BUFFER_SIZE];
+    ssize_t bytesRead = 0;
+
+    if (events & POLLIN)
+    {
+        do
+        {
+            bytesRead = le_fd_Read(fd, buffer, sizeof(buffer));
+            if (bytesRead > 0)
+            {
+                StreamByteCount += bytesRead;
+            }
+        }
+        while (bytesRead > 0);
+    }
+
+    if ((bytesRead == 0) || (events & (POLLHUP | POLLERR | POLLRDHUP)))
+    {
+        LE_INFO("End of stream, %" PRIu64 " bytes", StreamByteCount);
+
+        le_fdMonitor_Delete(le_fdMonitor_GetMonitor());
+        le_fd_Close(fd);
+
+        le_event_Report(StreamDoneEventId, &StreamByteCount, sizeof(StreamByteCount));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start draining a stream.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcBench_SetStreamFd
+(
+    int fd
+)
+{
+    if (fd < 0)
+    {
+        LE_ERROR("Invalid stream fd received");
+        return;
+    }
+
+    // Drain the stream without blocking the event loop
+    le_fd_Fcntl(fd, F_SETFL, le_fd_Fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    StreamByteCount = 0;
+    le_fdMonitor_Create("rpcBenchStream", fd, StreamFdMonitorHandler, POLLIN | POLLRDHUP);
+}
+
+COMPONENT_INIT
+{
+    TickEventId = le_event_CreateId("Tick", sizeof(uint32_t));
+    StreamDoneEventId = le_event_CreateId("StreamDone", sizeof(uint64_t));
+}
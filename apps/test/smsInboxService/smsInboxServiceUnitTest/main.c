@@ -449,7 +449,7 @@ static void Simulate_smsInbox_cfgFileInit
 )
 {
     LE_INFO("Init Sms InBox cfg files");
-    char cfgCpCommand[512] = "cp -rf ";
+    char cfgCpCommand[512] = "mkdir -p" SIMU_CONF_PATH " && cp -rf ";
     LE_ASSERT_OK(le_utf8_Append(cfgCpCommand, smsCfgFilePath, sizeof(cfgCpCommand), NULL));
     strncat(cfgCpCommand, SIMU_CONF_PATH, MAX_SIMU_PATH_LEN);
     system(cfgCpCommand);
@@ -466,7 +466,7 @@ static void Simulate_smsInbox_msgFileInit
 )
 {
     LE_INFO("Init Sms InBox msg files");
-    char msgCpCommand[512]= "cp -rf ";
+    char msgCpCommand[512]= "mkdir -p" SIMU_MSG_PATH " && cp -rf ";
     LE_ASSERT_OK(le_utf8_Append(msgCpCommand, smsMsgFilePath, sizeof(msgCpCommand), NULL));
     strncat(msgCpCommand, SIMU_MSG_PATH, MAX_SIMU_PATH_LEN);
     system(msgCpCommand);
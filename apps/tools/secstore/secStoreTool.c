@@ -106,6 +106,10 @@ static void PrintHelp
         "\n"
         "    secstore total\n"
         "       Gets the total space and free space, in bytes, for all of secure storage.\n"
+        "\n"
+        "    secstore rescan\n"
+        "       Recomputes the space used by each client of secure storage, as accounted to\n"
+        "       enforce the clients' secure storage limits.\n"
         );
 
     exit(EXIT_SUCCESS);
@@ -441,6 +445,26 @@ static void PrintTotalSizes
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Rescans the space used by the clients of secure storage.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RescanUsage
+(
+    void
+)
+{
+    le_result_t result = secStoreAdmin_RescanUsage();
+
+    if (result != LE_OK)
+    {
+        INTERNAL_ERR("Could not rescan secure storage usage.  Result code %s.",
+                     LE_RESULT_TXT(result));
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Prints the contents of the meta file.
@@ -634,6 +658,10 @@ static void SetCommandHandler
     {
         CommandHandler = ReadMeta;
     }
+    else if (strcmp(argPtr, "rescan") == 0)
+    {
+        CommandHandler = RescanUsage;
+    }
     else
     {
         fprintf(stderr, "Unknown command.\n");
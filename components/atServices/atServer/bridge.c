@@ -8,6 +8,12 @@
 #include "interfaces.h"
 #include "bridge.h"
 #include "le_atServer_local.h"
+#include "le_dev.h"
+
+#if LE_CONFIG_LINUX
+#include <termios.h>
+#include <sys/ioctl.h>
+#endif
 
 //--------------------------------------------------------------------------------------------------
 // Symbol and Enum definitions.
@@ -28,6 +34,50 @@
 //--------------------------------------------------------------------------------------------------
 #define AT_CLIENT_TIMEOUT 5*60*1000
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the buffer used to read the modem in passthrough mode
+ */
+//--------------------------------------------------------------------------------------------------
+#define MODEM_READ_BYTES    1024
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Events monitored on the modem in passthrough mode
+ */
+//--------------------------------------------------------------------------------------------------
+#define MODEM_EVENTS        (POLLIN | POLLPRI | POLLRDHUP)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Data mode strings: the escape sequence sent by the host to come back in command mode, and the
+ * result code sent by the modem when the connection is over.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ESCAPE_SEQUENCE     "+++"
+#define NO_CARRIER_PATTERN  "\r\nNO CARRIER\r\n"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Final result code sent to the device when the modem hangs up during a command line
+ */
+//--------------------------------------------------------------------------------------------------
+#define ERROR_PATTERN       "\r\nERROR\r\n"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Duration of the DTR drop used to hang up the modem in data mode (in microseconds)
+ */
+//--------------------------------------------------------------------------------------------------
+#define HANGUP_DTR_DROP_US  100000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Result code switching to data mode
+ */
+//--------------------------------------------------------------------------------------------------
+#define CONNECT_CODE        "CONNECT"
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Responses codes definition
@@ -69,6 +119,18 @@ typedef struct
                                                                     ///< handler refenrece
     le_sem_Ref_t                                semRef;             ///< semaphore reference
     le_msg_SessionRef_t                         sessionRef;         ///< session reference
+    bool                                        passthrough;        ///< are the bytes relayed as
+                                                                    ///< they are to the modem
+    Device_t                                    modemDevice;        ///< modem device, in
+                                                                    ///< passthrough mode
+    BridgedMode_t                               state;              ///< passthrough state
+    le_atServer_DeviceRef_t                     ownerRef;           ///< device whose command line
+                                                                    ///< or data is relayed
+    char                                        line[LE_ATDEFS_RESPONSE_MAX_BYTES];
+                                                                    ///< current modem line
+    size_t                                      lineLen;            ///< current modem line length
+    size_t                                      noCarrierLen;       ///< NO CARRIER pattern length
+                                                                    ///< matched in data mode
 }
 BridgeCtx_t;
 
@@ -267,6 +329,15 @@ static void BridgePoolDestructor
         le_sem_Delete(bridgePtr->semRef);
     }
 
+    // Close the modem device
+    if (bridgePtr->passthrough)
+    {
+        le_dev_DeleteFdMonitoring(&bridgePtr->modemDevice);
+#if LE_CONFIG_LINUX
+        le_fd_Close(bridgePtr->modemDevice.fd);
+#endif /* end LE_CONFIG_LINUX */
+    }
+
     // Release devices list
     le_dls_Link_t* linkPtr = le_dls_Pop(&bridgePtr->devicesList);
 
@@ -880,6 +951,269 @@ static void UnsolicitedResponseHandler
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a modem line is a final result code
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsFinalRsp
+(
+    const char* linePtr
+)
+{
+    int i;
+
+    for (i = 0; i < NUM_ARRAY_MEMBERS(AllRspCode); i++)
+    {
+        if (0 == strncmp(linePtr, AllRspCode[i], strlen(AllRspCode[i])))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the state of a passthrough bridge, and the mode of the device relayed
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetPassthroughState
+(
+    BridgeCtx_t*  bridgePtr,
+    BridgedMode_t state
+)
+{
+    bridgePtr->state = state;
+    bridgePtr->noCarrierLen = 0;
+
+    if (bridgePtr->ownerRef)
+    {
+        if (LE_OK != le_atServer_SetBridgedMode(bridgePtr->ownerRef, state))
+        {
+            LE_ERROR("Unable to set the mode of %p", bridgePtr->ownerRef);
+        }
+    }
+
+    if (BRIDGED_MODE_NONE == state)
+    {
+        bridgePtr->ownerRef = NULL;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the modem when the device relayed is removed from a passthrough bridge: the call in
+ * progress is hung up by dropping DTR, and the bytes not yet relayed are flushed.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReleaseModem
+(
+    BridgeCtx_t* bridgePtr
+)
+{
+#if LE_CONFIG_LINUX
+    int fd = bridgePtr->modemDevice.fd;
+
+    if (isatty(fd))
+    {
+        if (BRIDGED_MODE_DATA == bridgePtr->state)
+        {
+            int dtr = TIOCM_DTR;
+
+            if (-1 == ioctl(fd, TIOCMBIC, &dtr))
+            {
+                LE_WARN("Unable to drop DTR: %s", LE_ERRNO_TXT(errno));
+            }
+            else
+            {
+                usleep(HANGUP_DTR_DROP_US);
+                ioctl(fd, TIOCMBIS, &dtr);
+            }
+        }
+
+        tcflush(fd, TCIOFLUSH);
+    }
+#endif /* end LE_CONFIG_LINUX */
+
+    bridgePtr->lineLen = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Relay modem bytes to the device which sent the command line in progress, if it is still linked
+ * to the bridge
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void RelayToOwner
+(
+    BridgeCtx_t* bridgePtr,
+    uint8_t*     dataPtr,
+    size_t       size
+)
+{
+    if ((0 == size) || (NULL == bridgePtr->ownerRef))
+    {
+        return;
+    }
+
+    if (LE_OK != le_atServer_WriteBridgedData(bridgePtr->ownerRef, dataPtr, size))
+    {
+        LE_ERROR("Error during relaying on %p", bridgePtr->ownerRef);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Treat the bytes read on the modem in passthrough mode.
+ *
+ * The bytes are relayed as they are while a command line or data mode is in progress. They are
+ * only scanned to detect the end of it: the final result code of the command line, or the
+ * NO CARRIER result code in data mode. Otherwise, the modem lines are unsolicited responses sent
+ * to all the devices of the bridge.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void RelayModemBytes
+(
+    BridgeCtx_t* bridgePtr,
+    uint8_t*     dataPtr,
+    size_t       size
+)
+{
+    static const char noCarrier[] = NO_CARRIER_PATTERN;
+    size_t start = 0;
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        char input = dataPtr[i];
+
+        if (BRIDGED_MODE_DATA == bridgePtr->state)
+        {
+            if (input == noCarrier[bridgePtr->noCarrierLen])
+            {
+                bridgePtr->noCarrierLen++;
+            }
+            else
+            {
+                bridgePtr->noCarrierLen = (input == noCarrier[0]) ? 1 : 0;
+            }
+
+            if (bridgePtr->noCarrierLen == sizeof(noCarrier) - 1)
+            {
+                RelayToOwner(bridgePtr, dataPtr + start, i + 1 - start);
+                start = i + 1;
+                SetPassthroughState(bridgePtr, BRIDGED_MODE_NONE);
+            }
+            continue;
+        }
+
+        if (input != '\n')
+        {
+            if ((input != '\r') && (bridgePtr->lineLen < sizeof(bridgePtr->line) - 1))
+            {
+                bridgePtr->line[bridgePtr->lineLen++] = input;
+            }
+        }
+        else if (bridgePtr->lineLen)
+        {
+            bridgePtr->line[bridgePtr->lineLen] = '\0';
+            bridgePtr->lineLen = 0;
+
+            if (BRIDGED_MODE_NONE == bridgePtr->state)
+            {
+                UnsolicitedResponseHandler(bridgePtr->line, bridgePtr);
+            }
+            else if (IsFinalRsp(bridgePtr->line))
+            {
+                RelayToOwner(bridgePtr, dataPtr + start, i + 1 - start);
+                start = i + 1;
+
+                if (0 == strncmp(bridgePtr->line, CONNECT_CODE, sizeof(CONNECT_CODE) - 1))
+                {
+                    SetPassthroughState(bridgePtr, BRIDGED_MODE_DATA);
+                }
+                else
+                {
+                    SetPassthroughState(bridgePtr, BRIDGED_MODE_NONE);
+                }
+            }
+        }
+
+        // Bytes of unsolicited responses are not relayed
+        if (BRIDGED_MODE_NONE == bridgePtr->state)
+        {
+            start = i + 1;
+        }
+    }
+
+    RelayToOwner(bridgePtr, dataPtr + start, size - start);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is called when data are available to be read on the modem in passthrough mode
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ModemRxHandler
+(
+    int fd,      ///< File descriptor to read on
+    short events ///< Event reported on fd
+)
+{
+    BridgeCtx_t* bridgePtr = le_fdMonitor_GetContextPtr();
+    uint8_t buffer[MODEM_READ_BYTES];
+
+    if (events & POLLRDHUP)
+    {
+        ssize_t size;
+
+        LE_INFO("fd %d: Connection reset by peer", fd);
+
+        // Relay what the modem sent before hanging up
+        while ((size = le_dev_Read(&bridgePtr->modemDevice, buffer, sizeof(buffer))) > 0)
+        {
+            RelayModemBytes(bridgePtr, buffer, size);
+        }
+
+        le_dev_DeleteFdMonitoring(&bridgePtr->modemDevice);
+
+        // The command line or data mode in progress can't end normally anymore
+        if (BRIDGED_MODE_COMMAND == bridgePtr->state)
+        {
+            RelayToOwner(bridgePtr, (uint8_t*)ERROR_PATTERN, sizeof(ERROR_PATTERN) - 1);
+            SetPassthroughState(bridgePtr, BRIDGED_MODE_NONE);
+        }
+        else if (BRIDGED_MODE_DATA == bridgePtr->state)
+        {
+            RelayToOwner(bridgePtr, (uint8_t*)NO_CARRIER_PATTERN, sizeof(NO_CARRIER_PATTERN) - 1);
+            SetPassthroughState(bridgePtr, BRIDGED_MODE_NONE);
+        }
+        return;
+    }
+
+    if (events & (POLLIN | POLLPRI))
+    {
+        ssize_t size = le_dev_Read(&bridgePtr->modemDevice, buffer, sizeof(buffer));
+
+        if (size > 0)
+        {
+            RelayModemBytes(bridgePtr, buffer, size);
+        }
+    }
+    else
+    {
+        LE_CRIT("Unexpected event(s) on fd %d (0x%hX).", fd, events);
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Thread used for the bridge
@@ -1095,6 +1429,166 @@ le_atServer_BridgeRef_t bridge_Open
     return bridgeCtxPtr->bridgeRef;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function opens a passthrough bridge with the modem: command lines and data are relayed
+ * as they are on the file descriptor, which is monitored in the calling thread.
+ *
+ * @return
+ *      - Reference to the requested bridge.
+ *      - NULL if the device is not available.
+ */
+//--------------------------------------------------------------------------------------------------
+le_atServer_BridgeRef_t bridge_OpenPassthrough
+(
+    int fd
+)
+{
+    BridgeCtx_t* bridgeCtxPtr = le_mem_ForceAlloc(BridgesPool);
+    memset(bridgeCtxPtr, 0, sizeof(BridgeCtx_t));
+
+    bridgeCtxPtr->bridgeRef = le_ref_CreateRef(BridgesRefMap, bridgeCtxPtr);
+    bridgeCtxPtr->devicesList = LE_DLS_LIST_INIT;
+    bridgeCtxPtr->mainThreadRef = le_thread_GetCurrent();
+    bridgeCtxPtr->passthrough = true;
+    bridgeCtxPtr->state = BRIDGED_MODE_NONE;
+
+    // fd now belongs to the bridge
+    bridgeCtxPtr->modemDevice.fd = fd;
+
+    if (LE_OK != le_dev_EnableFdMonitoring(&bridgeCtxPtr->modemDevice,
+                                           ModemRxHandler,
+                                           bridgeCtxPtr,
+                                           MODEM_EVENTS))
+    {
+        LE_ERROR("Error during modem monitoring");
+        le_mem_Release(bridgeCtxPtr);
+        return NULL;
+    }
+
+    bridgeCtxPtr->sessionRef = le_atServer_GetClientSessionRef();
+
+    return bridgeCtxPtr->bridgeRef;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a bridge is a passthrough bridge.
+ *
+ * @return
+ *      - true if the bridge relays the bytes as they are.
+ *      - false otherwise, or if the bridge is not found.
+ */
+//--------------------------------------------------------------------------------------------------
+bool bridge_IsPassthrough
+(
+    le_atServer_BridgeRef_t bridgeRef
+)
+{
+    BridgeCtx_t* bridgePtr = le_ref_Lookup(BridgesRefMap, bridgeRef);
+
+    return (bridgePtr && bridgePtr->passthrough);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a command line to the modem through a passthrough bridge. The modem responses are written
+ * on the device up to the final result code.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BUSY          The modem is in use by a device.
+ *      - LE_FAULT         The function failed to send the command line.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_SendCommandLine
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    le_atServer_DeviceRef_t deviceRef,
+    char*                   cmdLinePtr,
+    size_t                  size
+)
+{
+    BridgeCtx_t* bridgePtr = le_ref_Lookup(BridgesRefMap, bridgeRef);
+
+    if ((NULL == bridgePtr) || (!bridgePtr->passthrough) || (NULL == cmdLinePtr))
+    {
+        LE_ERROR("Bad parameter");
+        return LE_FAULT;
+    }
+
+    if (BRIDGED_MODE_NONE != bridgePtr->state)
+    {
+        LE_DEBUG("Modem in use by %p", bridgePtr->ownerRef);
+        return LE_BUSY;
+    }
+
+    if (NULL == bridgePtr->modemDevice.fdMonitor)
+    {
+        LE_ERROR("Modem hung up");
+        return LE_FAULT;
+    }
+
+    if (le_dev_Write(&bridgePtr->modemDevice, (uint8_t*)cmdLinePtr, size) != (int32_t)size)
+    {
+        LE_ERROR("Error during command line sending");
+        return LE_FAULT;
+    }
+
+    bridgePtr->ownerRef = deviceRef;
+    SetPassthroughState(bridgePtr, BRIDGED_MODE_COMMAND);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send the data received in data mode by a device to the modem, through a passthrough bridge.
+ *
+ * The escape sequence, received on its own, switches the device back to command mode: the final
+ * result code of the modem ends it.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_FAULT         The function failed to send the data.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_SendData
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    le_atServer_DeviceRef_t deviceRef,
+    uint8_t*                dataPtr,
+    size_t                  size
+)
+{
+    BridgeCtx_t* bridgePtr = le_ref_Lookup(BridgesRefMap, bridgeRef);
+
+    if ((NULL == bridgePtr) || (NULL == dataPtr))
+    {
+        LE_ERROR("Bad parameter");
+        return LE_FAULT;
+    }
+
+    if ((BRIDGED_MODE_DATA != bridgePtr->state) || (bridgePtr->ownerRef != deviceRef))
+    {
+        LE_ERROR("Device %p not in data mode", deviceRef);
+        return LE_FAULT;
+    }
+
+    if (le_dev_Write(&bridgePtr->modemDevice, dataPtr, size) != (int32_t)size)
+    {
+        LE_ERROR("Error during data sending");
+        return LE_FAULT;
+    }
+
+    if ((size == sizeof(ESCAPE_SEQUENCE) - 1) && (0 == memcmp(dataPtr, ESCAPE_SEQUENCE, size)))
+    {
+        SetPassthroughState(bridgePtr, BRIDGED_MODE_COMMAND);
+    }
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function closes an open bridge.
@@ -1211,6 +1705,15 @@ le_result_t bridge_RemoveDevice
         {
             le_dls_Remove(&bridgePtr->devicesList, linkPtr);
             le_mem_Release(devLinkPtr);
+
+            // The call in progress is over: nothing is relayed to the device anymore, and the
+            // modem is released for the other devices
+            if (bridgePtr->ownerRef == deviceRef)
+            {
+                bridgePtr->ownerRef = NULL;
+                ReleaseModem(bridgePtr);
+                SetPassthroughState(bridgePtr, BRIDGED_MODE_NONE);
+            }
             return LE_OK;
         }
 
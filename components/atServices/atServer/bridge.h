@@ -54,6 +54,71 @@ le_atServer_BridgeRef_t bridge_Open
     int fd
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function opens a passthrough bridge with the modem: command lines and data are relayed
+ * as they are on the file descriptor, which is monitored in the calling thread.
+ *
+ * @return
+ *      - Reference to the requested bridge.
+ *      - NULL if the device is not available.
+ */
+//--------------------------------------------------------------------------------------------------
+le_atServer_BridgeRef_t bridge_OpenPassthrough
+(
+    int fd
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a bridge is a passthrough bridge.
+ *
+ * @return
+ *      - true if the bridge relays the bytes as they are.
+ *      - false otherwise, or if the bridge is not found.
+ */
+//--------------------------------------------------------------------------------------------------
+bool bridge_IsPassthrough
+(
+    le_atServer_BridgeRef_t bridgeRef
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a command line to the modem through a passthrough bridge. The modem responses are written
+ * on the device up to the final result code.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BUSY          The modem is in use by a device.
+ *      - LE_FAULT         The function failed to send the command line.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_SendCommandLine
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    le_atServer_DeviceRef_t deviceRef,
+    char*                   cmdLinePtr,     ///< Command line, with its carriage return
+    size_t                  size
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send the data received in data mode by a device to the modem, through a passthrough bridge.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_FAULT         The function failed to send the data.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_SendData
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    le_atServer_DeviceRef_t deviceRef,
+    uint8_t*                dataPtr,
+    size_t                  size
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function closes an open bridge.
@@ -57,6 +57,13 @@
 //--------------------------------------------------------------------------------------------------
 #define RSP_STRING_TYPICAL_BYTES 24
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the buffer of batched responses
+ */
+//--------------------------------------------------------------------------------------------------
+#define RSP_BATCH_BYTES     (LE_ATDEFS_TEXT_MAX_BYTES + LE_ATDEFS_RESPONSE_MAX_BYTES)
+
 //--------------------------------------------------------------------------------------------------
 /**
  * User-defined error strings pool size
@@ -529,6 +536,19 @@ typedef struct
 }
 RspString_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Batched responses structure, holding the responses to be written on a device at once.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    size_t          len;                                    ///< number of bytes stored
+    char            buffer[RSP_BATCH_BYTES];                ///< responses to be written
+}
+RspBatch_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * RX parser state.
@@ -621,6 +641,9 @@ typedef struct
     bool                    isBasicCommand;                         ///< is a basic format command
     le_atServer_CommandHandlerFunc_t handlerFunc;                   ///< Handler associated with the
                                                                     ///< AT command
+    le_atServer_CommandWithParamsHandlerFunc_t paramsHandlerFunc;   ///< Handler receiving the
+                                                                    ///< parameters, associated with
+                                                                    ///< the AT command
     void*                   handlerContextPtr;                      ///< client handler context
 }
 ATCmdSubscribed_t;
@@ -707,8 +730,12 @@ typedef struct
                                                                   ///< over
     bool                    isFirstIntermediate;                  ///< is first intermediate sent
     RspState_t              rspState;                             ///< sending response state
+    RspBatch_t*             rspBatchPtr;                          ///< batched responses, NULL
+                                                                  ///< if responses are written
+                                                                  ///< when sent
 #if !MK_CONFIG_DISABLE_AT_BRIDGE
     le_atServer_BridgeRef_t bridgeRef;                            ///< bridge reference
+    BridgedMode_t           bridgedMode;                          ///< passthrough bridge mode
 #endif
     le_msg_SessionRef_t     sessionRef;                           ///< session reference
     bool                    suspended;                            ///< is device in data mode
@@ -820,6 +847,22 @@ LE_MEM_DEFINE_STATIC_POOL(RspString,
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t  RspStringPool;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Static pool for batched responses
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(RspBatch,
+                          DEVICE_POOL_SIZE,
+                          sizeof(RspBatch_t));
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool for batched responses
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t  RspBatchPool;
+
 #if LE_CONFIG_ATSERVER_USER_ERRORS
 //--------------------------------------------------------------------------------------------------
 /*
@@ -1074,10 +1117,51 @@ static void AtCmdPoolDestructor
     le_ref_DeleteRef(SubscribedCmdRefMap, cmdPtr->cmdRef);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the batched responses on the opened device.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_FAULT         The function failed to write the responses.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FlushRspBatch
+(
+    DeviceContext_t* devPtr
+)
+{
+    RspBatch_t* batchPtr = devPtr->rspBatchPtr;
+    int32_t lenWritten;
+
+    if (0 == batchPtr->len)
+    {
+        return LE_OK;
+    }
+
+    lenWritten = le_dev_Write(&devPtr->device, (uint8_t*) batchPtr->buffer, batchPtr->len);
+
+#ifdef LE_AT_FLUSH
+    le_fd_Ioctl(devPtr->device.fd, LE_AT_FLUSH, NULL);
+#endif
+
+    if (lenWritten < (int32_t)batchPtr->len)
+    {
+        LE_ERROR("Failed to send data");
+        batchPtr->len = 0;
+        return LE_FAULT;
+    }
+
+    batchPtr->len = 0;
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Send a response on the opened device.
  *
+ * If responses are batched on the device, the response is stored to be written with the others.
+ *
  * @return
  *      - LE_OK            The function succeeded.
  *      - LE_FAULT         The function failed to send response.
@@ -1106,6 +1190,22 @@ static le_result_t SendRspString
     }
 
     stringLen = strnlen(string, LE_ATDEFS_RESPONSE_MAX_BYTES);
+
+    if (devPtr->rspBatchPtr)
+    {
+        RspBatch_t* batchPtr = devPtr->rspBatchPtr;
+
+        if ((batchPtr->len + stringLen > sizeof(batchPtr->buffer)) &&
+            (LE_OK != FlushRspBatch(devPtr)))
+        {
+            return LE_FAULT;
+        }
+
+        memcpy(batchPtr->buffer + batchPtr->len, string, stringLen);
+        batchPtr->len += stringLen;
+        return LE_OK;
+    }
+
     strLenWritted = le_dev_Write(&devPtr->device, (uint8_t*) string, stringLen);
 
 #ifdef LE_AT_FLUSH
@@ -1232,6 +1332,27 @@ static void SendStoredURC
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * End the command line processing on the opened device, and send the backed-up unsolicited
+ * responses.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void EndProcessing
+(
+    DeviceContext_t* devPtr
+)
+{
+    devPtr->processing = false;
+
+    memset( &devPtr->cmdParser, 0, sizeof(CmdParser_t) );
+    memset( &devPtr->finalRsp, 0, sizeof(FinalRsp_t) );
+
+    // Send backup unsolicited responses
+    SendStoredURC(devPtr);
+}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -1363,23 +1484,7 @@ static le_result_t SendFinalRsp
     res = SendRspString(devPtr, devPtr->finalRsp.resp);
 
 end_processing:
-    devPtr->processing = false;
-
-    memset( &devPtr->cmdParser, 0, sizeof(CmdParser_t) );
-    memset( &devPtr->finalRsp, 0, sizeof(FinalRsp_t) );
-
-    // Send backup unsolicited responses
-    le_dls_Link_t* linkPtr;
-
-    while ( (linkPtr = le_dls_Pop(&devPtr->unsolicitedList)) != NULL )
-    {
-        RspString_t* rspStringPtr = CONTAINER_OF(linkPtr,
-                                    RspString_t,
-                                    link);
-
-        SendRspString(devPtr, rspStringPtr->resp);
-        le_mem_Release(rspStringPtr);
-    }
+    EndProcessing(devPtr);
 
     return res;
 }
@@ -1484,6 +1589,12 @@ static le_result_t CreateModemCommand
 {
     void* cmdDescRef = NULL;
 
+    if (bridge_IsPassthrough(bridgeRef))
+    {
+        LE_ERROR("Passthrough bridge: AT command not relayed");
+        return LE_FAULT;
+    }
+
     if ((bridge_Create(atCmdPtr, &cmdDescRef) != LE_OK )||(NULL == cmdDescRef))
     {
         LE_ERROR("Error in AT command creation");
@@ -1519,6 +1630,93 @@ static le_result_t CreateModemCommand
 
     return LE_OK;
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether the AT command at the current parsing position is subscribed by an application.
+ * The command name is resolved as the parser does: up to the first '=', '?' or ';' for an
+ * extended format command, and the longest subscribed name for a basic format command.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsCmdSubscribed
+(
+    CmdParser_t* cmdParserPtr
+)
+{
+    char atCmd[LE_ATDEFS_COMMAND_MAX_BYTES];
+    const char* charPtr = cmdParserPtr->currentAtCmdPtr;
+    size_t len = 0;
+    bool isBasic = ((cmdParserPtr->lastCharPtr - charPtr >= 2) && IS_BASIC(charPtr[2]));
+
+    while ((charPtr <= cmdParserPtr->lastCharPtr) && (len < sizeof(atCmd) - 1))
+    {
+        if ((*charPtr == AT_TOKEN_EQUAL) || (*charPtr == AT_TOKEN_QUESTIONMARK) ||
+            (*charPtr == AT_TOKEN_SEMICOLON) ||
+            (isBasic && (IS_NUMBER(*charPtr) || IS_QUOTE(*charPtr))))
+        {
+            break;
+        }
+
+        atCmd[len++] = toupper(*charPtr);
+        charPtr++;
+    }
+
+    // "AT" alone is answered by the server
+    if (len <= 2)
+    {
+        return true;
+    }
+
+    do
+    {
+        atCmd[len] = '\0';
+
+        ATCmdSubscribed_t* cmdPtr = le_hashmap_Get(CmdHashMap, atCmd);
+
+        // Commands created by a bridge are not treated by the server
+        if (cmdPtr && !cmdPtr->bridgeCmd)
+        {
+            return true;
+        }
+    }
+    while (isBasic && (--len > 2));
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send the command line, from the current parsing position, to the passthrough bridge.
+ *
+ * The modem responses are written as they are on the device, and the modem final result code
+ * ends the command line processing.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendCmdLineToBridge
+(
+    DeviceContext_t* devPtr
+)
+{
+    CmdParser_t* cmdParserPtr = &devPtr->cmdParser;
+    size_t size = cmdParserPtr->lastCharPtr - cmdParserPtr->currentAtCmdPtr + 2;
+
+    // The carriage return takes the place of the null character ending the command line
+    cmdParserPtr->lastCharPtr[1] = AT_TOKEN_CR;
+
+    if (bridge_SendCommandLine(devPtr->bridgeRef,
+                               devPtr->ref,
+                               cmdParserPtr->currentAtCmdPtr,
+                               size) != LE_OK)
+    {
+        LE_ERROR("Error during command line relaying");
+
+        devPtr->finalRsp.final = LE_ATSERVER_ERROR;
+        devPtr->finalRsp.customStringAvailable = false;
+        SendFinalRsp(devPtr);
+    }
+}
 #endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
 
 //--------------------------------------------------------------------------------------------------
@@ -2307,6 +2505,46 @@ static le_result_t ParseSemicolon
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack the parameters of an AT command into a buffer, each one followed by its null character.
+ *
+ * @return The number of bytes written into the buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t PackParameters
+(
+    ATCmdSubscribed_t* cmdPtr,  ///< [IN] AT command
+    uint8_t* bufferPtr,         ///< [OUT] Buffer for the packed parameters
+    size_t bufferSize           ///< [IN] Buffer size
+)
+{
+    size_t size = 0;
+    le_dls_Link_t* linkPtr = le_dls_Peek(&cmdPtr->paramList);
+
+    while (linkPtr)
+    {
+        ParamString_t* paramPtr = CONTAINER_OF(linkPtr, ParamString_t, link);
+        size_t paramSize = strnlen(paramPtr->param, LE_ATDEFS_PARAMETER_MAX_BYTES - 1) + 1;
+
+        if (size + paramSize > bufferSize)
+        {
+            // Can't happen as the parameters come from the AT command string, but the handler
+            // still gets the ones which fit.
+            LE_ERROR("Parameters of AT command '%s' truncated", cmdPtr->cmdName);
+            break;
+        }
+
+        memcpy(bufferPtr + size, paramPtr->param, paramSize - 1);
+        bufferPtr[size + paramSize - 1] = '\0';
+        size += paramSize;
+
+        linkPtr = le_dls_PeekNext(&cmdPtr->paramList, linkPtr);
+    }
+
+    return size;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * AT parser main function
@@ -2339,6 +2577,17 @@ static void ParseAtCmd
         return;
     }
 
+#if !MK_CONFIG_DISABLE_AT_BRIDGE
+    // Unknown AT commands are relayed to a passthrough bridge, along with the rest of the command
+    // line
+    if (devPtr->bridgeRef && bridge_IsPassthrough(devPtr->bridgeRef) &&
+        !IsCmdSubscribed(cmdParserPtr))
+    {
+        SendCmdLineToBridge(devPtr);
+        return;
+    }
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
+
     while (( cmdParserPtr->cmdParser != PARSE_SEMICOLON ) &&
            ( cmdParserPtr->cmdParser != PARSE_LAST ))
     {
@@ -2487,6 +2736,18 @@ static void ParseAtCmd
                                    le_dls_NumLinks(&(cmdPtr->paramList)),
                                    cmdPtr->handlerContextPtr );
         }
+        else if (cmdPtr->paramsHandlerFunc)
+        {
+            uint8_t parameters[LE_ATDEFS_PARAMETERS_MAX_BYTES];
+            size_t parametersSize = PackParameters(cmdPtr, parameters, sizeof(parameters));
+
+            (cmdPtr->paramsHandlerFunc)( cmdPtr->cmdRef,
+                                         cmdPtr->type,
+                                         le_dls_NumLinks(&(cmdPtr->paramList)),
+                                         parameters,
+                                         parametersSize,
+                                         cmdPtr->handlerContextPtr );
+        }
         else
         {
             // Command exists, but no handler associate to it
@@ -2678,6 +2939,36 @@ static void ReceiveCmd
     ParseBuffer(devPtr);
 }
 
+#if !MK_CONFIG_DISABLE_AT_BRIDGE
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function handles receiving data in data mode, to relay them to the passthrough bridge
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReceiveBridgedData
+(
+    DeviceContext_t *devPtr
+)
+{
+    uint8_t buffer[LE_ATDEFS_COMMAND_MAX_BYTES];
+    ssize_t size;
+
+    size = le_dev_Read(&devPtr->device, buffer, sizeof(buffer));
+
+    if (0 >= size)
+    {
+        LE_DEBUG("Read data size %zd.", size);
+        return;
+    }
+
+    if (bridge_SendData(devPtr->bridgeRef, devPtr->ref, buffer, size) != LE_OK)
+    {
+        LE_ERROR("Error during data relaying");
+    }
+}
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function removes a backspace and the character before it
@@ -2909,6 +3200,14 @@ __attribute__((unused)) static void RxNewData
 
     if (events & (POLLIN | POLLPRI))
     {
+#if !MK_CONFIG_DISABLE_AT_BRIDGE
+        if (BRIDGED_MODE_DATA == devPtr->bridgedMode)
+        {
+            LE_DEBUG("Receiving data");
+            ReceiveBridgedData(devPtr);
+            return;
+        }
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
 #if LE_CONFIG_ATSERVER_TEXT_API
         if (devPtr->text.mode)
         {
@@ -3037,6 +3336,7 @@ static le_result_t CloseServer
     // Remove from bridge
     if (devPtr->bridgeRef)
     {
+        devPtr->bridgedMode = BRIDGED_MODE_NONE;
         le_atServer_RemoveDeviceFromBridge(devRef, devPtr->bridgeRef);
     }
 #endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
@@ -3279,6 +3579,12 @@ le_result_t le_atServer_UnlinkDeviceFromBridge
 
     if (devPtr->bridgeRef == bridgeRef)
     {
+        if (BRIDGED_MODE_NONE != devPtr->bridgedMode)
+        {
+            devPtr->bridgedMode = BRIDGED_MODE_NONE;
+            EndProcessing(devPtr);
+        }
+
         devPtr->bridgeRef = NULL;
         return LE_OK;
     }
@@ -3290,6 +3596,98 @@ le_result_t le_atServer_UnlinkDeviceFromBridge
 #endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function sets the mode of a device linked to a passthrough bridge.
+ *
+ * The device is busy until it comes back to BRIDGED_MODE_NONE: the received AT commands are
+ * rejected and the unsolicited responses are stored.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_FAULT         The function failed to set the mode.
+ *
+ * @note
+ *  This function internal, not exposed as API
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atServer_SetBridgedMode
+(
+    le_atServer_DeviceRef_t deviceRef,
+    BridgedMode_t           mode
+)
+{
+#if MK_CONFIG_DISABLE_AT_BRIDGE
+    return LE_FAULT;
+#else /* !MK_CONFIG_DISABLE_AT_BRIDGE */
+    DeviceContext_t* devPtr = le_ref_Lookup(DevicesRefMap, deviceRef);
+
+    if ((devPtr == NULL) || (devPtr->bridgeRef == NULL))
+    {
+        LE_ERROR("Bad reference");
+        return LE_FAULT;
+    }
+
+    devPtr->bridgedMode = mode;
+
+    switch (mode)
+    {
+        case BRIDGED_MODE_NONE:
+            EndProcessing(devPtr);
+            break;
+
+        case BRIDGED_MODE_DATA:
+            // The command line is over, but the device remains busy until the end of data mode
+            memset( &devPtr->cmdParser, 0, sizeof(CmdParser_t) );
+            memset( &devPtr->finalRsp, 0, sizeof(FinalRsp_t) );
+            devPtr->indexRead = devPtr->parseIndex = 0;
+            devPtr->processing = true;
+            break;
+
+        default:
+            devPtr->processing = true;
+            break;
+    }
+
+    return LE_OK;
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function writes bytes relayed by a passthrough bridge on a device, as they are.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_FAULT         The function failed to write the bytes.
+ *
+ * @note
+ *  This function internal, not exposed as API
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atServer_WriteBridgedData
+(
+    le_atServer_DeviceRef_t deviceRef,
+    uint8_t*                dataPtr,
+    size_t                  size
+)
+{
+    DeviceContext_t* devPtr = le_ref_Lookup(DevicesRefMap, deviceRef);
+
+    if (devPtr == NULL)
+    {
+        LE_ERROR("Bad reference");
+        return LE_FAULT;
+    }
+
+    if (le_dev_Write(&devPtr->device, dataPtr, size) != (int32_t)size)
+    {
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -3369,7 +3767,12 @@ le_result_t le_atServer_Close
         return LE_BAD_PARAMETER;
     }
 
-    if (devPtr->processing)
+    // A device only waiting for a passthrough bridge can be closed: the bridge releases the modem
+    if ((devPtr->processing)
+#if !MK_CONFIG_DISABLE_AT_BRIDGE
+        && (BRIDGED_MODE_NONE == devPtr->bridgedMode)
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
+       )
     {
         LE_ERROR("Device busy");
         return LE_BUSY;
@@ -3500,7 +3903,7 @@ static bool CallCmdRegistrationHandler
     }
 
     const ATCmdSubscribed_t* cmdPtr = valuePtr;
-    if (!cmdPtr->handlerFunc)
+    if ((!cmdPtr->handlerFunc) && (!cmdPtr->paramsHandlerFunc))
     {
         LE_WARN("AT command '%s' does not have a handler", (char*)keyPtr);
         return true;
@@ -3598,7 +4001,7 @@ le_atServer_CommandHandlerRef_t le_atServer_AddCommandHandler
         return NULL;
     }
 
-    if (cmdPtr->handlerFunc)
+    if ((cmdPtr->handlerFunc) || (cmdPtr->paramsHandlerFunc))
     {
         LE_INFO("Handler already exists");
         return NULL;
@@ -3637,6 +4040,72 @@ void le_atServer_RemoveCommandHandler
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add handler function for EVENT 'le_atServer_CommandWithParams'
+ *
+ * This event provides information when the AT command is detected, along with its parameters.
+ */
+//--------------------------------------------------------------------------------------------------
+le_atServer_CommandWithParamsHandlerRef_t le_atServer_AddCommandWithParamsHandler
+(
+    le_atServer_CmdRef_t commandRef,
+        ///< [IN] AT command reference
+
+    le_atServer_CommandWithParamsHandlerFunc_t handlerPtr,
+        ///< [IN]
+
+    void* contextPtr
+        ///< [IN]
+)
+{
+    ATCmdSubscribed_t* cmdPtr = le_ref_Lookup(SubscribedCmdRefMap, commandRef);
+
+    if (!cmdPtr)
+    {
+        LE_ERROR("Bad command reference");
+        return NULL;
+    }
+
+    if ((cmdPtr->handlerFunc) || (cmdPtr->paramsHandlerFunc))
+    {
+        LE_INFO("Handler already exists");
+        return NULL;
+    }
+
+    cmdPtr->paramsHandlerFunc = handlerPtr;
+    cmdPtr->handlerContextPtr = contextPtr;
+
+    // Register to the platform that the atServer will handle that command
+    // (it may be not used depending on the platform)
+    le_event_Report(CmdRegId, &commandRef, sizeof(le_atServer_CmdRef_t));
+
+    return (le_atServer_CommandWithParamsHandlerRef_t)(cmdPtr->cmdRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove handler function for EVENT 'le_atServer_CommandWithParams'
+ */
+//--------------------------------------------------------------------------------------------------
+void le_atServer_RemoveCommandWithParamsHandler
+(
+    le_atServer_CommandWithParamsHandlerRef_t handlerRef
+        ///< [IN]
+)
+{
+    if (handlerRef)
+    {
+        ATCmdSubscribed_t* cmdPtr = le_ref_Lookup(SubscribedCmdRefMap, handlerRef);
+
+        if (cmdPtr)
+        {
+            cmdPtr->paramsHandlerFunc = NULL;
+            cmdPtr->handlerContextPtr = NULL;
+        }
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function can be used to get the parameters of a received AT command.
@@ -3939,6 +4408,119 @@ le_result_t le_atServer_SendFinalResultCode
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function can be used to send intermediate responses and the final result code at once.
+ *
+ * The responses are written on the device together, along with any response sent meanwhile
+ * (e.g. by the next concatenated commands, or stored unsolicited responses).
+ *
+ * @return
+ *      - LE_OK            The function succeeded
+ *      - LE_FAULT         The function failed to send the responses
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atServer_SendResponses
+(
+    le_atServer_CmdRef_t commandRef,
+        ///< [IN] AT command reference
+
+    const char* intermediateRspPtr,
+        ///< [IN] Intermediate responses to be sent, separated by '\n'
+
+    le_atServer_FinalRsp_t final,
+        ///< [IN] Final result code to be sent
+
+    const char* patternPtr,
+        ///< [IN] Prefix string of the return message
+
+    uint32_t errorCode
+        ///< [IN] Numeric error code
+)
+{
+    ATCmdSubscribed_t* cmdPtr = le_ref_Lookup(SubscribedCmdRefMap, commandRef);
+
+    if (NULL == cmdPtr)
+    {
+        LE_ERROR("Bad command reference");
+        return LE_FAULT;
+    }
+
+    le_atServer_DeviceRef_t deviceRef = cmdPtr->deviceRef;
+    DeviceContext_t* devPtr = le_ref_Lookup(DevicesRefMap, deviceRef);
+
+    if (NULL == devPtr)
+    {
+        LE_ERROR("Bad device reference");
+        return LE_FAULT;
+    }
+
+    le_result_t res = LE_OK;
+    RspBatch_t* batchPtr = NULL;
+
+    // Responses sent by a handler called meanwhile join the current batch, if any
+    if (NULL == devPtr->rspBatchPtr)
+    {
+        batchPtr = le_mem_ForceAlloc(RspBatchPool);
+        batchPtr->len = 0;
+        devPtr->rspBatchPtr = batchPtr;
+    }
+
+    if (!cmdPtr->processing)
+    {
+        LE_ERROR("Command not processing");
+        res = LE_FAULT;
+    }
+    else if (NULL != intermediateRspPtr)
+    {
+        const char* linePtr = intermediateRspPtr;
+
+        devPtr->rspState = AT_RSP_INTERMEDIATE;
+
+        while ((LE_OK == res) && ('\0' != *linePtr))
+        {
+            char rsp[LE_ATDEFS_RESPONSE_MAX_BYTES];
+            size_t lineLen = strcspn(linePtr, "\n");
+            size_t rspLen = (lineLen < sizeof(rsp)) ? lineLen : sizeof(rsp) - 1;
+
+            memcpy(rsp, linePtr, rspLen);
+            rsp[rspLen] = '\0';
+
+            res = SendRspString(devPtr, rsp);
+
+            linePtr += lineLen;
+            if ('\n' == *linePtr)
+            {
+                linePtr++;
+            }
+        }
+    }
+
+    // The final result code has to be sent even if the intermediate responses failed
+    if (LE_OK != le_atServer_SendFinalResultCode(commandRef, final, patternPtr, errorCode))
+    {
+        res = LE_FAULT;
+    }
+
+    if (batchPtr)
+    {
+        // The device may have been closed by a handler called meanwhile
+        devPtr = le_ref_Lookup(DevicesRefMap, deviceRef);
+        if ((NULL != devPtr) && (batchPtr == devPtr->rspBatchPtr))
+        {
+            if (LE_OK != FlushRspBatch(devPtr))
+            {
+                res = LE_FAULT;
+            }
+            devPtr->rspBatchPtr = NULL;
+        }
+        le_mem_Release(batchPtr);
+    }
+
+    return res;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function can be used to send the unsolicited response.
@@ -4087,6 +4669,38 @@ le_atServer_BridgeRef_t le_atServer_OpenBridge
     return bridgeRef;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function opens a AT commands server passthrough bridge.
+ * All unknown AT commands, along with the rest of their command line, are written as they are on
+ * this alternative file descriptor, and the responses read on it are written as they are on the
+ * device, up to the final result code. The CONNECT result code switches the device to data mode,
+ * until the NO CARRIER result code or the "+++" escape sequence.
+ *
+ * @return
+ *      - Reference to the requested bridge.
+ *      - NULL if the device can't be bridged
+ */
+//--------------------------------------------------------------------------------------------------
+le_atServer_BridgeRef_t le_atServer_OpenPassthroughBridge
+(
+    int fd
+        ///< [IN] File descriptor.
+)
+{
+    le_atServer_BridgeRef_t bridgeRef = NULL;
+
+#if !MK_CONFIG_DISABLE_AT_BRIDGE
+    bridgeRef = bridge_OpenPassthrough(fd);
+    if (bridgeRef == NULL)
+    {
+        LE_ERROR("Error during bridge creation");
+    }
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
+
+    return bridgeRef;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function closes an opened bridge.
@@ -4190,9 +4804,10 @@ le_result_t le_atServer_RemoveDeviceFromBridge
         return LE_FAULT;
     }
 
-    if (devPtr->cmdParser.currentCmdPtr
-        && devPtr->cmdParser.currentCmdPtr->processing
-        && devPtr->cmdParser.currentCmdPtr->bridgeCmd)
+    if ((devPtr->cmdParser.currentCmdPtr
+         && devPtr->cmdParser.currentCmdPtr->processing
+         && devPtr->cmdParser.currentCmdPtr->bridgeCmd)
+        || (BRIDGED_MODE_NONE != devPtr->bridgedMode))
     {
         return LE_BUSY;
     }
@@ -4477,6 +5092,11 @@ COMPONENT_INIT
                                              "RspSmallStringPool",
                                              0, sizeof(RspString_t) + RSP_STRING_TYPICAL_BYTES);
 
+    // Batched responses pool allocation
+    RspBatchPool = le_mem_InitStaticPool(RspBatch,
+                                         DEVICE_POOL_SIZE,
+                                         sizeof(RspBatch_t));
+
 #if LE_CONFIG_ATSERVER_USER_ERRORS
     // User-defined errors pool allocation
     UserErrorPool = le_mem_InitStaticPool(UserError,
@@ -57,6 +57,19 @@
 //--------------------------------------------------------------------------------------------------
 #define IS_BASIC(X)           (IS_CHAR(X) || IS_AND(X) || IS_SLASH(X))
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mode of a device linked to a passthrough bridge.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    BRIDGED_MODE_NONE,      ///< AT commands are treated by the server
+    BRIDGED_MODE_COMMAND,   ///< Command line relayed to the modem, waiting for its final result
+    BRIDGED_MODE_DATA       ///< Data mode: all the bytes are relayed to and from the modem
+}
+BridgedMode_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function gets the bridge reference on a AT command in progress.
@@ -93,4 +106,44 @@ le_result_t le_atServer_UnlinkDeviceFromBridge
     le_atServer_BridgeRef_t bridgeRef
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function sets the mode of a device linked to a passthrough bridge.
+ *
+ * The device is busy until it comes back to BRIDGED_MODE_NONE: the received AT commands are
+ * rejected and the unsolicited responses are stored.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_FAULT         The function failed to set the mode.
+ *
+ * @note
+ *  This function internal, not exposed as API
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atServer_SetBridgedMode
+(
+    le_atServer_DeviceRef_t deviceRef,
+    BridgedMode_t           mode
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function writes bytes relayed by a passthrough bridge on a device, as they are.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_FAULT         The function failed to write the bytes.
+ *
+ * @note
+ *  This function internal, not exposed as API
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atServer_WriteBridgedData
+(
+    le_atServer_DeviceRef_t deviceRef,
+    uint8_t*                dataPtr,
+    size_t                  size
+);
+
 #endif //LEGATO_LE_ATSERVER_LOCAL_INCLUDE_GUARD
@@ -88,6 +88,8 @@ typedef struct {
     bool                        pause;              ///< pause in capture
     le_audio_MediaEvent_t       mediaEvent;         ///< media event to be sent
     int                         framesFuncTimeout;  ///< Timeout for getFramesFunc callback
+    bool                        isFile;             ///< fd is a regular file, read until its end
+    uint32_t                    fileDataLen;        ///< Length of file data left to play
 }
 le_audio_PcmContext_t;
 
@@ -203,6 +205,7 @@ typedef struct le_audio_Stream {
     le_audio_DtmfStreamEventHandlerRef_t dtmfEventHandler; ///< Dtmf stream event handler
     le_thread_Ref_t     mediaThreadRef;                 ///< Media thread reference
     bool                playFile;                      ///< Stream plays a file
+    uint32_t            wavDataLen;                    ///< Length of the data chunk of a WAV file
     int8_t              deviceIdentifier;              ///< Device identifier
     int8_t              hwDeviceId;                    ///< Hardware Device identifier
     pa_audio_Params_t   PaParams;                      ///< PA Parameters
@@ -15,7 +15,7 @@
 #include "pa_audio.h"
 #include "pa_amr.h"
 #include "pa_pcm.h"
-#include <math.h>
+#include "toneGenerator.h"
 
 //--------------------------------------------------------------------------------------------------
 // Symbol and Enum definitions.
@@ -33,11 +33,7 @@
  * Values used for DTMF sampling.
  */
 //--------------------------------------------------------------------------------------------------
-#define SAMPLE_SCALE    (32767)
 #define DTMF_AMPLITUDE  (40)
-#if !defined (PI)
-#define PI 3.14159265358979323846264338327
-#endif
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -287,6 +283,22 @@ static ssize_t WriteFd
     return tempBufSize;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a file descriptor refers to a regular file.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsRegularFile
+(
+    int fd                                ///<[IN] File descriptor.
+)
+{
+    struct stat st;
+
+    return ((fstat(fd, &st) == 0) && S_ISREG(st.st_mode));
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Return the low frequency component of a DTMF character.
@@ -381,34 +393,6 @@ static inline uint32_t Digit2HighFreq
     }
 }
 
-//--------------------------------------------------------------------------------------------------
-/**
- *  Add two 16-bit values.
- *
- */
-//--------------------------------------------------------------------------------------------------
-static inline int16_t SaturateAdd16
-(
-    int32_t a,
-    int32_t b
-)
-{
-    int32_t tot=a+b;
-
-    if (tot > 32767)
-    {
-        return 32767;
-    }
-    else if (tot < -32768)
-    {
-        return -32768;
-    }
-    else
-    {
-        return (tot & 0xFFFF);
-    }
-}
-
 //--------------------------------------------------------------------------------------------------
 /**
  *  Play Tone function. This function split into samples of 1s. To play a DTMF or a PAUSE for a
@@ -423,9 +407,6 @@ static le_result_t PlayTone
     uint32_t*                      bufferLenPtr  ///< [OUT] Length of the buffer
 )
 {
-    double   d1, d2;
-    uint32_t i;
-
     DtmfParams_t*  dtmfParamsPtr = (DtmfParams_t*) mediaCtxPtr->codecParams;
     // Max samples on the whole duration
     uint32_t samplesCount;
@@ -433,8 +414,6 @@ static le_result_t PlayTone
     uint32_t sampleOneSecond = dtmfParamsPtr->sampleRate + dtmfParamsPtr->currentSampleCount;
     uint32_t freq1;
     uint32_t freq2;
-    int32_t  amp1;
-    int32_t  amp2;
     int16_t* dataPtr = (int16_t*) bufferOutPtr;
     // Length of the current sample: max 1 second, i.e, sampleRate
     uint32_t sampleLength;
@@ -490,26 +469,18 @@ static le_result_t PlayTone
 
         freq1 = Digit2LowFreq(dtmfParamsPtr->dtmf[dtmfParamsPtr->currentDtmf]);
         freq2 = Digit2HighFreq(dtmfParamsPtr->dtmf[dtmfParamsPtr->currentDtmf]);
-        amp1 = DTMF_AMPLITUDE;
-        amp2 = DTMF_AMPLITUDE;
 
-        d1 = 1.0f * freq1 / dtmfParamsPtr->sampleRate;
-        d2 = 1.0f * freq2 / dtmfParamsPtr->sampleRate;
+        // Play max sampleRate (1s) of DTMF and continue at next call
+        toneGenerator_Dual(dataPtr, sampleLength, dtmfParamsPtr->currentSampleCount,
+                           dtmfParamsPtr->sampleRate, freq1, DTMF_AMPLITUDE,
+                           freq2, DTMF_AMPLITUDE);
 
-        for (i = dtmfParamsPtr->currentSampleCount;
-             // Play max sampleRate (1s) of DTMF and continue at next call
-             (i < sampleOneSecond) && (i < samplesCount);
-             i++)
+        // Save the current sample count. If the whole DTMF is played, reset to 0
+        dtmfParamsPtr->currentSampleCount += sampleLength;
+        if (dtmfParamsPtr->currentSampleCount >= samplesCount)
         {
-            int16_t s1, s2;
-
-            s1 = (int16_t)(SAMPLE_SCALE * amp1 / 100.0f * sin(2 * PI * d1 * i));
-            s2 = (int16_t)(SAMPLE_SCALE * amp2 / 100.0f * sin(2 * PI * d2 * i));
-            *(dataPtr++) = SaturateAdd16(s1, s2);
+            dtmfParamsPtr->currentSampleCount = 0;
         }
-
-        // Save the current sample count. If the whole DTMF is played, reset to 0
-        dtmfParamsPtr->currentSampleCount = (i == samplesCount ? 0 : i);
         if (0 == dtmfParamsPtr->currentSampleCount)
         {
             // Update the index of DTMF if the current sample count is reset to 0
@@ -872,8 +843,6 @@ static void* MediaThread
 
     while (1)
     {
-        memset(outBuffer,0,mediaCtxPtr->bufferSize);
-
         /* read/decode the packet */
         if ( ( mediaCtxPtr->readFunc( mediaCtxPtr,
                                       outBuffer,
@@ -1027,6 +996,7 @@ static le_result_t PlayWavFile
     samplePcmConfigPtr->sampleRate = hdr.sampleRate;
     samplePcmConfigPtr->channelsCount = hdr.channelsCount;
     samplePcmConfigPtr->bitsPerSample = hdr.bitsPerSample;
+    streamPtr->wavDataLen = hdr.dataSize;
 
     mediaContextPtr->initFunc = InitPlayWavFile;
     mediaContextPtr->readFunc = MediaReadFd;
@@ -1475,9 +1445,29 @@ static le_result_t GetPlaybackFrames
                 }
                 else if (pfd.revents & POLLIN)
                 {
-                    len = read(pcmContextPtr->fd, bufferPtr + amount, size);
+                    uint32_t readLen = size;
+
+                    if (pcmContextPtr->isFile && (readLen > pcmContextPtr->fileDataLen))
+                    {
+                        // Don't play what follows the data chunk of a WAV file
+                        readLen = pcmContextPtr->fileDataLen;
+                    }
+
+                    len = (readLen ? read(pcmContextPtr->fd, bufferPtr + amount, readLen) : 0);
 
-                    if (len == 0)
+                    if ((len == 0) && pcmContextPtr->isFile)
+                    {
+                        // End of the file: no more samples, as when the media thread closes the
+                        // pipe
+                        LE_DEBUG("End of file %d", pcmContextPtr->fd);
+                        if (amount)
+                        {
+                            *bufsizePtr = amount;
+                            return LE_OK;
+                        }
+                        return LE_CLOSED;
+                    }
+                    else if (len == 0)
                     {
                         LE_ERROR("Failed to read on fd %d, writing end of pipe was closed",
                                  pcmContextPtr->fd);
@@ -1485,6 +1475,10 @@ static le_result_t GetPlaybackFrames
                     }
                     else if (len > 0)
                     {
+                        if (pcmContextPtr->isFile)
+                        {
+                            pcmContextPtr->fileDataLen -= len;
+                        }
                         size -= len;
                         amount += len;
                         *bufsizePtr = amount;
@@ -1746,6 +1740,14 @@ le_result_t le_media_Open
                 // Check amr format
                 res = PlayAmrFile(streamPtr, samplePcmConfigPtr, mediaCtxPtr, &format);
             }
+            else if (IsRegularFile(streamPtr->fd))
+            {
+                // The PCM samples of a WAV file don't need to be decoded: the playback reads them
+                // directly from the file, without a media thread copying them through a pipe.
+                LE_DEBUG("Play WAV file fd.%d without media thread", streamPtr->fd);
+                le_mem_Release(mediaCtxPtr);
+                return LE_OK;
+            }
 
             if (res == LE_OK)
             {
@@ -1885,6 +1887,10 @@ le_result_t le_media_PlaySamples
     memset(pcmContextPtr, 0, sizeof(le_audio_PcmContext_t));
 
     pcmContextPtr->fd = streamPtr->fd;
+    pcmContextPtr->isFile = IsRegularFile(streamPtr->fd);
+    // A WAV file read without media thread ends with its data chunk, other files with their end
+    pcmContextPtr->fileDataLen = (pcmContextPtr->isFile && streamPtr->playFile) ?
+                                 streamPtr->wavDataLen : UINT32_MAX;
 
     samplePcmConfigPtr->byteRate = (  samplePcmConfigPtr->sampleRate *
                                       samplePcmConfigPtr->channelsCount *
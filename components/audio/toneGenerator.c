@@ -0,0 +1,186 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file toneGenerator.c
+ *
+ * This file contains the tone generator used by the media service to synthesize DTMFs.
+ *
+ * Each sine wave is computed by the recurrence sin(w(n + 1)) = 2cos(w)sin(wn) - sin(w(n - 1)),
+ * so that only a multiply and a subtract are needed per sample instead of a call to sin(). The
+ * samples are computed by TONE_LANES interleaved recurrences of step TONE_LANES * w, which have no
+ * dependency between each other: the inner loops can then be vectorized by the compiler.
+ *
+ * The recurrences are seeded again with sin() every TONE_SEGMENT_SIZE samples, which bounds the
+ * rounding error accumulated in single precision to about one unit.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "toneGenerator.h"
+#include <math.h>
+
+//--------------------------------------------------------------------------------------------------
+// Symbol and Enum definitions.
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of interleaved recurrences per wave.
+ */
+//--------------------------------------------------------------------------------------------------
+#define TONE_LANES      4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of samples computed by recurrence between two seeds. Must be a multiple of TONE_LANES.
+ */
+//--------------------------------------------------------------------------------------------------
+#define TONE_SEGMENT_SIZE   1024
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Full scale of the 16-bit samples.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SAMPLE_SCALE    (32767)
+
+#if !defined (PI)
+#define PI 3.14159265358979323846264338327
+#endif
+
+//--------------------------------------------------------------------------------------------------
+// Data structures.
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sine wave oscillator: lane k holds the samples (firstSample + k + TONE_LANES * m).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    float coef;                 ///< 2cos(TONE_LANES * w)
+    float cur[TONE_LANES];      ///< Current sample of each lane
+    float prev[TONE_LANES];     ///< Previous sample of each lane
+}
+Oscillator_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Seed an oscillator at a given sample.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InitOscillator
+(
+    Oscillator_t*  oscPtr,        ///< [OUT] Oscillator
+    uint32_t       firstSample,   ///< [IN] Index of the first sample
+    uint32_t       sampleRate,    ///< [IN] Sample frequency in Hertz
+    uint32_t       freq,          ///< [IN] Frequency in Hertz
+    uint32_t       amp            ///< [IN] Amplitude in percent
+)
+{
+    double w = 2 * PI * freq / sampleRate;
+    double scale = SAMPLE_SCALE * amp / 100.0;
+    int k;
+
+    oscPtr->coef = (float)(2 * cos(TONE_LANES * w));
+
+    for (k = 0; k < TONE_LANES; k++)
+    {
+        double n = (double)firstSample + k;
+
+        oscPtr->cur[k] = (float)(scale * sin(w * n));
+        oscPtr->prev[k] = (float)(scale * sin(w * (n - TONE_LANES)));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute TONE_LANES samples of the sum of two oscillators, and step them.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline void ComputeLanes
+(
+    Oscillator_t*  osc1Ptr,       ///< [INOUT] First oscillator
+    Oscillator_t*  osc2Ptr,       ///< [INOUT] Second oscillator
+    int16_t*       bufferPtr      ///< [OUT] Samples buffer, of TONE_LANES samples
+)
+{
+    int k;
+
+    for (k = 0; k < TONE_LANES; k++)
+    {
+        float next1 = osc1Ptr->coef * osc1Ptr->cur[k] - osc1Ptr->prev[k];
+        float next2 = osc2Ptr->coef * osc2Ptr->cur[k] - osc2Ptr->prev[k];
+
+        // The sum of the amplitudes is within the full scale: no saturation is needed
+        bufferPtr[k] = (int16_t)(osc1Ptr->cur[k] + osc2Ptr->cur[k]);
+
+        osc1Ptr->prev[k] = osc1Ptr->cur[k];
+        osc1Ptr->cur[k] = next1;
+        osc2Ptr->prev[k] = osc2Ptr->cur[k];
+        osc2Ptr->cur[k] = next2;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//                                       Public declarations
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate 16-bit samples of the sum of two sine waves.
+ *
+ * Sample n of the output is the value at (firstSample + n) of each wave, so that a tone longer
+ * than a buffer can be generated by successive calls. The amplitudes are given in percent of the
+ * full scale, and their sum must not exceed 100.
+ */
+//--------------------------------------------------------------------------------------------------
+void toneGenerator_Dual
+(
+    int16_t*  bufferPtr,     ///< [OUT] Samples buffer
+    uint32_t  samplesCount,  ///< [IN] Number of samples to generate
+    uint32_t  firstSample,   ///< [IN] Index of the first sample in the tone
+    uint32_t  sampleRate,    ///< [IN] Sample frequency in Hertz
+    uint32_t  freq1,         ///< [IN] Frequency of the first wave in Hertz
+    uint32_t  amp1,          ///< [IN] Amplitude of the first wave in percent
+    uint32_t  freq2,         ///< [IN] Frequency of the second wave in Hertz
+    uint32_t  amp2           ///< [IN] Amplitude of the second wave in percent
+)
+{
+    Oscillator_t osc1;
+    Oscillator_t osc2;
+    uint32_t segmentCount;
+    int k;
+
+    LE_ASSERT((amp1 + amp2) <= 100);
+
+    if (0 == sampleRate)
+    {
+        memset(bufferPtr, 0, samplesCount * sizeof(int16_t));
+        return;
+    }
+
+    for (; samplesCount > 0; samplesCount -= segmentCount)
+    {
+        segmentCount = (samplesCount > TONE_SEGMENT_SIZE) ? TONE_SEGMENT_SIZE : samplesCount;
+
+        InitOscillator(&osc1, firstSample, sampleRate, freq1, amp1);
+        InitOscillator(&osc2, firstSample, sampleRate, freq2, amp2);
+        firstSample += segmentCount;
+
+        for (k = 0; (k + TONE_LANES) <= segmentCount; k += TONE_LANES)
+        {
+            ComputeLanes(&osc1, &osc2, bufferPtr + k);
+        }
+
+        // Last samples of the buffer, fewer than TONE_LANES
+        for (; k < segmentCount; k++)
+        {
+            bufferPtr[k] = (int16_t)(osc1.cur[k % TONE_LANES] + osc2.cur[k % TONE_LANES]);
+        }
+
+        bufferPtr += segmentCount;
+    }
+}
@@ -0,0 +1,32 @@
+/** @file toneGenerator.h
+ *
+ * Tone generator used by the media service to synthesize DTMFs.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LEGATO_TONEGENERATOR_INCLUDE_GUARD
+#define LEGATO_TONEGENERATOR_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate 16-bit samples of the sum of two sine waves.
+ *
+ * Sample n of the output is the value at (firstSample + n) of each wave, so that a tone longer
+ * than a buffer can be generated by successive calls. The amplitudes are given in percent of the
+ * full scale, and their sum must not exceed 100.
+ */
+//--------------------------------------------------------------------------------------------------
+void toneGenerator_Dual
+(
+    int16_t*  bufferPtr,     ///< [OUT] Samples buffer
+    uint32_t  samplesCount,  ///< [IN] Number of samples to generate
+    uint32_t  firstSample,   ///< [IN] Index of the first sample in the tone
+    uint32_t  sampleRate,    ///< [IN] Sample frequency in Hertz
+    uint32_t  freq1,         ///< [IN] Frequency of the first wave in Hertz
+    uint32_t  amp1,          ///< [IN] Amplitude of the first wave in percent
+    uint32_t  freq2,         ///< [IN] Frequency of the second wave in Hertz
+    uint32_t  amp2           ///< [IN] Amplitude of the second wave in percent
+);
+
+#endif // LEGATO_TONEGENERATOR_INCLUDE_GUARD
@@ -75,6 +75,26 @@
 //--------------------------------------------------------------------------------------------------
 #define RESPONSE_BUFFER_SIZE        1024
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * HTTP response buffer size when the response body is written to a file descriptor. On Linux,
+ * larger blocks are read to reduce the number of system calls.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_LINUX
+#define STREAM_BUFFER_SIZE          16384
+#else
+#define STREAM_BUFFER_SIZE          RESPONSE_BUFFER_SIZE
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of the request body sent from a file descriptor at each step of the state machine,
+ * so that asynchronous requests don't hold the event loop for too long.
+ */
+//--------------------------------------------------------------------------------------------------
+#define BODY_FD_STEP_SIZE           65536
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -83,6 +103,14 @@
 //--------------------------------------------------------------------------------------------------
 #define HEAD_CMD_ENDED              2
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * HTTP status codes of responses which never have a body
+ */
+//--------------------------------------------------------------------------------------------------
+#define HTTP_NO_CONTENT             204
+#define HTTP_NOT_MODIFIED           304
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Enum for HTTP client state machine
@@ -125,6 +153,21 @@ typedef struct
                                                    ///< or explicit name of the remote server
     uint16_t            port;                      ///< HTTP server port numeric number (0-65535)
     bool                isSecure;                  ///< True if the session is secure
+    bool                isConnected;               ///< True if the socket is connected
+    uint32_t            connectionCount;           ///< Connections opened since the session start
+    bool                keepAlive;                 ///< True to keep the connection open between
+                                                   ///< requests
+    bool                isCloseRequested;          ///< True if the server closes the connection
+                                                   ///< after the current response
+    bool                isBodyUntilClose;          ///< True if the current response body ends
+                                                   ///< when the server closes the connection
+    int                 bodyFd;                    ///< File descriptor to read the request body
+                                                   ///< from, -1 to use bodyConstructCb
+    size_t              bodyFdLen;                 ///< Size of the body to read from bodyFd
+    size_t              bodyFdSentLen;             ///< Size of the body already sent from bodyFd
+    int                 bodyResponseFd;            ///< File descriptor to write the response body
+                                                   ///< to, -1 to use bodyResponseCb
+    bool                isBodyResponseFdError;     ///< True if writing to bodyResponseFd failed
     char                credential[CRED_MAX_LEN];  ///< "Login:Password to be used during connection
     le_httpCommand_t    command;                   ///< Command of current HTTP request
     le_result_t         result;                    ///< Result of current HTTP request
@@ -193,6 +236,20 @@ const char* SyntaxHttpCommandPtr[] =
 //--------------------------------------------------------------------------------------------------
 LE_MEM_DEFINE_STATIC_POOL(HttpContextPool, HTTP_SESSIONS_NB, sizeof(HttpSessionCtx_t));
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool for the buffers of response bodies written to a file descriptor.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(StreamBufferPool, HTTP_SESSIONS_NB, STREAM_BUFFER_SIZE);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool reference for the buffers of response bodies written to a file descriptor.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t StreamBufferPoolRef = NULL;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Static memory pool for tinyHTTP component
@@ -259,6 +316,8 @@ static HttpSessionCtx_t* NewHttpSessionContext
 
     // Zero-init HTTP session context
     memset(contextPtr, 0, sizeof(HttpSessionCtx_t));
+    contextPtr->bodyFd = -1;
+    contextPtr->bodyResponseFd = -1;
 
     // Create a safe reference for this object
     contextPtr->reference = le_ref_CreateRef(HttpSessionRefMap, contextPtr);
@@ -343,7 +402,29 @@ static void TinyHttpBodyRspCb
         return;
     }
 
-    if (contextPtr->bodyResponseCb)
+    if (contextPtr->bodyResponseFd >= 0)
+    {
+        // Write the body data as is, the rest of the response is still parsed if this fails
+        while ((size > 0) && (!contextPtr->isBodyResponseFdError))
+        {
+            ssize_t count = le_fd_Write(contextPtr->bodyResponseFd, dataPtr, size);
+            if (count > 0)
+            {
+                dataPtr += count;
+                size -= count;
+            }
+            else if ((count < 0) && (EINTR == errno))
+            {
+                continue;
+            }
+            else
+            {
+                LE_ERROR("Unable to write body: %d, %s", errno, LE_ERRNO_TXT(errno));
+                contextPtr->isBodyResponseFdError = true;
+            }
+        }
+    }
+    else if (contextPtr->bodyResponseCb)
     {
         contextPtr->bodyResponseCb(opaquePtr, dataPtr, size);
     }
@@ -370,6 +451,13 @@ static void TinyHttpHeaderRspCb
         return;
     }
 
+    // Check whether the server closes the connection after this response
+    if ((nkey == sizeof("Connection") - 1) && (0 == strncasecmp(keyPtr, "Connection", nkey)) &&
+        (nvalue == sizeof("close") - 1) && (0 == strncasecmp(valuePtr, "close", nvalue)))
+    {
+        contextPtr->isCloseRequested = true;
+    }
+
     if (contextPtr->headerResponseCb)
     {
         contextPtr->headerResponseCb(opaquePtr, keyPtr, nkey, valuePtr, nvalue);
@@ -506,6 +594,18 @@ static le_result_t BuildAndSendRequest
         return LE_FAULT;
     }
 
+    if (contextPtr->keepAlive)
+    {
+        int fieldLength = snprintf(buffer + length, sizeof(buffer) - length,
+                                   "Connection: keep-alive\r\n");
+        if ((fieldLength < 0) || (fieldLength >= (sizeof(buffer) - length)))
+        {
+            LE_ERROR("Unable to construct request line");
+            return LE_FAULT;
+        }
+        length += fieldLength;
+    }
+
     // Save HTTP command request for later use
     contextPtr->command = command;
 
@@ -651,6 +751,20 @@ end:
     // Append a final CRLF if needed
     if (status == LE_TERMINATED)
     {
+        // Announce the size of a body sent from a file descriptor
+        if ((contextPtr->bodyFd >= 0) &&
+            ((contextPtr->command == HTTP_POST) || (contextPtr->command == HTTP_PUT)))
+        {
+            int fieldLength = snprintf(buffer + length, sizeof(buffer) - length,
+                                       "Content-Length: %zu\r\n", contextPtr->bodyFdLen);
+            if ((fieldLength < 0) || (fieldLength >= (sizeof(buffer) - length)))
+            {
+                LE_ERROR("Unable to construct header field");
+                return LE_FAULT;
+            }
+            length += fieldLength;
+        }
+
         if ((length + sizeof(CRLF)) > sizeof(buffer))
         {
             LE_ERROR("Unable to append CRLF");
@@ -671,6 +785,54 @@ end:
     return status;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send the next part of the HTTP body from the file descriptor set by the user, without copying it
+ * in an intermediate buffer.
+ *
+ * @return
+ *  - LE_OK            Function success, part of the body sent
+ *  - LE_TERMINATED    End of body
+ *  - LE_FAULT         Internal error, or end of file reached before the announced body size
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SendBodyFromFd
+(
+    HttpSessionCtx_t*    contextPtr   ///< [IN] HTTP session context pointer
+)
+{
+    size_t length = contextPtr->bodyFdLen - contextPtr->bodyFdSentLen;
+    le_result_t status;
+
+    if (length > BODY_FD_STEP_SIZE)
+    {
+        length = BODY_FD_STEP_SIZE;
+    }
+
+    if (length)
+    {
+        size_t sentLength = length;
+
+        status = le_socket_SendFromFd(contextPtr->socketRef, contextPtr->bodyFd, &sentLength);
+        if (LE_OK != status)
+        {
+            LE_ERROR("Unable to transmit body: %d", status);
+            return LE_FAULT;
+        }
+
+        if (sentLength < length)
+        {
+            LE_ERROR("End of file after %zu bytes of %zu", contextPtr->bodyFdSentLen + sentLength,
+                     contextPtr->bodyFdLen);
+            return LE_FAULT;
+        }
+
+        contextPtr->bodyFdSentLen += sentLength;
+    }
+
+    return (contextPtr->bodyFdSentLen < contextPtr->bodyFdLen) ? LE_OK : LE_TERMINATED;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Retrieve user-defined HTTP body chunk and send it through socket.
@@ -691,6 +853,11 @@ static le_result_t BuildAndSendBody
     int length = sizeof(buffer);
     le_result_t status;
 
+    if (contextPtr->bodyFd >= 0)
+    {
+        return SendBodyFromFd(contextPtr);
+    }
+
     if (!contextPtr->bodyConstructCb)
     {
         return LE_UNAVAILABLE;
@@ -726,6 +893,91 @@ static le_result_t BuildAndSendBody
     return status;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether the body of the current response must be read once its header is parsed.
+ *
+ * @return
+ *  - True if a body follows the header, false otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsBodyExpected
+(
+    HttpSessionCtx_t*    contextPtr   ///< [IN] HTTP session context pointer
+)
+{
+    struct http_roundtripper* handlerPtr = &(contextPtr->tinyHttpCtx.handler);
+
+    if ((HTTP_HEAD == contextPtr->command) ||
+        (HTTP_NO_CONTENT == handlerPtr->code) ||
+        (HTTP_NOT_MODIFIED == handlerPtr->code))
+    {
+        return false;
+    }
+
+    // Chunked body, body of Content-Length bytes, or body up to the connection close if the
+    // length is unknown
+    return (handlerPtr->chunked || (handlerPtr->contentlength != 0));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close the connection with the remote server, if it is open.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t CloseConnection
+(
+    HttpSessionCtx_t*    contextPtr   ///< [IN] HTTP session context pointer
+)
+{
+    if (!contextPtr->isConnected)
+    {
+        return LE_OK;
+    }
+
+    contextPtr->isConnected = false;
+    return le_socket_Disconnect(contextPtr->socketRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the connection with the remote server again before a request, if it has been closed while
+ * the connection is kept alive.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - Connection error code otherwise, see @ref le_httpClient_Start
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReopenConnection
+(
+    HttpSessionCtx_t*    contextPtr   ///< [IN] HTTP session context pointer
+)
+{
+    le_result_t status;
+
+    if ((!contextPtr->keepAlive) || (contextPtr->isConnected))
+    {
+        return LE_OK;
+    }
+
+    LE_INFO("Reconnecting to %s:%d", contextPtr->host, contextPtr->port);
+
+    contextPtr->isConnected = true;
+    contextPtr->connectionCount++;
+    status = le_socket_Connect(contextPtr->socketRef);
+    if (LE_OK != status)
+    {
+        CloseConnection(contextPtr);
+    }
+
+    return status;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Read and parse remote server response.
@@ -743,7 +995,7 @@ static le_result_t HandleHttpResponse
 {
     TinyHttpCtx_t* tinyCtxPtr = &(contextPtr->tinyHttpCtx);
     char buffer[RESPONSE_BUFFER_SIZE] = {0};
-    const char* data = buffer;
+    char* bufferPtr = buffer;
     size_t length = sizeof(buffer);
     le_result_t status;
     int needmore = 1;
@@ -760,15 +1012,42 @@ static le_result_t HandleHttpResponse
 
         http_init(&tinyCtxPtr->handler, responseFuncs, contextPtr->reference);
         tinyCtxPtr->isInit = true;
+        contextPtr->isCloseRequested = false;
+        contextPtr->isBodyUntilClose = false;
+        contextPtr->isBodyResponseFdError = false;
+    }
+
+    // Bodies written to a file descriptor are read by larger blocks
+    if (contextPtr->bodyResponseFd >= 0)
+    {
+        if (!StreamBufferPoolRef)
+        {
+            StreamBufferPoolRef = le_mem_InitStaticPool(StreamBufferPool,
+                                                        HTTP_SESSIONS_NB,
+                                                        STREAM_BUFFER_SIZE);
+        }
+
+        bufferPtr = le_mem_TryAlloc(StreamBufferPoolRef);
+        if (bufferPtr)
+        {
+            length = STREAM_BUFFER_SIZE;
+        }
+        else
+        {
+            bufferPtr = buffer;
+        }
     }
 
-    status = le_socket_Read(contextPtr->socketRef, buffer, &length);
+    const char* data = bufferPtr;
+
+    status = le_socket_Read(contextPtr->socketRef, bufferPtr, &length);
     if (status != LE_OK)
     {
         if (status == LE_WOULD_BLOCK)
         {
             LE_DEBUG("Socket would block");
-            return LE_OK;
+            status = LE_OK;
+            goto release;
         }
 
         LE_ERROR("Error receiving data");
@@ -777,6 +1056,15 @@ static le_result_t HandleHttpResponse
 
     if (!length)
     {
+        // Without Content-Length nor chunked transfer encoding, the body ends with the connection
+        if (contextPtr->isBodyUntilClose)
+        {
+            LE_DEBUG("Connection closed, end of body");
+            contextPtr->isCloseRequested = true;
+            status = LE_TERMINATED;
+            goto end;
+        }
+
         LE_ERROR("No data received");
         status = LE_FAULT;
         goto end;
@@ -786,18 +1074,17 @@ static le_result_t HandleHttpResponse
     {
         int read;
         needmore = http_data(&tinyCtxPtr->handler, data, (int)length, &read);
-        // If data read equals HEAD size but body is expected due to
-        // HTTP_GET command, then continue to read remaining data.
+        // Once the header is parsed, the response ends there unless a body is expected. In that
+        // case, the remaining data are parsed as the body, whose end is detected by the parser
+        // from the Content-Length or the chunked transfer encoding.
         if (HEAD_CMD_ENDED == needmore)
         {
-            if ((HTTP_GET == contextPtr->command ||
-                HTTP_POST == contextPtr->command ||
-                HTTP_PUT == contextPtr->command ||
-                HTTP_DELETE == contextPtr->command) &&
-                tinyCtxPtr->handler.contentlength > 0)
+            if (IsBodyExpected(contextPtr))
             {
-                LE_DEBUG("HTTP_HEAD response received, continue reading data");
-                break;
+                LE_DEBUG("HTTP header received, continue reading body");
+                contextPtr->isBodyUntilClose = ((!tinyCtxPtr->handler.chunked) &&
+                                                (tinyCtxPtr->handler.contentlength < 0));
+                needmore = 1;
             }
             else
             {
@@ -812,7 +1099,8 @@ static le_result_t HandleHttpResponse
     // Need to read more data from socket
     if (needmore)
     {
-        return LE_OK;
+        status = LE_OK;
+        goto release;
     }
 
     // Check for HTTP parsing result
@@ -823,12 +1111,24 @@ static le_result_t HandleHttpResponse
         goto end;
     }
 
+    if (contextPtr->isBodyResponseFdError)
+    {
+        status = LE_FAULT;
+        goto end;
+    }
+
     // At this point, HTTP response has been totally read and processed correctly
     status = LE_TERMINATED;
 
 end:
     http_free(&tinyCtxPtr->handler);
     tinyCtxPtr->isInit = false;
+
+release:
+    if (bufferPtr != buffer)
+    {
+        le_mem_Release(bufferPtr);
+    }
     return status;
 }
 
@@ -865,7 +1165,22 @@ static void HttpClientStateMachine
     {
         LE_INFO("Connection closed by remote server");
 
-        le_socket_Disconnect(socketRef);
+        // The last bytes of the response may come along with the closing, and a body may even end
+        // with it: parse what is left before closing, the response is only an error if it is
+        // still incomplete
+        if (contextPtr->state == STATE_RESP_PARSE)
+        {
+            do
+            {
+                status = HandleHttpResponse(contextPtr);
+            }
+            while (status == LE_OK);
+
+            contextPtr->state = STATE_END;
+            contextPtr->result = (status == LE_TERMINATED) ? LE_OK : status;
+        }
+
+        CloseConnection(contextPtr);
 
         if (contextPtr->eventCb)
         {
@@ -881,7 +1196,7 @@ static void HttpClientStateMachine
             }
         }
 
-        if (contextPtr->state != STATE_IDLE)
+        if ((contextPtr->state != STATE_IDLE) && (contextPtr->state != STATE_END))
         {
             contextPtr->result = LE_FAULT;
             contextPtr->state = STATE_END;
@@ -1023,6 +1338,17 @@ static void HttpClientStateMachine
 
                 contextPtr->state = STATE_IDLE;
 
+                // A request body file descriptor is only used by one request
+                contextPtr->bodyFd = -1;
+
+                // A kept-alive connection is reused by the next request, unless the server closes
+                // it or the end of the exchange is unknown
+                if ((contextPtr->keepAlive) &&
+                    ((contextPtr->isCloseRequested) || (LE_OK != contextPtr->result)))
+                {
+                    CloseConnection(contextPtr);
+                }
+
                 if (contextPtr->timerRef)
                 {
                     le_timer_Stop(contextPtr->timerRef);
@@ -1307,6 +1633,88 @@ le_result_t le_httpClient_SetCredentials
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enable or disable keeping the connection alive between requests. By default, the connection is
+ * not kept alive.
+ *
+ * When enabled, requests ask the server to keep the connection open, and the next request reuses
+ * it. If a request fails, or if the server closes the connection after its response, the next
+ * request opens it again.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_httpClient_SetKeepAlive
+(
+    le_httpClient_Ref_t    ref,       ///< [IN] HTTP session context reference
+    bool                   enable     ///< [IN] True to keep the connection alive, false otherwise
+)
+{
+    HttpSessionCtx_t *contextPtr = (HttpSessionCtx_t *)le_ref_Lookup(HttpSessionRefMap, ref);
+    if (contextPtr == NULL)
+    {
+        LE_ERROR("Reference not found: %p", ref);
+        return LE_BAD_PARAMETER;
+    }
+
+    contextPtr->keepAlive = enable;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of connections opened with the server since the session was started: with
+ * keep-alive enabled, it only increases when a connection has to be opened again.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_httpClient_GetConnectionCount
+(
+    le_httpClient_Ref_t    ref,       ///< [IN] HTTP session context reference
+    uint32_t*              countPtr   ///< [OUT] Number of connections
+)
+{
+    HttpSessionCtx_t *contextPtr = (HttpSessionCtx_t *)le_ref_Lookup(HttpSessionRefMap, ref);
+    if ((contextPtr == NULL) || (countPtr == NULL))
+    {
+        LE_ERROR("Invalid parameter: %p, %p", ref, countPtr);
+        return LE_BAD_PARAMETER;
+    }
+
+    *countPtr = contextPtr->connectionCount;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether the current connection of a secure session resumed the TLS session of a previous
+ * connection to the same server.
+ *
+ * @return
+ *  - True if the TLS session was resumed, false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+bool le_httpClient_IsSessionResumed
+(
+    le_httpClient_Ref_t    ref        ///< [IN] HTTP session context reference
+)
+{
+    HttpSessionCtx_t *contextPtr = (HttpSessionCtx_t *)le_ref_Lookup(HttpSessionRefMap, ref);
+    if (contextPtr == NULL)
+    {
+        LE_ERROR("Reference not found: %p", ref);
+        return false;
+    }
+
+    return ((contextPtr->isSecure) && (le_socket_IsSessionResumed(contextPtr->socketRef)));
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Add a certificate to the HTTP session in order to make the connection secure
@@ -1373,6 +1781,8 @@ le_result_t le_httpClient_Start
         return LE_BAD_PARAMETER;
     }
 
+    contextPtr->isConnected = true;
+    contextPtr->connectionCount = 1;
     return le_socket_Connect(contextPtr->socketRef);
 }
 
@@ -1399,7 +1809,7 @@ le_result_t le_httpClient_Stop
     }
 
     contextPtr->state = STATE_IDLE;
-    return le_socket_Disconnect(contextPtr->socketRef);
+    return CloseConnection(contextPtr);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1441,6 +1851,13 @@ le_result_t le_httpClient_SendRequest
         return LE_BUSY;
     }
 
+    status = ReopenConnection(contextPtr);
+    if (LE_OK != status)
+    {
+        LE_ERROR("Unable to reconnect");
+        return status;
+    }
+
     status = BuildAndSendRequest(contextPtr, command, requestUriPtr);
     if (LE_OK != status)
     {
@@ -1594,6 +2011,86 @@ le_result_t le_httpClient_SetBodyConstructCallback
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set a file descriptor to read the body of the next POST or PUT request from, instead of calling
+ * the body construct callback. The body is sent without being copied in intermediate buffers: on
+ * non-secure sessions, it goes directly from the file descriptor to the socket when the file
+ * descriptor allows it (e.g. a regular file).
+ *
+ * @note
+ *  - The body is read from the current offset of the file descriptor, and a Content-Length header
+ *    is added to the request.
+ *  - The file descriptor is only used by the next request, and is not closed.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_BUSY          Busy handling a request
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_httpClient_SetBodyFd
+(
+    le_httpClient_Ref_t  ref,       ///< [IN] HTTP session context reference
+    int                  fd,        ///< [IN] File descriptor to read the body from
+    size_t               length     ///< [IN] Body size
+)
+{
+    HttpSessionCtx_t *contextPtr = (HttpSessionCtx_t *)le_ref_Lookup(HttpSessionRefMap, ref);
+    if (contextPtr == NULL)
+    {
+        LE_ERROR("Reference not found: %p", ref);
+        return LE_BAD_PARAMETER;
+    }
+
+    if (fd < 0)
+    {
+        LE_ERROR("Wrong parameter: %d", fd);
+        return LE_BAD_PARAMETER;
+    }
+
+    if (contextPtr->state != STATE_IDLE)
+    {
+        LE_ERROR("Busy handling previous request. Current state: %d", contextPtr->state);
+        return LE_BUSY;
+    }
+
+    contextPtr->bodyFd = fd;
+    contextPtr->bodyFdLen = length;
+    contextPtr->bodyFdSentLen = 0;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set a file descriptor to write the HTTP response bodies to, instead of calling the body response
+ * callback. Set -1 to use the callback again.
+ *
+ * @note The file descriptor is not closed. If writing to it fails, the rest of the response is
+ *       still read, and the request fails.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_httpClient_SetBodyResponseFd
+(
+    le_httpClient_Ref_t  ref,       ///< [IN] HTTP session context reference
+    int                  fd         ///< [IN] File descriptor to write the body to, or -1
+)
+{
+    HttpSessionCtx_t *contextPtr = (HttpSessionCtx_t *)le_ref_Lookup(HttpSessionRefMap, ref);
+    if (contextPtr == NULL)
+    {
+        LE_ERROR("Reference not found: %p", ref);
+        return LE_BAD_PARAMETER;
+    }
+
+    contextPtr->bodyResponseFd = (fd < 0) ? -1 : fd;
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set callback to get HTTP asynchronous events.
@@ -1721,6 +2218,13 @@ void le_httpClient_SendRequestAsync
         goto end;
     }
 
+    status = ReopenConnection(contextPtr);
+    if (LE_OK != status)
+    {
+        LE_ERROR("Unable to reconnect");
+        goto end;
+    }
+
     status = BuildAndSendRequest(contextPtr, command, requestUriPtr);
     if (LE_OK != status)
     {
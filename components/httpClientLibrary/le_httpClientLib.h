@@ -69,6 +69,11 @@
  * These callbacks are not mandatory. Also, it is possible to remove a previously registered
  * callback by putting @c NULL in the callback argument.
  *
+ * Large bodies can be streamed through file descriptors instead: @ref le_httpClient_SetBodyFd sets
+ * a file to send as the body of the next POST or PUT request, and
+ * @ref le_httpClient_SetBodyResponseFd a file to write response bodies to. On non-secure sessions,
+ * the request body is then sent by the kernel directly from the file to the socket when possible.
+ *
  * Example code:
  * @snippet "apps/test/httpServices/httpIntegrationTest/httpTestComponent/httpTest.c" HttpStatusCb
  * @snippet "apps/test/httpServices/httpIntegrationTest/httpTestComponent/httpTest.c" HttpSetCb
@@ -82,6 +87,13 @@
  * A default timeout of 10 sec is implemented to prevent infinite wait. This duration can be
  * modified by calling @ref le_httpClient_SetTimeout API.
  *
+ * Several requests can be sent once the session is started. To avoid a new connection, and a new
+ * TLS handshake for secure sessions, for each of them, call @ref le_httpClient_SetKeepAlive: the
+ * connection is then kept open between requests, and opened again by the next request if the
+ * previous one failed or if the server closed the connection after its response.
+ * @ref le_httpClient_GetConnectionCount and @ref le_httpClient_IsSessionResumed tell how often
+ * the connection was opened again, and whether the TLS session was then resumed.
+ *
  * Workflow example when all callbacks are subscribed:
  * @code
  * +-----------------+                                                         +-------------------+
@@ -414,6 +426,52 @@ LE_SHARED le_result_t le_httpClient_SetCredentials
     char*                  passwordPtr  ///< [IN] Password to be used during the HTTP connection
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enable or disable keeping the connection alive between requests. By default, the connection is
+ * not kept alive.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_httpClient_SetKeepAlive
+(
+    le_httpClient_Ref_t    ref,       ///< [IN] HTTP session context reference
+    bool                   enable     ///< [IN] True to keep the connection alive, false otherwise
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of connections opened with the server since the session was started: with
+ * keep-alive enabled, it only increases when a connection has to be opened again.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_httpClient_GetConnectionCount
+(
+    le_httpClient_Ref_t    ref,       ///< [IN] HTTP session context reference
+    uint32_t*              countPtr   ///< [OUT] Number of connections
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether the current connection of a secure session resumed the TLS session of a previous
+ * connection to the same server.
+ *
+ * @return
+ *  - True if the TLS session was resumed, false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED bool le_httpClient_IsSessionResumed
+(
+    le_httpClient_Ref_t    ref        ///< [IN] HTTP session context reference
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Add a certificate to the HTTP session in order to make the connection secure
@@ -551,6 +609,44 @@ LE_SHARED le_result_t le_httpClient_SetBodyConstructCallback
     le_httpClient_BodyConstructCb_t  callback   ///< [IN] Callback
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set a file descriptor to read the body of the next POST or PUT request from, instead of calling
+ * the body construct callback. A Content-Length header is added to the request.
+ *
+ * @note The file descriptor is only used by the next request, and is not closed.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_BUSY          Busy handling a request
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_httpClient_SetBodyFd
+(
+    le_httpClient_Ref_t  ref,       ///< [IN] HTTP session context reference
+    int                  fd,        ///< [IN] File descriptor to read the body from
+    size_t               length     ///< [IN] Body size
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set a file descriptor to write the HTTP response bodies to, instead of calling the body response
+ * callback. Set -1 to use the callback again.
+ *
+ * @note The file descriptor is not closed.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_httpClient_SetBodyResponseFd
+(
+    le_httpClient_Ref_t  ref,       ///< [IN] HTTP session context reference
+    int                  fd         ///< [IN] File descriptor to write the body to, or -1
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set callback to insert/update resources (key/value pairs) during a HTTP request.
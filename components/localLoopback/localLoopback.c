@@ -2,11 +2,21 @@
  * @file localLoopback.c
  *
  * This file provides a "local loopback" implementation of the RPC Communication API (le_comm.h).
- * It allows for testing the RPC Proxy as a single daemon acting as both
- * Proxy Client and Server in isolation.
+ * It connects two RPC Proxies running on the same Linux host over a Unix-domain stream socket,
+ * which allows for testing and benchmarking the RPC Proxy without any network hardware.
  *
- * NOTE:  Temporary interim solution for testing the RPC Proxy communication framework
- *        while under development.
+ * The link is configured with two arguments:
+ *
+ *  - argv[0]:  Path of the Unix-domain socket.  A leading '@' selects the abstract namespace,
+ *              which leaves no file behind in the file system.
+ *  - argv[1]:  Role of this end of the link, either "server" (listens for, and accepts, the
+ *              connection) or "client" (connects to the server).
+ *
+ * For example:
+ * @verbatim
+   rpctool --config "systems/<systemName>/links/<linkName>/args/0" "@rpcLoopback"
+   rpctool --config "systems/<systemName>/links/<linkName>/args/1" "server"
+   @endverbatim
  *
  * Copyright (C) Sierra Wireless Inc.
  */
@@ -15,10 +25,84 @@
 #include "legato.h"
 #include "interfaces.h"
 #include "le_comm.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of outstanding (pending) socket client connections
+ */
+//--------------------------------------------------------------------------------------------------
+#define LOCAL_LOOPBACK_MAX_CONNECT_REQUEST_BACKLOG   4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of Socket Handle records
+ */
+//--------------------------------------------------------------------------------------------------
+#define LOCAL_LOOPBACK_HANDLE_RECORD_MAX             10
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time to wait for the far side to drain the socket, when the socket buffer is full (in ms)
+ */
+//--------------------------------------------------------------------------------------------------
+#define LOCAL_LOOPBACK_SEND_TIMEOUT_MS               1000
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Socket Handle-Record Structure - Defines the data of a Unix-domain socket connection.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct HandleRecord
+{
+    int fd;                                       ///< File-descriptor of the socket
+    bool isListeningFd;                           ///< Identifies a listening server socket
+    bool isServer;                                ///< Server or Client end of the link
+    struct sockaddr_un sockAddr;                  ///< Address of the socket
+    socklen_t sockAddrLen;                        ///< Length of the socket address
+    le_fdMonitor_Ref_t fdMonitorRef;              ///< Monitor of the socket file-descriptor
+    le_comm_CallbackHandlerFunc_t connectionFunc; ///< Asynchronous Connection callback
+    le_comm_CallbackHandlerFunc_t receiveFunc;    ///< Asynchronous Receive callback
+    void* parentRecordPtr;                        ///< Parent (listening) socket record
+}
+HandleRecord_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This pool is used to allocate memory for the Handle record.
+ * Initialized in localLoopbackInitialize().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(HandleRecordPool,
+                          LOCAL_LOOPBACK_HANDLE_RECORD_MAX,
+                          sizeof(HandleRecord_t));
+
+static le_mem_PoolRef_t HandleRecordPoolRef = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to initialize the RPC Communication implementation.
+ *
+ * @note If the initialization failed, it is a fatal error, the function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef RPC_PROXY_LOCAL_SERVICE
+__attribute__((constructor))
+#endif
+static void localLoopbackInitialize(void)
+{
+    if (HandleRecordPoolRef == NULL)
+    {
+        // NOTE: Must be performed once.
+        HandleRecordPoolRef = le_mem_InitStaticPool(HandleRecordPool,
+                                                    LOCAL_LOOPBACK_HANDLE_RECORD_MAX,
+                                                    sizeof(HandleRecord_t));
+    }
+}
 
-static le_comm_CallbackHandlerFunc_t local_callback_handler;
-static char local_buffer[200];
-static size_t local_msgsize;
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -32,6 +116,140 @@ COMPONENT_INIT
     LE_INFO("RPC Local Loopback Init done");
 }
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to Parse Command Line Arguments
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ParseCommandLineArgs
+(
+    const int argc,
+    const char* argv[],
+    HandleRecord_t* connectionRecordPtr
+)
+{
+    if (argc != 2)
+    {
+        LE_ERROR("Invalid Command Line Argument, argc = [%d]", argc);
+        return LE_BAD_PARAMETER;
+    }
+
+    // Extract the role of this end of the link
+    if (strcmp(argv[1], "server") == 0)
+    {
+        connectionRecordPtr->isServer = true;
+    }
+    else if (strcmp(argv[1], "client") == 0)
+    {
+        connectionRecordPtr->isServer = false;
+    }
+    else
+    {
+        LE_ERROR("Invalid role [%s], expecting 'server' or 'client'", argv[1]);
+        return LE_BAD_PARAMETER;
+    }
+
+    // Extract the socket path
+    size_t pathLen = strlen(argv[0]);
+    if ((pathLen == 0) || (pathLen >= sizeof(connectionRecordPtr->sockAddr.sun_path)))
+    {
+        LE_ERROR("Invalid socket path [%s]", argv[0]);
+        return LE_BAD_PARAMETER;
+    }
+
+    memset(&connectionRecordPtr->sockAddr, 0, sizeof(connectionRecordPtr->sockAddr));
+    connectionRecordPtr->sockAddr.sun_family = AF_UNIX;
+    memcpy(connectionRecordPtr->sockAddr.sun_path, argv[0], pathLen);
+
+    if (argv[0][0] == '@')
+    {
+        // Abstract namespace - the name is not NUL-terminated
+        connectionRecordPtr->sockAddr.sun_path[0] = '\0';
+    }
+
+    connectionRecordPtr->sockAddrLen = offsetof(struct sockaddr_un, sun_path) + pathLen;
+
+    LE_INFO("Setting Local Loopback socket [%s], role [%s]", argv[0], argv[1]);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Callback function to receive events on a connection and pass them onto the RPC Proxy
+ */
+//--------------------------------------------------------------------------------------------------
+static void AsyncRecvHandler
+(
+    int fd,
+    short events
+)
+{
+    HandleRecord_t* connectionRecordPtr = le_fdMonitor_GetContextPtr();
+
+    LE_UNUSED(fd);
+
+    // Notify the RPC Proxy
+    connectionRecordPtr->receiveFunc(connectionRecordPtr, events);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Callback function to accept connections on a listening socket and pass them onto the RPC Proxy
+ */
+//--------------------------------------------------------------------------------------------------
+static void ConnectionRecvHandler
+(
+    int fd,
+    short events
+)
+{
+    HandleRecord_t* parentRecordPtr = le_fdMonitor_GetContextPtr();
+
+    if (!(events & POLLIN))
+    {
+        LE_ERROR("Unexpected fd event(s): 0x%hX", events);
+        return;
+    }
+
+    // Accept the connection, setting the connection to be non-blocking.
+    int clientFd = accept4(fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (clientFd < 0)
+    {
+        LE_ERROR("Failed to accept client connection. Errno %d", errno);
+        return;
+    }
+
+    LE_INFO("Accepting Client socket connection, fd [%d]", clientFd);
+
+    HandleRecord_t* connectionRecordPtr = le_mem_AssertAlloc(HandleRecordPoolRef);
+
+    // Initialize the connection record
+    memset(connectionRecordPtr, 0, sizeof(HandleRecord_t));
+    connectionRecordPtr->fd = clientFd;
+    connectionRecordPtr->isServer = true;
+    connectionRecordPtr->parentRecordPtr = parentRecordPtr;
+
+    if (parentRecordPtr->connectionFunc != NULL)
+    {
+        // Notify the RPC Proxy of the Client connection
+        parentRecordPtr->connectionFunc(connectionRecordPtr, POLLIN);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Creating a RPC Local Loopback Communication Channel
+ *
+ * Return Code values:
+ *      - LE_OK if successfully,
+ *      - otherwise failure
+ *
+ * @return
+ *      Opague handle to the Communication Channel.
+ */
+//--------------------------------------------------------------------------------------------------
 LE_SHARED void* le_comm_Create
 (
     const int argc,         ///< [IN] Number of strings pointed to by argv.
@@ -39,91 +257,346 @@ LE_SHARED void* le_comm_Create
     le_result_t* resultPtr  ///< [OUT] Return Code
 )
 {
-    LE_UNUSED(argc);
-    LE_UNUSED(argv);
-
-    int fd = 1;
+    // Verify result pointer is valid
     if (resultPtr == NULL)
     {
-        LE_ERROR("result pointer is NULL");
-        return (void*) -1;
+        LE_ERROR("resultPtr is NULL");
+        return NULL;
+    }
+
+    // Check if Communication Globals need initialization
+    localLoopbackInitialize();
+
+    HandleRecord_t* connectionRecordPtr = le_mem_AssertAlloc(HandleRecordPoolRef);
+    memset(connectionRecordPtr, 0, sizeof(HandleRecord_t));
+    connectionRecordPtr->fd = -1;
+
+    // Parse the Command Line arguments to extract the socket path and role
+    *resultPtr = ParseCommandLineArgs(argc, argv, connectionRecordPtr);
+    if (*resultPtr != LE_OK)
+    {
+        le_mem_Release(connectionRecordPtr);
+        return NULL;
+    }
+
+    // Create the non-blocking socket
+    connectionRecordPtr->fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (connectionRecordPtr->fd < 0)
+    {
+        LE_WARN("Failed to create AF_UNIX socket.  Errno = %d", errno);
+
+        le_mem_Release(connectionRecordPtr);
+        *resultPtr = LE_FAULT;
+        return NULL;
+    }
+
+    if (connectionRecordPtr->isServer)
+    {
+        if (connectionRecordPtr->sockAddr.sun_path[0] != '\0')
+        {
+            // Remove a stale socket file, left behind by a previous instance
+            unlink(connectionRecordPtr->sockAddr.sun_path);
+        }
+
+        if (bind(connectionRecordPtr->fd,
+                 (struct sockaddr*) &connectionRecordPtr->sockAddr,
+                 connectionRecordPtr->sockAddrLen) < 0)
+        {
+            LE_WARN("Failed to bind socket, fd %d, result = %d", connectionRecordPtr->fd, errno);
+
+            close(connectionRecordPtr->fd);
+            le_mem_Release(connectionRecordPtr);
+            *resultPtr = LE_FAULT;
+            return NULL;
+        }
     }
 
-    *resultPtr = LE_OK;
-    return (void*) fd;
+    LE_INFO("Created AF_UNIX Socket, fd %d", connectionRecordPtr->fd);
+
+    return connectionRecordPtr;
 }
 
-LE_SHARED le_result_t le_comm_RegisterHandleMonitor (void* handle, le_comm_CallbackHandlerFunc_t handlerFunc, short events)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Registering a Callback Handler function to monitor events on the specific handle
+ *
+ * @return
+ *      - LE_OK if successfully.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_comm_RegisterHandleMonitor
+(
+    void* handle,
+    le_comm_CallbackHandlerFunc_t handlerFunc,
+    short events
+)
 {
-    LE_UNUSED(handle);
-    LE_UNUSED(events);
+    HandleRecord_t* connectionRecordPtr = (HandleRecord_t*) handle;
+
+    if (!(events & POLLIN))
+    {
+        // Store the Asynchronous Connection callback function
+        connectionRecordPtr->connectionFunc = handlerFunc;
+        return LE_OK;
+    }
+
+    // Store the Asynchronous Receive callback function
+    connectionRecordPtr->receiveFunc = handlerFunc;
 
-    LE_INFO("Registering handle_monitor callback");
+    char socketName[32];
+    snprintf(socketName, sizeof(socketName), "unixSocket-%d", connectionRecordPtr->fd);
 
-    local_callback_handler = handlerFunc;
+    connectionRecordPtr->fdMonitorRef = le_fdMonitor_Create(socketName,
+                                                            connectionRecordPtr->fd,
+                                                            AsyncRecvHandler,
+                                                            events);
+    le_fdMonitor_SetContextPtr(connectionRecordPtr->fdMonitorRef, connectionRecordPtr);
 
-    LE_INFO("Successfully registered handle_monitor callback");
+    LE_INFO("Registered Asynchronous Receive callback on fd %d, events [0x%x]",
+            connectionRecordPtr->fd,
+            events);
 
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Deleting RPC Local Loopback Communication Channel
+ *
+ * @return
+ *      - LE_OK if successfully.
+ */
+//--------------------------------------------------------------------------------------------------
 LE_SHARED le_result_t le_comm_Delete (void* handle)
 {
-    LE_UNUSED(handle);
+    HandleRecord_t* connectionRecordPtr = (HandleRecord_t*) handle;
+
+    LE_INFO("Deleting AF_UNIX socket, fd %d", connectionRecordPtr->fd);
+
+    if (connectionRecordPtr->fdMonitorRef != NULL)
+    {
+        le_fdMonitor_Delete(connectionRecordPtr->fdMonitorRef);
+        connectionRecordPtr->fdMonitorRef = NULL;
+    }
+
+    if (connectionRecordPtr->fd >= 0)
+    {
+        if (!connectionRecordPtr->isListeningFd)
+        {
+            shutdown(connectionRecordPtr->fd, SHUT_RDWR);
+        }
+        close(connectionRecordPtr->fd);
+        connectionRecordPtr->fd = -1;
+    }
+
+    if (connectionRecordPtr->isListeningFd &&
+        (connectionRecordPtr->sockAddr.sun_path[0] != '\0'))
+    {
+        unlink(connectionRecordPtr->sockAddr.sun_path);
+    }
+
+    // Free the Handle Record memory
+    le_mem_Release(connectionRecordPtr);
+
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Connecting RPC Local Loopback Communication Channel
+ *
+ * @return
+ *      - LE_OK if successfully,
+ *      - LE_IN_PROGRESS if pending on asynchronous connection,
+ *      - LE_NOT_FOUND if the server is not listening (yet),
+ *      - otherwise failure
+ */
+//--------------------------------------------------------------------------------------------------
 LE_SHARED le_result_t le_comm_Connect (void* handle)
 {
-    int fd = (int) handle;
+    HandleRecord_t* connectionRecordPtr = (HandleRecord_t*) handle;
 
-    LE_INFO("Successfully connected, fd %d, ", fd);
+    if (connectionRecordPtr->isServer)
+    {
+        if (listen(connectionRecordPtr->fd, LOCAL_LOOPBACK_MAX_CONNECT_REQUEST_BACKLOG) != 0)
+        {
+            LE_WARN("Server socket listen() call failed with errno %d", errno);
+            return LE_FAULT;
+        }
+
+        // Flag as a listening socket
+        connectionRecordPtr->isListeningFd = true;
+
+        char socketName[32];
+        snprintf(socketName, sizeof(socketName), "unixListen-%d", connectionRecordPtr->fd);
+
+        connectionRecordPtr->fdMonitorRef = le_fdMonitor_Create(socketName,
+                                                                connectionRecordPtr->fd,
+                                                                ConnectionRecvHandler,
+                                                                POLLIN);
+        le_fdMonitor_SetContextPtr(connectionRecordPtr->fdMonitorRef, connectionRecordPtr);
+
+        // Connection will be notified via the connection callback
+        return LE_IN_PROGRESS;
+    }
+
+    // A Unix-domain connect() completes immediately, or fails
+    if (connect(connectionRecordPtr->fd,
+                (struct sockaddr*) &connectionRecordPtr->sockAddr,
+                connectionRecordPtr->sockAddrLen) != 0)
+    {
+        switch (errno)
+        {
+            case EACCES:
+                return LE_NOT_PERMITTED;
+
+            case ENOENT:
+            case ECONNREFUSED:
+            case EAGAIN:
+                // Server is not listening yet, or its backlog is full
+                return LE_NOT_FOUND;
+
+            default:
+                LE_ERROR("Connect failed with errno %d", errno);
+                return LE_FAULT;
+        }
+    }
 
+    // Set the parent record to ourself
+    connectionRecordPtr->parentRecordPtr = connectionRecordPtr;
+
+    LE_INFO("Connected AF_UNIX socket, fd %d", connectionRecordPtr->fd);
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Disconnecting RPC Local Loopback Communication Channel
+ *
+ * @return
+ *      - LE_OK if successfully.
+ */
+//--------------------------------------------------------------------------------------------------
 LE_SHARED le_result_t le_comm_Disconnect (void* handle)
 {
-    LE_UNUSED(handle);
+    HandleRecord_t* connectionRecordPtr = (HandleRecord_t*) handle;
+
+    if (connectionRecordPtr->fdMonitorRef != NULL)
+    {
+        le_fdMonitor_Delete(connectionRecordPtr->fdMonitorRef);
+        connectionRecordPtr->fdMonitorRef = NULL;
+    }
+
+    if (connectionRecordPtr->fd >= 0)
+    {
+        close(connectionRecordPtr->fd);
+        connectionRecordPtr->fd = -1;
+    }
+
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Sending Data over RPC Local Loopback Communication Channel
+ *
+ * The whole buffer is written, waiting for the far side to drain the socket if needed, so that a
+ * message is never split by a full socket buffer.
+ *
+ * @return
+ *      - LE_OK if successfully,
+ *      - LE_TIMEOUT if the far side didn't drain the socket in time,
+ *      - LE_COMM_ERROR if the connection is lost,
+ *      - otherwise failure
+ */
+//--------------------------------------------------------------------------------------------------
 LE_SHARED le_result_t le_comm_Send (void* handle, const void* buf, size_t len)
 {
-    // Ensure local loopback buffer is big enough
-    if (sizeof(local_buffer) < len)
+    HandleRecord_t* connectionRecordPtr = (HandleRecord_t*) handle;
+    const uint8_t* bufPtr = buf;
+
+    while (len > 0)
     {
-        LE_INFO("Send Buffer too small");
-        return LE_OK;
-    }
+        ssize_t bytesSent = send(connectionRecordPtr->fd, bufPtr, len, MSG_NOSIGNAL);
 
-    // Copy Proxy Message onto local loopback buffer and set the size
-    memcpy(&local_buffer, buf, len);
-    local_msgsize = len;
+        if (bytesSent >= 0)
+        {
+            bufPtr += bytesSent;
+            len -= bytesSent;
+            continue;
+        }
 
-    LE_INFO("Calling local_callback_handler() function");
+        switch (errno)
+        {
+            case EINTR:
+                break;
 
-    // Call RPC Proxy receive handler
-    local_callback_handler(handle, 0x00);
-    LE_INFO("Finished local_callback_handler() function");
+            case EAGAIN:  // Same as EWOULDBLOCK
+            {
+                struct pollfd pollFd = { .fd = connectionRecordPtr->fd, .events = POLLOUT };
+
+                if (poll(&pollFd, 1, LOCAL_LOOPBACK_SEND_TIMEOUT_MS) == 0)
+                {
+                    LE_WARN("Timed out waiting for socket, fd %d", connectionRecordPtr->fd);
+                    return LE_TIMEOUT;
+                }
+                break;
+            }
+
+            case ENOTCONN:
+            case ECONNRESET:
+            case EPIPE:
+                LE_WARN("send() failed with errno %d", errno);
+                return LE_COMM_ERROR;
+
+            default:
+                LE_ERROR("send() failed with errno %d", errno);
+                return LE_FAULT;
+        }
+    }
 
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Receiving Data over RPC Local Loopback Communication Channel
+ *
+ * @return
+ *      - LE_OK if successfully.
+ */
+//--------------------------------------------------------------------------------------------------
 LE_SHARED le_result_t le_comm_Receive (void* handle, void* buf, size_t* len)
 {
-    LE_UNUSED(handle);
-    LE_INFO("Calling myLocal le_comm_Receive");
+    HandleRecord_t* connectionRecordPtr = (HandleRecord_t*) handle;
+    ssize_t bytesReceived;
 
-    if (*len < local_msgsize)
+    // Keep trying to receive until we don't get interrupted by a signal.
+    do
     {
-        LE_INFO("Receive Buffer too small");
-        return LE_OK;
+        bytesReceived = recv(connectionRecordPtr->fd, buf, *len, 0);
     }
+    while ((bytesReceived < 0) && (errno == EINTR));
 
-    memcpy(buf, &local_buffer, local_msgsize);
-    *len = local_msgsize;
+    if (bytesReceived < 0)
+    {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+        {
+            // Set the length to zero and return
+            *len = 0;
+            return LE_OK;
+        }
+        else if (errno == ECONNRESET)
+        {
+            return LE_CLOSED;
+        }
+
+        LE_ERROR("recv() failed with errno %d", errno);
+        return LE_FAULT;
+    }
 
+    *len = bytesReceived;
     return LE_OK;
 }
 
@@ -147,8 +620,12 @@ LE_SHARED int le_comm_GetId
     void* handle
 )
 {
-    LE_UNUSED(handle);
-    return 1;
+    if (handle == NULL)
+    {
+        return -1;
+    }
+
+    return ((HandleRecord_t*) handle)->fd;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -166,6 +643,10 @@ LE_SHARED void* le_comm_GetParentHandle
     void* handle
 )
 {
-    LE_UNUSED(handle);
-    return NULL;
+    if (handle == NULL)
+    {
+        return NULL;
+    }
+
+    return ((HandleRecord_t*) handle)->parentRecordPtr;
 }
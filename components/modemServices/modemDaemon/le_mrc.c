@@ -6097,3 +6097,345 @@ le_mrc_PciScanInformationRef_t le_mrc_GetNextPciScanInfo
     return NULL;
 #endif
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy the information of the cells of a pa_mrc_CellInfo_t list, from a given position.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_OUT_OF_RANGE if startIndex is beyond the end of the list
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t CopyNeighborCellDetails
+(
+    le_dls_List_t*                 paNgbrCellInfoListPtr, ///< [IN] List of pa_mrc_CellInfo_t
+    uint32_t                       startIndex,            ///< [IN] Position of the first cell
+    le_mrc_NeighborCellDetails_t*  cellListPtr,           ///< [OUT] Cells information
+    size_t*                        cellListSizePtr,       ///< [INOUT] Max/returned cells number
+    uint32_t*                      totalCountPtr          ///< [OUT] Number of cells in the list
+)
+{
+    size_t         maxCount = *cellListSizePtr;
+    size_t         count = 0;
+    uint32_t       index = 0;
+    le_dls_Link_t* linkPtr = le_dls_Peek(paNgbrCellInfoListPtr);
+
+    *totalCountPtr = le_dls_NumLinks(paNgbrCellInfoListPtr);
+    *cellListSizePtr = 0;
+
+    if ((startIndex > 0) && (startIndex >= *totalCountPtr))
+    {
+        return LE_OUT_OF_RANGE;
+    }
+
+    while ((linkPtr != NULL) && (count < maxCount))
+    {
+        if (index >= startIndex)
+        {
+            pa_mrc_CellInfo_t* cellInfoPtr = CONTAINER_OF(linkPtr, pa_mrc_CellInfo_t, link);
+            le_mrc_NeighborCellDetails_t* detailsPtr = &cellListPtr[count];
+
+            detailsPtr->id = cellInfoPtr->id;
+            detailsPtr->lac = cellInfoPtr->lac;
+            detailsPtr->rxLevel = cellInfoPtr->rxLevel;
+            detailsPtr->rat = cellInfoPtr->rat;
+            detailsPtr->umtsEcIo = cellInfoPtr->umtsEcIo;
+            detailsPtr->lteIntraRsrq = cellInfoPtr->lteIntraRsrq;
+            detailsPtr->lteIntraRsrp = cellInfoPtr->lteIntraRsrp;
+            detailsPtr->lteInterRsrq = cellInfoPtr->lteInterRsrq;
+            detailsPtr->lteInterRsrp = cellInfoPtr->lteInterRsrp;
+            detailsPtr->earfcn = cellInfoPtr->earfcn;
+            detailsPtr->physCellId = cellInfoPtr->physCellId;
+            detailsPtr->psc = cellInfoPtr->psc;
+            detailsPtr->bsic = cellInfoPtr->bsic;
+            count++;
+        }
+
+        index++;
+        linkPtr = le_dls_PeekNext(paNgbrCellInfoListPtr, linkPtr);
+    }
+
+    *cellListSizePtr = count;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the information of the Neighboring Cells retrieved with le_mrc_GetNeighborCellsInfo(), in a
+ * single call.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_OUT_OF_RANGE if startIndex is beyond the end of the list
+ *      - LE_FAULT on failure
+ *
+ * @note If the caller is passing a bad pointer into this function, it is a fatal error, the
+ *       function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_mrc_GetNeighborCellDetails
+(
+    le_mrc_NeighborCellsRef_t      ngbrCellsRef,    ///< [IN] The Neighboring Cells reference
+    uint32_t                       startIndex,      ///< [IN] Position of the first cell to return
+    le_mrc_NeighborCellDetails_t*  cellListPtr,     ///< [OUT] Cells information
+    size_t*                        cellListSizePtr, ///< [INOUT] Max/returned number of cells
+    uint32_t*                      totalCountPtr    ///< [OUT] Number of cells in the list
+)
+{
+    if ((cellListPtr == NULL) || (cellListSizePtr == NULL) || (totalCountPtr == NULL))
+    {
+        LE_KILL_CLIENT("Invalid output parameter!");
+        return LE_FAULT;
+    }
+
+    CellList_t* ngbrCellsInfoListPtr = le_ref_Lookup(CellListRefMap, ngbrCellsRef);
+    if (ngbrCellsInfoListPtr == NULL)
+    {
+        LE_KILL_CLIENT("Invalid reference (%p) provided!", ngbrCellsRef);
+        return LE_FAULT;
+    }
+
+    return CopyNeighborCellDetails(&(ngbrCellsInfoListPtr->paNgbrCellInfoList),
+                                   startIndex,
+                                   cellListPtr,
+                                   cellListSizePtr,
+                                   totalCountPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Retrieve the Neighboring Cells information and return it at once, without creating a
+ * Neighboring Cells reference.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_NOT_FOUND if no Cells Information are available
+ *      - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_mrc_GetNeighborCellsSnapshot
+(
+    le_mrc_NeighborCellDetails_t*  cellListPtr,     ///< [OUT] Cells information
+    size_t*                        cellListSizePtr, ///< [INOUT] Max/returned number of cells
+    uint32_t*                      totalCountPtr    ///< [OUT] Number of detected cells
+)
+{
+    le_dls_List_t paNgbrCellInfoList = LE_DLS_LIST_INIT;
+
+    if ((cellListPtr == NULL) || (cellListSizePtr == NULL) || (totalCountPtr == NULL))
+    {
+        LE_KILL_CLIENT("Invalid output parameter!");
+        return LE_FAULT;
+    }
+
+    if (pa_mrc_GetNeighborCellsInfo(&paNgbrCellInfoList) <= 0)
+    {
+        LE_WARN("Unable to retrieve the Neighboring Cells information!");
+        *cellListSizePtr = 0;
+        *totalCountPtr = 0;
+        return LE_NOT_FOUND;
+    }
+
+    le_result_t result = CopyNeighborCellDetails(&paNgbrCellInfoList,
+                                                 0,
+                                                 cellListPtr,
+                                                 cellListSizePtr,
+                                                 totalCountPtr);
+
+    pa_mrc_DeleteNeighborCellsInfo(&paNgbrCellInfoList);
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the information of the networks retrieved with le_mrc_PerformCellularNetworkScan(), in a
+ * single call.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_OUT_OF_RANGE if startIndex is beyond the end of the list
+ *      - LE_FAULT on failure
+ *
+ * @note If the caller is passing a bad pointer into this function, it is a fatal error, the
+ *       function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_mrc_GetCellularNetworkScanDetails
+(
+    le_mrc_ScanInformationListRef_t scanInformationListRef, ///< [IN] The list of scan information
+    uint32_t                        startIndex,             ///< [IN] Position of the first network
+    le_mrc_ScanDetails_t*           scanListPtr,            ///< [OUT] Networks information
+    size_t*                         scanListSizePtr,        ///< [INOUT] Max/returned networks
+    uint32_t*                       totalCountPtr           ///< [OUT] Number of networks
+)
+{
+    if ((scanListPtr == NULL) || (scanListSizePtr == NULL) || (totalCountPtr == NULL))
+    {
+        LE_KILL_CLIENT("Invalid output parameter!");
+        return LE_FAULT;
+    }
+
+    ScanInfoList_t* scanInformationListPtr = le_ref_Lookup(ScanInformationListRefMap,
+                                                           scanInformationListRef);
+    if (scanInformationListPtr == NULL)
+    {
+        LE_KILL_CLIENT("Invalid reference (%p) provided!", scanInformationListRef);
+        return LE_FAULT;
+    }
+
+    le_dls_List_t* listPtr = &(scanInformationListPtr->paScanInfoList);
+    size_t         maxCount = *scanListSizePtr;
+    size_t         count = 0;
+    uint32_t       index = 0;
+    le_dls_Link_t* linkPtr = le_dls_Peek(listPtr);
+
+    *totalCountPtr = le_dls_NumLinks(listPtr);
+    *scanListSizePtr = 0;
+
+    if ((startIndex > 0) && (startIndex >= *totalCountPtr))
+    {
+        return LE_OUT_OF_RANGE;
+    }
+
+    while ((linkPtr != NULL) && (count < maxCount))
+    {
+        if (index >= startIndex)
+        {
+            pa_mrc_ScanInformation_t* nodePtr = CONTAINER_OF(linkPtr,
+                                                             pa_mrc_ScanInformation_t,
+                                                             link);
+            le_mrc_ScanDetails_t* detailsPtr = &scanListPtr[count];
+
+            le_utf8_Copy(detailsPtr->mcc, nodePtr->mobileCode.mcc, sizeof(detailsPtr->mcc), NULL);
+            le_utf8_Copy(detailsPtr->mnc, nodePtr->mobileCode.mnc, sizeof(detailsPtr->mnc), NULL);
+            detailsPtr->rat = nodePtr->rat;
+            detailsPtr->isInUse = nodePtr->isInUse;
+            detailsPtr->isAvailable = nodePtr->isAvailable;
+            detailsPtr->isHome = nodePtr->isHome;
+            detailsPtr->isForbidden = nodePtr->isForbidden;
+            count++;
+        }
+
+        index++;
+        linkPtr = le_dls_PeekNext(listPtr, linkPtr);
+    }
+
+    *scanListSizePtr = count;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the information of the cells retrieved with le_mrc_PerformPciNetworkScan(), in a single
+ * call. The list is flattened to one entry per cell and per Mcc/Mnc.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_OUT_OF_RANGE if startIndex is beyond the end of the list
+ *      - LE_UNSUPPORTED if PCI scan is not supported
+ *      - LE_FAULT on failure
+ *
+ * @note If the caller is passing a bad pointer into this function, it is a fatal error, the
+ *       function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_mrc_GetPciScanDetails
+(
+    le_mrc_PciScanInformationListRef_t scanInformationListRef, ///< [IN] The list of scan
+                                                               ///<      information
+    uint32_t                           startIndex,             ///< [IN] Position of the first entry
+    le_mrc_PciScanDetails_t*           scanListPtr,            ///< [OUT] Cells information
+    size_t*                            scanListSizePtr,        ///< [INOUT] Max/returned entries
+    uint32_t*                          totalCountPtr           ///< [OUT] Number of entries
+)
+{
+#if LE_CONFIG_ENABLE_PCI_SCAN
+    if ((scanListPtr == NULL) || (scanListSizePtr == NULL) || (totalCountPtr == NULL))
+    {
+        LE_KILL_CLIENT("Invalid output parameter!");
+        return LE_FAULT;
+    }
+
+    PciScanInfoList_t* scanInformationListPtr = le_ref_Lookup(PciScanInformationListRefMap,
+                                                              scanInformationListRef);
+    if (scanInformationListPtr == NULL)
+    {
+        LE_KILL_CLIENT("Invalid reference (%p) provided!", scanInformationListRef);
+        return LE_FAULT;
+    }
+
+    le_dls_List_t* listPtr = &(scanInformationListPtr->paPciScanInfoList);
+    size_t         maxCount = *scanListSizePtr;
+    size_t         count = 0;
+    uint32_t       index = 0;
+    le_dls_Link_t* linkPtr;
+
+    // The whole list is walked, to count the entries of the flattened list
+    for (linkPtr = le_dls_Peek(listPtr);
+         linkPtr != NULL;
+         linkPtr = le_dls_PeekNext(listPtr, linkPtr))
+    {
+        pa_mrc_PciScanInformation_t* cellPtr = CONTAINER_OF(linkPtr,
+                                                            pa_mrc_PciScanInformation_t,
+                                                            link);
+        le_dls_Link_t* plmnLinkPtr = le_dls_Peek(&(cellPtr->plmnList));
+
+        do
+        {
+            if ((index >= startIndex) && (count < maxCount))
+            {
+                le_mrc_PciScanDetails_t* detailsPtr = &scanListPtr[count];
+
+                detailsPtr->physicalCellId = cellPtr->physicalCellId;
+                detailsPtr->globalCellId = cellPtr->globalCellId;
+                detailsPtr->mcc[0] = '\0';
+                detailsPtr->mnc[0] = '\0';
+
+                if (plmnLinkPtr != NULL)
+                {
+                    pa_mrc_PlmnInformation_t* plmnPtr = CONTAINER_OF(plmnLinkPtr,
+                                                                     pa_mrc_PlmnInformation_t,
+                                                                     link);
+
+                    le_utf8_Copy(detailsPtr->mcc, plmnPtr->mobileCode.mcc,
+                                 sizeof(detailsPtr->mcc), NULL);
+                    le_utf8_Copy(detailsPtr->mnc, plmnPtr->mobileCode.mnc,
+                                 sizeof(detailsPtr->mnc), NULL);
+                }
+                count++;
+            }
+            index++;
+
+            if (plmnLinkPtr != NULL)
+            {
+                plmnLinkPtr = le_dls_PeekNext(&(cellPtr->plmnList), plmnLinkPtr);
+            }
+        }
+        while (plmnLinkPtr != NULL);
+    }
+
+    *totalCountPtr = index;
+    *scanListSizePtr = count;
+
+    if ((startIndex > 0) && (startIndex >= index))
+    {
+        return LE_OUT_OF_RANGE;
+    }
+
+    return LE_OK;
+#else
+    LE_UNUSED(scanInformationListRef);
+    LE_UNUSED(startIndex);
+    LE_UNUSED(scanListPtr);
+    LE_UNUSED(totalCountPtr);
+
+    if (scanListSizePtr != NULL)
+    {
+        *scanListSizePtr = 0;
+    }
+
+    return LE_UNSUPPORTED;
+#endif
+}
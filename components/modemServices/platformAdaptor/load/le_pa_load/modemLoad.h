@@ -0,0 +1,127 @@
+/**
+ * @file modemLoad.h
+ *
+ * Control block shared between the load platform adaptor (running in the modemDaemon) and the
+ * modemServices load harness.
+ *
+ * The block is a file mapped by both processes.  The harness writes the rate and burst size of each
+ * event stream, and the size of the neighboring cell list.  The platform adaptor writes the number
+ * of events emitted and dropped, the emission time of the most recent events, and the usage of the
+ * main modemDaemon memory pools.
+ *
+ * Emission times use the relative clock (le_clk_GetRelativeTime()), which is common to all the
+ * processes of the system.  The time of event N of a stream is stored at index
+ * N % MODEM_LOAD_STAMP_COUNT of its emitTimeUs[] array, before emittedCount is incremented.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef MODEM_LOAD_H_INCLUDE_GUARD
+#define MODEM_LOAD_H_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Path of the file holding the control block.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MODEM_LOAD_FILE_PATH        "/tmp/modemLoad"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Value of the magic field once the block is initialized by the platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MODEM_LOAD_MAGIC            0x4D4C4431
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of emission times kept per stream.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MODEM_LOAD_STAMP_COUNT      256
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of memory pools reported.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MODEM_LOAD_POOL_MAX         16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of a reported pool name, including the terminating null-character.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MODEM_LOAD_POOL_NAME_BYTES  32
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of neighboring cells generated.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MODEM_LOAD_NEIGHBOR_CELL_MAX 32
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Event streams generated by the platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    MODEM_LOAD_SMS = 0,         ///< Incoming SMS (SMS-DELIVER, 8-bit data "LOAD <seq>")
+    MODEM_LOAD_SIGNAL,          ///< LTE signal strength changes
+    MODEM_LOAD_NET_REG,         ///< Network registration changes (home / roaming)
+    MODEM_LOAD_DATA_SESSION,    ///< Data session flaps (connected / disconnected)
+    MODEM_LOAD_STREAM_COUNT
+}
+modemLoad_Stream_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Control and counters of an event stream.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    volatile uint32_t ratePerSec;       ///< Events per second, 0 to stop (written by the harness)
+    volatile uint32_t burstSize;        ///< Events emitted back-to-back (written by the harness)
+    volatile uint32_t emittedCount;     ///< Events emitted (written by the platform adaptor)
+    volatile uint32_t droppedCount;     ///< Events dropped on resource exhaustion (idem)
+    volatile uint64_t emitTimeUs[MODEM_LOAD_STAMP_COUNT];   ///< Emission times (idem)
+}
+modemLoad_StreamCtrl_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Usage of a memory pool.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char        name[MODEM_LOAD_POOL_NAME_BYTES];   ///< Pool name, empty if not found
+    uint64_t    numAllocs;                          ///< Number of allocations
+    uint32_t    numBlocksInUse;                     ///< Blocks currently allocated
+    uint32_t    maxNumBlocksUsed;                   ///< High-water mark
+    uint32_t    numFree;                            ///< Free blocks
+    uint32_t    numOverflows;                       ///< Times the pool had to expand
+}
+modemLoad_PoolStats_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Control block.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    volatile uint32_t magic;                ///< MODEM_LOAD_MAGIC once initialized
+    volatile uint32_t neighborCellCount;    ///< Neighboring cells reported (written by harness)
+    volatile uint32_t dataProfileIndex;     ///< Profile of the data session flaps (idem)
+    volatile uint32_t poolCount;            ///< Number of entries in pools[]
+    modemLoad_StreamCtrl_t streams[MODEM_LOAD_STREAM_COUNT];    ///< Event streams
+    modemLoad_PoolStats_t pools[MODEM_LOAD_POOL_MAX];           ///< Pool usage, refreshed
+                                                                ///  every 100 ms
+}
+modemLoad_Block_t;
+
+#endif // MODEM_LOAD_H_INCLUDE_GUARD
@@ -0,0 +1,394 @@
+/**
+ * @file pa_load.c
+ *
+ * Load platform adaptor: generates modem event storms at a rate controlled by the modemServices
+ * load harness (apps/test/modemServices/load), through the control block described in
+ * modemLoad.h.
+ *
+ * The events are generated by a dedicated thread, which wakes up every GENERATOR_PERIOD_MS and
+ * emits the events due since the last period.  This thread also copies the usage of the main
+ * modemDaemon memory pools to the control block.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "pa_load_local.h"
+
+#include <sys/mman.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Period of the generator, in milliseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+#define GENERATOR_PERIOD_MS         10
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of generator periods between two refreshes of the pool usage.
+ */
+//--------------------------------------------------------------------------------------------------
+#define POOL_STATS_PERIOD_COUNT     10
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of events emitted per stream and per period.  A stream lagging further behind
+ * its rate skips the extra events, so that the generator never stalls.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_EVENTS_PER_PERIOD       1000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Scheduling state of an event stream.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t        ratePerSec;     ///< Rate in use
+    le_clk_Time_t   startTime;      ///< Time the rate was set
+    uint64_t        eventCount;     ///< Events scheduled since the rate was set
+}
+StreamState_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pools whose usage is reported.
+ */
+//--------------------------------------------------------------------------------------------------
+static const struct
+{
+    const char* componentNamePtr;
+    const char* poolNamePtr;
+}
+ReportedPools[] =
+{
+    { "modemDaemon", "SmsMsg" },
+    { "modemDaemon", "MsgRef" },
+    { "modemDaemon", "SmsReference" },
+    { "modemDaemon", "CellList" },
+    { "modemDaemon", "CellInfoSafeRef" },
+    { "modemDaemon", "DataProfile" },
+    { STRINGIZE(LE_COMPONENT_NAME), "LoadSms" },
+    { STRINGIZE(LE_COMPONENT_NAME), "LoadNetRegState" },
+    { STRINGIZE(LE_COMPONENT_NAME), "LoadSignalStrength" },
+    { STRINGIZE(LE_COMPONENT_NAME), "LoadCellInfo" },
+    { STRINGIZE(LE_COMPONENT_NAME), "LoadSessionState" },
+};
+
+static_assert(NUM_ARRAY_MEMBERS(ReportedPools) <= MODEM_LOAD_POOL_MAX, "too many reported pools");
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Functions emitting one event of each stream, indexed by modemLoad_Stream_t.
+ */
+//--------------------------------------------------------------------------------------------------
+static void (*const EmitFuncs[MODEM_LOAD_STREAM_COUNT])(void) =
+{
+    pa_smsLoad_EmitNewMsg,
+    pa_mrcLoad_EmitSignalStrength,
+    pa_mrcLoad_EmitNetworkReg,
+    pa_mdcLoad_EmitSessionState,
+};
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Control block, mapped from MODEM_LOAD_FILE_PATH.  LocalBlock is used if the file can't be
+ * mapped, in which case no event is generated.
+ */
+//--------------------------------------------------------------------------------------------------
+static modemLoad_Block_t* BlockPtr;
+static modemLoad_Block_t LocalBlock;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generator state.  Only accessed by the generator thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static StreamState_t StreamStates[MODEM_LOAD_STREAM_COUNT];
+static le_mem_PoolRef_t PoolRefs[NUM_ARRAY_MEMBERS(ReportedPools)];
+static uint32_t PeriodCount;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a relative time in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetTimeUs
+(
+    le_clk_Time_t time  ///< [IN] Relative time
+)
+{
+    return ((uint64_t) time.sec * 1000000) + (uint64_t) time.usec;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the control block shared with the load harness.
+ */
+//--------------------------------------------------------------------------------------------------
+modemLoad_Block_t* pa_load_GetBlock
+(
+    void
+)
+{
+    return BlockPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record the emission of an event, just before it is reported.
+ *
+ * @return
+ *      Sequence number of the event in its stream.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t pa_load_StampEvent
+(
+    modemLoad_Stream_t stream   ///< [IN] Event stream
+)
+{
+    modemLoad_StreamCtrl_t* ctrlPtr = &BlockPtr->streams[stream];
+    uint32_t seq = ctrlPtr->emittedCount;
+
+    // The time must be visible to the harness before the event can be received
+    ctrlPtr->emitTimeUs[seq % MODEM_LOAD_STAMP_COUNT] = GetTimeUs(le_clk_GetRelativeTime());
+    LE_ATOMIC_ADD_FETCH(&ctrlPtr->emittedCount, 1, LE_ATOMIC_ORDER_RELEASE);
+
+    return seq;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record an event which could not be emitted.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_load_DropEvent
+(
+    modemLoad_Stream_t stream   ///< [IN] Event stream
+)
+{
+    LE_ATOMIC_ADD_FETCH(&BlockPtr->streams[stream].droppedCount, 1, LE_ATOMIC_ORDER_RELAXED);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit the events of a stream due at a given time.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ScheduleStream
+(
+    modemLoad_Stream_t stream,  ///< [IN] Event stream
+    le_clk_Time_t now           ///< [IN] Current relative time
+)
+{
+    modemLoad_StreamCtrl_t* ctrlPtr = &BlockPtr->streams[stream];
+    StreamState_t* statePtr = &StreamStates[stream];
+    uint32_t ratePerSec = ctrlPtr->ratePerSec;
+    uint32_t burstSize = ctrlPtr->burstSize;
+
+    if (ratePerSec != statePtr->ratePerSec)
+    {
+        LE_INFO("Stream %d: %" PRIu32 " events/s", stream, ratePerSec);
+
+        statePtr->ratePerSec = ratePerSec;
+        statePtr->startTime = now;
+        statePtr->eventCount = 0;
+    }
+
+    if (ratePerSec == 0)
+    {
+        return;
+    }
+
+    if (burstSize == 0)
+    {
+        burstSize = 1;
+    }
+
+    uint64_t dueCount = (GetTimeUs(le_clk_Sub(now, statePtr->startTime)) * ratePerSec) / 1000000;
+
+    // The last burst may have gone past the due events: eventCount can be above dueCount
+    if ((dueCount > statePtr->eventCount) &&
+        ((dueCount - statePtr->eventCount) > MAX_EVENTS_PER_PERIOD))
+    {
+        statePtr->eventCount = dueCount - MAX_EVENTS_PER_PERIOD;
+    }
+
+    // A whole burst is emitted as soon as its first event is due
+    while (statePtr->eventCount < dueCount)
+    {
+        for (uint32_t i = 0; i < burstSize; i++)
+        {
+            EmitFuncs[stream]();
+        }
+        statePtr->eventCount += burstSize;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy the usage of the reported memory pools to the control block.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RefreshPoolStats
+(
+    void
+)
+{
+#if LE_CONFIG_MEM_POOL_NAMES_ENABLED
+    for (size_t i = 0; i < NUM_ARRAY_MEMBERS(ReportedPools); i++)
+    {
+        modemLoad_PoolStats_t* statsPtr = &BlockPtr->pools[i];
+        le_mem_PoolStats_t poolStats;
+
+        // The modemDaemon pools are created after this component is initialized
+        if (PoolRefs[i] == NULL)
+        {
+            PoolRefs[i] = _le_mem_FindPool(ReportedPools[i].componentNamePtr,
+                                           ReportedPools[i].poolNamePtr);
+            if (PoolRefs[i] == NULL)
+            {
+                continue;
+            }
+            le_utf8_Copy(statsPtr->name, ReportedPools[i].poolNamePtr, sizeof(statsPtr->name),
+                         NULL);
+        }
+
+        le_mem_GetStats(PoolRefs[i], &poolStats);
+
+        statsPtr->numAllocs = poolStats.numAllocs;
+        statsPtr->numBlocksInUse = (uint32_t) poolStats.numBlocksInUse;
+        statsPtr->maxNumBlocksUsed = (uint32_t) poolStats.maxNumBlocksUsed;
+        statsPtr->numFree = (uint32_t) poolStats.numFree;
+        statsPtr->numOverflows = (uint32_t) poolStats.numOverflows;
+    }
+
+    BlockPtr->poolCount = NUM_ARRAY_MEMBERS(ReportedPools);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generator timer handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GeneratorTimerHandler
+(
+    le_timer_Ref_t timerRef     ///< [IN] Generator timer
+)
+{
+    LE_UNUSED(timerRef);
+
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+
+    for (int stream = 0; stream < MODEM_LOAD_STREAM_COUNT; stream++)
+    {
+        ScheduleStream((modemLoad_Stream_t) stream, now);
+    }
+
+    if ((PeriodCount++ % POOL_STATS_PERIOD_COUNT) == 0)
+    {
+        RefreshPoolStats();
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generator thread main function.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* GeneratorThread
+(
+    void* contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    le_timer_Ref_t timerRef = le_timer_Create("LoadGenerator");
+
+    le_timer_SetMsInterval(timerRef, GENERATOR_PERIOD_MS);
+    le_timer_SetRepeat(timerRef, 0);
+    le_timer_SetHandler(timerRef, GeneratorTimerHandler);
+    le_timer_Start(timerRef);
+
+    le_event_RunLoop();
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map the control block shared with the load harness.
+ *
+ * @return
+ *      - LE_OK on success,
+ *      - LE_FAULT if the file can't be mapped.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t MapBlock
+(
+    void
+)
+{
+    int fd = open(MODEM_LOAD_FILE_PATH, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        LE_ERROR("Unable to open %s: %m", MODEM_LOAD_FILE_PATH);
+        return LE_FAULT;
+    }
+
+    if (ftruncate(fd, sizeof(modemLoad_Block_t)) != 0)
+    {
+        LE_ERROR("Unable to size %s: %m", MODEM_LOAD_FILE_PATH);
+        close(fd);
+        return LE_FAULT;
+    }
+
+    void* addrPtr = mmap(NULL, sizeof(modemLoad_Block_t), PROT_READ | PROT_WRITE, MAP_SHARED,
+                         fd, 0);
+    close(fd);
+
+    if (addrPtr == MAP_FAILED)
+    {
+        LE_ERROR("Unable to map %s: %m", MODEM_LOAD_FILE_PATH);
+        return LE_FAULT;
+    }
+
+    BlockPtr = addrPtr;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Init this component.  Component initializers run in dependency order, so the parts of the
+ * platform adaptor are ready before the modemDaemon registers its handlers.
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+    le_result_t result = MapBlock();
+
+    if (result != LE_OK)
+    {
+        BlockPtr = &LocalBlock;
+    }
+
+    // Start from a clean block: the harness waits for the magic number
+    memset(BlockPtr, 0, sizeof(*BlockPtr));
+    BlockPtr->dataProfileIndex = 1;
+
+    pa_smsLoad_Init();
+    pa_mrcLoad_Init();
+    pa_mdcLoad_Init();
+
+    BlockPtr->magic = MODEM_LOAD_MAGIC;
+
+    if (result == LE_OK)
+    {
+        le_thread_Start(le_thread_Create("LoadGenerator", GeneratorThread, NULL));
+        LE_INFO("Load generator ready, control block %s", MODEM_LOAD_FILE_PATH);
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ * @file pa_load_local.h
+ *
+ * Functions shared by the files of the load platform adaptor.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef PA_LOAD_LOCAL_H_INCLUDE_GUARD
+#define PA_LOAD_LOCAL_H_INCLUDE_GUARD
+
+#include "modemLoad.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the control block shared with the load harness.
+ */
+//--------------------------------------------------------------------------------------------------
+modemLoad_Block_t* pa_load_GetBlock
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record the emission of an event, just before it is reported.
+ *
+ * @return
+ *      Sequence number of the event in its stream.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t pa_load_StampEvent
+(
+    modemLoad_Stream_t stream   ///< [IN] Event stream
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record an event which could not be emitted.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_load_DropEvent
+(
+    modemLoad_Stream_t stream   ///< [IN] Event stream
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the SMS, MRC and MDC parts.  Called before the modemDaemon is initialized.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_smsLoad_Init
+(
+    void
+);
+
+void pa_mrcLoad_Init
+(
+    void
+);
+
+void pa_mdcLoad_Init
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit one event of a stream.  Called by the generator thread; the event is recorded either with
+ * pa_load_StampEvent() or with pa_load_DropEvent().
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_smsLoad_EmitNewMsg
+(
+    void
+);
+
+void pa_mrcLoad_EmitSignalStrength
+(
+    void
+);
+
+void pa_mrcLoad_EmitNetworkReg
+(
+    void
+);
+
+void pa_mdcLoad_EmitSessionState
+(
+    void
+);
+
+#endif // PA_LOAD_LOCAL_H_INCLUDE_GUARD
@@ -0,0 +1,178 @@
+/**
+ * @file pa_mdc_load.c
+ *
+ * Load implementation of @ref c_pa_mdc: data session flaps on the profile set by the load harness.
+ *
+ * The other pa_mdc functions are left to the default platform adaptor.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "pa_mdc.h"
+#include "pa_load_local.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of session state indications in flight.
+ */
+//--------------------------------------------------------------------------------------------------
+#define EVENT_POOL_SIZE             128
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of session state indications, released by the modemDaemon.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(LoadSessionState, EVENT_POOL_SIZE, sizeof(pa_mdc_SessionStateData_t));
+static le_mem_PoolRef_t SessionStatePool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Session state indication event.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_event_Id_t SessionStateEventId;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Current state of the data session, updated by the generator thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static volatile le_mdc_ConState_t SessionState = LE_MDC_DISCONNECTED;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit one data session state change, alternating between connected and disconnected.  Called by
+ * the generator thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mdcLoad_EmitSessionState
+(
+    void
+)
+{
+    pa_mdc_SessionStateData_t* sessionStatePtr = le_mem_TryAlloc(SessionStatePool);
+
+    if (sessionStatePtr == NULL)
+    {
+        pa_load_DropEvent(MODEM_LOAD_DATA_SESSION);
+        return;
+    }
+
+    pa_load_StampEvent(MODEM_LOAD_DATA_SESSION);
+
+    SessionState = (SessionState == LE_MDC_CONNECTED) ? LE_MDC_DISCONNECTED : LE_MDC_CONNECTED;
+
+    memset(sessionStatePtr, 0, sizeof(*sessionStatePtr));
+    sessionStatePtr->profileIndex = pa_load_GetBlock()->dataProfileIndex;
+    sessionStatePtr->newState = SessionState;
+    sessionStatePtr->pdp = LE_MDC_PDP_IPV4;
+    if (SessionState == LE_MDC_DISCONNECTED)
+    {
+        sessionStatePtr->disc = LE_MDC_DISC_REGULAR_DEACTIVATION;
+    }
+
+    le_event_ReportWithRefCounting(SessionStateEventId, sessionStatePtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the index of the default profile (link to the platform)
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_mdc_GetDefaultProfileIndex
+(
+    uint32_t* profileIndexPtr
+)
+{
+    if (profileIndexPtr == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    *profileIndexPtr = pa_load_GetBlock()->dataProfileIndex;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the session state for the given profile
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_FAULT on error
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_mdc_GetSessionState
+(
+    uint32_t profileIndex,                  ///< [IN] The profile to use
+    le_mdc_ConState_t* sessionStatePtr      ///< [OUT] The data session state
+)
+{
+    if (sessionStatePtr == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    *sessionStatePtr = (profileIndex == pa_load_GetBlock()->dataProfileIndex) ?
+                       SessionState : LE_MDC_DISCONNECTED;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Register a handler for session state notifications.
+ *
+ * If the handler is NULL, then the previous handler will be removed.
+ *
+ * @note
+ *      The process exits on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_event_HandlerRef_t pa_mdc_AddSessionStateHandler
+(
+    pa_mdc_SessionStateHandler_t handlerRef, ///< [IN] The session state handler function.
+    void*                        contextPtr  ///< [IN] The context to be given to the handler.
+
+)
+{
+    static le_event_HandlerRef_t sessionStateHandlerRef = NULL;
+
+    if (sessionStateHandlerRef != NULL)
+    {
+        le_event_RemoveHandler(sessionStateHandlerRef);
+        sessionStateHandlerRef = NULL;
+    }
+
+    if (handlerRef != NULL)
+    {
+        sessionStateHandlerRef = le_event_AddHandler("LoadSessionStateHandler",
+                                                     SessionStateEventId,
+                                                     (le_event_HandlerFunc_t) handlerRef);
+        le_event_SetContextPtr(sessionStateHandlerRef, contextPtr);
+    }
+
+    return sessionStateHandlerRef;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the MDC part of the load platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mdcLoad_Init
+(
+    void
+)
+{
+    SessionStatePool = le_mem_InitStaticPool(LoadSessionState, EVENT_POOL_SIZE,
+                                             sizeof(pa_mdc_SessionStateData_t));
+    SessionStateEventId = le_event_CreateIdWithRefCounting("LoadSessionState");
+}
@@ -0,0 +1,427 @@
+/**
+ * @file pa_mrc_load.c
+ *
+ * Load implementation of @ref c_pa_mrc: signal strength and network registration storms, and
+ * neighboring cell lists of a size set by the load harness.
+ *
+ * The indications are allocated from pools of EVENT_POOL_SIZE blocks, which hold them until every
+ * client has been notified.  An indication generated while its pool is exhausted is dropped.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "pa_mrc.h"
+#include "pa_load_local.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of indications of each kind in flight.
+ */
+//--------------------------------------------------------------------------------------------------
+#define EVENT_POOL_SIZE             128
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of cell information blocks, enough for a few lists of the maximum size.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CELL_INFO_POOL_SIZE         (4 * MODEM_LOAD_NEIGHBOR_CELL_MAX)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Range of the generated LTE signal strength, in dBm.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SIGNAL_STRENGTH_MAX         (-60)
+#define SIGNAL_STRENGTH_MIN         (-110)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pools of indications and of cell information.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(LoadNetRegState, EVENT_POOL_SIZE, sizeof(le_mrc_NetRegState_t));
+LE_MEM_DEFINE_STATIC_POOL(LoadSignalStrength, EVENT_POOL_SIZE,
+                          sizeof(pa_mrc_SignalStrengthIndication_t));
+LE_MEM_DEFINE_STATIC_POOL(LoadCellInfo, CELL_INFO_POOL_SIZE, sizeof(pa_mrc_CellInfo_t));
+
+static le_mem_PoolRef_t NetRegStatePool;
+static le_mem_PoolRef_t SignalStrengthPool;
+static le_mem_PoolRef_t CellInfoPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Indication events.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_event_Id_t NetRegStateEventId;
+static le_event_Id_t SignalStrengthEventId;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Current state, updated by the generator thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static volatile le_mrc_NetRegState_t NetRegState = LE_MRC_REG_HOME;
+static volatile int32_t SignalStrength = SIGNAL_STRENGTH_MAX;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of neighboring cell lists retrieved, so that consecutive lists differ.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t CellListCount;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit one signal strength change.  Called by the generator thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mrcLoad_EmitSignalStrength
+(
+    void
+)
+{
+    pa_mrc_SignalStrengthIndication_t* ssIndPtr = le_mem_TryAlloc(SignalStrengthPool);
+
+    if (ssIndPtr == NULL)
+    {
+        pa_load_DropEvent(MODEM_LOAD_SIGNAL);
+        return;
+    }
+
+    uint32_t seq = pa_load_StampEvent(MODEM_LOAD_SIGNAL);
+
+    SignalStrength = SIGNAL_STRENGTH_MAX -
+                     (int32_t)(seq % (SIGNAL_STRENGTH_MAX - SIGNAL_STRENGTH_MIN + 1));
+
+    ssIndPtr->rat = LE_MRC_RAT_LTE;
+    ssIndPtr->ss = SignalStrength;
+
+    le_event_ReportWithRefCounting(SignalStrengthEventId, ssIndPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit one network registration change, alternating between home and roaming.  Called by the
+ * generator thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mrcLoad_EmitNetworkReg
+(
+    void
+)
+{
+    le_mrc_NetRegState_t* statePtr = le_mem_TryAlloc(NetRegStatePool);
+
+    if (statePtr == NULL)
+    {
+        pa_load_DropEvent(MODEM_LOAD_NET_REG);
+        return;
+    }
+
+    pa_load_StampEvent(MODEM_LOAD_NET_REG);
+
+    NetRegState = (NetRegState == LE_MRC_REG_HOME) ? LE_MRC_REG_ROAMING : LE_MRC_REG_HOME;
+    *statePtr = NetRegState;
+
+    le_event_ReportWithRefCounting(NetRegStateEventId, statePtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to get the Radio Module power state.
+ *
+ * @return LE_FAULT  The function failed.
+ * @return LE_OK     The function succeed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_mrc_GetRadioPower
+(
+     le_onoff_t*    powerPtr   ///< [OUT] The power state.
+)
+{
+    if (powerPtr == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    *powerPtr = LE_ON;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to register a handler for Network registration state handling.
+ *
+ * @return A handler reference, which is only needed for later removal of the handler.
+ *
+ * @note Doesn't return on failure, so there's no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_event_HandlerRef_t pa_mrc_AddNetworkRegHandler
+(
+    pa_mrc_NetworkRegHdlrFunc_t regStateHandler ///< [IN] The handler function to handle the
+                                                ///        Network registration state.
+)
+{
+    LE_ASSERT(regStateHandler != NULL);
+
+    return le_event_AddHandler("LoadNetRegStateHandler",
+                               NetRegStateEventId,
+                               (le_event_HandlerFunc_t) regStateHandler);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to unregister the handler for Network registration state handling.
+ *
+ * @note Doesn't return on failure, so there's no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mrc_RemoveNetworkRegHandler
+(
+    le_event_HandlerRef_t handlerRef
+)
+{
+    le_event_RemoveHandler(handlerRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function gets the Network registration state.
+ *
+ * @return LE_BAD_PARAMETER Bad parameter passed to the function
+ * @return LE_FAULT         The function failed.
+ * @return LE_TIMEOUT       No response was received.
+ * @return LE_OK            The function succeeded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_mrc_GetNetworkRegState
+(
+    le_mrc_NetRegState_t* statePtr  ///< [OUT] The network registration state.
+)
+{
+    if (statePtr == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    *statePtr = NetRegState;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function gets the Signal Strength information.
+ *
+ * @return LE_BAD_PARAMETER Bad parameter passed to the function
+ * @return LE_OUT_OF_RANGE  The signal strength values are not known or not detectable.
+ * @return LE_FAULT         The function failed.
+ * @return LE_TIMEOUT       No response was received.
+ * @return LE_OK            The function succeeded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_mrc_GetSignalStrength
+(
+    int32_t*          rssiPtr    ///< [OUT] The received signal strength (in dBm).
+)
+{
+    if (rssiPtr == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    *rssiPtr = SignalStrength;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function gets the Radio Access Technology currently in use.
+ *
+ * @return
+ * - LE_OK              On success
+ * - LE_FAULT           On failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_mrc_GetRadioAccessTechInUse
+(
+    le_mrc_Rat_t*   ratPtr    ///< [OUT] The Radio Access Technology.
+)
+{
+    if (ratPtr == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    *ratPtr = LE_MRC_RAT_LTE;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function retrieves the Neighboring Cells information.
+ * Each cell information is queued in the list specified with the IN/OUT parameter.
+ * Neither add nor remove of elements in the list can be done outside this function.
+ *
+ * @return LE_FAULT          The function failed to retrieve the Neighboring Cells information.
+ * @return a positive value  The function succeeded. The number of cells which the information have
+ *                           been retrieved.
+ */
+//--------------------------------------------------------------------------------------------------
+int32_t pa_mrc_GetNeighborCellsInfo
+(
+    le_dls_List_t*   cellInfoListPtr    ///< [IN/OUT] The Neighboring Cells information.
+)
+{
+    uint32_t cellCount = pa_load_GetBlock()->neighborCellCount;
+    int32_t count = 0;
+
+    if (cellInfoListPtr == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    if (cellCount > MODEM_LOAD_NEIGHBOR_CELL_MAX)
+    {
+        cellCount = MODEM_LOAD_NEIGHBOR_CELL_MAX;
+    }
+
+    // Vary the measurements from one list to the next
+    CellListCount++;
+
+    for (uint32_t i = 0; i < cellCount; i++)
+    {
+        pa_mrc_CellInfo_t* cellInfoPtr = le_mem_ForceAlloc(CellInfoPool);
+
+        memset(cellInfoPtr, 0, sizeof(*cellInfoPtr));
+        cellInfoPtr->link = LE_DLS_LINK_INIT;
+        cellInfoPtr->index = i;
+        cellInfoPtr->id = 0x1000 + i;
+        cellInfoPtr->physCellId = (uint16_t) i;
+        cellInfoPtr->lac = 0xFFFF;
+        cellInfoPtr->rat = LE_MRC_RAT_LTE;
+        cellInfoPtr->rxLevel = (int16_t)(SIGNAL_STRENGTH_MAX - ((CellListCount + i) % 40));
+        cellInfoPtr->lteIntraRsrp = -800 - (int32_t)((CellListCount + i) % 400);
+        cellInfoPtr->lteIntraRsrq = -100 - (int32_t)((CellListCount + i) % 100);
+        cellInfoPtr->lteInterRsrp = cellInfoPtr->lteIntraRsrp - 20;
+        cellInfoPtr->lteInterRsrq = cellInfoPtr->lteIntraRsrq - 10;
+        cellInfoPtr->earfcn = 6300;
+
+        le_dls_Queue(cellInfoListPtr, &cellInfoPtr->link);
+        count++;
+    }
+
+    return (count > 0) ? count : LE_FAULT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to delete the list of neighboring cells information.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mrc_DeleteNeighborCellsInfo
+(
+    le_dls_List_t *cellInfoListPtr ///< [IN] list of pa_mrc_CellInfo_t
+)
+{
+    le_dls_Link_t* linkPtr;
+
+    while ((linkPtr = le_dls_Pop(cellInfoListPtr)) != NULL)
+    {
+        le_mem_Release(CONTAINER_OF(linkPtr, pa_mrc_CellInfo_t, link));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to register a handler for Signal Strength change handling.
+ *
+ * @return A handler reference, which is only needed for later removal of the handler.
+ *
+ * @note Doesn't return on failure, so there's no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_event_HandlerRef_t pa_mrc_AddSignalStrengthIndHandler
+(
+    pa_mrc_SignalStrengthIndHdlrFunc_t ssIndHandler, ///< [IN] The handler function to handle the
+                                                     ///        Signal Strength change indication.
+    void*                              contextPtr    ///< [IN] The context to be given to the handler.
+)
+{
+    LE_ASSERT(ssIndHandler != NULL);
+
+    le_event_HandlerRef_t handlerRef;
+
+    handlerRef = le_event_AddHandler("LoadSignalStrengthHandler",
+                                     SignalStrengthEventId,
+                                     (le_event_HandlerFunc_t) ssIndHandler);
+    le_event_SetContextPtr(handlerRef, contextPtr);
+
+    return handlerRef;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to unregister the handler for Signal Strength change handling.
+ *
+ * @note Doesn't return on failure, so there's no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mrc_RemoveSignalStrengthIndHandler
+(
+    le_event_HandlerRef_t handlerRef
+)
+{
+    le_event_RemoveHandler(handlerRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to set and activate the signal strength thresholds for signal
+ * strength indications
+ *
+ * @return
+ *  - LE_FAULT  Function failed.
+ *  - LE_OK     Function succeeded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_mrc_SetSignalStrengthIndThresholds
+(
+    le_mrc_Rat_t rat,                 ///< [IN] Radio Access Technology
+    int32_t      lowerRangeThreshold, ///< [IN] lower-range threshold in dBm
+    int32_t      upperRangeThreshold  ///< [IN] upper-range strength threshold in dBm
+)
+{
+    // Every generated change is reported, whatever the thresholds
+    LE_DEBUG("RAT %d, thresholds [%" PRIi32 ", %" PRIi32 "] ignored",
+             rat, lowerRangeThreshold, upperRangeThreshold);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the MRC part of the load platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_mrcLoad_Init
+(
+    void
+)
+{
+    NetRegStatePool = le_mem_InitStaticPool(LoadNetRegState, EVENT_POOL_SIZE,
+                                            sizeof(le_mrc_NetRegState_t));
+    SignalStrengthPool = le_mem_InitStaticPool(LoadSignalStrength, EVENT_POOL_SIZE,
+                                               sizeof(pa_mrc_SignalStrengthIndication_t));
+    CellInfoPool = le_mem_InitStaticPool(LoadCellInfo, CELL_INFO_POOL_SIZE,
+                                         sizeof(pa_mrc_CellInfo_t));
+
+    NetRegStateEventId = le_event_CreateIdWithRefCounting("LoadNetRegState");
+    SignalStrengthEventId = le_event_CreateIdWithRefCounting("LoadSignalStrength");
+}
@@ -0,0 +1,360 @@
+/**
+ * @file pa_sms_load.c
+ *
+ * Load implementation of @ref c_pa_sms: incoming SMS storms.
+ *
+ * Each generated SMS is an SMS-DELIVER PDU with 8-bit data "LOAD <seq>", where seq is the sequence
+ * number of the event in the MODEM_LOAD_SMS stream.  The PDU is kept in a simulated storage until
+ * it is deleted with pa_sms_DelMsgFromMem(); an SMS arriving while the storage is full is dropped.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "pa_sms.h"
+#include "pa_load_local.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of messages held by the simulated storage.
+ */
+//--------------------------------------------------------------------------------------------------
+#define STORAGE_SIZE                256
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Originating address of the generated messages, in international format.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ORIGINATING_ADDRESS         "15555550100"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stored message.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_sms_Status_t status;                     ///< Status in storage
+    uint32_t        pduLen;                     ///< PDU length
+    uint8_t         pdu[LE_SMS_PDU_MAX_BYTES];  ///< PDU, including the (empty) SMSC information
+}
+StoredSms_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of stored messages.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(LoadSms, STORAGE_SIZE, sizeof(StoredSms_t));
+static le_mem_PoolRef_t StoredSmsPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Simulated storage, indexed by message index.  Shared by the generator thread and the modemDaemon
+ * main thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static StoredSms_t* Storage[STORAGE_SIZE];
+static le_mutex_Ref_t StorageMutex;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * New message indication event, and the handler set by the modemDaemon.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_event_Id_t NewMsgEventId;
+static le_event_HandlerRef_t NewMsgHandlerRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Encode the SMS-DELIVER PDU of a generated message.
+ *
+ * @return
+ *      PDU length.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t EncodeDeliverPdu
+(
+    uint32_t seq,       ///< [IN] Sequence number of the message
+    uint8_t* pduPtr     ///< [OUT] PDU buffer, at least LE_SMS_PDU_MAX_BYTES
+)
+{
+    const char* addrPtr = ORIGINATING_ADDRESS;
+    size_t addrLen = strlen(addrPtr);
+    uint32_t pos = 0;
+    char text[32];
+
+    pduPtr[pos++] = 0x00;                       // No SMSC information
+    pduPtr[pos++] = 0x04;                       // SMS-DELIVER, no more messages to send
+    pduPtr[pos++] = (uint8_t) addrLen;          // Originating address: digit count,
+    pduPtr[pos++] = 0x91;                       // international numbering
+
+    for (size_t i = 0; i < addrLen; i += 2)
+    {
+        uint8_t high = (i + 1 < addrLen) ? (uint8_t)(addrPtr[i + 1] - '0') : 0x0F;
+        pduPtr[pos++] = (uint8_t)((high << 4) | (uint8_t)(addrPtr[i] - '0'));
+    }
+
+    pduPtr[pos++] = 0x00;                       // Protocol identifier
+    pduPtr[pos++] = 0x04;                       // Data coding scheme: 8-bit data
+
+    // Service centre time stamp, semi-octets: 26/01/01 00:00:00 UTC
+    static const uint8_t scts[] = { 0x62, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00 };
+    memcpy(&pduPtr[pos], scts, sizeof(scts));
+    pos += sizeof(scts);
+
+    int textLen = snprintf(text, sizeof(text), "LOAD %" PRIu32, seq);
+    pduPtr[pos++] = (uint8_t) textLen;          // User data length
+    memcpy(&pduPtr[pos], text, textLen);
+    pos += textLen;
+
+    return pos;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Emit one new message.  Called by the generator thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_smsLoad_EmitNewMsg
+(
+    void
+)
+{
+    StoredSms_t* smsPtr = le_mem_TryAlloc(StoredSmsPool);
+    uint32_t index;
+
+    if (smsPtr == NULL)
+    {
+        pa_load_DropEvent(MODEM_LOAD_SMS);
+        return;
+    }
+
+    le_mutex_Lock(StorageMutex);
+    for (index = 0; index < STORAGE_SIZE; index++)
+    {
+        if (Storage[index] == NULL)
+        {
+            Storage[index] = smsPtr;
+            break;
+        }
+    }
+
+    // The pool has as many blocks as the storage has slots
+    LE_ASSERT(index < STORAGE_SIZE);
+
+    smsPtr->status = LE_SMS_RX_UNREAD;
+    smsPtr->pduLen = EncodeDeliverPdu(pa_load_StampEvent(MODEM_LOAD_SMS), smsPtr->pdu);
+    le_mutex_Unlock(StorageMutex);
+
+    pa_sms_NewMessageIndication_t indication;
+
+    memset(&indication, 0, sizeof(indication));
+    indication.msgIndex = index;
+#ifndef MK_CONFIG_SMS_LIGHT
+    indication.protocol = PA_SMS_PROTOCOL_GSM;
+    indication.storage = PA_SMS_STORAGE_NV;
+#endif
+
+    le_event_Report(NewMsgEventId, &indication, sizeof(indication));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to register a handler function for new message indications.
+ *
+ * @return LE_FAULT         The function failed to register a new handler.
+ * @return LE_OK            The function succeeded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_sms_SetNewMsgHandler
+(
+    pa_sms_NewMsgHdlrFunc_t msgHandler   ///< [IN] The handler function to handle a new message
+                                         ///       reception.
+)
+{
+    if (msgHandler == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    if (NewMsgHandlerRef != NULL)
+    {
+        le_event_RemoveHandler(NewMsgHandlerRef);
+    }
+
+    NewMsgHandlerRef = le_event_AddHandler("LoadNewMsgHandler",
+                                           NewMsgEventId,
+                                           (le_event_HandlerFunc_t) msgHandler);
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to unregister the handler function.
+ *
+ * @return LE_FAULT         The function failed to unregister the handler.
+ * @return LE_OK            The function succeeded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_sms_ClearNewMsgHandler
+(
+    void
+)
+{
+    if (NewMsgHandlerRef != NULL)
+    {
+        le_event_RemoveHandler(NewMsgHandlerRef);
+        NewMsgHandlerRef = NULL;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to get the message from the preferred message storage.
+ *
+ * @return LE_FAULT        The function failed to get the message from the preferred message
+ *                         storage.
+ * @return LE_OK           The function succeeded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_sms_RdPDUMsgFromMem
+(
+    uint32_t            index,      ///< [IN]  The place of storage in memory.
+    pa_sms_Protocol_t   protocol,   ///< [IN] The protocol used for this message
+    pa_sms_Storage_t    storage,    ///< [IN] SMS Storage used
+    pa_sms_Pdu_t*       msgPtr      ///< [OUT] The message.
+)
+{
+    le_result_t result = LE_FAULT;
+
+    LE_UNUSED(storage);
+
+    if ((index >= STORAGE_SIZE) || (protocol != PA_SMS_PROTOCOL_GSM) || (msgPtr == NULL))
+    {
+        return LE_FAULT;
+    }
+
+    le_mutex_Lock(StorageMutex);
+    if (Storage[index] != NULL)
+    {
+        memset(msgPtr, 0, sizeof(*msgPtr));
+        msgPtr->status = Storage[index]->status;
+        msgPtr->protocol = PA_SMS_PROTOCOL_GSM;
+        msgPtr->dataLen = Storage[index]->pduLen;
+        memcpy(msgPtr->data, Storage[index]->pdu, Storage[index]->pduLen);
+
+        // A message read from storage is no longer unread
+        Storage[index]->status = LE_SMS_RX_READ;
+        result = LE_OK;
+    }
+    le_mutex_Unlock(StorageMutex);
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to get the indexes of messages stored in the preferred memory for a
+ * specific status.
+ *
+ * @return LE_FAULT        The function failed to get the indexes of messages stored in the
+ *                         preferred memory.
+ * @return LE_OK           The function succeeded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_sms_ListMsgFromMem
+(
+    le_sms_Status_t     status,     ///< [IN] The status of message in memory.
+    pa_sms_Protocol_t   protocol,   ///< [IN] The protocol to read
+    uint32_t           *numPtr,     ///< [OUT] The number of indexes retrieved.
+    uint32_t           *idxPtr,     ///< [OUT] The pointer to an array of indexes.
+                                    ///        The array is filled with 'num' index values.
+    pa_sms_Storage_t    storage     ///< [IN] SMS Storage used
+)
+{
+    LE_UNUSED(storage);
+
+    if ((numPtr == NULL) || (idxPtr == NULL))
+    {
+        return LE_FAULT;
+    }
+
+    *numPtr = 0;
+    if (protocol != PA_SMS_PROTOCOL_GSM)
+    {
+        return LE_OK;
+    }
+
+    le_mutex_Lock(StorageMutex);
+    for (uint32_t index = 0; index < STORAGE_SIZE; index++)
+    {
+        if ((Storage[index] != NULL) && (Storage[index]->status == status))
+        {
+            idxPtr[(*numPtr)++] = index;
+        }
+    }
+    le_mutex_Unlock(StorageMutex);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to delete one specific Message from preferred message storage.
+ *
+ * @return LE_FAULT        The function failed to delete one specific Message from preferred
+ *                         message storage.
+ * @return LE_OK           The function succeeded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t pa_sms_DelMsgFromMem
+(
+    uint32_t            index,    ///< [IN] Index of the message to be deleted.
+    pa_sms_Protocol_t   protocol, ///< [IN] protocol
+    pa_sms_Storage_t    storage   ///< [IN] SMS Storage used
+)
+{
+    StoredSms_t* smsPtr = NULL;
+
+    LE_UNUSED(protocol);
+    LE_UNUSED(storage);
+
+    if (index >= STORAGE_SIZE)
+    {
+        return LE_FAULT;
+    }
+
+    le_mutex_Lock(StorageMutex);
+    smsPtr = Storage[index];
+    Storage[index] = NULL;
+    le_mutex_Unlock(StorageMutex);
+
+    if (smsPtr == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    le_mem_Release(smsPtr);
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the SMS part of the load platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_smsLoad_Init
+(
+    void
+)
+{
+    StoredSmsPool = le_mem_InitStaticPool(LoadSms, STORAGE_SIZE, sizeof(StoredSms_t));
+    StorageMutex = le_mutex_CreateNonRecursive("LoadSmsStorage");
+    NewMsgEventId = le_event_CreateId("LoadNewMsg", sizeof(pa_sms_NewMessageIndication_t));
+}
@@ -24,6 +24,9 @@
 /// Maximum expected position handlers
 #define GNSS_POSITION_HANDLER_HIGH       1
 
+/// Maximum expected fix batch handlers
+#define GNSS_FIX_BATCH_HANDLER_HIGH      1
+
 /// Some platforms don't define O_CLOEXEC.  If not defined, define it as 0 (no effect)
 #ifndef O_CLOEXEC
 #define O_CLOEXEC 0
@@ -207,6 +210,24 @@ typedef struct le_gnss_PositionHandler
 }
 le_gnss_PositionHandler_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fix batch Handler structure.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_gnss_FixBatchHandlerFunc_t handlerFuncPtr;      ///< The handler function address.
+    void*                         handlerContextPtr;   ///< The handler function context.
+    le_msg_SessionRef_t           sessionRef;          ///< Store message session reference.
+    uint32_t                      batchSize;           ///< Number of fixes per batch.
+    size_t                        fixCount;            ///< Number of fixes buffered.
+    le_gnss_Fix_t                 fixList[LE_GNSS_FIX_BATCH_MAX]; ///< Buffered fixes.
+    le_dls_Link_t                 link;                ///< Object node link
+}
+le_gnss_FixBatchHandler_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Position sample request objet structure.
@@ -296,6 +317,31 @@ static int32_t NumOfPositionHandlers = 0;
 //--------------------------------------------------------------------------------------------------
 static le_dls_List_t PositionHandlerList = LE_DLS_LIST_DECL_INIT;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Static memory pool for fix batch handlers
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(FixBatchHandler,
+                          GNSS_FIX_BATCH_HANDLER_HIGH,
+                          sizeof(le_gnss_FixBatchHandler_t));
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory Pool for fix batch handlers.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t   FixBatchHandlerPoolRef;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create and initialize the fix batch handlers list.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t FixBatchHandlerList = LE_DLS_LIST_DECL_INIT;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Memory Pool for position samples.
@@ -388,206 +434,345 @@ static le_ref_MapRef_t PositionSampleMap;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t ClientRequestRefMap;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Whether the NMEA frames are received from the PA, i.e. the NMEA flow is managed by Legato.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsNmeaFlowManaged = false;
+
 #ifndef MK_CONFIG_DISABLE_AT_GNSS
 //--------------------------------------------------------------------------------------------------
 /**
- * NMEA pipe file descriptor
+ * NMEA reader structure: the NMEA FIFO or a NMEA stream opened by a client.
  */
 //--------------------------------------------------------------------------------------------------
-static int NmeaPipeFd = -1;
+typedef struct
+{
+    int                 fd;                 ///< File descriptor the NMEA frames are written to
+    le_fdMonitor_Ref_t  fdMonitorRef;       ///< FD monitor, to resume writing on POLLOUT
+    bool                isPollOutEnabled;   ///< POLLOUT is enabled on the FD monitor
+    uint64_t            offset;             ///< Offset of the next byte to write in NmeaBuffer
+    bool                isMidFrame;         ///< The last byte written does not end a frame
+    uint64_t            droppedBytes;       ///< Number of bytes lost because the reader lagged
+    le_msg_SessionRef_t sessionRef;         ///< Client session, NULL for the NMEA FIFO
+    le_dls_Link_t       link;               ///< Link in NmeaReaderList
+}
+le_gnss_NmeaReader_t;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Reference to the FD Monitor for the NMEA stream
+ * Pool for the NMEA readers: the NMEA streams opened by clients and the NMEA FIFO.
  */
 //--------------------------------------------------------------------------------------------------
-static le_fdMonitor_Ref_t NmeaFdMonitor = NULL;
+LE_MEM_DEFINE_STATIC_POOL(NmeaReader,
+                          LE_CONFIG_GNSS_NMEA_STREAM_MAX + 1,
+                          sizeof(le_gnss_NmeaReader_t));
+static le_mem_PoolRef_t NmeaReaderPoolRef;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * List of the NMEA readers.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t NmeaReaderList = LE_DLS_LIST_DECL_INIT;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Current FD monitor enable/disable state
+ * NMEA reader of the NMEA FIFO, NULL when the FIFO is not opened.
  */
 //--------------------------------------------------------------------------------------------------
-static bool FdMonitorDisabled = true;
+static le_gnss_NmeaReader_t* NmeaFifoReaderPtr = NULL;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * NMEA sentence to write to NMEA fifo
+ * Number of NMEA streams opened by clients.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t NmeaStreamCount = 0;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Circular buffer holding the latest NMEA frames, each one with its terminating null byte.
+ *
+ * The frames are written once in that buffer and every reader is served from its own offset, so
+ * that a reader lagging behind only loses the oldest frames and never slows down the others.
  */
 //--------------------------------------------------------------------------------------------------
-static char* CurrentNmeaStringPtr = NULL;
+static char NmeaBuffer[LE_CONFIG_GNSS_NMEA_BUFFER_SIZE];
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Position in NMEA sentence
+ * Offset of the end of the last frame written in NmeaBuffer, counted from the first frame ever
+ * written.
  */
 //--------------------------------------------------------------------------------------------------
-static ssize_t  CurrentNmeaWritePosition = 0;
+static uint64_t NmeaBufferHead = 0;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Close the NMEA pipe
+ * Offset of the oldest frame still available in NmeaBuffer.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t CloseNmeaPipe
+static uint64_t NmeaBufferTail = 0;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close a NMEA reader and release it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CloseNmeaReader
 (
-    void
+    le_gnss_NmeaReader_t* readerPtr     ///< [IN] NMEA reader
 )
 {
     int result;
 
-    // Check NMEA pipe file descriptor
-    if(NmeaPipeFd == -1)
+    if (readerPtr->droppedBytes)
     {
-        LE_WARN("Pipe already closed");
-        return LE_DUPLICATE;
+        LE_WARN("NMEA reader %p lost %" PRIu64 " bytes", readerPtr, readerPtr->droppedBytes);
     }
 
-    // Close NMEA pipe
+    le_fdMonitor_Delete(readerPtr->fdMonitorRef);
+
     do
     {
-        result = le_fd_Close(NmeaPipeFd);
+        result = le_fd_Close(readerPtr->fd);
     }
     while ((result != 0) && (errno == EINTR));
 
     if (0 != result)
     {
-        LE_ERROR("Could not close %s. errno.%d (%s)", LE_GNSS_NMEA_NODE_PATH,
+        LE_ERROR("Could not close NMEA reader fd %d. errno.%d (%s)", readerPtr->fd,
                  errno, LE_ERRNO_TXT(errno));
-        return LE_FAULT;
     }
 
-    // Release the NMEA pipe file descriptor
-    NmeaPipeFd = -1;
-    if (NmeaFdMonitor)
+    if (readerPtr == NmeaFifoReaderPtr)
+    {
+        NmeaFifoReaderPtr = NULL;
+    }
+    else
     {
-        le_fdMonitor_Delete(NmeaFdMonitor);
-        NmeaFdMonitor = NULL;
+        NmeaStreamCount--;
     }
 
-    return LE_OK;
+    le_dls_Remove(&NmeaReaderList, &readerPtr->link);
+    le_mem_Release(readerPtr);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Write the NMEA sentence to NMEA pipe
+ * Write to a NMEA reader all the frames it has not received yet, as long as it accepts them.
+ *
+ * @return
+ *  - LE_OK            All the frames have been written.
+ *  - LE_WOULD_BLOCK   The reader does not accept more data for now.
+ *  - LE_FAULT         The reader can't be written anymore.
  */
 //--------------------------------------------------------------------------------------------------
-static void WriteNmeaPipe
+static le_result_t FlushNmeaReader
 (
-   char* nmeaString        // [IN] The NMEA string
+    le_gnss_NmeaReader_t* readerPtr     ///< [IN] NMEA reader
 )
 {
-    // Increment by one to add the terminating null byte
-    size_t stringSize = strlen(nmeaString)+1;
-    size_t sizeToWrite = stringSize - CurrentNmeaWritePosition;
+    ssize_t writeSize = 0;
 
-    ssize_t writeSize = le_fd_Write(NmeaPipeFd,
-                                   nmeaString + CurrentNmeaWritePosition,
-                                   sizeToWrite);
+    if (readerPtr->offset < NmeaBufferTail)
+    {
+        // The reader lagged behind: the frames it has not received yet were overwritten.
+        if (readerPtr->isMidFrame)
+        {
+            // Terminate the truncated frame before resuming with a complete one
+            writeSize = le_fd_Write(readerPtr->fd, "", 1);
+            if (1 != writeSize)
+            {
+                goto writeError;
+            }
+            readerPtr->isMidFrame = false;
+        }
 
-    LE_DEBUG("resultWrite %zd / %zd, error, errno.%d (%s)",writeSize, sizeToWrite, errno,
-             LE_ERRNO_TXT(errno));
+        LE_DEBUG("NMEA reader %p lagged behind, %" PRIu64 " bytes dropped",
+                 readerPtr, NmeaBufferTail - readerPtr->offset);
+        readerPtr->droppedBytes += NmeaBufferTail - readerPtr->offset;
+        readerPtr->offset = NmeaBufferTail;
+    }
 
-    if (-1 != writeSize)
+    // Write as many frames as possible at once: only the wrap-around of the buffer splits them.
+    while (readerPtr->offset < NmeaBufferHead)
     {
-        if (!writeSize)
+        size_t index = readerPtr->offset % LE_CONFIG_GNSS_NMEA_BUFFER_SIZE;
+        size_t sizeToWrite = LE_CONFIG_GNSS_NMEA_BUFFER_SIZE - index;
+
+        if ((NmeaBufferHead - readerPtr->offset) < sizeToWrite)
         {
-            LE_ERROR("EOF error");
-            goto error;
+            sizeToWrite = NmeaBufferHead - readerPtr->offset;
         }
 
-        if (writeSize == sizeToWrite)
+        writeSize = le_fd_Write(readerPtr->fd, &NmeaBuffer[index], sizeToWrite);
+        if (writeSize <= 0)
         {
-            // NMEA frame was completely writen
-            LE_DEBUG("Frame completely writen");
-
-            le_mem_Release(nmeaString);
-            CurrentNmeaStringPtr = NULL;
-            CurrentNmeaWritePosition = 0;
-            if (!FdMonitorDisabled)
-            {
-                le_fdMonitor_Disable(NmeaFdMonitor, POLLOUT);
-                FdMonitorDisabled = true;
-            }
-            return;
+            goto writeError;
         }
 
-        if (writeSize < sizeToWrite)
+        readerPtr->offset += writeSize;
+        readerPtr->isMidFrame = ('\0' != NmeaBuffer[index + writeSize - 1]);
+
+        if ((size_t)writeSize < sizeToWrite)
         {
-            // Wait for the next POLLOUT to complete the frame
-            LE_DEBUG("Wait for the next POLLOUT to complete the frame");
+            // Wait for the next POLLOUT to write the rest
+            return LE_WOULD_BLOCK;
+        }
+    }
 
-            CurrentNmeaStringPtr     = nmeaString;
-            CurrentNmeaWritePosition += writeSize;
+    return LE_OK;
 
-            if (FdMonitorDisabled)
-            {
-                le_fdMonitor_Enable(NmeaFdMonitor, POLLOUT);
-                FdMonitorDisabled = false;
-            }
-            return;
-        }
+writeError:
+    if ((writeSize < 0) && ((errno == EINTR) || (errno == EAGAIN)))
+    {
+        return LE_WOULD_BLOCK;
+    }
+
+    LE_WARN_IF(writeSize < 0, "Could not write to NMEA reader %p (errno.%d (%s))",
+               readerPtr, errno, LE_ERRNO_TXT(errno));
+    return LE_FAULT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Serve a NMEA reader: write the pending frames, and monitor POLLOUT while some remain. The
+ * reader is closed if it can't be written anymore.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ServeNmeaReader
+(
+    le_gnss_NmeaReader_t* readerPtr     ///< [IN] NMEA reader
+)
+{
+    le_result_t result = FlushNmeaReader(readerPtr);
 
-        LE_ERROR("Fifo write error");
+    if (LE_FAULT == result)
+    {
+        CloseNmeaReader(readerPtr);
+        return;
     }
-    else
+
+    if ((LE_WOULD_BLOCK == result) && (!readerPtr->isPollOutEnabled))
     {
-        if ((errno == EINTR) || (errno == EAGAIN))
-        {
-            // Retry writing the frame
-            LE_DEBUG("Retry writing the frame");
+        le_fdMonitor_Enable(readerPtr->fdMonitorRef, POLLOUT);
+        readerPtr->isPollOutEnabled = true;
+    }
+    else if ((LE_OK == result) && (readerPtr->isPollOutEnabled))
+    {
+        le_fdMonitor_Disable(readerPtr->fdMonitorRef, POLLOUT);
+        readerPtr->isPollOutEnabled = false;
+    }
+}
 
-            CurrentNmeaStringPtr = nmeaString;
+//--------------------------------------------------------------------------------------------------
+/**
+ * Event handler for a NMEA reader file descriptor.
+ */
+//--------------------------------------------------------------------------------------------------
+static void NmeaEventsHandler
+(
+    int fd,                 ///< [IN] Write file descriptor
+    short events            ///< [IN] FD events
+)
+{
+    le_gnss_NmeaReader_t* readerPtr = le_fdMonitor_GetContextPtr();
 
-            if (FdMonitorDisabled)
-            {
-                le_fdMonitor_Enable(NmeaFdMonitor, POLLOUT);
-                FdMonitorDisabled = false;
-            }
-            return;
+    LE_DEBUG("Received NMEA reader event: %x", events);
 
-        }
+    if (events & (POLLERR | POLLHUP))
+    {
+        // The read end has been closed
+        LE_DEBUG("NMEA reader %p closed", readerPtr);
+        CloseNmeaReader(readerPtr);
+        return;
+    }
 
-        LE_ERROR("Could not write to %s (write error, errno.%d (%s))",
-                     LE_GNSS_NMEA_NODE_PATH,
-                     errno, LE_ERRNO_TXT(errno));
+    if (events & POLLOUT)
+    {
+        ServeNmeaReader(readerPtr);
     }
+}
 
-error:
-    le_mem_Release(nmeaString);
-    CurrentNmeaWritePosition = 0;
-    CurrentNmeaStringPtr = NULL;
-    CloseNmeaPipe();
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a NMEA reader. It receives the frames added after its creation.
+ *
+ * @return The NMEA reader.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_gnss_NmeaReader_t* CreateNmeaReader
+(
+    const char*         namePtr,    ///< [IN] Name of the FD monitor
+    int                 fd,         ///< [IN] Non-blocking file descriptor to write to
+    le_msg_SessionRef_t sessionRef  ///< [IN] Client session, NULL for the NMEA FIFO
+)
+{
+    le_gnss_NmeaReader_t* readerPtr = le_mem_ForceAlloc(NmeaReaderPoolRef);
+
+    readerPtr->fd = fd;
+    readerPtr->offset = NmeaBufferHead;
+    readerPtr->isMidFrame = false;
+    readerPtr->droppedBytes = 0;
+    readerPtr->sessionRef = sessionRef;
+    readerPtr->link = LE_DLS_LINK_INIT;
+
+    readerPtr->fdMonitorRef = le_fdMonitor_Create(namePtr, fd, NmeaEventsHandler, POLLOUT);
+    le_fdMonitor_SetContextPtr(readerPtr->fdMonitorRef, readerPtr);
+    le_fdMonitor_Disable(readerPtr->fdMonitorRef, POLLOUT);
+    readerPtr->isPollOutEnabled = false;
 
+    le_dls_Queue(&NmeaReaderList, &readerPtr->link);
+
+    return readerPtr;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Event handler for NMEA frames writing to FIFO
+ * Add a NMEA frame to the NMEA buffer, dropping the oldest frames to make room for it.
  */
 //--------------------------------------------------------------------------------------------------
-static void NmeaEventsHandler
+static void AddNmeaFrame
 (
-    int fd,                 ///< [IN] Read file descriptor
-    short events            ///< [IN] FD events
+    const char* nmeaPtr     ///< [IN] The NMEA string
 )
 {
-    LE_DEBUG("Received FIFO event: %x", events);
+    // Increment by one to add the terminating null byte
+    size_t frameSize = strlen(nmeaPtr) + 1;
 
-    if (events & POLLOUT)
+    if (frameSize > LE_CONFIG_GNSS_NMEA_BUFFER_SIZE)
     {
-        if (CurrentNmeaStringPtr)
+        LE_WARN("NMEA frame of %zu bytes larger than the NMEA buffer, dropped", frameSize);
+        return;
+    }
+
+    // Drop the oldest frames until the new one fits
+    while ((NmeaBufferHead + frameSize - NmeaBufferTail) > LE_CONFIG_GNSS_NMEA_BUFFER_SIZE)
+    {
+        while ('\0' != NmeaBuffer[NmeaBufferTail % LE_CONFIG_GNSS_NMEA_BUFFER_SIZE])
         {
-            WriteNmeaPipe(CurrentNmeaStringPtr);
+            NmeaBufferTail++;
         }
+        NmeaBufferTail++;
     }
 
-    if (events & POLLERR)
+    size_t index = NmeaBufferHead % LE_CONFIG_GNSS_NMEA_BUFFER_SIZE;
+    size_t firstPartSize = LE_CONFIG_GNSS_NMEA_BUFFER_SIZE - index;
+
+    if (frameSize <= firstPartSize)
     {
-        LE_DEBUG("Event POLLERR");
+        memcpy(&NmeaBuffer[index], nmeaPtr, frameSize);
     }
+    else
+    {
+        memcpy(&NmeaBuffer[index], nmeaPtr, firstPartSize);
+        memcpy(NmeaBuffer, nmeaPtr + firstPartSize, frameSize - firstPartSize);
+    }
+
+    NmeaBufferHead += frameSize;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -600,8 +785,10 @@ static le_result_t OpenNmeaPipe
     void
 )
 {
+    int nmeaPipeFd;
+
     // Check NMEA pipe file descriptor
-    if (NmeaPipeFd != -1)
+    if (NULL != NmeaFifoReaderPtr)
     {
         LE_DEBUG("Nmea Pipe is already open");
         return LE_DUPLICATE;
@@ -611,9 +798,9 @@ static le_result_t OpenNmeaPipe
     LE_DEBUG("Open Nmea Pipe");
     do
     {
-        NmeaPipeFd = le_fd_Open(LE_GNSS_NMEA_NODE_PATH, O_WRONLY|O_APPEND|O_CLOEXEC|O_NONBLOCK);
+        nmeaPipeFd = le_fd_Open(LE_GNSS_NMEA_NODE_PATH, O_WRONLY|O_APPEND|O_CLOEXEC|O_NONBLOCK);
 
-        if ((NmeaPipeFd == -1) && (errno != EINTR))
+        if ((nmeaPipeFd == -1) && (errno != EINTR))
         {
             LE_WARN_IF(errno != ENXIO,
                        "Open %s failure: errno.%d (%s)",
@@ -623,15 +810,10 @@ static le_result_t OpenNmeaPipe
             return LE_FAULT;
         }
 
-    }while (NmeaPipeFd == -1);
+    }while (nmeaPipeFd == -1);
 
-    if (!NmeaFdMonitor)
-    {
-        NmeaFdMonitor = le_fdMonitor_Create("NmeaPipe", NmeaPipeFd, NmeaEventsHandler, POLLOUT);
+    NmeaFifoReaderPtr = CreateNmeaReader("NmeaPipe", nmeaPipeFd, NULL);
 
-        le_fdMonitor_Disable(NmeaFdMonitor, POLLOUT);
-        FdMonitorDisabled = true;
-    }
     return LE_OK;
 }
 #endif //MK_CONFIG_DISABLE_AT_GNSS
@@ -753,6 +935,8 @@ static void PaNmeaHandler
 )
 {
 #ifndef MK_CONFIG_DISABLE_AT_GNSS
+    le_dls_Link_t* linkPtr;
+
     LE_DEBUG("NMEA Handler %s", nmeaPtr);
 
     // Open the NMEA FIFO pipe
@@ -760,20 +944,25 @@ static void PaNmeaHandler
     if ((resultNmeaPipe != LE_OK) && (resultNmeaPipe != LE_DUPLICATE))
     {
         LE_DEBUG("Could not open Nmea Pipe");
-        le_mem_Release(nmeaPtr);
-        return;
     }
 
-    if (NULL != CurrentNmeaStringPtr)
+    AddNmeaFrame(nmeaPtr);
+    le_mem_Release(nmeaPtr);
+
+    // Readers already waiting for POLLOUT get the new frame with the pending ones
+    linkPtr = le_dls_Peek(&NmeaReaderList);
+    while (NULL != linkPtr)
     {
-        // The last frame (CurrentNmeaStringPtr) was not sent completely, discard the new one
-        LE_WARN("Lost Frame");
-        le_mem_Release(nmeaPtr);
-        return;
-    }
+        le_gnss_NmeaReader_t* readerPtr = CONTAINER_OF(linkPtr, le_gnss_NmeaReader_t, link);
+
+        // Get the next link first, the reader may be closed
+        linkPtr = le_dls_PeekNext(&NmeaReaderList, linkPtr);
 
-    CurrentNmeaWritePosition = 0;
-    WriteNmeaPipe(nmeaPtr);
+        if (!readerPtr->isPollOutEnabled)
+        {
+            ServeNmeaReader(readerPtr);
+        }
+    }
 #else
     LE_DEBUG("AT GNSS disabled, dropping this NMEA frames notification");
 
@@ -1008,18 +1197,18 @@ static le_gnss_Client_t* GetClientSessionReference
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Convert the DOP value in the selected resolution.
+ * Convert the DOP value in the resolution selected by a client session.
  */
 //--------------------------------------------------------------------------------------------------
-static uint32_t ConvertDop
+static uint32_t ConvertDopForSession
 (
-    uint32_t dopValue    ///< [IN] Dilution of Precision value to convert.
+    le_msg_SessionRef_t sessionRef,  ///< [IN] Client session.
+    uint32_t dopValue                ///< [IN] Dilution of Precision value to convert.
 )
 {
     uint16_t resValue = 0;
 
     le_gnss_Client_t* clientRequestPtr = NULL;
-    le_msg_SessionRef_t sessionRef = le_gnss_GetClientSessionRef();
     le_gnss_Resolution_t resolution = LE_GNSS_RES_UNKNOWN;
 
     clientRequestPtr = FindClientSessionReference(sessionRef);
@@ -1053,22 +1242,35 @@ static uint32_t ConvertDop
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Convert the position data in the selected resolution.
+ * Convert the DOP value in the selected resolution.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t ConvertDop
+(
+    uint32_t dopValue    ///< [IN] Dilution of Precision value to convert.
+)
+{
+    return ConvertDopForSession(le_gnss_GetClientSessionRef(), dopValue);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert the position data in the resolution selected by a client session.
  *
  * @return
  *  - LE_OK     The function succeed.
  *  - LE_FAULT  The function failed.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t ConvertPositionData
+static le_result_t ConvertPositionDataForSession
 (
-    int32_t value,                 ///< [IN] Data value to convert.
-    le_gnss_DataType_t dataType,   ///< [IN] Data type.
-    int32_t* valuePtr              ///< [OUT] The converted data value.
+    le_msg_SessionRef_t sessionRef,  ///< [IN] Client session.
+    int32_t value,                   ///< [IN] Data value to convert.
+    le_gnss_DataType_t dataType,     ///< [IN] Data type.
+    int32_t* valuePtr                ///< [OUT] The converted data value.
 )
 {
     le_gnss_Client_t* clientRequestPtr = NULL;
-    le_msg_SessionRef_t sessionRef = le_gnss_GetClientSessionRef();
     le_gnss_Resolution_t resolution = LE_GNSS_RES_UNKNOWN;
 
     if (NULL == valuePtr)
@@ -1139,6 +1341,194 @@ static le_result_t ConvertPositionData
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert the position data in the selected resolution.
+ *
+ * @return
+ *  - LE_OK     The function succeed.
+ *  - LE_FAULT  The function failed.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ConvertPositionData
+(
+    int32_t value,                 ///< [IN] Data value to convert.
+    le_gnss_DataType_t dataType,   ///< [IN] Data type.
+    int32_t* valuePtr              ///< [OUT] The converted data value.
+)
+{
+    return ConvertPositionDataForSession(le_gnss_GetClientSessionRef(), value, dataType, valuePtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a DOP value in the resolution selected by a client session.
+ *
+ * @return The converted DOP value, or UINT16_MAX if it is not valid.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint16_t GetFixDop
+(
+    le_msg_SessionRef_t sessionRef,  ///< [IN] Client session.
+    bool isValid,                    ///< [IN] Whether the DOP value is set.
+    uint32_t dopValue                ///< [IN] Dilution of Precision value to convert.
+)
+{
+    if (isValid)
+    {
+        uint32_t dop = ConvertDopForSession(sessionRef, dopValue);
+
+        // Test if the dop value exceeds a uint16_t after the conversion
+        if (!(dop >> 16))
+        {
+            return (uint16_t)dop;
+        }
+    }
+
+    return UINT16_MAX;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get an accuracy value in the resolution selected by a client session.
+ *
+ * @return The converted value, or INT32_MAX if it is not valid.
+ */
+//--------------------------------------------------------------------------------------------------
+static int32_t GetFixAccuracy
+(
+    le_msg_SessionRef_t sessionRef,  ///< [IN] Client session.
+    bool isValid,                    ///< [IN] Whether the value is set.
+    int32_t value,                   ///< [IN] Data value to convert.
+    le_gnss_DataType_t dataType      ///< [IN] Data type.
+)
+{
+    int32_t resValue;
+
+    if ((!isValid) ||
+        (LE_OK != ConvertPositionDataForSession(sessionRef, value, dataType, &resValue)))
+    {
+        return INT32_MAX;
+    }
+
+    return resValue;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fill in a fix structure from a position sample, with the resolutions of a client session.
+ *
+ * The fields that are not valid are set to the values returned by the le_gnss_GetXxx() functions
+ * in that case.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GetFixData
+(
+    const le_gnss_PositionSample_t* samplePtr,  ///< [IN] Position sample.
+    le_msg_SessionRef_t sessionRef,             ///< [IN] Client session.
+    le_gnss_Fix_t* fixPtr                       ///< [OUT] Fix data.
+)
+{
+    // Position
+    fixPtr->fixState = samplePtr->fixState;
+    fixPtr->latitude = samplePtr->latitudeValid ? samplePtr->latitude : INT32_MAX;
+    fixPtr->longitude = samplePtr->longitudeValid ? samplePtr->longitude : INT32_MAX;
+    fixPtr->hAccuracy = samplePtr->hAccuracyValid ? samplePtr->hAccuracy : INT32_MAX;
+    fixPtr->altitude = samplePtr->altitudeValid ? samplePtr->altitude : INT32_MAX;
+    fixPtr->altitudeOnWgs84 = samplePtr->altitudeOnWgs84Valid ? samplePtr->altitudeOnWgs84 :
+                                                                INT32_MAX;
+    fixPtr->vAccuracy = GetFixAccuracy(sessionRef,
+                                       samplePtr->vAccuracyValid,
+                                       samplePtr->vAccuracy,
+                                       LE_GNSS_DATA_VACCURACY);
+
+    // Speeds and direction
+    fixPtr->hSpeed = samplePtr->hSpeedValid ? samplePtr->hSpeed : UINT32_MAX;
+    int32_t hSpeedAccuracy = GetFixAccuracy(sessionRef,
+                                            samplePtr->hSpeedAccuracyValid,
+                                            samplePtr->hSpeedAccuracy,
+                                            LE_GNSS_DATA_HSPEEDACCURACY);
+    fixPtr->hSpeedAccuracy = (INT32_MAX == hSpeedAccuracy) ? UINT32_MAX : (uint32_t)hSpeedAccuracy;
+    fixPtr->vSpeed = samplePtr->vSpeedValid ? samplePtr->vSpeed : INT32_MAX;
+    fixPtr->vSpeedAccuracy = GetFixAccuracy(sessionRef,
+                                            samplePtr->vSpeedAccuracyValid,
+                                            samplePtr->vSpeedAccuracy,
+                                            LE_GNSS_DATA_VSPEEDACCURACY);
+    fixPtr->direction = samplePtr->directionValid ? samplePtr->direction : UINT32_MAX;
+    fixPtr->directionAccuracy = samplePtr->directionAccuracyValid ?
+                                samplePtr->directionAccuracy : UINT32_MAX;
+    fixPtr->magneticDeviation = samplePtr->magneticDeviationValid ?
+                                samplePtr->magneticDeviation : INT32_MAX;
+
+    // Date and time
+    fixPtr->year = samplePtr->dateValid ? samplePtr->year : 0;
+    fixPtr->month = samplePtr->dateValid ? samplePtr->month : 0;
+    fixPtr->day = samplePtr->dateValid ? samplePtr->day : 0;
+    fixPtr->hours = samplePtr->timeValid ? samplePtr->hours : 0;
+    fixPtr->minutes = samplePtr->timeValid ? samplePtr->minutes : 0;
+    fixPtr->seconds = samplePtr->timeValid ? samplePtr->seconds : 0;
+    fixPtr->milliseconds = samplePtr->timeValid ? samplePtr->milliseconds : 0;
+    fixPtr->epochTime = samplePtr->timeValid ? samplePtr->epochTime : 0;
+    fixPtr->gpsWeek = samplePtr->gpsTimeValid ? samplePtr->gpsWeek : 0;
+    fixPtr->gpsTimeOfWeek = samplePtr->gpsTimeValid ? samplePtr->gpsTimeOfWeek : 0;
+    fixPtr->timeAccuracy = samplePtr->timeAccuracyValid ? samplePtr->timeAccuracy : UINT16_MAX;
+    fixPtr->leapSeconds = samplePtr->leapSecondsValid ? samplePtr->leapSeconds : UINT8_MAX;
+
+    // DOP parameters
+    fixPtr->hdop = GetFixDop(sessionRef, samplePtr->hdopValid, samplePtr->hdop);
+    fixPtr->vdop = GetFixDop(sessionRef, samplePtr->vdopValid, samplePtr->vdop);
+    fixPtr->pdop = GetFixDop(sessionRef, samplePtr->pdopValid, samplePtr->pdop);
+    fixPtr->gdop = GetFixDop(sessionRef, samplePtr->gdopValid, samplePtr->gdop);
+    fixPtr->tdop = GetFixDop(sessionRef, samplePtr->tdopValid, samplePtr->tdop);
+
+    // Satellites
+    fixPtr->satsInViewCount = samplePtr->satsInViewCountValid ?
+                              samplePtr->satsInViewCount : UINT8_MAX;
+    fixPtr->satsTrackingCount = samplePtr->satsTrackingCountValid ?
+                                samplePtr->satsTrackingCount : UINT8_MAX;
+    fixPtr->satsUsedCount = samplePtr->satsUsedCountValid ? samplePtr->satsUsedCount : UINT8_MAX;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Buffer the last position fix for each fix batch handler, and call the handlers whose batch is
+ * complete.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportFixBatches
+(
+    void
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&FixBatchHandlerList);
+
+    while (NULL != linkPtr)
+    {
+        le_gnss_FixBatchHandler_t* batchHandlerPtr =
+            CONTAINER_OF(linkPtr, le_gnss_FixBatchHandler_t, link);
+
+        // The handler may remove itself when called
+        linkPtr = le_dls_PeekNext(&FixBatchHandlerList, linkPtr);
+
+        GetFixData(&LastPositionSample,
+                   batchHandlerPtr->sessionRef,
+                   &batchHandlerPtr->fixList[batchHandlerPtr->fixCount]);
+        batchHandlerPtr->fixCount++;
+
+        if (batchHandlerPtr->fixCount >= batchHandlerPtr->batchSize)
+        {
+            size_t fixCount = batchHandlerPtr->fixCount;
+
+            LE_DEBUG("Report %zu fixes to handler %p", fixCount, batchHandlerPtr->handlerFuncPtr);
+
+            batchHandlerPtr->fixCount = 0;
+            batchHandlerPtr->handlerFuncPtr(batchHandlerPtr->fixList,
+                                            fixCount,
+                                            batchHandlerPtr->handlerContextPtr);
+        }
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 // APIs.
 //--------------------------------------------------------------------------------------------------
@@ -1171,6 +1561,8 @@ static void PaPositionHandler
     // Get the position sample data from the PA position data report
     GetPosSampleData(&LastPositionSample, positionPtr);
 
+    ReportFixBatches();
+
     if(!NumOfPositionHandlers)
     {
         LE_DEBUG("No positioning handlers, exit Handler Function");
@@ -1328,6 +1720,22 @@ static void CloseSessionEventHandler
         // Get the next value in the reference map
         result = le_ref_NextNode(iterRef);
     }
+
+#ifndef MK_CONFIG_DISABLE_AT_GNSS
+    // Close the NMEA streams opened by the client
+    le_dls_Link_t* linkPtr = le_dls_Peek(&NmeaReaderList);
+    while (NULL != linkPtr)
+    {
+        le_gnss_NmeaReader_t* readerPtr = CONTAINER_OF(linkPtr, le_gnss_NmeaReader_t, link);
+
+        linkPtr = le_dls_PeekNext(&NmeaReaderList, linkPtr);
+
+        if (readerPtr->sessionRef == sessionRef)
+        {
+            CloseNmeaReader(readerPtr);
+        }
+    }
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1434,6 +1842,11 @@ le_result_t gnss_Init
                                                    sizeof(le_gnss_PositionHandler_t));
     le_mem_SetDestructor(PositionHandlerPoolRef, PositionHandlerDestructor);
 
+    // Create a pool for fix batch Handler objects
+    FixBatchHandlerPoolRef = le_mem_InitStaticPool(FixBatchHandler,
+                                                   GNSS_FIX_BATCH_HANDLER_HIGH,
+                                                   sizeof(le_gnss_FixBatchHandler_t));
+
     // Create a pool for Position Sample objects
     PositionSamplePoolRef = le_mem_InitStaticPool(PositionSample,
                                                   GNSS_POSITION_SAMPLE_MAX,
@@ -1456,6 +1869,13 @@ le_result_t gnss_Init
     ClientPoolRef = le_mem_InitStaticPool(Client,
             LE_CONFIG_POSITIONING_ACTIVATION_MAX, sizeof(le_gnss_Client_t));
 
+#ifndef MK_CONFIG_DISABLE_AT_GNSS
+    // Create a pool for the NMEA readers
+    NmeaReaderPoolRef = le_mem_InitStaticPool(NmeaReader,
+                                              LE_CONFIG_GNSS_NMEA_STREAM_MAX + 1,
+                                              sizeof(le_gnss_NmeaReader_t));
+#endif
+
     // Initialize the event client close function handler.
     le_msg_ServiceRef_t msgService = le_gnss_GetServiceRef();
     le_msg_AddServiceCloseHandler(msgService, CloseSessionEventHandler, NULL);
@@ -1486,6 +1906,10 @@ le_result_t gnss_Init
          {
              LE_ERROR("Failed to add PA NMEA handler!");
          }
+         else
+         {
+             IsNmeaFlowManaged = true;
+         }
     }
     else if ((resultStat == 0) && (S_ISCHR(nmeaFileStat.st_mode))) // Character device file
     {
@@ -1499,6 +1923,8 @@ le_result_t gnss_Init
     {
         if (pa_gnss_AddNmeaHandler(PaNmeaHandler) != NULL)
         {
+            IsNmeaFlowManaged = true;
+
             // Create NMEA device folder
             CreateNmeaPipe();
         }
@@ -1607,7 +2033,98 @@ void le_gnss_RemovePositionHandler
         } while (linkPtr != NULL);
     }
 
-    if(NumOfPositionHandlers == 0)
+    if ((NumOfPositionHandlers == 0) && (le_dls_IsEmpty(&FixBatchHandlerList)))
+    {
+        pa_gnss_RemovePositionDataHandler(PaHandlerRef);
+        PaHandlerRef = NULL;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to register an handler for batches of position fixes.
+ *
+ *  - A handler reference, which is only needed for later removal of the handler.
+ *
+ * @note Doesn't return on failure, so there's no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_gnss_FixBatchHandlerRef_t le_gnss_AddFixBatchHandler
+(
+    uint32_t                      batchSize,   ///< [IN] Number of fixes per batch.
+    le_gnss_FixBatchHandlerFunc_t handlerPtr,  ///< [IN] The handler function.
+    void*                         contextPtr   ///< [IN] The context pointer
+)
+{
+    le_gnss_FixBatchHandler_t* batchHandlerPtr;
+
+    if ((NULL == handlerPtr) || (0 == batchSize) || (batchSize > LE_GNSS_FIX_BATCH_MAX))
+    {
+        LE_KILL_CLIENT("Invalid parameters, handler %p, batch size %"PRIu32,
+                       handlerPtr, batchSize);
+        return NULL;
+    }
+
+    // Create the fix batch handler node.
+    batchHandlerPtr = (le_gnss_FixBatchHandler_t*)le_mem_ForceAlloc(FixBatchHandlerPoolRef);
+    batchHandlerPtr->link = LE_DLS_LINK_INIT;
+    batchHandlerPtr->handlerFuncPtr = handlerPtr;
+    batchHandlerPtr->handlerContextPtr = contextPtr;
+    batchHandlerPtr->sessionRef = le_gnss_GetClientSessionRef();
+    batchHandlerPtr->batchSize = batchSize;
+    batchHandlerPtr->fixCount = 0;
+
+    // Subscribe to PA position Data handler
+    if (NULL == PaHandlerRef)
+    {
+        if ((PaHandlerRef=pa_gnss_AddPositionDataHandler(PaPositionHandler)) == NULL)
+        {
+            LE_ERROR("Failed to add PA position Data handler!");
+        }
+        else
+        {
+            LE_DEBUG("PaHandlerRef %p subscribed", PaHandlerRef);
+        }
+    }
+
+    le_dls_Queue(&FixBatchHandlerList, &(batchHandlerPtr->link));
+
+    LE_DEBUG("Fix batch handler %p added, batch size %"PRIu32, handlerPtr, batchSize);
+
+    return (le_gnss_FixBatchHandlerRef_t)batchHandlerPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to remove a handler for batches of position fixes. The fixes
+ * buffered for that handler are discarded.
+ *
+ * @note Doesn't return on failure, so there's no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_gnss_RemoveFixBatchHandler
+(
+    le_gnss_FixBatchHandlerRef_t    handlerRef ///< [IN] The handler reference.
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&FixBatchHandlerList);
+
+    while (NULL != linkPtr)
+    {
+        le_gnss_FixBatchHandler_t* batchHandlerPtr =
+            CONTAINER_OF(linkPtr, le_gnss_FixBatchHandler_t, link);
+
+        if ((le_gnss_FixBatchHandlerRef_t)batchHandlerPtr == handlerRef)
+        {
+            le_dls_Remove(&FixBatchHandlerList, linkPtr);
+            le_mem_Release(batchHandlerPtr);
+            break;
+        }
+
+        linkPtr = le_dls_PeekNext(&FixBatchHandlerList, linkPtr);
+    }
+
+    if ((NumOfPositionHandlers == 0) && (le_dls_IsEmpty(&FixBatchHandlerList)))
     {
         pa_gnss_RemovePositionDataHandler(PaHandlerRef);
         PaHandlerRef = NULL;
@@ -3176,6 +3693,82 @@ void le_gnss_ReleaseSampleRef
     le_mem_Release(positionSampleRequestNodePtr);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get all the data of a position sample at once.
+ *
+ * @return
+ *  - LE_FAULT         Function failed to find the positionSample.
+ *  - LE_OK            Function succeeded.
+ *
+ * @note Fields that are not available are set to the invalid value returned by the corresponding
+ *       le_gnss_GetXxx() function.
+ *
+ * @note If the caller is passing an invalid Position sample reference or a null pointer into this
+ *       function, it is a fatal error, the function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_gnss_GetFix
+(
+    le_gnss_SampleRef_t positionSampleRef,  ///< [IN] Position sample's reference.
+    le_gnss_Fix_t* fixPtr                   ///< [OUT] Position fix data.
+)
+{
+    le_gnss_PositionSampleRequest_t* positionSampleRequestNodePtr
+                                            = le_ref_Lookup(PositionSampleMap,positionSampleRef);
+
+    // Check input pointer
+    if (NULL == fixPtr)
+    {
+        LE_KILL_CLIENT("Invalid pointer provided!");
+        return LE_FAULT;
+    }
+
+    // Check position sample's reference
+    le_result_t result = ValidatePositionSamplePtr(positionSampleRequestNodePtr);
+    if (LE_OK != result)
+    {
+        return result;
+    }
+
+    GetFixData(positionSampleRequestNodePtr->positionSampleNodePtr,
+               le_gnss_GetClientSessionRef(),
+               fixPtr);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get all the data of the last computed position at once, without creating a position sample.
+ *
+ * @return
+ *  - LE_OK            Function succeeded.
+ *
+ * @note Fields that are not available are set to the invalid value returned by the corresponding
+ *       le_gnss_GetXxx() function.
+ *
+ * @note If the caller is passing a null pointer into this function, it is a fatal error, the
+ *       function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_gnss_GetLastFix
+(
+    le_gnss_Fix_t* fixPtr   ///< [OUT] Position fix data.
+)
+{
+    // Check input pointer
+    if (NULL == fixPtr)
+    {
+        LE_KILL_CLIENT("Invalid pointer provided!");
+        return LE_FAULT;
+    }
+
+    GetFixData(&LastPositionSample, le_gnss_GetClientSessionRef(), fixPtr);
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set the GNSS constellation bit mask
@@ -4835,3 +5428,66 @@ le_result_t le_gnss_ConvertDataCoordinateSystem
                                                locationDataSrc,
                                                locationDataDstPtr);
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open a stream of the NMEA frames.
+ *
+ * The NMEA frames are written to the returned file descriptor, each one terminated by a null
+ * byte. The stream is closed by closing the file descriptor.
+ *
+ * @return
+ *  - LE_OK               Function succeeded.
+ *  - LE_UNSUPPORTED      The NMEA frames are not managed by the positioning service on this
+ *                        platform.
+ *  - LE_OVERFLOW         Too many NMEA streams are already opened.
+ *  - LE_FAULT            Function failed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_gnss_OpenNmeaStream
+(
+    int* fdPtr              ///< [OUT] Read end of the NMEA stream.
+)
+{
+    if (NULL == fdPtr)
+    {
+        LE_KILL_CLIENT("fdPtr is NULL !");
+        return LE_FAULT;
+    }
+
+    *fdPtr = -1;
+
+#if defined(MK_CONFIG_DISABLE_AT_GNSS) || !defined(LE_CONFIG_LINUX)
+    return LE_UNSUPPORTED;
+#else
+    int pipeFds[2];
+
+    if (!IsNmeaFlowManaged)
+    {
+        return LE_UNSUPPORTED;
+    }
+
+    if (NmeaStreamCount >= LE_CONFIG_GNSS_NMEA_STREAM_MAX)
+    {
+        LE_WARN("Too many NMEA streams (%d)", LE_CONFIG_GNSS_NMEA_STREAM_MAX);
+        return LE_OVERFLOW;
+    }
+
+    if (0 != pipe2(pipeFds, O_CLOEXEC))
+    {
+        LE_ERROR("Could not create NMEA stream pipe. errno.%d (%s)", errno, LE_ERRNO_TXT(errno));
+        return LE_FAULT;
+    }
+
+    // The positioning service never waits for a reader
+    le_fd_Fcntl(pipeFds[1], F_SETFL, le_fd_Fcntl(pipeFds[1], F_GETFL) | O_NONBLOCK);
+
+    CreateNmeaReader("NmeaStream", pipeFds[1], le_gnss_GetClientSessionRef());
+    NmeaStreamCount++;
+
+    // The read end is closed once sent to the client
+    *fdPtr = pipeFds[0];
+
+    return LE_OK;
+#endif
+}
@@ -800,6 +800,72 @@ static le_result_t ComputeMove
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fill a position fix structure from a position sample, with the same resolutions and invalid
+ * values as the le_pos_sample_GetXxx() functions.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GetPosFixData
+(
+    const le_pos_Sample_t* posSamplePtr,    ///< [IN] Position sample
+    le_pos_Fix_t* fixPtr                    ///< [OUT] Position fix data
+)
+{
+    fixPtr->fixState = posSamplePtr->fixState;
+
+    fixPtr->latitude = posSamplePtr->latitudeValid ? posSamplePtr->latitude : INT32_MAX;
+    fixPtr->longitude = posSamplePtr->longitudeValid ? posSamplePtr->longitude : INT32_MAX;
+    fixPtr->hAccuracy = posSamplePtr->hAccuracyValid ?
+                        ConvertDistance(posSamplePtr->hAccuracy, H_ACCURACY) : INT32_MAX;
+    fixPtr->altitude = posSamplePtr->altitudeValid ?
+                       ConvertDistance(posSamplePtr->altitude, ALTITUDE) : INT32_MAX;
+    fixPtr->vAccuracy = posSamplePtr->vAccuracyValid ?
+                        ConvertDistance(posSamplePtr->vAccuracy, V_ACCURACY) : INT32_MAX;
+
+    // Update resolutions
+    fixPtr->hSpeed = posSamplePtr->hSpeedValid ? posSamplePtr->hSpeed/100 : UINT32_MAX;
+    fixPtr->hSpeedAccuracy = posSamplePtr->hSpeedAccuracyValid ?
+                             posSamplePtr->hSpeedAccuracy/10 : UINT32_MAX;
+    fixPtr->vSpeed = posSamplePtr->vSpeedValid ? posSamplePtr->vSpeed/100 : INT32_MAX;
+    fixPtr->vSpeedAccuracy = posSamplePtr->vSpeedAccuracyValid ?
+                             posSamplePtr->vSpeedAccuracy/10 : INT32_MAX;
+    fixPtr->heading = posSamplePtr->headingValid ? posSamplePtr->heading : UINT32_MAX;
+    fixPtr->headingAccuracy = posSamplePtr->headingAccuracyValid ?
+                              posSamplePtr->headingAccuracy : UINT32_MAX;
+    fixPtr->direction = posSamplePtr->directionValid ? posSamplePtr->direction/10 : UINT32_MAX;
+    fixPtr->directionAccuracy = posSamplePtr->directionAccuracyValid ?
+                                posSamplePtr->directionAccuracy/10 : UINT32_MAX;
+
+    if (posSamplePtr->dateValid)
+    {
+        fixPtr->year = posSamplePtr->year;
+        fixPtr->month = posSamplePtr->month;
+        fixPtr->day = posSamplePtr->day;
+    }
+    else
+    {
+        fixPtr->year = 0;
+        fixPtr->month = 0;
+        fixPtr->day = 0;
+    }
+
+    if (posSamplePtr->timeValid)
+    {
+        fixPtr->hours = posSamplePtr->hours;
+        fixPtr->minutes = posSamplePtr->minutes;
+        fixPtr->seconds = posSamplePtr->seconds;
+        fixPtr->milliseconds = posSamplePtr->milliseconds;
+    }
+    else
+    {
+        fixPtr->hours = 0;
+        fixPtr->minutes = 0;
+        fixPtr->seconds = 0;
+        fixPtr->milliseconds = 0;
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The main position Sample Handler.
@@ -2129,6 +2195,44 @@ le_result_t le_pos_sample_GetFixState
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get all the data of the position sample at once.
+ *
+ * @return LE_FAULT         Function failed to find the positionSample.
+ * @return LE_OK            Function succeeded.
+ *
+ * @note Fields that are not available are set to the invalid value returned by the corresponding
+ *       le_pos_sample_GetXxx() function.
+ *
+ * @note If the caller is passing an invalid Position reference or a null pointer into this
+ *       function, it is a fatal error, the function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_pos_sample_GetFix
+(
+    le_pos_SampleRef_t  positionSampleRef,    ///< [IN] The position sample's reference.
+    le_pos_Fix_t*       fixPtr                ///< [OUT] Position fix data.
+)
+{
+    if (NULL == fixPtr)
+    {
+        LE_KILL_CLIENT("fixPtr is NULL!");
+        return LE_FAULT;
+    }
+
+    PosSampleRequest_t* posSampleRequestPtr = le_ref_Lookup(PosSampleMap, positionSampleRef);
+    if ((NULL == posSampleRequestPtr) || (NULL == posSampleRequestPtr->posSampleNodePtr))
+    {
+        LE_KILL_CLIENT("Invalid reference (%p) provided!", positionSampleRef);
+        return LE_FAULT;
+    }
+
+    GetPosFixData(posSampleRequestPtr->posSampleNodePtr, fixPtr);
+
+    return LE_OK;
+}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -2766,6 +2870,83 @@ le_result_t le_pos_GetFixState
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get all the data of the last updated location at once.
+ *
+ * @return LE_FAULT         Function failed to get the location's data.
+ * @return LE_OK            Function succeeded.
+ *
+ * @note Fields that are not available are set to the invalid value returned by the corresponding
+ *       le_pos_GetXxx() function.
+ *
+ * @note If the caller is passing a null pointer into this function, it is a fatal error, the
+ *       function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_pos_GetFix
+(
+    le_pos_Fix_t* fixPtr    ///< [OUT] Position fix data.
+)
+{
+    le_gnss_Fix_t gnssFix;
+    le_pos_Sample_t posSample;
+
+    if (NULL == fixPtr)
+    {
+        LE_KILL_CLIENT("fixPtr is NULL!");
+        return LE_FAULT;
+    }
+
+    // Get the whole last position sample from the GNSS at once
+    if (LE_OK != le_gnss_GetLastFix(&gnssFix))
+    {
+        LE_ERROR("Failed to get the last position fix");
+        return LE_FAULT;
+    }
+
+    posSample.fixState = (le_pos_FixState_t)gnssFix.fixState;
+    posSample.latitudeValid = (INT32_MAX != gnssFix.latitude);
+    posSample.latitude = gnssFix.latitude;
+    posSample.longitudeValid = (INT32_MAX != gnssFix.longitude);
+    posSample.longitude = gnssFix.longitude;
+    posSample.hAccuracyValid = (INT32_MAX != gnssFix.hAccuracy);
+    posSample.hAccuracy = gnssFix.hAccuracy;
+    posSample.altitudeValid = (INT32_MAX != gnssFix.altitude);
+    posSample.altitude = gnssFix.altitude;
+    posSample.vAccuracyValid = (INT32_MAX != gnssFix.vAccuracy);
+    posSample.vAccuracy = gnssFix.vAccuracy;
+    posSample.hSpeedValid = (UINT32_MAX != gnssFix.hSpeed);
+    posSample.hSpeed = gnssFix.hSpeed;
+    posSample.hSpeedAccuracyValid = (UINT32_MAX != gnssFix.hSpeedAccuracy);
+    posSample.hSpeedAccuracy = gnssFix.hSpeedAccuracy;
+    posSample.vSpeedValid = (INT32_MAX != gnssFix.vSpeed);
+    posSample.vSpeed = gnssFix.vSpeed;
+    posSample.vSpeedAccuracyValid = (INT32_MAX != gnssFix.vSpeedAccuracy);
+    posSample.vSpeedAccuracy = gnssFix.vSpeedAccuracy;
+    // Heading not supported by GNSS engine
+    posSample.headingValid = false;
+    posSample.headingAccuracyValid = false;
+    posSample.directionValid = (UINT32_MAX != gnssFix.direction);
+    posSample.direction = gnssFix.direction;
+    posSample.directionAccuracyValid = (UINT32_MAX != gnssFix.directionAccuracy);
+    posSample.directionAccuracy = gnssFix.directionAccuracy;
+    // Date and time are already set to 0 when not available
+    posSample.dateValid = true;
+    posSample.year = gnssFix.year;
+    posSample.month = gnssFix.month;
+    posSample.day = gnssFix.day;
+    posSample.timeValid = true;
+    posSample.hours = gnssFix.hours;
+    posSample.minutes = gnssFix.minutes;
+    posSample.seconds = gnssFix.seconds;
+    posSample.milliseconds = gnssFix.milliseconds;
+
+    GetPosFixData(&posSample, fixPtr);
+
+    return LE_OK;
+}
+
 // -------------------------------------------------------------------------------------------------
 /**
  * Set the acquisition rate.
@@ -193,6 +193,66 @@ static le_mem_PoolRef_t EntryPool = NULL;
 
 #endif /* end !MK_CONFIG_SECSTORE_DISABLE_ADMIN */
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Client's usage ledger entry.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct ClientUsage ClientUsage_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Usage accounting of an operation on a client's area of secure storage.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    ClientUsage_t* clientPtr;       ///< Client's ledger entry.  NULL if not accounted.
+    size_t origSize;                ///< Size of the item before the operation.
+}
+UsageUpdate_t;
+
+#if !MK_CONFIG_SECSTORE_DISABLE_LIMIT
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Estimated number of clients using secure storage.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CLIENT_USAGE_MAP_SIZE   31
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Client's usage ledger entry.  The amount of space used by each client is computed once, from the
+ * content of secure storage, and then kept up to date by the operations done through this daemon,
+ * so that the client's limit can be checked without walking its whole area of secure storage.
+ */
+//--------------------------------------------------------------------------------------------------
+struct ClientUsage
+{
+    char path[SECSTORE_MAX_PATH_BYTES];     ///< Path to the client's area.  Key in the ledger.
+    char name[LIMIT_MAX_USER_NAME_BYTES];   ///< Client name.
+    size_t limit;                           ///< Client's secure storage limit.
+    size_t usedSpace;                       ///< Space used by the client.
+    bool isValid;                           ///< false if the entry must be rescanned.
+};
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Usage ledger of the clients, indexed by the path to their area of secure storage.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t ClientUsageMap = NULL;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of usage ledger entries.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ClientUsagePool = NULL;
+
+#endif /* end !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
+
 #if LE_CONFIG_SOTA
 
 //--------------------------------------------------------------------------------------------------
@@ -683,60 +743,120 @@ static void GetClientPath
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Checks if there is enough space in the client's area of secure storage for the client to write
- * the item.
+ * Computes the limit and the amount of space used by a client from the app configuration and the
+ * content of secure storage.
  *
  * @return
- *      LE_OK if the item would fit in the client's area of secure storage.
- *      LE_NO_MEMORY if there is not enough memory to store the item.
+ *      LE_OK if successful.
  *      LE_UNAVAILABLE if the secure storage is currently unavailable.
  *      LE_FAULT if there was an error.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t CheckClientLimit
+static le_result_t ScanClientUsage
 (
-    const char* clientNamePtr,              ///< [IN] Name of the client.
-    const char* clientPathPtr,              ///< [IN] Path to the client's area in secure storage.
-    const char* itemNamePtr,                ///< [IN] Name of the item.
-    size_t itemSize                         ///< [IN] Size, in bytes, of the item.
+    ClientUsage_t* usagePtr                 ///< [IN] Client's ledger entry.
 )
 {
     // Get the secure storage limit for the client.
-    appCfg_Iter_t iter = appCfg_FindApp(clientNamePtr);
+    appCfg_Iter_t iter = appCfg_FindApp(usagePtr->name);
     if (!iter)
     {
        LE_ERROR("iter is NULL");
        return LE_FAULT;
     }
-    size_t secStoreLimit = appCfg_GetSecStoreLimit(iter);
+    usagePtr->limit = appCfg_GetSecStoreLimit(iter);
     appCfg_DeleteIter(iter);
 
     // Get the current amount of space used by the client.
     size_t usedSpace = 0;
-    le_result_t result = pa_secStore_GetSize(clientPathPtr, &usedSpace);
+    le_result_t result = pa_secStore_GetSize(usagePtr->path, &usedSpace);
 
     if ( (result != LE_OK) && (result != LE_NOT_FOUND) )
     {
         return result;
     }
 
-    // Get the size of the item in the secure storage if it already exists.
-    char itemPath[SECSTORE_MAX_PATH_BYTES] = "";
+    if (usagePtr->isValid && (usagePtr->usedSpace != usedSpace))
+    {
+        LE_WARN("Usage of '%s' was %" PRIuS " bytes, actual usage is %" PRIuS " bytes.",
+                usagePtr->path, usagePtr->usedSpace, usedSpace);
+    }
 
-    LE_FATAL_IF(le_path_Concat("/", itemPath, sizeof(itemPath),
-        clientPathPtr, itemNamePtr, (void *) NULL) != LE_OK,
-            "Client %s's path for item %s is too long.", clientNamePtr, itemNamePtr);
+    usagePtr->usedSpace = usedSpace;
+    usagePtr->isValid = true;
 
-    size_t origItemSize = 0;
-    result = pa_secStore_GetSize(itemPath, &origItemSize);
+    return LE_OK;
+}
 
-    if ( (result != LE_OK) && (result != LE_NOT_FOUND) )
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the ledger entry of a client, creating and scanning it if needed.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_UNAVAILABLE if the secure storage is currently unavailable.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t GetClientUsage
+(
+    const char* clientNamePtr,              ///< [IN] Name of the client.
+    const char* clientPathPtr,              ///< [IN] Path to the client's area in secure storage.
+    ClientUsage_t** usagePtrPtr             ///< [OUT] Client's ledger entry.
+)
+{
+    ClientUsage_t* usagePtr = le_hashmap_Get(ClientUsageMap, clientPathPtr);
+
+    if (NULL == usagePtr)
     {
-        return result;
+        usagePtr = le_mem_ForceAlloc(ClientUsagePool);
+        memset(usagePtr, 0, sizeof(ClientUsage_t));
+
+        LE_ASSERT(le_utf8_Copy(usagePtr->path, clientPathPtr, sizeof(usagePtr->path), NULL)
+                  == LE_OK);
+        LE_ASSERT(le_utf8_Copy(usagePtr->name, clientNamePtr, sizeof(usagePtr->name), NULL)
+                  == LE_OK);
+
+        le_hashmap_Put(ClientUsageMap, usagePtr->path, usagePtr);
     }
 
+    if (!usagePtr->isValid)
+    {
+        le_result_t result = ScanClientUsage(usagePtr);
+
+        if (result != LE_OK)
+        {
+            return result;
+        }
+    }
+
+    *usagePtrPtr = usagePtr;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks if there is enough space in the client's area of secure storage for the client to write
+ * the item.
+ *
+ * @return
+ *      LE_OK if the item would fit in the client's area of secure storage.
+ *      LE_NO_MEMORY if there is not enough memory to store the item.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t CheckClientLimit
+(
+    const UsageUpdate_t* updatePtr,         ///< [IN] Usage accounting of the write operation.
+    size_t itemSize                         ///< [IN] Size, in bytes, of the item.
+)
+{
+    const ClientUsage_t* usagePtr = updatePtr->clientPtr;
+
     // Calculate if replacing the item would fit within the limit.
-    if (((ssize_t)(secStoreLimit - usedSpace + origItemSize - itemSize)) >= 0)
+    if (((ssize_t)(usagePtr->limit - usagePtr->usedSpace + updatePtr->origSize - itemSize)) >= 0)
     {
         return LE_OK;
     }
@@ -744,8 +864,86 @@ static le_result_t CheckClientLimit
     return LE_NO_MEMORY;
 }
 
+
+#if LE_CONFIG_SOTA || !MK_CONFIG_SECSTORE_DISABLE_ADMIN
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Marks the ledger entries of all the clients whose area of secure storage may have been modified
+ * by an operation on a path, so that they are rescanned on their next use.  NULL marks all the
+ * entries.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InvalidateClientUsage
+(
+    const char* pathPtr                     ///< [IN] Modified path.  May be NULL.
+)
+{
+    le_hashmap_It_Ref_t iter = le_hashmap_GetIterator(ClientUsageMap);
+
+    while (le_hashmap_NextNode(iter) == LE_OK)
+    {
+        ClientUsage_t* usagePtr = le_hashmap_GetValue(iter);
+
+        if ( (NULL == pathPtr) ||
+             le_path_IsEquivalent(usagePtr->path, pathPtr, "/") ||
+             le_path_IsSubpath(usagePtr->path, pathPtr, "/") ||
+             le_path_IsSubpath(pathPtr, usagePtr->path, "/") )
+        {
+            usagePtr->isValid = false;
+        }
+    }
+}
+
+#endif /* end LE_CONFIG_SOTA || !MK_CONFIG_SECSTORE_DISABLE_ADMIN */
+
 #endif /* end !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Updates the client's ledger entry once an operation on an item is done.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UpdateClientUsage
+(
+    const UsageUpdate_t* updatePtr,         ///< [IN] Usage accounting of the operation.
+    le_result_t opResult,                   ///< [IN] Result of the operation.
+    size_t newSize                          ///< [IN] Size of the item after a successful operation.
+)
+{
+#if MK_CONFIG_SECSTORE_DISABLE_LIMIT
+    LE_UNUSED(updatePtr);
+    LE_UNUSED(opResult);
+    LE_UNUSED(newSize);
+#else /* !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
+    ClientUsage_t* usagePtr = updatePtr->clientPtr;
+
+    if (NULL == usagePtr)
+    {
+        return;
+    }
+
+    if (LE_OK == opResult)
+    {
+        if (usagePtr->usedSpace + newSize >= updatePtr->origSize)
+        {
+            usagePtr->usedSpace = usagePtr->usedSpace + newSize - updatePtr->origSize;
+        }
+        else
+        {
+            usagePtr->isValid = false;
+        }
+    }
+    else if (LE_NOT_FOUND != opResult)
+    {
+        // The item may have been partially modified.
+        usagePtr->isValid = false;
+    }
+#endif /* end !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Check that item names are valid.
@@ -808,12 +1006,20 @@ static le_result_t PrepareOp
     size_t           bufNumElements,        ///< [IN]  Size of buffer.
     bool             checkLimit,            ///< [IN]  Check buffer size against client's secure
                                             ///<       storage limit?
+    UsageUpdate_t   *updatePtr,             ///< [OUT] Usage accounting of the operation.  May be
+                                            ///<       NULL if the operation doesn't modify the item.
     char            *path                   ///< [OUT] Buffer to write constructed path into. Must be
                                             ///<       SECSTORE_MAX_PATH_BYTES in size.
 )
 {
     le_result_t result = LE_OK;
 
+    if (updatePtr)
+    {
+        updatePtr->clientPtr = NULL;
+        updatePtr->origSize = 0;
+    }
+
     // Check parameters.
     if (!IsValidName(name))
     {
@@ -847,6 +1053,11 @@ static le_result_t PrepareOp
         {
             return result;
         }
+
+#if !MK_CONFIG_SECSTORE_DISABLE_LIMIT
+        // The content and the limits of the apps' areas may have changed with the system.
+        InvalidateClientUsage(NULL);
+#endif
     }
 #endif /* end LE_CONFIG_SOTA */
 
@@ -876,16 +1087,24 @@ static le_result_t PrepareOp
         // Get the path to the client's secure storage area.
         GetClientPath(clientName, isApp, path, SECSTORE_MAX_PATH_BYTES);
 
-#if MK_CONFIG_SECSTORE_DISABLE_LIMIT
-        LE_UNUSED(checkLimit);
-#else /* !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
-        if (checkLimit)
+#if !MK_CONFIG_SECSTORE_DISABLE_LIMIT
+        if (updatePtr)
         {
-            // Check the available limit for the client.
-            result = CheckClientLimit(clientName, path, name, bufNumElements);
+            result = GetClientUsage(clientName, path, &updatePtr->clientPtr);
             if (result != LE_OK)
             {
-                return result;
+                if (checkLimit)
+                {
+                    return result;
+                }
+
+                // The ledger is only needed to enforce the limit, so don't let it block an
+                // operation that can only free space.  The entry stays invalid and is scanned
+                // again on the next access.
+                LE_WARN("Usage of client %s unknown (%s), not accounting the operation.",
+                        clientName, LE_RESULT_TXT(result));
+                updatePtr->clientPtr = NULL;
+                result = LE_OK;
             }
         }
 #endif /* end !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
@@ -893,6 +1112,44 @@ static le_result_t PrepareOp
         // Append item name to client path.
         LE_FATAL_IF(le_path_Concat("/", path, SECSTORE_MAX_PATH_BYTES, name, (void *) NULL)
             != LE_OK, "Client %s's path for item %s is too long.", clientName, name);
+
+#if MK_CONFIG_SECSTORE_DISABLE_LIMIT
+        LE_UNUSED(checkLimit);
+#else /* !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
+        if ((updatePtr) && (updatePtr->clientPtr))
+        {
+            if (name[0] == '\0')
+            {
+                // The whole client's area is accessed.
+                updatePtr->origSize = updatePtr->clientPtr->usedSpace;
+            }
+            else
+            {
+                // Get the size of the item in the secure storage if it already exists.
+                result = pa_secStore_GetSize(path, &updatePtr->origSize);
+
+                if ( (result != LE_OK) && (result != LE_NOT_FOUND) )
+                {
+                    if (checkLimit)
+                    {
+                        return result;
+                    }
+
+                    // Unknown original size, rescan the client's area after the operation.
+                    updatePtr->clientPtr->isValid = false;
+                    updatePtr->clientPtr = NULL;
+                    updatePtr->origSize = 0;
+                }
+                result = LE_OK;
+            }
+
+            if (checkLimit)
+            {
+                // Check the available limit for the client.
+                result = CheckClientLimit(updatePtr, bufNumElements);
+            }
+        }
+#endif /* end !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
     }
 
     return result;
@@ -919,12 +1176,13 @@ static le_result_t Write
     size_t bufNumElements           ///< [IN] Size of buffer.
 )
 {
-    char        path[SECSTORE_MAX_PATH_BYTES] = {0};
-    le_result_t result;
+    char          path[SECSTORE_MAX_PATH_BYTES] = {0};
+    UsageUpdate_t update;
+    le_result_t   result;
 
     LE_ASSERT(bufPtr != NULL);
 
-    result  = PrepareOp(isGlobal, false, name, bufNumElements, true, path);
+    result  = PrepareOp(isGlobal, false, name, bufNumElements, true, &update, path);
     if (result != LE_OK)
     {
         return result;
@@ -933,6 +1191,8 @@ static le_result_t Write
     // Write the item to the secure storage.
     result = pa_secStore_Write(path, bufPtr, bufNumElements);
 
+    UpdateClientUsage(&update, result, bufNumElements);
+
     if (result == LE_BAD_PARAMETER)
     {
         return LE_FAULT;
@@ -1017,7 +1277,7 @@ static le_result_t Read
     LE_ASSERT(bufPtr != NULL);
     LE_ASSERT(bufNumElementsPtr != NULL);
 
-    result = PrepareOp(isGlobal, false, name, *bufNumElementsPtr, false, path);
+    result = PrepareOp(isGlobal, false, name, *bufNumElementsPtr, false, NULL, path);
     if (result != LE_OK)
     {
         return result;
@@ -1104,14 +1364,19 @@ le_result_t Delete
 )
 {
     char path[SECSTORE_MAX_PATH_BYTES] = {0};
-    le_result_t result = PrepareOp(isGlobal, true, name, 0, false, path);
+    UsageUpdate_t update;
+    le_result_t result = PrepareOp(isGlobal, true, name, 0, false, &update, path);
     if (result != LE_OK)
     {
         return result;
     }
 
     // Delete the item from the secure storage.
-    return pa_secStore_Delete(path);
+    result = pa_secStore_Delete(path);
+
+    UpdateClientUsage(&update, result, 0);
+
+    return result;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1563,7 +1828,13 @@ le_result_t secStoreAdmin_Write
     }
 
     // Write the item to the secure storage.
-    return pa_secStore_Write(path, bufPtr, bufNumElements);
+    le_result_t result = pa_secStore_Write(path, bufPtr, bufNumElements);
+
+#if !MK_CONFIG_SECSTORE_DISABLE_LIMIT
+    InvalidateClientUsage(path);
+#endif
+
+    return result;
 }
 
 
@@ -1667,7 +1938,13 @@ le_result_t secStoreAdmin_Delete
     }
 
     // Delete the item from the secure storage.
-    return pa_secStore_Delete(path);
+    le_result_t result = pa_secStore_Delete(path);
+
+#if !MK_CONFIG_SECSTORE_DISABLE_LIMIT
+    InvalidateClientUsage(path);
+#endif
+
+    return result;
 }
 
 
@@ -1761,6 +2038,46 @@ le_result_t secStoreAdmin_GetTotalSpace
     return result;
 }
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Rescans the amount of space used by all the clients of secure storage.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_UNAVAILABLE if the secure storage is currently unavailable.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t secStoreAdmin_RescanUsage
+(
+    void
+)
+{
+    le_result_t result = LE_OK;
+
+#if !MK_CONFIG_SECSTORE_DISABLE_LIMIT
+    le_hashmap_It_Ref_t iter = le_hashmap_GetIterator(ClientUsageMap);
+
+    while (le_hashmap_NextNode(iter) == LE_OK)
+    {
+        ClientUsage_t* usagePtr = le_hashmap_GetValue(iter);
+
+        le_result_t scanResult = ScanClientUsage(usagePtr);
+
+        if (scanResult != LE_OK)
+        {
+            LE_ERROR("Could not rescan usage of '%s'.  %s.", usagePtr->path,
+                     LE_RESULT_TXT(scanResult));
+            usagePtr->isValid = false;
+            result = scanResult;
+        }
+    }
+#endif /* end !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
+
+    return result;
+}
+
 #endif /* end !MK_CONFIG_SECSTORE_DISABLE_ADMIN */
 
 #if LE_CONFIG_SOTA
@@ -1868,6 +2185,12 @@ COMPONENT_INIT
                                   NULL);
 #endif /* end !MK_CONFIG_SECSTORE_DISABLE_ADMIN */
 
+#if !MK_CONFIG_SECSTORE_DISABLE_LIMIT
+    ClientUsagePool = le_mem_CreatePool("ClientUsagePool", sizeof(ClientUsage_t));
+    ClientUsageMap = le_hashmap_Create("ClientUsageMap", CLIENT_USAGE_MAP_SIZE,
+                                       le_hashmap_HashString, le_hashmap_EqualsString);
+#endif /* end !MK_CONFIG_SECSTORE_DISABLE_LIMIT */
+
 #if LE_CONFIG_SOTA
     SystemIndexPool = le_mem_CreatePool("SystemIndexPool", sizeof(SystemsIndex_t));
 
@@ -2,18 +2,18 @@
 /**
  *  SMS Inbox Server
  *
- * When the service is activated, or when a SMS is received, the SMS is copied from the SIM to a
- * specific folder (SMSINBOX_PATH/MSG_PATH).
+ * When the service is activated, or when a SMS is received, the SMS is copied from the SIM to the
+ * message store located in SMSINBOX_PATH (see smsInboxStore.c).
  *
- * Each SMS is copied into a dedicated file (named with a unique message identifier). The data
- * are stored using the Jannsson representation: Each data (imsi, SMS format, message length,
- * text/pdu, sender telephone number, timestamp, read/unread) are recorded with a key to retrieve
- * each value.
+ * Each SMS is recorded once in the store with a unique message identifier, the message data (imsi,
+ * SMS format, message length, text/pdu, sender telephone number, timestamp) and, for each
+ * application message box, whether the message belongs to the message box and whether it has been
+ * read. Marking a message as read or deleting it from a message box only updates its fixed-size
+ * index record.
  *
- * Each application using the SMS Inbox Server possesses a configuration file in
- * SMSINBOX_PATH/CONF_PATH directory (also encoding using Jansson format): this file is used to
- * store the message identifier contained in the application mailbox. It is updated each time is new
- * SMS is received.
+ * Previous versions stored each SMS in a dedicated Jansson file (SMSINBOX_PATH/MSG_PATH) and the
+ * message identifiers of each application message box in a Jansson file (SMSINBOX_PATH/CONF_PATH).
+ * Those files are imported into the store and removed the first time the store is used.
  *
  *  Copyright (C) Sierra Wireless Inc.
  */
@@ -23,6 +23,7 @@
 #include "interfaces.h"
 #include "mdmCfgEntries.h"
 #include "le_smsInbox.h"
+#include "smsInboxStore.h"
 
 #include "le_print.h"
 #include "le_hex.h"
@@ -44,19 +45,25 @@
 #else
 #define SMSINBOX_PATH "/tmp/smsInbox/"
 #endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Legacy message and message box directories.
+ */
+//--------------------------------------------------------------------------------------------------
 #define MSG_PATH "msg/"
 #define CONF_PATH "cfg/"
 
 //--------------------------------------------------------------------------------------------------
 /**
- * File extension definition.
+ * Legacy file extension definition.
  */
 //--------------------------------------------------------------------------------------------------
 #define FILE_EXTENSION ".json"
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Json keys.
+ * Legacy Json keys.
  */
 //--------------------------------------------------------------------------------------------------
 #define JSON_FORMAT "format"
@@ -68,7 +75,6 @@
 #define JSON_MSGLEN "msgLen"
 #define JSON_TIMESTAMP "timestamp"
 #define JSON_ISUNREAD "isUnread"
-#define JSON_ISDELETED "isDeleted"
 #define JSON_MSGINBOX "msgInBox"
 
 //--------------------------------------------------------------------------------------------------
@@ -119,6 +125,10 @@
 
 #define CFG_SMSINBOX_PATH               SMSINBOX_CONFIG_TREE_ROOT_DIR"/"CFG_NODE_SMSINBOX
 
+#if (MAX_APPS > SMSSTORE_MAX_MBOX) || (MAX_APPS * MAX_MBOX_SIZE > SMSSTORE_MAX_MSG)
+#error "The message store can't hold all the message boxes"
+#endif
+
 //--------------------------------------------------------------------------------------------------
 // Data structures.
 //--------------------------------------------------------------------------------------------------
@@ -139,41 +149,10 @@ typedef uint32_t MessageId_t;
 //--------------------------------------------------------------------------------------------------
 typedef struct
 {
-    json_t* jsonObjPtr;
-    json_t* jsonArrayPtr;
-    uint32_t currentMessageIndex;
-    uint32_t maxIndex;
+    MessageId_t currentMessageId;   ///< Last message returned, 0 if browsing is over
 }
 BrowseCtx_t;
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Entry description structure.
- *
- */
-//--------------------------------------------------------------------------------------------------
-typedef struct
-{
-    enum
-    {
-        DESC_INT,
-        DESC_STRING,
-        DESC_BOOL
-    }                               type;       ///< Union type (string or integer
-    union
-    {
-        struct
-        {
-            char*   strPtr;                     ///< String
-            size_t  lenStr;                     ///< Length of the string
-        }                  str;                 ///< Value for string
-        uint32_t           val;                 ///< Value for integer
-        bool               boolVal;             ///< Boolean value
-    }                               uVal;       ///< Union type
-}
-EntryDesc_t;
-
-
 //--------------------------------------------------------------------------------------------------
 /**
  * message box object structure.
@@ -185,7 +164,7 @@ typedef struct
     char *    namePtr;                  ///< App name
     uint32_t inboxSize;                 ///< Max messages in the inbox
     uint32_t msgCount;                  ///< Number message
-
+    uint32_t index;                     ///< Message box index in the message store
 }
 MboxCtx_t;
 
@@ -313,11 +292,11 @@ static char SimImsi[LE_SIM_IMSI_BYTES];
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Next message Identifier
+ * Message store state. The store is opened on first use.
  *
  */
 //--------------------------------------------------------------------------------------------------
-static MessageId_t NextMessageId = 1;
+static bool StoreOpened = false;
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -336,129 +315,7 @@ static le_ref_MapRef_t ActivationRequestRefMap;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Add a boolean value of a key in a Jason object
- *
- */
-//--------------------------------------------------------------------------------------------------
-static le_result_t AddBooleanKeyInJsonObject
-(
-    json_t *jsonObjPtr, ///<[IN] json object
-    const char* key,    ///<[IN] Key to be added
-    bool value          ///<[IN] Value to be added
-)
-{
-    json_t *jsonBoolPtr;
-    int ret = -1;
-
-    if ( value == true )
-    {
-        jsonBoolPtr = json_true();
-    }
-    else
-    {
-        jsonBoolPtr = json_false();
-    }
-
-    if (jsonBoolPtr)
-    {
-        ret = json_object_set_new(jsonObjPtr, key, jsonBoolPtr);
-    }
-    else
-    {
-        LE_ERROR("Error during set of the key %s", key);
-    }
-
-    if (ret == 0)
-    {
-        return LE_OK;
-    }
-    else
-    {
-        return LE_FAULT;
-    }
-}
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- * Add an integer value of a key in a Jason object
- *
- */
-//--------------------------------------------------------------------------------------------------
-static le_result_t AddIntegerKeyInJsonObject
-(
-    json_t *jsonObjPtr, ///<[IN] json object
-    const char* key,    ///<[IN] Key to be added
-    int  value          ///<[IN] Value to be added
-)
-{
-    json_t *jsonIntPtr = json_integer(value);
-    int ret = -1;
-
-    if (jsonIntPtr)
-    {
-        if (json_is_array(jsonObjPtr))
-        {
-            ret = json_array_append_new(jsonObjPtr, jsonIntPtr);
-        }
-        else
-        {
-            ret = json_object_set_new(jsonObjPtr, key, jsonIntPtr);
-        }
-    }
-    else
-    {
-        LE_ERROR("Error during set of the key %s", key);
-    }
-
-    if (ret == 0)
-    {
-        return LE_OK;
-    }
-    else
-    {
-        return LE_FAULT;
-    }
-}
-
-//--------------------------------------------------------------------------------------------------
-/**
- * Add a string value of a key in a Jason object
- *
- */
-//--------------------------------------------------------------------------------------------------
-static le_result_t AddStringKeyInJsonObject
-(
-    json_t *jsonObjPtr, ///<[IN] json object
-    const char* key,    ///<[IN] Key to be added
-    char* string        ///<[IN] String to be added
-)
-{
-    json_t * jsonStrPtr = json_string(string);
-    int ret = -1;
-
-    if (jsonStrPtr)
-    {
-        ret = json_object_set_new(jsonObjPtr, key, jsonStrPtr);
-    }
-    else
-    {
-        LE_ERROR("Error during set of the key %s", key);
-    }
-
-    if (ret == 0)
-    {
-        return LE_OK;
-    }
-    else
-    {
-        return LE_FAULT;
-    }
-}
-
-//--------------------------------------------------------------------------------------------------
-/**
- * Get the SMSInbox directory path length
+ * Get the legacy SMSInbox message file path length
  *
  */
 //--------------------------------------------------------------------------------------------------
@@ -472,7 +329,7 @@ static uint32_t GetSMSInboxMessagePathLen
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Get the SMSInbox file path
+ * Get the legacy SMSInbox message file path
  *
  */
 //--------------------------------------------------------------------------------------------------
@@ -490,7 +347,7 @@ static void GetSMSInboxMessagePath
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Get the SMSInbox configuration path length
+ * Get the legacy SMSInbox configuration path length
  *
  */
 //--------------------------------------------------------------------------------------------------
@@ -504,7 +361,7 @@ static uint32_t GetSMSInboxConfigPathLen
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Get the application's box file descriptor path
+ * Get the legacy application's box file descriptor path
  *
  */
 //--------------------------------------------------------------------------------------------------
@@ -520,714 +377,486 @@ static void GetSMSInboxConfigPath
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Modify Json object
+ * Read legacy Application's config file
  *
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t ModifyJsonObj
+static le_result_t GetMsgListFromMbox
 (
-    json_t* jsonObjPtr,         ///<[IN] Json object (root object)
-    json_t* jsonValPtr,         ///<[IN] Json value to be modified
-    char*   key,                ///<[IN] Key to modify
-    EntryDesc_t * modifPtr      ///<[IN] Requested modification
+    char* pathPtr,              ///<[IN] Application's config file path
+    json_t **jsonRootObjPtr,    ///<[OUT] json root object
+    json_t **jsonArrayPtr       ///<[OUT] messages in box list
 )
 {
-    int res = 0;
+    json_error_t error;
+    *jsonRootObjPtr = json_load_file(pathPtr, 0, &error);
 
-    if (jsonValPtr == NULL)
+    if ( !(*jsonRootObjPtr) )
     {
-        LE_ERROR("NULL jsonValPtr");
-        return LE_FAULT;
+        LE_DEBUG("No message box file %s", pathPtr);
+        return LE_NOT_FOUND;
     }
 
-    switch (modifPtr->type)
-    {
-        case DESC_STRING:
-            // check the type
-            if (json_is_string(jsonValPtr) == false)
-            {
-                LE_ERROR("Bad key format");
-                res = -1;
-            }
+    *jsonArrayPtr = json_object_get(*jsonRootObjPtr, JSON_MSGINBOX);
 
-            if ( res == 0 )
-            {
-                res = json_string_set(jsonValPtr, modifPtr->uVal.str.strPtr);
-            }
-        break;
-        case DESC_INT:
-            // check the type
-            if (json_is_integer(jsonValPtr) == false )
-            {
-                LE_ERROR("Bad key format");
-                res = -1;
-            }
+    if ( !json_is_array(*jsonArrayPtr) )
+    {
+        json_decref(*jsonRootObjPtr);
+        LE_ERROR("Json error");
+        return LE_FAULT;
+    }
 
-            if ( res == 0 )
-            {
-                res = json_integer_set(jsonValPtr, modifPtr->uVal.val);
-            }
-        break;
-        case DESC_BOOL:
-            // check the type
-            if ( (json_is_true(jsonValPtr) != true) && (json_is_false(jsonValPtr) != true) )
-            {
-                LE_ERROR("Bad key format");
-                res = -1;
-            }
+    return LE_OK;
+}
 
-            if (( res == 0 ) &&
-                (AddBooleanKeyInJsonObject(jsonObjPtr, key, modifPtr->uVal.boolVal) != LE_OK))
-            {
-                res = -1;
-            }
-        break;
-        default:
-            res = -1;
-        break;
-    }
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if a message identifier is listed in a legacy message box list
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsMessageIdInList
+(
+    json_t* jsonArrayPtr,       ///<[IN] messages in box list
+    MessageId_t messageId       ///<[IN] Message identifier
+)
+{
+    size_t i;
 
-    if (res < 0)
+    for (i = 0; i < json_array_size(jsonArrayPtr); i++)
     {
-        LE_ERROR(("Update error %d"), modifPtr->type);
-        return LE_FAULT;
+        if (json_integer_value(json_array_get(jsonArrayPtr, i)) == messageId)
+        {
+            return true;
+        }
     }
-    else
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy a string value of a legacy Json object
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReadJsonString
+(
+    json_t* jsonObjPtr,         ///<[IN] Json object
+    const char* keyPtr,         ///<[IN] Key to read
+    char* strPtr,               ///<[OUT] String value
+    size_t strSize              ///<[IN] Size of strPtr
+)
+{
+    const char* valuePtr = json_string_value(json_object_get(jsonObjPtr, keyPtr));
+
+    if (valuePtr)
     {
-        LE_DEBUG("ModifyJsonObj OK");
-        return LE_OK;
+        le_utf8_Copy(strPtr, valuePtr, strSize, NULL);
     }
-
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Modify message file
+ * Import a legacy message file into the message store
  *
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t ModifyMsgEntry
+static le_result_t ImportLegacyMsg
 (
-    MessageId_t messageId,      ///<[IN] Message identifier to be modified
-    char* keyPtr[],              ///<[IN] Key to modify
-    uint8_t nbKey,              ///<[IN] Number of elements in keyPtr
-    EntryDesc_t * modifPtr      ///<[IN] Requested modification
+    MessageId_t messageId,      ///<[IN] Message identifier
+    uint16_t mboxMask           ///<[IN] Message boxes holding the message
 )
 {
     uint16_t pathLen = GetSMSInboxMessagePathLen();
     char path[pathLen];
-    memset(path, 0, pathLen);
     json_error_t error;
-    le_result_t res;
-    int indexKey = -1;
+    smsStore_Msg_t msg;
+    uint16_t unreadMask = 0;
+    const char* jsonKey = NULL;
+    int i;
 
     GetSMSInboxMessagePath(messageId, path, pathLen);
 
-    LE_DEBUG("ModifyMsgEntry: messageId %d, path %s",messageId, path);
-
-    json_t* jsonRootPtr = json_load_file(path, 0, &error);
+    json_t* jsonRootPtr = json_load_file(path, JSON_REJECT_DUPLICATES, &error);
 
     if ( jsonRootPtr == NULL )
     {
-        LE_ERROR("Json decoder error %s", error.text);
+        LE_ERROR("Json decoder error %s, path %s", error.text, path);
         return LE_FAULT;
     }
 
-    json_t* jsonValPtr = jsonRootPtr;
-    json_t* jsonSubObjPtr = jsonRootPtr;
+    memset(&msg, 0, sizeof(msg));
+    msg.format = json_integer_value(json_object_get(jsonRootPtr, JSON_FORMAT));
+    msg.msgLen = json_integer_value(json_object_get(jsonRootPtr, JSON_MSGLEN));
+    ReadJsonString(jsonRootPtr, JSON_IMSI, msg.imsi, sizeof(msg.imsi));
+    ReadJsonString(jsonRootPtr, JSON_SENDERTEL, msg.senderTel, sizeof(msg.senderTel));
+    ReadJsonString(jsonRootPtr, JSON_TIMESTAMP, msg.timestamp, sizeof(msg.timestamp));
 
-    while ( ( json_is_object(jsonValPtr) == true ) && ( nbKey > indexKey ) )
+    switch (msg.format)
     {
-        indexKey++;
-        jsonSubObjPtr = jsonValPtr;
-        jsonValPtr = json_object_get(jsonSubObjPtr, keyPtr[indexKey]);
+        case LE_SMS_FORMAT_TEXT:
+            jsonKey = JSON_TEXT;
+            break;
+        case LE_SMS_FORMAT_BINARY:
+            jsonKey = JSON_BIN;
+            break;
+        case LE_SMS_FORMAT_PDU:
+            jsonKey = JSON_PDU;
+            break;
+        default:
+            LE_ERROR("Bad format %d", msg.format);
+            break;
     }
 
-    if ( !jsonValPtr )
-    {
-        if ((indexKey > -1) && (indexKey < nbKey))
-        {
-            LE_ERROR("Unable to get the object %s", keyPtr[indexKey]);
-        }
-        else
-        {
-            LE_ERROR("IndexKey: %d is out of range", indexKey);
-        }
+    // Payloads were stored as hexadecimal strings.
+    const char* hexPtr = jsonKey ? json_string_value(json_object_get(jsonRootPtr, jsonKey)) : NULL;
 
-        res = LE_FAULT;
-    }
-    else
+    if (hexPtr)
     {
-        if ((indexKey > -1) && (indexKey < nbKey))
+        int32_t len = le_hex_StringToBinary(hexPtr, strlen(hexPtr), msg.payload,
+                                            sizeof(msg.payload));
+        if (len < 0)
         {
-            res = ModifyJsonObj(jsonSubObjPtr, jsonValPtr, keyPtr[indexKey], modifPtr);
+            LE_ERROR("Bad payload in %s", path);
+            len = 0;
         }
-        else
+
+        msg.payloadLen = len;
+
+        if (LE_SMS_FORMAT_TEXT == msg.format)
         {
-            LE_ERROR("IndexKey: %d is out of range", indexKey);
-            res = LE_FAULT;
+            // The text was recorded with its '\0' character
+            msg.payloadLen = strnlen((const char*) msg.payload, msg.payloadLen);
         }
     }
 
-    if ( res == LE_OK )
+    json_t* jsonUnreadPtr = json_object_get(jsonRootPtr, JSON_ISUNREAD);
+
+    for (i = 0; i < MAX_APPS; i++)
     {
-        if (json_dump_file(jsonRootPtr, path, JSON_INDENT(1) | JSON_PRESERVE_ORDER) < 0)
+        if ( (mboxMask & (1 << i)) &&
+             json_is_true(json_object_get(jsonUnreadPtr, Apps[i].namePtr)) )
         {
-            LE_ERROR("Json error");
-            res = LE_FAULT;
+            unreadMask |= (1 << i);
         }
     }
-    else
-    {
-        LE_ERROR("Something was wrong in ModifyJsonObj");
-    }
 
     json_decref(jsonRootPtr);
 
-    return res;
+    return smsStore_Add(&msg, messageId, mboxMask, unreadMask, &messageId);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Read Json object
+ * Select the legacy message files in the message directory
  *
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t ReadJsonObj
+static int IsLegacyMsgFile
 (
-    json_t* jsonValPtr,         ///<[IN] Json value to be read
-    char* keyPtr[],             ///<[IN] Key to read
-    uint8_t nbKey,              ///<[IN] Number of elements in keyPtr
-    EntryDesc_t * decodePtr     ///<[OUT] Decoding result
+    const struct dirent* entryPtr  ///<[IN] Directory entry
 )
 {
-    le_result_t res = LE_OK;
-
-    if ( jsonValPtr == NULL )
-    {
-        LE_ERROR("No information");
-        return LE_FAULT;
-    }
-
-    switch json_typeof(jsonValPtr)
-    {
-        case JSON_STRING:
-        {
-            if ( decodePtr->type != DESC_STRING )
-            {
-                LE_ERROR("Bad format %d", decodePtr->type);
-                res = LE_FAULT;
-            }
+    size_t len = strlen(entryPtr->d_name);
+    size_t extLen = strlen(FILE_EXTENSION);
 
-            if (res == LE_OK)
-            {
-                const char* strPtr = json_string_value((const json_t *)jsonValPtr);
-
-                if ( strlen(strPtr) >= decodePtr->uVal.str.lenStr )
-                {
-                    LE_ERROR("String too long");
-                    res = LE_OVERFLOW;
-                }
-                else
-                {
-                    strncpy(decodePtr->uVal.str.strPtr, strPtr, decodePtr->uVal.str.lenStr);
-                    decodePtr->uVal.str.lenStr = strlen(strPtr);
-                }
-            }
-        }
-        break;
-        case JSON_INTEGER:
-        {
-            if ( decodePtr->type != DESC_INT )
-            {
-                LE_ERROR("Bad format %d", decodePtr->type);
-                res = LE_FAULT;
-            }
-            else
-            {
-                decodePtr->uVal.val = json_integer_value((const json_t *)jsonValPtr);
-            }
-        }
-        break;
-        case JSON_TRUE:
-        case JSON_FALSE:
-        {
-            if ( decodePtr->type != DESC_BOOL )
-            {
-                LE_ERROR("Bad format %d", decodePtr->type);
-                res = LE_FAULT;
-            }
-            else
-            {
-                decodePtr->uVal.boolVal = json_is_true((const json_t *)jsonValPtr);
-            }
-        }
-        break;
-        case JSON_OBJECT:
-        {
-            // if key-value is an object, read the next key
-            if (nbKey >= 1)
-            {
-                json_t* jsonSubValPtr = json_object_get(jsonValPtr, keyPtr[0]);
-
-                if ( jsonSubValPtr )
-                {
-                    res = ReadJsonObj(jsonSubValPtr, &keyPtr[1], nbKey-1,  decodePtr );
-                }
-                else
-                {
-                    LE_ERROR("Bad format");
-                    res = LE_FAULT;
-                }
-            }
-            else
-            {
-                LE_ERROR("Key error");
-                res = LE_FAULT;
-            }
-        }
-        break;
-        case JSON_ARRAY:
-        case JSON_REAL:
-        case JSON_NULL:
-        default:
-            LE_ERROR("Bad json_typeof");
-            res = LE_FAULT;
-        break;
-    }
-
-    return res;
+    return (len > extLen) && (0 == strcmp(entryPtr->d_name + len - extLen, FILE_EXTENSION));
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Read Application's config file
+ * Convert the file name string in hexa
  *
+ * @return
+ *      - Positive integer corresponding to the hexadecimal input string
+ *      - -1 in case of error
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t GetMsgListFromMbox
+static MessageId_t GetMessageId
 (
-    char* pathPtr,              ///<[IN] Application's config file path
-    json_t **jsonRootObjPtr,    ///<[OUT] json root object
-    json_t **jsonArrayPtr       ///<[OUT] messages in box list
+    char* fileNamePtr  ///<[IN] file name to be converted
 )
 {
-    json_error_t error;
-    *jsonRootObjPtr = json_load_file(pathPtr, 0, &error);
+    char *savePtr;
 
-    if ( !(*jsonRootObjPtr) )
+    if(NULL != fileNamePtr)
     {
-        // File doesn't exist, create objects
-        *jsonRootObjPtr = json_object();
+        char *str = strtok_r(fileNamePtr,".", &savePtr);
 
-        if ( !(*jsonRootObjPtr) )
+        if (NULL == str)
         {
-            LE_ERROR("Json error");
-            return LE_FAULT;
+            LE_ERROR("Unable to find . in the file name");
+            return -1;
         }
+        return le_hex_HexaToInteger(str);
     }
-
-    *jsonArrayPtr = json_object_get(*jsonRootObjPtr, JSON_MSGINBOX);
-
-    if ( !(*jsonArrayPtr) )
+    else
     {
-        // Array doesn't exist, create it
-        *jsonArrayPtr = json_array();
-
-        if (!(*jsonArrayPtr))
-        {
-            json_decref(*jsonRootObjPtr);
-            LE_ERROR("Json error");
-            return LE_FAULT;
-        }
-
-        if ( json_object_set(*jsonRootObjPtr, JSON_MSGINBOX, *jsonArrayPtr) < 0 )
-        {
-            json_decref(*jsonRootObjPtr);
-            LE_ERROR("Json error");
-            return LE_FAULT;
-        }
+        LE_ERROR("Provided file name pointer is NULL");
+        return -1;
     }
-
-    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Remove a message from the application's cfg file
+ * Import the legacy Jansson message files and message box files into the message store, then
+ * remove them.
+ *
+ * A message file which can't be imported is kept, along with the message box files, so that its
+ * import is tried again the next time the store is opened.
  *
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t DeleteMsgInAppCfg
+static void MigrateLegacyFiles
 (
-    char *appNamePtr,               ///<[IN] application name
-    MessageId_t deleteMessageId     ///<[IN] message to delete
+    void
 )
 {
-    uint32_t pathLen = GetSMSInboxConfigPathLen(appNamePtr);
-    char path[pathLen];
-    memset(path, 0, pathLen);
-    GetSMSInboxConfigPath(appNamePtr, path, pathLen);
-    json_t *jsonObjPtr;
-    json_t *jsonArrayPtr;
+    struct dirent **namelist;
+    json_t* jsonRootObjPtr[MAX_APPS] = { NULL };
+    json_t* jsonArrayPtr[MAX_APPS] = { NULL };
+    char path[PATH_MAX];
+    bool isComplete = true;
+    int nbSmsEntries;
+    int i;
 
-    LE_DEBUG("DeleteMessageId %d, path %s",deleteMessageId, path);
+    snprintf(path, sizeof(path), "%s%s", SMSINBOX_PATH, MSG_PATH);
 
-    if (GetMsgListFromMbox(path, &jsonObjPtr, &jsonArrayPtr) != LE_OK)
+    nbSmsEntries = scandir(path, &namelist, IsLegacyMsgFile, alphasort);
+    if (nbSmsEntries < 0)
     {
-       LE_ERROR("No message");
-       return LE_FAULT;
+        // No legacy files
+        return;
     }
 
-    int i;
-    MessageId_t messageId;
+    LE_INFO("Import %d legacy messages", nbSmsEntries);
 
-    for (i=0; i < json_array_size(jsonArrayPtr); i++)
+    for (i = 0; i < MAX_APPS; i++)
     {
-        json_t * jsonIntegerPtr = json_array_get(jsonArrayPtr, i);
-
-        if (jsonIntegerPtr)
+        if ( Apps[i].namePtr && strlen(Apps[i].namePtr) )
         {
-            messageId = json_integer_value(jsonIntegerPtr);
+            uint32_t pathLen = GetSMSInboxConfigPathLen(Apps[i].namePtr);
+            char cfgPath[pathLen];
+            GetSMSInboxConfigPath(Apps[i].namePtr, cfgPath, pathLen);
 
-            if (messageId == deleteMessageId)
+            if (GetMsgListFromMbox(cfgPath, &jsonRootObjPtr[i], &jsonArrayPtr[i]) != LE_OK)
             {
-                LE_DEBUG("Remove %d", (int) messageId);
-                json_array_remove(jsonArrayPtr, i);
+                jsonRootObjPtr[i] = NULL;
+                jsonArrayPtr[i] = NULL;
             }
         }
-        else
-        {
-            LE_ERROR("Json error");
-        }
     }
 
-    le_result_t res = LE_OK;
-    if ( json_dump_file(jsonObjPtr, path, JSON_INDENT(1) | JSON_PRESERVE_ORDER) < 0 )
+    while (nbSmsEntries--)
     {
-        res = LE_FAULT;
-        LE_ERROR("Json_dump_file error");
-    }
+        char name[NAME_MAX + 1];
+        uint16_t mboxMask = 0;
 
-    json_decref(jsonObjPtr);
+        le_utf8_Copy(name, namelist[nbSmsEntries]->d_name, sizeof(name), NULL);
+        free(namelist[nbSmsEntries]);
 
-    return res;
-}
+        MessageId_t messageId = GetMessageId(name);
+        if ((-1 == messageId) || (0 == messageId))
+        {
+            LE_ERROR("Unable to get the message id of %s", name);
+            continue;
+        }
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Check if a message belongs to a message box
- *
- */
-//--------------------------------------------------------------------------------------------------
+        for (i = 0; i < MAX_APPS; i++)
+        {
+            if (jsonArrayPtr[i] && IsMessageIdInList(jsonArrayPtr[i], messageId))
+            {
+                mboxMask |= (1 << i);
+            }
+        }
 
-static le_result_t CheckMessageIdInMbox
-(
-    char* mboxName,
-    MessageId_t messageId
-)
-{
-    json_t *jsonRootObjPtr;
-    json_t *jsonArrayPtr;
-    uint32_t pathLen = GetSMSInboxConfigPathLen(mboxName);
-    char path[pathLen];
-    GetSMSInboxConfigPath(mboxName, path, pathLen);
+        if (mboxMask && (ImportLegacyMsg(messageId, mboxMask) != LE_OK))
+        {
+            LE_ERROR("Unable to import message %08x, keep it", (int) messageId);
+            isComplete = false;
+            continue;
+        }
 
-    if ( GetMsgListFromMbox(path, &jsonRootObjPtr, &jsonArrayPtr) != LE_OK )
-    {
-        LE_ERROR("Error in GetMsgListFromMbox");
-        return LE_FAULT;
+        uint16_t msgPathLen = GetSMSInboxMessagePathLen();
+        char msgPath[msgPathLen];
+        GetSMSInboxMessagePath(messageId, msgPath, msgPathLen);
+        unlink(msgPath);
     }
 
-    int i = 0;
+    free(namelist);
 
-    while (i < json_array_size(jsonArrayPtr))
+    for (i = 0; i < MAX_APPS; i++)
     {
-        json_t * jsonIntegerPtr = json_array_get(jsonArrayPtr, i);
-        MessageId_t msgId = 0;
-
-        if (jsonIntegerPtr)
-        {
-            msgId = json_integer_value(jsonIntegerPtr);
-        }
-        else
+        if (jsonRootObjPtr[i])
         {
-            LE_ERROR("Json error");
-            json_decref(jsonRootObjPtr);
-            return LE_FAULT;
+            json_decref(jsonRootObjPtr[i]);
         }
 
-        LE_DEBUG("MessageId %d, msgId %d, i %d", messageId, msgId, i);
-        if (msgId == messageId)
+        if ( isComplete && Apps[i].namePtr && strlen(Apps[i].namePtr) )
         {
-            json_decref(jsonRootObjPtr);
-            return LE_OK;
+            uint32_t pathLen = GetSMSInboxConfigPathLen(Apps[i].namePtr);
+            char cfgPath[pathLen];
+            GetSMSInboxConfigPath(Apps[i].namePtr, cfgPath, pathLen);
+            unlink(cfgPath);
         }
+    }
 
-        i++;
+    if (!isComplete)
+    {
+        return;
     }
 
-    LE_ERROR("Bad msg id or mbox name");
-    json_decref(jsonRootObjPtr);
-    return LE_FAULT;
+    rmdir(path);
+    snprintf(path, sizeof(path), "%s%s", SMSINBOX_PATH, CONF_PATH);
+    rmdir(path);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Decode message file
+ * Open the message store if not done yet.
+ *
+ * The legacy files left by a previous version of the service are imported at this time.
  *
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t DecodeMsgEntry
+static le_result_t OpenStore
 (
-    char* mboxName,                      ///<[IN] mbox name
-    MessageId_t messageId,               ///<[IN] Message identifier to decode
-    char* keyPtr[],                      ///<[IN] Key to retrieve
-    uint8_t nbKey,                       ///<[IN] Number of elements in keyPtr
-    EntryDesc_t * decodePtr              ///<[IN/OUT] Decoding result
+    void
 )
 {
-    uint16_t pathLen = GetSMSInboxMessagePathLen();
-    char path[pathLen];
-    memset(path, 0, pathLen);
-    json_error_t error;
-    le_result_t res = LE_OK;
+    bool created;
 
-    GetSMSInboxMessagePath(messageId, path, pathLen);
-
-    json_t* jsonRootPtr = json_load_file(path, JSON_REJECT_DUPLICATES, &error);
+    if (StoreOpened)
+    {
+        return LE_OK;
+    }
 
-    if ( jsonRootPtr == NULL )
+    if (smsStore_Open(SMSINBOX_PATH, le_smsInbox_mboxName, le_smsInbox_NbMbx, &created) != LE_OK)
     {
-        LE_ERROR("Json decoder error %s mboxName %s", error.text, mboxName);
-        DeleteMsgInAppCfg(mboxName, messageId);
+        LE_ERROR("Unable to open the message store");
         return LE_FAULT;
     }
 
-    res = ReadJsonObj(jsonRootPtr, keyPtr, nbKey, decodePtr);
+    LE_DEBUG("Message store %s", created ? "created" : "opened");
 
-    json_decref(jsonRootPtr);
+    StoreOpened = true;
 
-    return res;
-}
+    MigrateLegacyFiles();
 
+    return LE_OK;
+}
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Check if an application requested the deletion of a message
+ * Check if a message belongs to a message box
  *
  */
 //--------------------------------------------------------------------------------------------------
-static bool IsDeleted
+static le_result_t CheckMessageIdInMbox
 (
-    MessageId_t messageId,  ///<[IN] Message identifier
-    char* appNamePtr        ///<[IN] Application name
+    MboxCtx_t* mboxCtxPtr,
+    MessageId_t messageId
 )
 {
-    EntryDesc_t decode;
-    decode.type = DESC_BOOL;
-    char* key[2] = {JSON_ISDELETED, appNamePtr};
-
-    if (DecodeMsgEntry(appNamePtr, messageId, key, 2, &decode) == LE_OK)
+    if (smsStore_IsInMbox(messageId, mboxCtxPtr->index))
     {
-        LE_DEBUG("Decode.uVal.boolVal %d", decode.uVal.boolVal);
-        return decode.uVal.boolVal;
-    }
-    else
-    {
-        // if error, delete the message
-        return true;
+        return LE_OK;
     }
+
+    LE_ERROR("Bad msg id or mbox name");
+    return LE_FAULT;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Perform the deleteion
+ * Copy a string of a stored message
  *
+ * @return
+ *      - LE_OK on success
+ *      - LE_OVERFLOW if the string doesn't fit into the buffer
  */
 //--------------------------------------------------------------------------------------------------
-static void PerformDeletion
+static le_result_t CopyMsgString
 (
-    MessageId_t messageId   ///<[IN] Message identifier
+    char* dstPtr,           ///<[OUT] Destination buffer
+    size_t dstSize,         ///<[IN] Destination buffer size
+    const char* srcPtr      ///<[IN] Stored string
 )
 {
-    int i;
-    bool deleted = true;
-
-    for (i=0; i < MAX_APPS; i++)
+    if ( strlen(srcPtr) >= dstSize )
     {
-        if ( Apps[i].namePtr && (strlen(Apps[i].namePtr) != 0) )
-        {
-            deleted &= IsDeleted(messageId, Apps[i].namePtr);
-        }
+        LE_ERROR("String too long");
+        return LE_OVERFLOW;
     }
 
-    // All applications mark this message to be delteted => erase physically the message
-    if (deleted)
-    {
-        uint16_t pathLen = GetSMSInboxMessagePathLen();
-        char path[pathLen];
-        memset(path, 0, pathLen);
-
-        GetSMSInboxMessagePath(messageId, path, pathLen);
-
-        LE_DEBUG("Delete messageId %d, path %s",messageId, path);
-        unlink(path);
-    }
+    return le_utf8_Copy(dstPtr, srcPtr, dstSize, NULL);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Add a message in the application's cfg file
+ * Remove the oldest messages of a message box until there is room for a new message
  *
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t AddMsgInAppCfg
+static void MakeRoomInMbox
 (
-    MboxCtx_t* appsPtr,         ///<[IN] application config
-    MessageId_t messageId     ///<[IN] message to add
+    MboxCtx_t* appsPtr          ///<[IN] application config
 )
 {
-    uint32_t pathLen = GetSMSInboxConfigPathLen(appsPtr->namePtr);
-    char path[pathLen];
-    GetSMSInboxConfigPath(appsPtr->namePtr, path, pathLen);
-    json_t* jsonMsgIdPtr = NULL;
-    json_t* jsonPtr;
-    json_t* jsonArrayPtr;
-
-    if ( GetMsgListFromMbox (path, &jsonPtr, &jsonArrayPtr) != LE_OK )
+    while ( smsStore_GetMboxCount(appsPtr->index) >= appsPtr->inboxSize )
     {
-        LE_ERROR("Message %s not found", path);
-        return LE_FAULT;
-    }
-    LE_DEBUG("Add messageId %d, path %s, array Size %zu", messageId,
-                                                          path,
-                                                          json_array_size(jsonArrayPtr) );
-
-    if ( json_array_size(jsonArrayPtr) == appsPtr->inboxSize )
-    {
-        // delete older entry
-        jsonMsgIdPtr = json_array_get(jsonArrayPtr, 0);
-        MessageId_t messageId = 0;
+        MessageId_t messageId = smsStore_GetNextInMbox(appsPtr->index, 0);
 
-        if (jsonMsgIdPtr)
+        if (0 == messageId)
         {
-            messageId = json_integer_value(jsonMsgIdPtr);
+            break;
         }
 
-        if (messageId != 0)
-        {
-            json_array_remove(jsonArrayPtr, 0);
-
-            EntryDesc_t modif;
-            modif.type = DESC_BOOL;
-            modif.uVal.boolVal = true;
-            char* key[2]={JSON_ISDELETED, appsPtr->namePtr};
-
-            if (ModifyMsgEntry(messageId, key, 2, &modif) != LE_OK)
-            {
-                LE_ERROR("Can't modify entry %08x, path %s", (int) messageId, path);
-            }
-
-            PerformDeletion(messageId);
-        }
-        else
+        LE_DEBUG("Remove %d from %s", (int) messageId, appsPtr->namePtr);
+        if (smsStore_RemoveFromMbox(messageId, appsPtr->index) != LE_OK)
         {
-            json_decref(jsonPtr);
-            LE_ERROR("Json error");
-            return LE_FAULT;
+            LE_ERROR("Can't remove entry %08x from %s", (int) messageId, appsPtr->namePtr);
+            break;
         }
     }
-
-    if (AddIntegerKeyInJsonObject(jsonArrayPtr, NULL, messageId) != LE_OK)
-    {
-        json_decref(jsonPtr);
-        LE_ERROR("Json error");
-        return LE_FAULT;
-    }
-
-    if ( json_dump_file(jsonPtr, path, JSON_INDENT(1) | JSON_PRESERVE_ORDER) < 0 )
-    {
-        json_decref(jsonPtr);
-        LE_ERROR("Json error");
-        return LE_FAULT;
-    }
-
-    json_decref(jsonPtr);
-
-    // Use for the first initialization
-    if (jsonArrayPtr->refcount > 0)
-    {
-        json_decref(jsonArrayPtr);
-    }
-
-    return LE_OK;
 }
 
-
-
 //--------------------------------------------------------------------------------------------------
 /**
- * Encode Json file
+ * Store a new message into all the message boxes
  *
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t EncodeMsgEntry
+static le_result_t StoreMsgEntry
 (
-    uint32_t fd,            ///<[IN] file descriptor
-    le_sms_MsgRef_t msgRef  ///<[IN] SMS to be encoding
+    le_sms_MsgRef_t msgRef,     ///<[IN] SMS to be stored
+    MessageId_t *msgPtr         ///<[OUT] created messageId
 )
 {
-    json_t *jsonRootPtr = json_object();
+    smsStore_Msg_t msg;
+    uint16_t mboxMask = 0;
+    le_result_t result;
+    int i;
 
-    if (!jsonRootPtr)
+    if (OpenStore() != LE_OK)
     {
-        LE_ERROR("Json error");
         return LE_FAULT;
     }
 
-    // Add imsi in json file
-    AddStringKeyInJsonObject(jsonRootPtr, JSON_IMSI, SimImsi);
+    memset(&msg, 0, sizeof(msg));
 
-    // Add sms format in json file
-    le_sms_Format_t format = le_sms_GetFormat(msgRef);
-    AddIntegerKeyInJsonObject(jsonRootPtr, JSON_FORMAT, (int) format);
-
-    // Unread by default for all applications
-    json_t *jsonUnreadPtr = json_object();
-    int i;
-    for (i=0; i < MAX_APPS; i++)
-    {
-        if ( Apps[i].namePtr && (strlen(Apps[i].namePtr) != 0) )
-        {
-            AddBooleanKeyInJsonObject(jsonUnreadPtr, Apps[i].namePtr, true);
-        }
-    }
-
-    json_object_set_new(jsonRootPtr, JSON_ISUNREAD, jsonUnreadPtr);
-
-    // Undeleted by default for all applications
-    json_t *jsonDeletePtr = json_object();
-    for (i=0; i < MAX_APPS; i++)
-    {
-        if ( Apps[i].namePtr && (strlen(Apps[i].namePtr) != 0) )
-        {
-            AddBooleanKeyInJsonObject(jsonDeletePtr, Apps[i].namePtr, false);
-        }
-    }
+    le_utf8_Copy(msg.imsi, SimImsi, sizeof(msg.imsi), NULL);
 
-    json_object_set_new(jsonRootPtr, JSON_ISDELETED, jsonDeletePtr);
+    msg.format = le_sms_GetFormat(msgRef);
 
-    switch ( format )
+    switch ( msg.format )
     {
         case LE_SMS_FORMAT_TEXT:
         case LE_SMS_FORMAT_BINARY:
         {
-            char tel[LE_MDMDEFS_PHONE_NUM_MAX_BYTES];
-            memset(tel, 0, LE_MDMDEFS_PHONE_NUM_MAX_BYTES);
-
             // Add phone number
-            le_result_t result = le_sms_GetSenderTel(msgRef, tel, LE_MDMDEFS_PHONE_NUM_MAX_BYTES);
+            result = le_sms_GetSenderTel(msgRef, msg.senderTel, sizeof(msg.senderTel));
 
             if (result != LE_OK)
             {
@@ -1235,13 +864,11 @@ static le_result_t EncodeMsgEntry
             }
             else
             {
-                LE_DEBUG("Tel num: %s", tel);
-                AddStringKeyInJsonObject(jsonRootPtr, JSON_SENDERTEL, tel);
+                LE_DEBUG("Tel num: %s", msg.senderTel);
             }
 
             // Add timestamp
-            char timeStamp[LE_SMS_TIMESTAMP_MAX_BYTES];
-            result = le_sms_GetTimeStamp (msgRef, timeStamp, LE_SMS_TIMESTAMP_MAX_BYTES);
+            result = le_sms_GetTimeStamp(msgRef, msg.timestamp, sizeof(msg.timestamp));
 
             if (result != LE_OK)
             {
@@ -1249,196 +876,76 @@ static le_result_t EncodeMsgEntry
             }
             else
             {
-                LE_DEBUG("Timestamp: %s", timeStamp);
-                AddStringKeyInJsonObject(jsonRootPtr, JSON_TIMESTAMP, timeStamp);
+                LE_DEBUG("Timestamp: %s", msg.timestamp);
             }
 
-            size_t len = le_sms_GetUserdataLen(msgRef);
-            AddIntegerKeyInJsonObject(jsonRootPtr, JSON_MSGLEN, len);
-
-            // Add a character for last '\0'
-            len++;
-
-            uint8_t bin[len];
-            memset(bin, 0, len);
-            int32_t strLen = 2*len + 1;
-            char string[strLen];
-            memset(string, 0, strLen);
-            const char* jsonKey;
-
-            if (format == LE_SMS_FORMAT_TEXT)
-            {
-                // Get text
-                result = le_sms_GetText(msgRef, (char*) bin, len);
-                jsonKey = JSON_TEXT;
-            }
-            else
-            {
-                // Get binary
-                result = le_sms_GetBinary(msgRef, bin, &len);
-                jsonKey = JSON_BIN;
-            }
-
-            if (result != LE_OK)
-            {
-                LE_ERROR("Unable to get payload %d", result);
-                AddIntegerKeyInJsonObject(jsonRootPtr, JSON_MSGLEN, 0);
-            }
-            else
-            {
-                // Convert payload in string: json supports only utf-8 characters.
-                // Some extended-ASCII characters can be sent by SMS (such as character with accent)
-                // and can't be convert directly in utf-8. A convertion in string solves this issue.
-                strLen = le_hex_BinaryToString(bin, len, string, strLen);
-                AddStringKeyInJsonObject(jsonRootPtr, jsonKey, string);
-
-            }
-        }
-        break;
-
-        case LE_SMS_FORMAT_PDU:
-        {
-            size_t len = le_sms_GetPDULen(msgRef);
-            AddIntegerKeyInJsonObject(jsonRootPtr, JSON_MSGLEN, len);
-            // Add a character for last '\0'
-            len++;
-            uint8_t pdu[len];
-            memset(pdu, 0, len);
-            int32_t strLen = 2*len + 1;
-            char string[strLen];
-            memset(string, 0, strLen);
-
-            // Add pdu
-            le_result_t result = le_sms_GetPDU(msgRef, pdu, &len);
-
-            if (result != LE_OK)
-            {
-                LE_ERROR("Unable to get pdu %d", result);
-                AddIntegerKeyInJsonObject(jsonRootPtr, JSON_MSGLEN, 0);
-            }
-            else
-            {
-                // Convert pdu in string
-                strLen = le_hex_BinaryToString(pdu, len, string, strLen);
-                AddStringKeyInJsonObject(jsonRootPtr, JSON_PDU, string);
-                LE_DEBUG("PDU format OK");
-            }
-        }
-        break;
-        case LE_SMS_FORMAT_UNKNOWN:
-        default:
-            LE_ERROR("Bad format %d", format);
-    }
-
-    // Write json file in the file system
-    char* jsondumpStr = json_dumps( (const json_t *) jsonRootPtr,
-                                    JSON_INDENT(1) | JSON_PRESERVE_ORDER);
-    if (!jsondumpStr)
-    {
-        LE_ERROR("JsondumpStr is NULL");
-        return LE_FAULT;
-    }
-
-    char* restJsondumpStr = jsondumpStr;
-    ssize_t writeSize = strlen(jsondumpStr);
-    ssize_t writtenSize;
-
-    do
-    {
-        writtenSize = write( fd, restJsondumpStr, writeSize );
-        if (writtenSize > 0)
-        {
-            writeSize -= writtenSize;
-            restJsondumpStr += writtenSize;
-        }
-    }
-    while ((writeSize > 0) && ((writtenSize >= 0) || (EINTR == errno)));
-
-    free(jsondumpStr);
-    json_decref(jsonRootPtr);
-
-    return LE_OK;
-}
-
-//--------------------------------------------------------------------------------------------------
-/**
- * Create a new message entry
- *
- */
-//--------------------------------------------------------------------------------------------------
-static le_result_t CreateMsgEntry
-(
-    MessageId_t *msgPtr,    ///<[OUT] create messageId
-    int32_t *fdPtr         ///<[OUT] Created file descriptor
-)
-{
-    uint16_t pathLen = GetSMSInboxMessagePathLen();
-    char path[pathLen];
-    memset(path, 0, pathLen);
-
-    GetSMSInboxMessagePath(NextMessageId, path, pathLen);
-    LE_DEBUG("Create entry: NextMessageId %d, path %s",NextMessageId, path);
-
-    *fdPtr = open( path, O_CREAT | O_RDWR | O_SYNC, S_IRUSR | S_IWUSR );
-
-    if (*fdPtr < 0)
-    {
-        LE_ERROR("No such file: %s: %m", path);
-        return LE_FAULT;
-    }
-
-    LE_DEBUG("New entry: %s", path);
+            msg.msgLen = le_sms_GetUserdataLen(msgRef);
 
-    int i;
+            if (msg.format == LE_SMS_FORMAT_TEXT)
+            {
+                // Get text
+                result = le_sms_GetText(msgRef, (char*) msg.payload, sizeof(msg.payload));
+                msg.payloadLen = strnlen((const char*) msg.payload, sizeof(msg.payload));
+            }
+            else
+            {
+                // Get binary
+                msg.payloadLen = sizeof(msg.payload);
+                result = le_sms_GetBinary(msgRef, msg.payload, &msg.payloadLen);
+            }
 
-    // For all the applications
-    for (i = 0; i < MAX_APPS; i++)
-    {
-        if ( Apps[i].namePtr && strlen(Apps[i].namePtr) )
-        {
-            AddMsgInAppCfg(&Apps[i], NextMessageId);
+            if (result != LE_OK)
+            {
+                LE_ERROR("Unable to get payload %d", result);
+                msg.msgLen = 0;
+                msg.payloadLen = 0;
+            }
         }
-    }
-
-    *msgPtr = NextMessageId;
+        break;
 
-    NextMessageId++;
+        case LE_SMS_FORMAT_PDU:
+        {
+            msg.msgLen = le_sms_GetPDULen(msgRef);
+            msg.payloadLen = sizeof(msg.payload);
 
-    return LE_OK;
-}
+            // Add pdu
+            result = le_sms_GetPDU(msgRef, msg.payload, &msg.payloadLen);
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Convert the file name string in hexa
- *
- * @return
- *      - Positive integer corresponding to the hexadecimal input string
- *      - -1 in case of error
- */
-//--------------------------------------------------------------------------------------------------
-static MessageId_t GetMessageId
-(
-    char* fileNamePtr  ///<[IN] file name to be converted
-)
-{
-    char *savePtr;
+            if (result != LE_OK)
+            {
+                LE_ERROR("Unable to get pdu %d", result);
+                msg.msgLen = 0;
+                msg.payloadLen = 0;
+            }
+            else
+            {
+                LE_DEBUG("PDU format OK");
+            }
+        }
+        break;
+        case LE_SMS_FORMAT_UNKNOWN:
+        default:
+            LE_ERROR("Bad format %d", msg.format);
+    }
 
-    if(NULL != fileNamePtr)
+    // For all the applications: unread and undeleted by default
+    for (i = 0; i < MAX_APPS; i++)
     {
-        char *str = strtok_r(fileNamePtr,".", &savePtr);
-
-        if (NULL == str)
+        if ( Apps[i].namePtr && strlen(Apps[i].namePtr) && Apps[i].inboxSize )
         {
-            LE_ERROR("Unable to find . in the file name");
-            return -1;
+            MakeRoomInMbox(&Apps[i]);
+            mboxMask |= (1 << i);
         }
-        return le_hex_HexaToInteger(str);
     }
-    else
+
+    result = smsStore_Add(&msg, 0, mboxMask, mboxMask, msgPtr);
+
+    if (result == LE_OK)
     {
-        LE_ERROR("Provided file name pointer is NULL");
-        return -1;
+        LE_DEBUG("New entry: %d", (int) *msgPtr);
     }
+
+    return result;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1475,63 +982,10 @@ static void InitSmsInBoxDirectory
     void
 )
 {
-    struct dirent **namelist;
-    uint32_t nbSmsEntries;
-
     LE_DEBUG("InitSmsInBoxDirectory");
 
-    // create directories
-    if (LE_OK != MkdirCreate(SMSINBOX_PATH))
-    {
-        return;
-    }
-
-    uint16_t pathLen = GetSMSInboxMessagePathLen();
-    char path[pathLen];
-    memset(path, 0, pathLen);
-    snprintf(path, pathLen, "%s%s", SMSINBOX_PATH, CONF_PATH);
-
-    if (LE_OK != MkdirCreate(path))
-    {
-        return;
-    }
-
-    memset(path, 0, pathLen);
-    snprintf(path, pathLen, "%s%s", SMSINBOX_PATH, MSG_PATH);
-
-    if (LE_OK != MkdirCreate(path))
-    {
-        return;
-    }
-
-    nbSmsEntries = scandir(path, &namelist, NULL, alphasort);
-    if ( nbSmsEntries > 2 )
-    {
-        uint8_t len = strlen(namelist[nbSmsEntries-1]->d_name);
-        char name[len+1];
-        MessageId_t id;
-
-        memset(name, 0, len+1);
-        strncpy(name, namelist[nbSmsEntries-1]->d_name, len);
-
-        id = GetMessageId(name);
-        if (-1 == id)
-        {
-            LE_ERROR("Unable to get the id of %s", name);
-            return;
-        }
-
-        NextMessageId = ++id;
-
-        LE_DEBUG("NextMessageId %d", (int) NextMessageId);
-    }
-
-    while (nbSmsEntries--)
-    {
-        free(namelist[nbSmsEntries]);
-    }
-
-    free(namelist);
+    // create directory
+    MkdirCreate(SMSINBOX_PATH);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1545,7 +999,6 @@ static void MoveSmsFromSimToFolder
     void
 )
 {
-    int32_t fd;
     le_result_t result = LE_OK;
 
     le_sms_MsgListRef_t msgListRef = le_sms_CreateRxMsgList();
@@ -1562,18 +1015,9 @@ static void MoveSmsFromSimToFolder
     {
         MessageId_t msgId;
 
-        result = CreateMsgEntry(&msgId, &fd);
-
-        if (result == LE_OK)
-        {
-            if ( EncodeMsgEntry(fd, smsRef) != LE_OK )
-            {
-                LE_ERROR("Encoding issue");
-            }
+        result = StoreMsgEntry(smsRef, &msgId);
 
-            close(fd);
-        }
-        else
+        if (result != LE_OK)
         {
             LE_ERROR("Error during new entry creation");
         }
@@ -1602,23 +1046,12 @@ static void NewSmsMsgHandler
     void*           contextPtr
 )
 {
-    int32_t fd;
     le_result_t result;
     MessageId_t msgId;
 
     LE_DEBUG("Receive new message");
 
-    result = CreateMsgEntry(&msgId, &fd);
-
-    if (result == LE_OK)
-    {
-        result = EncodeMsgEntry(fd, msgRef);
-        close(fd);
-    }
-    else
-    {
-        LE_ERROR("CreateMsgEntry error");
-    }
+    result = StoreMsgEntry(msgRef, &msgId);
 
     if (result == LE_OK)
     {
@@ -1630,7 +1063,7 @@ static void NewSmsMsgHandler
     }
     else
     {
-        LE_ERROR("EncodeMsgEntry error");
+        LE_ERROR("StoreMsgEntry error");
     }
 }
 
@@ -1706,6 +1139,7 @@ static le_result_t LoadInboxSettings
         }
 
         Apps[i].namePtr = (char*) le_smsInbox_mboxName[i];
+        Apps[i].index = i;
 
         le_cfg_CancelTxn(appIter);
 
@@ -1868,6 +1302,12 @@ SmsInbox_SessionRef_t SmsInbox_Open
         return NULL;
     }
 
+    if (OpenStore() != LE_OK)
+    {
+        LE_ERROR("Message store not available");
+        return NULL;
+    }
+
     int i;
 
     for (i=0; i < MAX_APPS; i++)
@@ -2040,30 +1480,17 @@ void SmsInbox_DeleteMsg
         return;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t modif;
-    modif.type = DESC_BOOL;
-    modif.uVal.boolVal = true;
-    char* key[2]={JSON_ISDELETED, clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr};
-
-    if (ModifyMsgEntry(messageId, key, 2, &modif) != LE_OK)
-    {
-        LE_ERROR("ModifyMsgEntry error");
-    }
-
-    if (DeleteMsgInAppCfg(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId)
-                          != LE_OK)
+    if (smsStore_RemoveFromMbox((MessageId_t) msgId,
+                                clientRequestPtr->mboxSessionPtr->mboxCtxPtr->index) != LE_OK)
     {
-        LE_ERROR("DeleteMsgInAppCfg error");
+        LE_ERROR("Unable to delete message %08x", (int) msgId);
     }
-
-    PerformDeletion(messageId);
 }
 
 
@@ -2111,13 +1538,13 @@ le_result_t SmsInbox_GetImsi
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
+    smsStore_Msg_t msg;
     le_result_t res;
 
     memset(imsiPtr, 0, imsiNumElements);
@@ -2127,14 +1554,12 @@ le_result_t SmsInbox_GetImsi
         return LE_OVERFLOW;
     }
 
-    EntryDesc_t decode;
-    decode.type = DESC_STRING;
-    decode.uVal.str.strPtr = imsiPtr;
-    decode.uVal.str.lenStr = imsiNumElements;
-    char* key[1] = {JSON_IMSI};
+    if ((res = smsStore_Read((MessageId_t) msgId, &msg)) != LE_OK)
+    {
+        return LE_FAULT;
+    }
 
-    if ((res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr,
-                              messageId, key, 1, &decode)) == LE_OK)
+    if ((res = CopyMsgString(imsiPtr, imsiNumElements, msg.imsi)) == LE_OK)
     {
         SmsInbox_MarkRead(sessionRef, msgId);
     }
@@ -2178,22 +1603,18 @@ le_sms_Format_t SmsInbox_GetFormat
         return 0;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return 0;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t decode;
-    decode.type = DESC_INT;
-    char* key[1] = {JSON_FORMAT};
+    smsStore_Msg_t msg;
 
-    if (DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key, 1,
-                      &decode) == LE_OK)
+    if (smsStore_Read((MessageId_t) msgId, &msg) == LE_OK)
     {
         SmsInbox_MarkRead(sessionRef, msgId);
-        return decode.uVal.val;
+        return msg.format;
     }
     else
     {
@@ -2243,23 +1664,29 @@ le_result_t SmsInbox_GetSenderTel
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
+    smsStore_Msg_t msg;
     le_result_t res;
-    EntryDesc_t decode;
-    decode.type = DESC_STRING;
-    decode.uVal.str.strPtr = telPtr;
-    decode.uVal.str.lenStr = telNumElements;
+
     memset(telPtr, 0, telNumElements);
-    char* key[1] = {JSON_SENDERTEL};
 
-    if ((res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key,
-                              1, &decode)) == LE_OK)
+    if (smsStore_Read((MessageId_t) msgId, &msg) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    if (msg.senderTel[0] == '\0')
+    {
+        LE_ERROR("No sender telephone number");
+        return LE_FAULT;
+    }
+
+    if ((res = CopyMsgString(telPtr, telNumElements, msg.senderTel)) == LE_OK)
     {
         SmsInbox_MarkRead(sessionRef, msgId);
     }
@@ -2313,23 +1740,29 @@ le_result_t SmsInbox_GetTimeStamp
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t decode;
-    decode.type = DESC_STRING;
-    decode.uVal.str.strPtr = timestampPtr;
-    decode.uVal.str.lenStr = timestampNumElements;
-    memset(timestampPtr, 0, timestampNumElements);
-    char* key[1] = {JSON_TIMESTAMP};
+    smsStore_Msg_t msg;
     le_result_t res;
 
-    if ( (res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId,
-                               key, 1, &decode)) == LE_OK )
+    memset(timestampPtr, 0, timestampNumElements);
+
+    if (smsStore_Read((MessageId_t) msgId, &msg) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    if (msg.timestamp[0] == '\0')
+    {
+        LE_ERROR("No timestamp");
+        return LE_FAULT;
+    }
+
+    if ((res = CopyMsgString(timestampPtr, timestampNumElements, msg.timestamp)) == LE_OK)
     {
         SmsInbox_MarkRead(sessionRef, msgId);
     }
@@ -2370,28 +1803,19 @@ size_t SmsInbox_GetMsgLen
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-
-    EntryDesc_t decode;
-    decode.type = DESC_INT;
-    char* key[1] = {JSON_MSGLEN};
-    le_result_t res;
+    smsStore_Msg_t msg;
 
-    if ( (res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr,
-                                messageId,
-                                key,
-                                1,
-                                &decode)) == LE_OK )
+    if (smsStore_Read((MessageId_t) msgId, &msg) == LE_OK)
     {
         SmsInbox_MarkRead(sessionRef, msgId);
 
-        return decode.uVal.val;
+        return msg.msgLen;
     }
     else
     {
@@ -2442,42 +1866,38 @@ le_result_t SmsInbox_GetText
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t decode;
-    le_result_t res;
-    size_t len = 2*textNumElements+1;
-    char tmpTextPtr[len];
-    memset(tmpTextPtr, 0, len);
-    memset(textPtr, 0, textNumElements);
+    smsStore_Msg_t msg;
 
-    decode.type = DESC_STRING;
-    decode.uVal.str.strPtr = tmpTextPtr;
-    decode.uVal.str.lenStr = len;
-    char* key[1] = {JSON_TEXT};
+    memset(textPtr, 0, textNumElements);
 
-    res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key, 1,
-                         &decode);
+    if (smsStore_Read((MessageId_t) msgId, &msg) != LE_OK)
+    {
+        return LE_FAULT;
+    }
 
-    if ( res == LE_OK )
+    if (msg.format != LE_SMS_FORMAT_TEXT)
     {
-        if ( le_hex_StringToBinary(tmpTextPtr,
-                                   decode.uVal.str.lenStr,
-                                   (uint8_t*) textPtr,
-                                   textNumElements ) < 0 )
-        {
-            return LE_FAULT;
-        }
+        LE_ERROR("Not a text message");
+        return LE_FORMAT_ERROR;
+    }
 
-        SmsInbox_MarkRead(sessionRef, msgId);
+    if (msg.payloadLen >= textNumElements)
+    {
+        LE_ERROR("Text too long");
+        return LE_OVERFLOW;
     }
 
-    return res;
+    memcpy(textPtr, msg.payload, msg.payloadLen);
+
+    SmsInbox_MarkRead(sessionRef, msgId);
+
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -2529,46 +1949,39 @@ le_result_t SmsInbox_GetBinary
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    le_result_t res;
-    EntryDesc_t decode;
-    size_t len = 2*(*binNumElementsPtr)+1;
-    char tmpBinPtr[len];
-    memset(tmpBinPtr, 0, len);
-    memset(binPtr, 0, *binNumElementsPtr);
+    smsStore_Msg_t msg;
 
-    decode.type = DESC_STRING;
-    decode.uVal.str.strPtr = tmpBinPtr;
-    decode.uVal.str.lenStr = len;
-    char* key[1] = {JSON_BIN};
+    memset(binPtr, 0, *binNumElementsPtr);
 
-    res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId,
-                         key, 1, &decode);
+    if (smsStore_Read((MessageId_t) msgId, &msg) != LE_OK)
+    {
+        return LE_FAULT;
+    }
 
-    if ( res == LE_OK )
+    if (msg.format != LE_SMS_FORMAT_BINARY)
     {
-        int32_t binNumElements = le_hex_StringToBinary(tmpBinPtr,
-                                                    decode.uVal.str.lenStr,
-                                                    binPtr,
-                                                    *binNumElementsPtr);
+        LE_ERROR("Not a binary message");
+        return LE_FORMAT_ERROR;
+    }
 
-        if ( binNumElements < 0 )
-        {
-            return LE_FAULT;
-        }
+    if (msg.payloadLen > *binNumElementsPtr)
+    {
+        LE_ERROR("Binary message too long");
+        return LE_OVERFLOW;
+    }
 
-        *binNumElementsPtr = binNumElements;
+    memcpy(binPtr, msg.payload, msg.payloadLen);
+    *binNumElementsPtr = msg.payloadLen;
 
-        SmsInbox_MarkRead(sessionRef, msgId);
-    }
+    SmsInbox_MarkRead(sessionRef, msgId);
 
-    return res;
+    return LE_OK;
 }
 
 
@@ -2624,46 +2037,39 @@ le_result_t SmsInbox_GetPdu
         return 0;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return 0;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    le_result_t res;
-    EntryDesc_t decode;
-    size_t len = 2*(*pduNumElementsPtr)+1;
-    char tmpPduPtr[len];
-    memset(tmpPduPtr, 0, len);
-    memset(pduPtr, 0, *pduNumElementsPtr);
+    smsStore_Msg_t msg;
 
-    decode.type = DESC_STRING;
-    decode.uVal.str.strPtr = tmpPduPtr;
-    decode.uVal.str.lenStr = len;
-    char* key[1] = {JSON_PDU};
+    memset(pduPtr, 0, *pduNumElementsPtr);
 
-    res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key, 1,
-                         &decode);
+    if (smsStore_Read((MessageId_t) msgId, &msg) != LE_OK)
+    {
+        return LE_FAULT;
+    }
 
-    if ( res == LE_OK )
+    if (msg.format != LE_SMS_FORMAT_PDU)
     {
-        int32_t pduNumElements = le_hex_StringToBinary(tmpPduPtr,
-                                                    decode.uVal.str.lenStr,
-                                                    pduPtr,
-                                                    *pduNumElementsPtr);
+        LE_ERROR("Not a PDU message");
+        return LE_FORMAT_ERROR;
+    }
 
-        if ( pduNumElements < 0 )
-        {
-            return LE_FAULT;
-        }
+    if (msg.payloadLen > *pduNumElementsPtr)
+    {
+        LE_ERROR("PDU message too long");
+        return LE_OVERFLOW;
+    }
 
-        *pduNumElementsPtr = pduNumElements;
+    memcpy(pduPtr, msg.payload, msg.payloadLen);
+    *pduNumElementsPtr = msg.payloadLen;
 
-        SmsInbox_MarkRead(sessionRef, msgId);
-    }
+    SmsInbox_MarkRead(sessionRef, msgId);
 
-    return res;
+    return LE_OK;
 }
 
 
@@ -2698,75 +2104,17 @@ uint32_t SmsInbox_GetFirst
         return 0;
     }
 
-    uint32_t pathLen = GetSMSInboxConfigPathLen(clientRequestPtr->
-                                                mboxSessionPtr->mboxCtxPtr->namePtr);
-    char path[pathLen];
-    memset(path, 0, pathLen);
-    GetSMSInboxConfigPath(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, path, pathLen);
-    le_result_t res = LE_OK;
-    MessageId_t messageId=0;
-
-    if ( GetMsgListFromMbox(path,
-                        &clientRequestPtr->mboxSessionPtr->browseCtx.jsonObjPtr,
-                        &clientRequestPtr->mboxSessionPtr->browseCtx.jsonArrayPtr) != LE_OK )
-    {
-        LE_ERROR("Error in GetMsgListFromMbox");
-        return 0;
-    }
-
-    clientRequestPtr->mboxSessionPtr->browseCtx.maxIndex =
-                      json_array_size(clientRequestPtr->mboxSessionPtr->browseCtx.jsonArrayPtr);
+    BrowseCtx_t* browseCtxPtr = &clientRequestPtr->mboxSessionPtr->browseCtx;
 
-    LE_DEBUG("MaxIndex %d", clientRequestPtr->mboxSessionPtr->browseCtx.maxIndex);
-
-    if ( clientRequestPtr->mboxSessionPtr->browseCtx.maxIndex > 0 )
-    {
-        json_t * jsonIntegerPtr =
-                 json_array_get(clientRequestPtr->mboxSessionPtr->browseCtx.jsonArrayPtr, 0);
-
-        if (jsonIntegerPtr)
-        {
-            messageId = json_integer_value(jsonIntegerPtr);
-        }
-        else
-        {
-            LE_ERROR("Json error");
-            res = LE_FAULT;
-        }
+    browseCtxPtr->currentMessageId =
+        smsStore_GetNextInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->index, 0);
 
-        if (messageId)
-        {
-            clientRequestPtr->mboxSessionPtr->browseCtx.currentMessageIndex = 1;
-        }
-        else
-        {
-            LE_ERROR("Json error");
-            res = LE_FAULT;
-        }
-    }
-    else
+    if (0 == browseCtxPtr->currentMessageId)
     {
-        res = LE_FAULT;
         LE_DEBUG("Empty mbox");
     }
 
-    if (res == LE_FAULT)
-    {
-        if (clientRequestPtr->mboxSessionPtr->browseCtx.jsonObjPtr)
-        {
-            json_decref(clientRequestPtr->mboxSessionPtr->browseCtx.jsonObjPtr);
-        }
-
-        memset(&clientRequestPtr->mboxSessionPtr->browseCtx, 0, sizeof(BrowseCtx_t));
-
-        return 0;
-    }
-    else
-    {
-        return messageId;
-    }
-
-    return 0;
+    return browseCtxPtr->currentMessageId;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -2794,60 +2142,29 @@ uint32_t SmsInbox_GetNext
         return LE_BAD_PARAMETER;
     }
 
-    while(clientRequestPtr->mboxSessionPtr->browseCtx.maxIndex !=
-          clientRequestPtr->mboxSessionPtr->browseCtx.currentMessageIndex)
+    if (clientRequestPtr->mboxSessionPtr == NULL)
     {
-        LE_DEBUG("CurrentIndex %d, maxIndex %d", clientRequestPtr->
-                                                 mboxSessionPtr->browseCtx.currentMessageIndex,
-                                                 clientRequestPtr->
-                                                 mboxSessionPtr->browseCtx.maxIndex);
-
-        json_t * jsonIntegerPtr = json_array_get(clientRequestPtr->
-                                                 mboxSessionPtr->browseCtx.jsonArrayPtr,
-                                                 clientRequestPtr->
-                                                 mboxSessionPtr->browseCtx.currentMessageIndex);
+        LE_ERROR("Bad mbox reference");
+        return 0;
+    }
 
-        if (jsonIntegerPtr)
-        {
-            MessageId_t messageId = json_integer_value(jsonIntegerPtr);
+    BrowseCtx_t* browseCtxPtr = &clientRequestPtr->mboxSessionPtr->browseCtx;
 
-            if (messageId > 0)
-            {
-                clientRequestPtr->mboxSessionPtr->browseCtx.currentMessageIndex++;
-
-                // Check if the message exist (it may be deleted since the GetFirst call)
-                uint16_t pathLen = GetSMSInboxMessagePathLen();
-                char path[pathLen];
-                memset(path, 0, pathLen);
-                GetSMSInboxMessagePath(messageId, path, pathLen);
-                int32_t fd = open(path, O_RDWR);
-
-                if (fd >= 0)
-                {
-                    // message is still existing
-                    close(fd);
-                    return messageId;
-                }
-
-                // else continue the parsing
-            }
-            else
-            {
-                LE_ERROR("Json error");
-            }
-        }
-        else
-        {
-            LE_ERROR("Json error");
-        }
+    // Messages deleted since the previous call are skipped, as the store only returns the
+    // messages still held by the message box.
+    if (browseCtxPtr->currentMessageId)
+    {
+        browseCtxPtr->currentMessageId =
+            smsStore_GetNextInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->index,
+                                   browseCtxPtr->currentMessageId);
     }
 
-    // Parsing end => free the memory
-    LE_DEBUG("No more messages");
-    json_decref(clientRequestPtr->mboxSessionPtr->browseCtx.jsonObjPtr);
-    memset(&clientRequestPtr->mboxSessionPtr->browseCtx, 0, sizeof(BrowseCtx_t));
+    if (0 == browseCtxPtr->currentMessageId)
+    {
+        LE_DEBUG("No more messages");
+    }
 
-    return 0;
+    return browseCtxPtr->currentMessageId;
 }
 //--------------------------------------------------------------------------------------------------
 /**
@@ -2886,27 +2203,14 @@ bool SmsInbox_IsUnread
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t decode;
-    decode.type = DESC_BOOL;
-    char* key[] = {JSON_ISUNREAD, clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr};
-
-    if (DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key, 2,
-                       &decode) == LE_OK)
-    {
-        return decode.uVal.boolVal;
-    }
-    else
-    {
-        LE_ERROR("Error in DecodeMsgEntry");
-        return false;
-    }
+    return smsStore_IsUnread((MessageId_t) msgId,
+                             clientRequestPtr->mboxSessionPtr->mboxCtxPtr->index);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -2941,21 +2245,16 @@ void SmsInbox_MarkRead
         return;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t modif;
-    modif.type = DESC_BOOL;
-    modif.uVal.boolVal = false;
-    char* key[2]={JSON_ISUNREAD, clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr};
-
-    if (ModifyMsgEntry(messageId, key, 2, &modif) != LE_OK)
+    if (smsStore_SetUnread((MessageId_t) msgId,
+                           clientRequestPtr->mboxSessionPtr->mboxCtxPtr->index, false) != LE_OK)
     {
-        LE_ERROR("Error in ModifyMsgEntry");
+        LE_ERROR("Error in smsStore_SetUnread");
     }
 }
 
@@ -2991,21 +2290,16 @@ void SmsInbox_MarkUnread
         return;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t modif;
-    modif.type = DESC_BOOL;
-    modif.uVal.boolVal = true;
-    char* key[2]={JSON_ISUNREAD, clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr};
-
-    if (ModifyMsgEntry(messageId, key, 2, &modif) != LE_OK)
+    if (smsStore_SetUnread((MessageId_t) msgId,
+                           clientRequestPtr->mboxSessionPtr->mboxCtxPtr->index, true) != LE_OK)
     {
-        LE_ERROR("Error in ModifyMsgEntry");
+        LE_ERROR("Error in smsStore_SetUnread");
     }
 }
 
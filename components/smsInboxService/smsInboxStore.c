@@ -0,0 +1,1392 @@
+// -------------------------------------------------------------------------------------------------
+/**
+ *  SMS Inbox Server
+ *
+ * Message store of the smsInbox.
+ *
+ * The messages are kept in two files:
+ *  - An append-only data file (DATA_FILE) holding the message content. Each record is a
+ *    DataRecordHeader_t followed by the message payload. Records are never modified: deleting a
+ *    message only makes its record dead.
+ *  - An index file (INDEX_FILE) holding a header and an array of fixed-size IndexRecord_t: message
+ *    identifier, location of the record in the data file and the per-message box flags (message box
+ *    membership and unread status, one bit per message box). Records are updated in place.
+ *
+ * The whole index is loaded in memory when the store is opened, so browsing a message box or
+ * checking a message status doesn't access the file system, and updating a message only rewrites
+ * its index record.
+ *
+ * When the dead records represent more than the live records in the data file, the store is
+ * compacted: live records are copied into a new data file of a new generation, then a new index
+ * referring to this generation is committed by renaming it, and finally the new data file replaces
+ * the old one. If the process is interrupted, the generation recorded in the index tells on the
+ * next opening which data file is valid.
+ *
+ *  Copyright (C) Sierra Wireless Inc.
+ */
+// -------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+#include "smsInboxStore.h"
+
+//--------------------------------------------------------------------------------------------------
+// Symbols and enums.
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Store file names.
+ */
+//--------------------------------------------------------------------------------------------------
+#define INDEX_FILE          "msgIndex.bin"
+#define DATA_FILE           "msgData.bin"
+#define NEW_FILE_SUFFIX     ".new"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a store file path.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_STORE_PATH_BYTES    128
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Store file identifiers and format version.
+ */
+//--------------------------------------------------------------------------------------------------
+#define INDEX_MAGIC         0x58424953  // "SIBX"
+#define DATA_MAGIC          0x44424953  // "SIBD"
+#define STORE_VERSION       2
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum number of dead bytes in the data file before a compaction is considered.
+ */
+//--------------------------------------------------------------------------------------------------
+#define COMPACT_MIN_DEAD_BYTES  (16 * 1024)
+
+//--------------------------------------------------------------------------------------------------
+// Data structures.
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Index file header.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;                                             ///< INDEX_MAGIC
+    uint32_t version;                                           ///< STORE_VERSION
+    uint32_t generation;                                        ///< Valid data file generation
+    uint32_t nextMsgId;                                         ///< Next message identifier
+    uint32_t slotCount;                                         ///< Number of index records
+    char     mboxName[SMSSTORE_MAX_MBOX][SMSSTORE_MBOX_NAME_BYTES]; ///< Name of each mask bit
+}
+IndexHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Index file record.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t msgId;         ///< Message identifier, 0 for a free slot
+    uint32_t dataOffset;    ///< Offset of the message record in the data file
+    uint32_t dataLen;       ///< Length of the message record in the data file
+    uint16_t mboxMask;      ///< Message boxes holding the message
+    uint16_t unreadMask;    ///< Message boxes for which the message is unread
+}
+IndexRecord_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Data file header.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;         ///< DATA_MAGIC
+    uint32_t generation;    ///< Data file generation
+}
+DataHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Data file record header, followed by the message payload.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t msgId;                                     ///< Message identifier
+    int32_t  format;                                    ///< Message format
+    uint32_t msgLen;                                    ///< Message length
+    uint32_t payloadLen;                                ///< Length of the following payload
+    char     imsi[LE_SIM_IMSI_BYTES];                   ///< Receiver SIM IMSI
+    char     senderTel[LE_MDMDEFS_PHONE_NUM_MAX_BYTES]; ///< Sender telephone number
+    char     timestamp[LE_SMS_TIMESTAMP_MAX_BYTES];     ///< Message time stamp
+}
+DataRecordHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a data file record.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_DATA_RECORD_BYTES   (sizeof(DataRecordHeader_t) + SMSSTORE_PAYLOAD_MAX_BYTES)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * In-memory copy of an index record.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    IndexRecord_t record;   ///< Index record content
+    uint32_t      slot;     ///< Position of the record in the index file
+}
+Entry_t;
+
+//--------------------------------------------------------------------------------------------------
+//                                       Static declarations
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Directory of the store files.
+ */
+//--------------------------------------------------------------------------------------------------
+static char StoreDir[MAX_STORE_PATH_BYTES];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Store file descriptors.
+ */
+//--------------------------------------------------------------------------------------------------
+static int IndexFd = -1;
+static int DataFd = -1;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * In-memory index header.
+ */
+//--------------------------------------------------------------------------------------------------
+static IndexHeader_t Header;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * In-memory index, sorted by message identifier (i.e. by reception order).
+ */
+//--------------------------------------------------------------------------------------------------
+static Entry_t Entries[SMSSTORE_MAX_MSG];
+static uint32_t EntryCount;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Index file slots in use.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool SlotUsed[SMSSTORE_MAX_MSG];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Data file accounting.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t DataEnd;        ///< Current size of the data file
+static uint32_t DeadBytes;      ///< Bytes of the data file not referenced by the index
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build the path of a store file.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GetStorePath
+(
+    const char* fileNamePtr,    ///<[IN] File name
+    const char* suffixPtr,      ///<[IN] File name suffix
+    char*       pathPtr         ///<[OUT] File path, MAX_STORE_PATH_BYTES long
+)
+{
+    snprintf(pathPtr, MAX_STORE_PATH_BYTES, "%s%s%s", StoreDir, fileNamePtr, suffixPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a buffer at a given offset of a file.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t WriteAt
+(
+    int         fd,         ///<[IN] File descriptor
+    const void* bufPtr,     ///<[IN] Data to write
+    size_t      len,        ///<[IN] Data length
+    off_t       offset      ///<[IN] File offset
+)
+{
+    const uint8_t* dataPtr = bufPtr;
+
+    while (len > 0)
+    {
+        ssize_t writtenSize = pwrite(fd, dataPtr, len, offset);
+
+        if (writtenSize < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            LE_ERROR("Write error: %m");
+            return LE_FAULT;
+        }
+
+        dataPtr += writtenSize;
+        offset += writtenSize;
+        len -= writtenSize;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a buffer at a given offset of a file.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReadAt
+(
+    int     fd,         ///<[IN] File descriptor
+    void*   bufPtr,     ///<[OUT] Read data
+    size_t  len,        ///<[IN] Data length
+    off_t   offset      ///<[IN] File offset
+)
+{
+    uint8_t* dataPtr = bufPtr;
+
+    while (len > 0)
+    {
+        ssize_t readSize = pread(fd, dataPtr, len, offset);
+
+        if (readSize < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            LE_ERROR("Read error: %m");
+            return LE_FAULT;
+        }
+        if (0 == readSize)
+        {
+            LE_ERROR("Unexpected end of file");
+            return LE_FAULT;
+        }
+
+        dataPtr += readSize;
+        offset += readSize;
+        len -= readSize;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the file offset of an index record.
+ */
+//--------------------------------------------------------------------------------------------------
+static off_t GetSlotOffset
+(
+    uint32_t slot   ///<[IN] Index record position
+)
+{
+    return sizeof(IndexHeader_t) + (off_t)slot * sizeof(IndexRecord_t);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for a message in the in-memory index.
+ *
+ * @return Position of the message in Entries, or -1 if not found.
+ */
+//--------------------------------------------------------------------------------------------------
+static int32_t FindEntry
+(
+    uint32_t msgId  ///<[IN] Message identifier
+)
+{
+    int32_t low = 0;
+    int32_t high = (int32_t)EntryCount - 1;
+
+    while (low <= high)
+    {
+        int32_t mid = low + (high - low) / 2;
+
+        if (Entries[mid].record.msgId == msgId)
+        {
+            return mid;
+        }
+        else if (Entries[mid].record.msgId < msgId)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare two entries by message identifier, for qsort().
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareEntries
+(
+    const void* aPtr,
+    const void* bPtr
+)
+{
+    uint32_t aId = ((const Entry_t*)aPtr)->record.msgId;
+    uint32_t bId = ((const Entry_t*)bPtr)->record.msgId;
+
+    return (aId > bId) - (aId < bId);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write an index record in place.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t WriteEntry
+(
+    const Entry_t* entryPtr     ///<[IN] Entry to write
+)
+{
+    return WriteAt(IndexFd, &entryPtr->record, sizeof(IndexRecord_t),
+                   GetSlotOffset(entryPtr->slot));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a new index file holding the in-memory index, then commit it by renaming it over the
+ * current index file. The in-memory entries are renumbered to occupy the first slots.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t RewriteIndex
+(
+    void
+)
+{
+    char path[MAX_STORE_PATH_BYTES];
+    char newPath[MAX_STORE_PATH_BYTES];
+    le_result_t res = LE_OK;
+    uint32_t i;
+
+    GetStorePath(INDEX_FILE, "", path);
+    GetStorePath(INDEX_FILE, NEW_FILE_SUFFIX, newPath);
+
+    int fd = open(newPath, O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        LE_ERROR("Unable to create %s: %m", newPath);
+        return LE_FAULT;
+    }
+
+    IndexHeader_t header = Header;
+    header.slotCount = EntryCount;
+
+    res = WriteAt(fd, &header, sizeof(header), 0);
+
+    for (i = 0; (LE_OK == res) && (i < EntryCount); i++)
+    {
+        res = WriteAt(fd, &Entries[i].record, sizeof(IndexRecord_t), GetSlotOffset(i));
+    }
+
+    if ((LE_OK == res) && (0 != fsync(fd)))
+    {
+        LE_ERROR("Unable to sync %s: %m", newPath);
+        res = LE_FAULT;
+    }
+
+    if ((LE_OK == res) && (0 != rename(newPath, path)))
+    {
+        LE_ERROR("Unable to rename %s: %m", newPath);
+        res = LE_FAULT;
+    }
+
+    if (LE_OK != res)
+    {
+        close(fd);
+        unlink(newPath);
+        return res;
+    }
+
+    if (IndexFd >= 0)
+    {
+        close(IndexFd);
+    }
+    IndexFd = fd;
+
+    Header = header;
+    memset(SlotUsed, 0, sizeof(SlotUsed));
+    for (i = 0; i < EntryCount; i++)
+    {
+        Entries[i].slot = i;
+        SlotUsed[i] = true;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an empty data file of a given generation.
+ *
+ * @return File descriptor, or -1 on error.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CreateDataFile
+(
+    const char* pathPtr,        ///<[IN] Data file path
+    uint32_t    generation      ///<[IN] Data file generation
+)
+{
+    DataHeader_t header = { .magic = DATA_MAGIC, .generation = generation };
+
+    int fd = open(pathPtr, O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        LE_ERROR("Unable to create %s: %m", pathPtr);
+        return -1;
+    }
+
+    if (LE_OK != WriteAt(fd, &header, sizeof(header), 0))
+    {
+        close(fd);
+        unlink(pathPtr);
+        return -1;
+    }
+
+    return fd;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compact the data file: copy the live records into a new data file and commit a new index
+ * referring to it.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t Compact
+(
+    void
+)
+{
+    char path[MAX_STORE_PATH_BYTES];
+    char newPath[MAX_STORE_PATH_BYTES];
+    uint8_t record[MAX_DATA_RECORD_BYTES];
+    uint32_t newOffset[SMSSTORE_MAX_MSG];
+    uint32_t offset = sizeof(DataHeader_t);
+    uint32_t generation = Header.generation + 1;
+    le_result_t res = LE_OK;
+    uint32_t i;
+
+    LE_INFO("Compacting SMS store: %"PRIu32" dead bytes out of %"PRIu32, DeadBytes, DataEnd);
+
+    GetStorePath(DATA_FILE, "", path);
+    GetStorePath(DATA_FILE, NEW_FILE_SUFFIX, newPath);
+
+    int fd = CreateDataFile(newPath, generation);
+    if (fd < 0)
+    {
+        return LE_FAULT;
+    }
+
+    for (i = 0; (LE_OK == res) && (i < EntryCount); i++)
+    {
+        IndexRecord_t* recordPtr = &Entries[i].record;
+
+        res = ReadAt(DataFd, record, recordPtr->dataLen, recordPtr->dataOffset);
+        if (LE_OK == res)
+        {
+            res = WriteAt(fd, record, recordPtr->dataLen, offset);
+        }
+        newOffset[i] = offset;
+        offset += recordPtr->dataLen;
+    }
+
+    if ((LE_OK == res) && (0 != fsync(fd)))
+    {
+        LE_ERROR("Unable to sync %s: %m", newPath);
+        res = LE_FAULT;
+    }
+
+    if (LE_OK != res)
+    {
+        close(fd);
+        unlink(newPath);
+        return res;
+    }
+
+    // Commit point: the new index refers to the new data file generation.
+    uint32_t oldGeneration = Header.generation;
+    uint32_t oldOffset[SMSSTORE_MAX_MSG];
+    for (i = 0; i < EntryCount; i++)
+    {
+        oldOffset[i] = Entries[i].record.dataOffset;
+        Entries[i].record.dataOffset = newOffset[i];
+    }
+    Header.generation = generation;
+
+    if (LE_OK != RewriteIndex())
+    {
+        for (i = 0; i < EntryCount; i++)
+        {
+            Entries[i].record.dataOffset = oldOffset[i];
+        }
+        Header.generation = oldGeneration;
+        close(fd);
+        unlink(newPath);
+        return LE_FAULT;
+    }
+
+    if (0 != rename(newPath, path))
+    {
+        // The new data file will be renamed when the store is opened next time.
+        LE_ERROR("Unable to rename %s: %m", newPath);
+    }
+
+    close(DataFd);
+    DataFd = fd;
+    DataEnd = offset;
+    DeadBytes = 0;
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compact the data file if dead records use more space than live records.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CompactIfNeeded
+(
+    void
+)
+{
+    uint32_t liveBytes = DataEnd - sizeof(DataHeader_t) - DeadBytes;
+
+    if ((DeadBytes >= COMPACT_MIN_DEAD_BYTES) && (DeadBytes > liveBytes))
+    {
+        if (LE_OK != Compact())
+        {
+            LE_ERROR("SMS store compaction failed");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove an entry from the in-memory index and free its index slot.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t DeleteEntry
+(
+    int32_t pos     ///<[IN] Position of the entry in Entries
+)
+{
+    Entry_t entry = Entries[pos];
+
+    entry.record.msgId = 0;
+    if (LE_OK != WriteEntry(&entry))
+    {
+        return LE_FAULT;
+    }
+
+    memmove(&Entries[pos], &Entries[pos + 1], (EntryCount - pos - 1) * sizeof(Entry_t));
+    EntryCount--;
+    SlotUsed[entry.slot] = false;
+    DeadBytes += entry.record.dataLen;
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find a free index slot, appending a new one to the index file if needed.
+ *
+ * @return
+ *  - LE_OK            slotPtr is updated.
+ *  - LE_NO_MEMORY     No more slot available.
+ *  - LE_FAULT         The index file can't be updated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t AllocSlot
+(
+    uint32_t* slotPtr   ///<[OUT] Free slot
+)
+{
+    uint32_t slot;
+
+    for (slot = 0; slot < Header.slotCount; slot++)
+    {
+        if (!SlotUsed[slot])
+        {
+            *slotPtr = slot;
+            return LE_OK;
+        }
+    }
+
+    if (Header.slotCount >= SMSSTORE_MAX_MSG)
+    {
+        return LE_NO_MEMORY;
+    }
+
+    IndexRecord_t emptyRecord;
+    memset(&emptyRecord, 0, sizeof(emptyRecord));
+
+    if (LE_OK != WriteAt(IndexFd, &emptyRecord, sizeof(emptyRecord), GetSlotOffset(slot)))
+    {
+        return LE_FAULT;
+    }
+
+    Header.slotCount++;
+    if (LE_OK != WriteAt(IndexFd, &Header.slotCount, sizeof(Header.slotCount),
+                         offsetof(IndexHeader_t, slotCount)))
+    {
+        Header.slotCount--;
+        return LE_FAULT;
+    }
+
+    *slotPtr = slot;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an empty store.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t CreateStore
+(
+    void
+)
+{
+    char path[MAX_STORE_PATH_BYTES];
+
+    LE_INFO("Create SMS store in %s", StoreDir);
+
+    memset(&Header, 0, sizeof(Header));
+    Header.magic = INDEX_MAGIC;
+    Header.version = STORE_VERSION;
+    Header.generation = 1;
+    Header.nextMsgId = 1;
+    EntryCount = 0;
+    DeadBytes = 0;
+
+    GetStorePath(DATA_FILE, "", path);
+    DataFd = CreateDataFile(path, Header.generation);
+    if (DataFd < 0)
+    {
+        return LE_FAULT;
+    }
+    DataEnd = sizeof(DataHeader_t);
+
+    return RewriteIndex();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finish or roll back a compaction interrupted before the new data file replaced the old one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RecoverCompaction
+(
+    void
+)
+{
+    char path[MAX_STORE_PATH_BYTES];
+    char newPath[MAX_STORE_PATH_BYTES];
+    DataHeader_t dataHeader;
+
+    // An uncommitted index is never valid.
+    GetStorePath(INDEX_FILE, NEW_FILE_SUFFIX, newPath);
+    unlink(newPath);
+
+    GetStorePath(DATA_FILE, "", path);
+    GetStorePath(DATA_FILE, NEW_FILE_SUFFIX, newPath);
+
+    int fd = open(newPath, O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    le_result_t res = ReadAt(fd, &dataHeader, sizeof(dataHeader), 0);
+    close(fd);
+
+    if ((LE_OK == res) &&
+        (DATA_MAGIC == dataHeader.magic) &&
+        (dataHeader.generation == Header.generation))
+    {
+        LE_INFO("Complete interrupted SMS store compaction");
+        if (0 != rename(newPath, path))
+        {
+            LE_ERROR("Unable to rename %s: %m", newPath);
+        }
+    }
+    else
+    {
+        LE_INFO("Discard interrupted SMS store compaction");
+        unlink(newPath);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Load an existing store.
+ *
+ * @return
+ *  - LE_OK            The store is loaded.
+ *  - LE_NOT_FOUND     There is no store.
+ *  - LE_FAULT         The store is corrupted.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t LoadStore
+(
+    void
+)
+{
+    char path[MAX_STORE_PATH_BYTES];
+    DataHeader_t dataHeader;
+    struct stat st;
+    uint32_t liveBytes = 0;
+    uint32_t slot;
+
+    GetStorePath(INDEX_FILE, "", path);
+    IndexFd = open(path, O_RDWR);
+    if (IndexFd < 0)
+    {
+        return (ENOENT == errno) ? LE_NOT_FOUND : LE_FAULT;
+    }
+
+    if ((LE_OK != ReadAt(IndexFd, &Header, sizeof(Header), 0)) ||
+        (INDEX_MAGIC != Header.magic) ||
+        (STORE_VERSION != Header.version) ||
+        (Header.slotCount > SMSSTORE_MAX_MSG))
+    {
+        LE_ERROR("Invalid SMS store index");
+        return LE_FAULT;
+    }
+
+    RecoverCompaction();
+
+    GetStorePath(DATA_FILE, "", path);
+    DataFd = open(path, O_RDWR);
+    if ((DataFd < 0) ||
+        (0 != fstat(DataFd, &st)) ||
+        (LE_OK != ReadAt(DataFd, &dataHeader, sizeof(dataHeader), 0)) ||
+        (DATA_MAGIC != dataHeader.magic) ||
+        (Header.generation != dataHeader.generation))
+    {
+        LE_ERROR("Invalid SMS store data file");
+        return LE_FAULT;
+    }
+    DataEnd = st.st_size;
+
+    EntryCount = 0;
+    memset(SlotUsed, 0, sizeof(SlotUsed));
+
+    for (slot = 0; slot < Header.slotCount; slot++)
+    {
+        Entry_t* entryPtr = &Entries[EntryCount];
+
+        if (LE_OK != ReadAt(IndexFd, &entryPtr->record, sizeof(IndexRecord_t),
+                            GetSlotOffset(slot)))
+        {
+            return LE_FAULT;
+        }
+
+        if (0 == entryPtr->record.msgId)
+        {
+            continue;
+        }
+
+        if ((entryPtr->record.dataOffset < sizeof(DataHeader_t)) ||
+            (entryPtr->record.dataLen > MAX_DATA_RECORD_BYTES) ||
+            ((uint64_t)entryPtr->record.dataOffset + entryPtr->record.dataLen > DataEnd))
+        {
+            LE_ERROR("Drop invalid index record for message %"PRIu32, entryPtr->record.msgId);
+            continue;
+        }
+
+        entryPtr->slot = slot;
+        SlotUsed[slot] = true;
+        liveBytes += entryPtr->record.dataLen;
+        EntryCount++;
+    }
+
+    qsort(Entries, EntryCount, sizeof(Entry_t), CompareEntries);
+
+    DeadBytes = DataEnd - sizeof(DataHeader_t) - liveBytes;
+
+    LE_INFO("SMS store loaded: %"PRIu32" messages, %"PRIu32" bytes, %"PRIu32" dead bytes",
+            EntryCount, DataEnd, DeadBytes);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map the message box bits recorded in the store onto the current message box list.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t MapMboxNames
+(
+    const char* const* mboxNamePtr, ///<[IN] Message box names
+    size_t             mboxCount    ///<[IN] Number of message boxes
+)
+{
+    int8_t newBit[SMSSTORE_MAX_MBOX];
+    bool changed = false;
+    uint32_t i, j;
+
+    for (i = 0; i < SMSSTORE_MAX_MBOX; i++)
+    {
+        newBit[i] = -1;
+
+        for (j = 0; (j < mboxCount) && ('\0' != Header.mboxName[i][0]); j++)
+        {
+            if (0 == strcmp(Header.mboxName[i], mboxNamePtr[j]))
+            {
+                newBit[i] = j;
+                break;
+            }
+        }
+
+        if (newBit[i] != (int8_t)i)
+        {
+            changed = changed || ('\0' != Header.mboxName[i][0]) || (i < mboxCount);
+        }
+    }
+
+    if (!changed)
+    {
+        return LE_OK;
+    }
+
+    LE_INFO("Message box list changed, remap SMS store flags");
+
+    i = 0;
+    while (i < EntryCount)
+    {
+        IndexRecord_t* recordPtr = &Entries[i].record;
+        uint16_t mboxMask = 0;
+        uint16_t unreadMask = 0;
+
+        for (j = 0; j < SMSSTORE_MAX_MBOX; j++)
+        {
+            if (newBit[j] >= 0)
+            {
+                mboxMask |= ((recordPtr->mboxMask >> j) & 1) << newBit[j];
+                unreadMask |= ((recordPtr->unreadMask >> j) & 1) << newBit[j];
+            }
+        }
+
+        if (0 == mboxMask)
+        {
+            DeadBytes += recordPtr->dataLen;
+            memmove(&Entries[i], &Entries[i + 1], (EntryCount - i - 1) * sizeof(Entry_t));
+            EntryCount--;
+            continue;
+        }
+
+        recordPtr->mboxMask = mboxMask;
+        recordPtr->unreadMask = unreadMask;
+        i++;
+    }
+
+    memset(Header.mboxName, 0, sizeof(Header.mboxName));
+    for (i = 0; i < mboxCount; i++)
+    {
+        le_utf8_Copy(Header.mboxName[i], mboxNamePtr[i], SMSSTORE_MBOX_NAME_BYTES, NULL);
+    }
+
+    return RewriteIndex();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the message store, creating it if it doesn't exist.
+ *
+ * @return
+ *  - LE_OK            The store is open.
+ *  - LE_BAD_PARAMETER Too many message boxes, or a message box name too long.
+ *  - LE_FAULT         The store can't be opened.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_Open
+(
+    const char*        dirPathPtr,  ///< [IN] Directory holding the store files
+    const char* const* mboxNamePtr, ///< [IN] Message box names, indexed by message box index
+    size_t             mboxCount,   ///< [IN] Number of message boxes
+    bool*              createdPtr   ///< [OUT] true if the store has just been created
+)
+{
+    size_t i;
+
+    if (mboxCount > SMSSTORE_MAX_MBOX)
+    {
+        LE_ERROR("Too many message boxes: %zu", mboxCount);
+        return LE_BAD_PARAMETER;
+    }
+
+    // Names are recorded in full, so that message boxes are never confused with each other.
+    for (i = 0; i < mboxCount; i++)
+    {
+        if (strlen(mboxNamePtr[i]) >= SMSSTORE_MBOX_NAME_BYTES)
+        {
+            LE_ERROR("Message box name too long: %s", mboxNamePtr[i]);
+            return LE_BAD_PARAMETER;
+        }
+    }
+
+    if (LE_OK != le_utf8_Copy(StoreDir, dirPathPtr, sizeof(StoreDir), NULL))
+    {
+        LE_ERROR("Store path too long: %s", dirPathPtr);
+        return LE_BAD_PARAMETER;
+    }
+
+    *createdPtr = false;
+
+    le_result_t res = LoadStore();
+    if (LE_OK != res)
+    {
+        if (IndexFd >= 0)
+        {
+            close(IndexFd);
+            IndexFd = -1;
+        }
+        if (DataFd >= 0)
+        {
+            close(DataFd);
+            DataFd = -1;
+        }
+
+        if (LE_FAULT == res)
+        {
+            LE_CRIT("SMS store is corrupted, messages are lost");
+        }
+
+        if (LE_OK != CreateStore())
+        {
+            return LE_FAULT;
+        }
+        *createdPtr = true;
+    }
+
+    if (LE_OK != MapMboxNames(mboxNamePtr, mboxCount))
+    {
+        return LE_FAULT;
+    }
+
+    CompactIfNeeded();
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a message into the store.
+ *
+ * @return
+ *  - LE_OK            The message is stored.
+ *  - LE_BAD_PARAMETER Invalid message content.
+ *  - LE_NO_MEMORY     The store is full.
+ *  - LE_FAULT         The message can't be written.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_Add
+(
+    const smsStore_Msg_t* msgPtr,       ///< [IN] Message content
+    uint32_t              msgId,        ///< [IN] Message identifier, 0 to allocate a new one
+    uint16_t              mboxMask,     ///< [IN] Message boxes holding the message
+    uint16_t              unreadMask,   ///< [IN] Message boxes for which the message is unread
+    uint32_t*             msgIdPtr      ///< [OUT] Message identifier
+)
+{
+    uint8_t record[MAX_DATA_RECORD_BYTES];
+    DataRecordHeader_t* recordHeaderPtr = (DataRecordHeader_t*)record;
+    Entry_t entry;
+    int32_t oldPos = -1;
+
+    if (msgPtr->payloadLen > SMSSTORE_PAYLOAD_MAX_BYTES)
+    {
+        LE_ERROR("Payload too long: %zu", msgPtr->payloadLen);
+        return LE_BAD_PARAMETER;
+    }
+
+    if (0 == msgId)
+    {
+        msgId = Header.nextMsgId;
+    }
+    else
+    {
+        // A message added again replaces the existing one, once the new one is written.
+        oldPos = FindEntry(msgId);
+    }
+
+    if ((oldPos < 0) && (EntryCount >= SMSSTORE_MAX_MSG))
+    {
+        LE_ERROR("SMS store is full");
+        return LE_NO_MEMORY;
+    }
+
+    memset(record, 0, sizeof(record));
+    recordHeaderPtr->msgId = msgId;
+    recordHeaderPtr->format = msgPtr->format;
+    recordHeaderPtr->msgLen = msgPtr->msgLen;
+    recordHeaderPtr->payloadLen = msgPtr->payloadLen;
+    le_utf8_Copy(recordHeaderPtr->imsi, msgPtr->imsi, sizeof(recordHeaderPtr->imsi), NULL);
+    le_utf8_Copy(recordHeaderPtr->senderTel, msgPtr->senderTel,
+                 sizeof(recordHeaderPtr->senderTel), NULL);
+    le_utf8_Copy(recordHeaderPtr->timestamp, msgPtr->timestamp,
+                 sizeof(recordHeaderPtr->timestamp), NULL);
+    memcpy(record + sizeof(DataRecordHeader_t), msgPtr->payload, msgPtr->payloadLen);
+
+    memset(&entry, 0, sizeof(entry));
+    entry.record.msgId = msgId;
+    entry.record.dataOffset = DataEnd;
+    entry.record.dataLen = sizeof(DataRecordHeader_t) + msgPtr->payloadLen;
+    entry.record.mboxMask = mboxMask;
+    entry.record.unreadMask = unreadMask & mboxMask;
+
+    // A replaced message keeps its index slot: rewriting the slot switches from the old record
+    // to the new one at once.  A slot allocated for a new message is only used once its record
+    // is written, so it stays free on failure.
+    if (oldPos >= 0)
+    {
+        entry.slot = Entries[oldPos].slot;
+    }
+    else
+    {
+        le_result_t res = AllocSlot(&entry.slot);
+        if (LE_OK != res)
+        {
+            return res;
+        }
+    }
+
+    // Append the message content, then reference it from the index.
+    if (LE_OK != WriteAt(DataFd, record, entry.record.dataLen, entry.record.dataOffset))
+    {
+        return LE_FAULT;
+    }
+    DataEnd += entry.record.dataLen;
+
+    if (0 != fdatasync(DataFd))
+    {
+        LE_ERROR("Unable to sync SMS store data: %m");
+        DeadBytes += entry.record.dataLen;
+        return LE_FAULT;
+    }
+
+    // Skipping an identifier is harmless, reusing one is not: record the next identifier first.
+    if (msgId >= Header.nextMsgId)
+    {
+        uint32_t nextMsgId = msgId + 1;
+
+        if (LE_OK != WriteAt(IndexFd, &nextMsgId, sizeof(nextMsgId),
+                             offsetof(IndexHeader_t, nextMsgId)))
+        {
+            DeadBytes += entry.record.dataLen;
+            return LE_FAULT;
+        }
+        Header.nextMsgId = nextMsgId;
+    }
+
+    if ((LE_OK != WriteEntry(&entry)) || (0 != fdatasync(IndexFd)))
+    {
+        LE_ERROR("Unable to update SMS store index: %m");
+
+        // Put back what the slot held before, as far as possible.
+        if (oldPos >= 0)
+        {
+            WriteEntry(&Entries[oldPos]);
+        }
+        else
+        {
+            Entry_t freeEntry;
+            memset(&freeEntry, 0, sizeof(freeEntry));
+            freeEntry.slot = entry.slot;
+            WriteEntry(&freeEntry);
+        }
+
+        DeadBytes += entry.record.dataLen;
+        return LE_FAULT;
+    }
+
+    if (oldPos >= 0)
+    {
+        // Same identifier, so the in-memory index stays sorted.
+        DeadBytes += Entries[oldPos].record.dataLen;
+        Entries[oldPos] = entry;
+    }
+    else
+    {
+        // Keep the in-memory index sorted: new messages usually go at the end.
+        uint32_t pos = EntryCount;
+        while ((pos > 0) && (Entries[pos - 1].record.msgId > msgId))
+        {
+            pos--;
+        }
+        memmove(&Entries[pos + 1], &Entries[pos], (EntryCount - pos) * sizeof(Entry_t));
+        Entries[pos] = entry;
+        EntryCount++;
+        SlotUsed[entry.slot] = true;
+    }
+
+    *msgIdPtr = msgId;
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a message from the store.
+ *
+ * @return
+ *  - LE_OK            The message has been read.
+ *  - LE_NOT_FOUND     The message doesn't exist.
+ *  - LE_FAULT         The message can't be read.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_Read
+(
+    uint32_t        msgId,      ///< [IN] Message identifier
+    smsStore_Msg_t* msgPtr      ///< [OUT] Message content
+)
+{
+    uint8_t record[MAX_DATA_RECORD_BYTES];
+    DataRecordHeader_t* recordHeaderPtr = (DataRecordHeader_t*)record;
+
+    int32_t pos = FindEntry(msgId);
+    if (pos < 0)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    IndexRecord_t* indexPtr = &Entries[pos].record;
+
+    if (LE_OK != ReadAt(DataFd, record, indexPtr->dataLen, indexPtr->dataOffset))
+    {
+        return LE_FAULT;
+    }
+
+    if ((recordHeaderPtr->msgId != msgId) ||
+        (recordHeaderPtr->payloadLen != indexPtr->dataLen - sizeof(DataRecordHeader_t)))
+    {
+        LE_ERROR("Corrupted record for message %"PRIu32, msgId);
+        return LE_FAULT;
+    }
+
+    memset(msgPtr, 0, sizeof(smsStore_Msg_t));
+    msgPtr->format = recordHeaderPtr->format;
+    msgPtr->msgLen = recordHeaderPtr->msgLen;
+    msgPtr->payloadLen = recordHeaderPtr->payloadLen;
+    le_utf8_Copy(msgPtr->imsi, recordHeaderPtr->imsi, sizeof(msgPtr->imsi), NULL);
+    le_utf8_Copy(msgPtr->senderTel, recordHeaderPtr->senderTel, sizeof(msgPtr->senderTel), NULL);
+    le_utf8_Copy(msgPtr->timestamp, recordHeaderPtr->timestamp, sizeof(msgPtr->timestamp), NULL);
+    memcpy(msgPtr->payload, record + sizeof(DataRecordHeader_t), msgPtr->payloadLen);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if a message belongs to a message box.
+ */
+//--------------------------------------------------------------------------------------------------
+bool smsStore_IsInMbox
+(
+    uint32_t msgId,     ///< [IN] Message identifier
+    uint32_t mboxIdx    ///< [IN] Message box index
+)
+{
+    int32_t pos = FindEntry(msgId);
+
+    return (pos >= 0) && (Entries[pos].record.mboxMask & (1 << mboxIdx));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the unread status of a message for a message box.
+ */
+//--------------------------------------------------------------------------------------------------
+bool smsStore_IsUnread
+(
+    uint32_t msgId,     ///< [IN] Message identifier
+    uint32_t mboxIdx    ///< [IN] Message box index
+)
+{
+    int32_t pos = FindEntry(msgId);
+
+    return (pos >= 0) && (Entries[pos].record.unreadMask & (1 << mboxIdx));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the unread status of a message for a message box.
+ *
+ * @return
+ *  - LE_OK            The status is updated.
+ *  - LE_NOT_FOUND     The message doesn't exist.
+ *  - LE_FAULT         The index can't be updated.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_SetUnread
+(
+    uint32_t msgId,     ///< [IN] Message identifier
+    uint32_t mboxIdx,   ///< [IN] Message box index
+    bool     isUnread   ///< [IN] New status
+)
+{
+    int32_t pos = FindEntry(msgId);
+    if (pos < 0)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    Entry_t entry = Entries[pos];
+
+    if (isUnread)
+    {
+        entry.record.unreadMask |= (1 << mboxIdx);
+    }
+    else
+    {
+        entry.record.unreadMask &= ~(1 << mboxIdx);
+    }
+
+    if (entry.record.unreadMask == Entries[pos].record.unreadMask)
+    {
+        return LE_OK;
+    }
+
+    // Keep the in-memory index in line with the index file
+    if (LE_OK != WriteEntry(&entry))
+    {
+        return LE_FAULT;
+    }
+
+    Entries[pos] = entry;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove a message from a message box.
+ *
+ * @return
+ *  - LE_OK            The message is removed.
+ *  - LE_NOT_FOUND     The message doesn't exist.
+ *  - LE_FAULT         The index can't be updated.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_RemoveFromMbox
+(
+    uint32_t msgId,     ///< [IN] Message identifier
+    uint32_t mboxIdx    ///< [IN] Message box index
+)
+{
+    le_result_t res;
+
+    int32_t pos = FindEntry(msgId);
+    if (pos < 0)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    Entry_t entry = Entries[pos];
+
+    entry.record.mboxMask &= ~(1 << mboxIdx);
+    entry.record.unreadMask &= ~(1 << mboxIdx);
+
+    if (0 != entry.record.mboxMask)
+    {
+        // Keep the in-memory index in line with the index file
+        if (LE_OK != WriteEntry(&entry))
+        {
+            return LE_FAULT;
+        }
+
+        Entries[pos] = entry;
+        return LE_OK;
+    }
+
+    // No message box holds the message anymore: delete it physically.
+    LE_DEBUG("Delete messageId %"PRIu32, msgId);
+    res = DeleteEntry(pos);
+
+    CompactIfNeeded();
+
+    return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of messages in a message box.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t smsStore_GetMboxCount
+(
+    uint32_t mboxIdx    ///< [IN] Message box index
+)
+{
+    uint32_t count = 0;
+    uint32_t i;
+
+    for (i = 0; i < EntryCount; i++)
+    {
+        if (Entries[i].record.mboxMask & (1 << mboxIdx))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the oldest message of a message box received after a given message.
+ *
+ * @return
+ *  - 0 No more message in the message box.
+ *  - Message identifier.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t smsStore_GetNextInMbox
+(
+    uint32_t mboxIdx,   ///< [IN] Message box index
+    uint32_t afterId    ///< [IN] Message identifier to start after, 0 to get the oldest message
+)
+{
+    uint32_t i;
+
+    for (i = 0; i < EntryCount; i++)
+    {
+        if ((Entries[i].record.msgId > afterId) &&
+            (Entries[i].record.mboxMask & (1 << mboxIdx)))
+        {
+            return Entries[i].record.msgId;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+// -------------------------------------------------------------------------------------------------
+/**
+ *  SMS Inbox Server
+ *
+ * Declaration of the message store used by the smsInbox.
+ *
+ *  Copyright (C) Sierra Wireless Inc.
+ */
+// -------------------------------------------------------------------------------------------------
+
+#ifndef SMSINBOXSTORE_H_INCLUDE_GUARD
+#define SMSINBOXSTORE_H_INCLUDE_GUARD
+
+
+#include "legato.h"
+
+// Interface specific includes
+#include "interfaces.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of message boxes which can be tracked by the store (one bit per message box in
+ * the index records).
+ */
+//--------------------------------------------------------------------------------------------------
+#define SMSSTORE_MAX_MBOX           16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a message box name recorded into the store, including the terminating NUL.
+ * Message boxes are named after applications, so this holds the longest application name.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SMSSTORE_MBOX_NAME_BYTES    48
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of messages in the store.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SMSSTORE_MAX_MSG            1600
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum payload size of a stored message (text, binary or PDU).
+ */
+//--------------------------------------------------------------------------------------------------
+#define SMSSTORE_PAYLOAD_MAX_BYTES  LE_SMS_PDU_MAX_BYTES
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stored message content.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_sms_Format_t format;                                  ///< Message format
+    uint32_t        msgLen;                                  ///< Message length reported to apps
+    char            imsi[LE_SIM_IMSI_BYTES];                 ///< Receiver SIM IMSI
+    char            senderTel[LE_MDMDEFS_PHONE_NUM_MAX_BYTES];///< Sender telephone number
+    char            timestamp[LE_SMS_TIMESTAMP_MAX_BYTES];   ///< Message time stamp
+    size_t          payloadLen;                              ///< Payload length in bytes
+    uint8_t         payload[SMSSTORE_PAYLOAD_MAX_BYTES];     ///< Text (without '\0'), binary or
+                                                             ///< PDU payload
+}
+smsStore_Msg_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the message store, creating it if it doesn't exist.
+ *
+ * The message box names are recorded in the store so that the per-message box flags follow the
+ * message box if the list of message boxes changes between two runs.
+ *
+ * @return
+ *  - LE_OK            The store is open.
+ *  - LE_BAD_PARAMETER Too many message boxes, or a message box name too long.
+ *  - LE_FAULT         The store can't be opened.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_Open
+(
+    const char*        dirPathPtr,  ///< [IN] Directory holding the store files
+    const char* const* mboxNamePtr, ///< [IN] Message box names, indexed by message box index
+    size_t             mboxCount,   ///< [IN] Number of message boxes
+    bool*              createdPtr   ///< [OUT] true if the store has just been created
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a message into the store.
+ *
+ * If msgId is 0, a new message identifier is allocated. Otherwise the message is stored with the
+ * provided identifier, replacing any message already stored with the same identifier.
+ *
+ * @return
+ *  - LE_OK            The message is stored.
+ *  - LE_BAD_PARAMETER Invalid message content.
+ *  - LE_NO_MEMORY     The store is full.
+ *  - LE_FAULT         The message can't be written.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_Add
+(
+    const smsStore_Msg_t* msgPtr,       ///< [IN] Message content
+    uint32_t              msgId,        ///< [IN] Message identifier, 0 to allocate a new one
+    uint16_t              mboxMask,     ///< [IN] Message boxes holding the message
+    uint16_t              unreadMask,   ///< [IN] Message boxes for which the message is unread
+    uint32_t*             msgIdPtr      ///< [OUT] Message identifier
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a message from the store.
+ *
+ * @return
+ *  - LE_OK            The message has been read.
+ *  - LE_NOT_FOUND     The message doesn't exist.
+ *  - LE_FAULT         The message can't be read.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_Read
+(
+    uint32_t        msgId,      ///< [IN] Message identifier
+    smsStore_Msg_t* msgPtr      ///< [OUT] Message content
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if a message belongs to a message box.
+ */
+//--------------------------------------------------------------------------------------------------
+bool smsStore_IsInMbox
+(
+    uint32_t msgId,     ///< [IN] Message identifier
+    uint32_t mboxIdx    ///< [IN] Message box index
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the unread status of a message for a message box.
+ */
+//--------------------------------------------------------------------------------------------------
+bool smsStore_IsUnread
+(
+    uint32_t msgId,     ///< [IN] Message identifier
+    uint32_t mboxIdx    ///< [IN] Message box index
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the unread status of a message for a message box. The index record is only rewritten if the
+ * status changes.
+ *
+ * @return
+ *  - LE_OK            The status is updated.
+ *  - LE_NOT_FOUND     The message doesn't exist.
+ *  - LE_FAULT         The index can't be updated.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_SetUnread
+(
+    uint32_t msgId,     ///< [IN] Message identifier
+    uint32_t mboxIdx,   ///< [IN] Message box index
+    bool     isUnread   ///< [IN] New status
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove a message from a message box. The message is physically deleted when no message box holds
+ * it anymore.
+ *
+ * @return
+ *  - LE_OK            The message is removed.
+ *  - LE_NOT_FOUND     The message doesn't exist.
+ *  - LE_FAULT         The index can't be updated.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsStore_RemoveFromMbox
+(
+    uint32_t msgId,     ///< [IN] Message identifier
+    uint32_t mboxIdx    ///< [IN] Message box index
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of messages in a message box.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t smsStore_GetMboxCount
+(
+    uint32_t mboxIdx    ///< [IN] Message box index
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the oldest message of a message box received after a given message.
+ *
+ * @return
+ *  - 0 No more message in the message box.
+ *  - Message identifier.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t smsStore_GetNextInMbox
+(
+    uint32_t mboxIdx,   ///< [IN] Message box index
+    uint32_t afterId    ///< [IN] Message identifier to start after, 0 to get the oldest message
+);
+
+#endif // SMSINBOXSTORE_H_INCLUDE_GUARD
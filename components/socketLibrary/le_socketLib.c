@@ -20,6 +20,19 @@
 //--------------------------------------------------------------------------------------------------
 #define ADDR_MAX_LEN    LE_MDC_IPV6_ADDR_MAX_BYTES
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the blocks read from a file descriptor and then sent through a socket, when the data
+ * can't go directly from the file descriptor to the socket (e.g. through a secure socket).  On
+ * Linux, it matches the maximum payload of a TLS record.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_LINUX
+#define SEND_BLOCK_SIZE 16384
+#else
+#define SEND_BLOCK_SIZE 1024
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Socket context
@@ -62,6 +75,20 @@ LE_MEM_DEFINE_STATIC_POOL(SocketPool, MAX_SOCKET_NB, sizeof(SocketCtx_t));
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t SocketPoolRef = NULL;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool for the blocks of data sent from a file descriptor.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(SendBlockPool, MAX_SOCKET_NB, SEND_BLOCK_SIZE);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool reference for the blocks of data sent from a file descriptor.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t SendBlockPoolRef = NULL;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Safe Reference Map for the sockets pool.
@@ -600,6 +627,134 @@ le_result_t le_socket_Send
     return status;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send data read from a file descriptor through the socket, up to the requested size or to the end
+ * of file.
+ *
+ * Through a non-secure socket, the data goes directly from the file descriptor to the socket when
+ * the file descriptor allows it (e.g. a regular file).  Otherwise, it is read and sent by blocks.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_TIMEOUT       Timeout during execution
+ *  - LE_IO_ERROR      Unable to read from the file descriptor
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_socket_SendFromFd
+(
+    le_socket_Ref_t  ref,        ///< [IN] Socket context reference
+    int              fd,         ///< [IN] File descriptor to read the data from
+    size_t*          dataLenPtr  ///< [INOUT] Input: size of data to send. Output: data size sent,
+                                 ///<         less than requested if the end of file was reached
+)
+{
+    le_result_t status = LE_OK;
+    size_t sentLen = 0;
+    char* blockPtr;
+
+    SocketCtx_t *contextPtr = (SocketCtx_t *)le_ref_Lookup(SocketRefMap, ref);
+    if (contextPtr == NULL)
+    {
+        LE_ERROR("Reference not found: %p", ref);
+        return LE_BAD_PARAMETER;
+    }
+
+    if ((fd < 0) || (!dataLenPtr))
+    {
+        LE_ERROR("Wrong parameter: %d, %p", fd, dataLenPtr);
+        return LE_BAD_PARAMETER;
+    }
+
+    if (contextPtr->fd == -1)
+    {
+        LE_ERROR("Socket not connected");
+        return LE_FAULT;
+    }
+
+    if (contextPtr->isMonitoring)
+    {
+        // Enable POLLOUT event just before sending data. Thus, when writing is possible again,
+        // an event is raised.
+        le_fdMonitor_Enable(contextPtr->monitorRef, POLLOUT);
+    }
+
+    if (!contextPtr->isSecure)
+    {
+        status = netSocket_SendFile(contextPtr->fd, fd, dataLenPtr);
+        if (LE_UNSUPPORTED != status)
+        {
+            return status;
+        }
+    }
+
+    if (!SendBlockPoolRef)
+    {
+        SendBlockPoolRef = le_mem_InitStaticPool(SendBlockPool, MAX_SOCKET_NB, SEND_BLOCK_SIZE);
+    }
+
+    blockPtr = le_mem_TryAlloc(SendBlockPoolRef);
+    if (!blockPtr)
+    {
+        LE_ERROR("Unable to allocate a data block from pool");
+        return LE_FAULT;
+    }
+
+    while (sentLen < *dataLenPtr)
+    {
+        size_t blockLen = *dataLenPtr - sentLen;
+        ssize_t count;
+
+        if (blockLen > SEND_BLOCK_SIZE)
+        {
+            blockLen = SEND_BLOCK_SIZE;
+        }
+
+        count = le_fd_Read(fd, blockPtr, blockLen);
+        if (count < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            LE_ERROR("Read failed: %d, %s", errno, LE_ERRNO_TXT(errno));
+            status = LE_IO_ERROR;
+            break;
+        }
+        else if (0 == count)
+        {
+            // End of file
+            break;
+        }
+
+        if (contextPtr->isSecure)
+        {
+            status = secSocket_Write(contextPtr->secureCtxPtr, blockPtr, count);
+        }
+        else
+        {
+            status = netSocket_Write(contextPtr->fd, blockPtr, count);
+        }
+
+        if (LE_OK != status)
+        {
+            LE_ERROR("Send failed: %d", status);
+            break;
+        }
+
+        // Only the blocks fully written are reported as sent
+        sentLen += count;
+    }
+
+    le_mem_Release(blockPtr);
+
+    *dataLenPtr = sentLen;
+    return status;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Read up to 'dataLenPtr' characters from the socket in a blocking way until data is received or
@@ -783,6 +938,34 @@ bool le_socket_IsMonitoring
     return contextPtr->isMonitoring;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether the current secure connection resumed the TLS session of a previous connection
+ *
+ * @return
+ *  - True if the TLS session was resumed, false otherwise or if the socket is not secure.
+ */
+//--------------------------------------------------------------------------------------------------
+bool le_socket_IsSessionResumed
+(
+    le_socket_Ref_t  socketRef      ///< [IN] Socket context reference
+)
+{
+    SocketCtx_t *contextPtr = (SocketCtx_t *)le_ref_Lookup(SocketRefMap, socketRef);
+    if (contextPtr == NULL)
+    {
+        LE_ERROR("Reference not found: %p", socketRef);
+        return false;
+    }
+
+    if ((!contextPtr->isSecure) || (contextPtr->fd == -1))
+    {
+        return false;
+    }
+
+    return secSocket_IsSessionResumed(contextPtr->secureCtxPtr);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Add a handler to monitor socket events.
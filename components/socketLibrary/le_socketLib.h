@@ -64,8 +64,16 @@
  * @snippet "apps/test/httpServices/socketIntegrationTest/socketTestComponent/socketTest.c"
  * SocketConnect
  *
+ * When a secure socket is disconnected, its TLS session is kept in a cache shared by all the
+ * sockets, keyed by the remote host and port. The next secure connection to the same host and port,
+ * through the same or another socket reference, resumes this session instead of performing a full
+ * handshake. The cache size is set by the @c SOCKET_LIB_TLS_SESSION_CACHE_MAX option, and
+ * @ref le_socket_IsSessionResumed tells whether the current connection resumed a session.
+ *
  * Data transmission can be achieved through @ref le_socket_Read and @ref le_socket_Send APIs.
  * These APIs are blocking until there is something to read from the socket or send is finished.
+ * Data stored in a file can be sent with @ref le_socket_SendFromFd, without copying it to the user
+ * application buffers, and on non-secure sockets without copying it to user space at all.
  * A default timeout of 10 sec is implemented to prevent infinite wait. This duration can be
  * modified by calling @ref le_httpClient_SetTimeout API.
  *
@@ -277,6 +285,27 @@ LE_SHARED le_result_t le_socket_Send
     size_t           dataLen     ///< [IN] Data length
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send data read from a file descriptor through the socket, up to the requested size or to the end
+ * of file.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_TIMEOUT       Timeout during execution
+ *  - LE_IO_ERROR      Unable to read from the file descriptor
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_socket_SendFromFd
+(
+    le_socket_Ref_t  ref,        ///< [IN] Socket context reference
+    int              fd,         ///< [IN] File descriptor to read the data from
+    size_t*          dataLenPtr  ///< [INOUT] Input: size of data to send. Output: data size sent,
+                                 ///<         less than requested if the end of file was reached
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Read up to 'dataLenPtr' characters from the socket
@@ -348,6 +377,19 @@ LE_SHARED bool le_socket_IsMonitoring
     le_socket_Ref_t  socketRef      ///< [IN] Socket context reference
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether the current secure connection resumed the TLS session of a previous connection
+ *
+ * @return
+ *  - True if the TLS session was resumed, false otherwise or if the socket is not secure.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED bool le_socket_IsSessionResumed
+(
+    le_socket_Ref_t  socketRef      ///< [IN] Socket context reference
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Add a handler to monitor socket events.
@@ -16,6 +16,7 @@
 #if LE_CONFIG_LINUX
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <sys/sendfile.h>
 #endif
 
 //--------------------------------------------------------------------------------------------------
@@ -276,6 +277,71 @@ le_result_t netSocket_Write
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write to the socket file descriptor an amount of data read from another file descriptor, in a
+ * blocking way and without copying it to user space.
+ *
+ * @return
+ *  - LE_OK            The function succeeded
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_UNSUPPORTED   Not supported for this source file descriptor, nothing was sent
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_SendFile
+(
+    int     fd,        ///< [IN] Socket file descriptor
+    int     srcFd,     ///< [IN] File descriptor to read the data from
+    size_t* lenPtr     ///< [INOUT] Input: size of data to send. Output: data size sent, less than
+                       ///<         requested if the end of file was reached
+)
+{
+#if LE_CONFIG_LINUX
+    size_t sentLen = 0;
+    ssize_t count;
+
+    if ((!lenPtr) || (fd < 0) || (srcFd < 0))
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    while (sentLen < *lenPtr)
+    {
+        count = sendfile(fd, srcFd, NULL, *lenPtr - sentLen);
+        if (count > 0)
+        {
+            sentLen += count;
+        }
+        else if (0 == count)
+        {
+            // End of file
+            break;
+        }
+        else if (EINTR == errno)
+        {
+            continue;
+        }
+        else if ((0 == sentLen) && ((EINVAL == errno) || (ENOSYS == errno)))
+        {
+            // The source can't be mapped, e.g. a pipe
+            return LE_UNSUPPORTED;
+        }
+        else
+        {
+            LE_ERROR("Sendfile failed: %d, %s", errno, LE_ERRNO_TXT(errno));
+            *lenPtr = sentLen;
+            return LE_FAULT;
+        }
+    }
+
+    *lenPtr = sentLen;
+    return LE_OK;
+#else
+    return LE_UNSUPPORTED;
+#endif
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Read data from the socket file descriptor in a blocking way. If the timeout is zero, then the
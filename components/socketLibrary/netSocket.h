@@ -76,6 +76,26 @@ le_result_t netSocket_Write
     size_t  bufLen     ///< [IN] Size of data to be sent
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write to the socket file descriptor an amount of data read from another file descriptor, in a
+ * blocking way and without copying it to user space.
+ *
+ * @return
+ *  - LE_OK            The function succeeded
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_UNSUPPORTED   Not supported for this source file descriptor, nothing was sent
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_SendFile
+(
+    int     fd,        ///< [IN] Socket file descriptor
+    int     srcFd,     ///< [IN] File descriptor to read the data from
+    size_t* lenPtr     ///< [INOUT] Input: size of data to send. Output: data size sent, less than
+                       ///<         requested if the end of file was reached
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Read data from the socket file descriptor in a blocking way. If the timeout is zero, then the
@@ -26,6 +26,17 @@
 //--------------------------------------------------------------------------------------------------
 typedef void secSocket_Ctx_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of TLS sessions kept for resumption, one per remote host and port
+ */
+//--------------------------------------------------------------------------------------------------
+#ifdef LE_CONFIG_SOCKET_LIB_TLS_SESSION_CACHE_MAX
+#define SESSION_CACHE_MAX        LE_CONFIG_SOCKET_LIB_TLS_SESSION_CACHE_MAX
+#else
+#define SESSION_CACHE_MAX        0
+#endif
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -91,6 +102,7 @@ le_result_t secSocket_Connect
 //--------------------------------------------------------------------------------------------------
 /**
  * Gracefully close the socket connection while keeping the SSL configuration.
+ * The TLS session is cached to be resumed by the next connection to the same host and port.
  *
  * @return
  *  - LE_OK            The function succeeded
@@ -166,4 +178,17 @@ bool secSocket_IsDataAvailable
     secSocket_Ctx_t* ctxPtr       ///< [INOUT] Secure socket context pointer
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if the last handshake resumed a cached TLS session
+ *
+ * @return
+ *  - True if the session was resumed, false otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+bool secSocket_IsSessionResumed
+(
+    secSocket_Ctx_t* ctxPtr       ///< [IN] Secure socket context pointer
+);
+
 #endif /* LE_SEC_SOCKET_LIB_H */
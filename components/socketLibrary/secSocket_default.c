@@ -175,3 +175,19 @@ bool secSocket_IsDataAvailable
 {
     return false;
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if the last handshake resumed a cached TLS session
+ *
+ * @return
+ *  - True if the session was resumed, false otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+bool secSocket_IsSessionResumed
+(
+    secSocket_Ctx_t* ctxPtr       ///< [IN] Secure socket context pointer
+)
+{
+    return false;
+}
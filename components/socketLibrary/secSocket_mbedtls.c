@@ -42,6 +42,13 @@
 //--------------------------------------------------------------------------------------------------
 #define MBEDTLS_SSL_CONNECT_TIMEOUT (3 * 10000)
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS master secret length
+ */
+//--------------------------------------------------------------------------------------------------
+#define MASTER_SECRET_LEN           48
+
 //--------------------------------------------------------------------------------------------------
 /**
  * MbedTLS global context
@@ -53,9 +60,33 @@ typedef struct
     mbedtls_ssl_context sslCtx;     ///< SSL/TLS context.
     mbedtls_ssl_config  sslConf;    ///< SSL/TLS configuration.
     mbedtls_x509_crt    caCert;     ///< X.509 certificate.
+    char                host[HOST_ADDR_LEN];    ///< Host of the last connection
+    uint16_t            port;                   ///< Port of the last connection
+    bool                isHandshakeDone;        ///< True if the last handshake succeeded
+    bool                isSessionOffered;       ///< True if a cached session was offered to the
+                                                ///< server by the last handshake
+    bool                isSessionResumed;       ///< True if the last handshake resumed it
+    unsigned char       offeredMaster[MASTER_SECRET_LEN];   ///< Master secret of the session
+                                                            ///< offered, kept by a resumption
 }
 MbedtlsCtx_t;
 
+#if SESSION_CACHE_MAX > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS session cache entry
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char                host[HOST_ADDR_LEN];    ///< Remote host, empty if the entry is unused
+    uint16_t            port;                   ///< Remote port
+    uint32_t            lastUse;                ///< Value of SessionUseCount at last use
+    mbedtls_ssl_session session;                ///< Session to resume
+}
+SessionCacheEntry_t;
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Memory pool for MbedTLS sockets context.
@@ -64,6 +95,29 @@ MbedtlsCtx_t;
 static le_mem_PoolRef_t SocketCtxPoolRef = NULL;
 LE_MEM_DEFINE_STATIC_POOL(SocketCtxPool, MAX_SOCKET_NB, sizeof(MbedtlsCtx_t));
 
+#if SESSION_CACHE_MAX > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS sessions kept for resumption, shared by all the secure sockets.
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionCacheEntry_t SessionCache[SESSION_CACHE_MAX];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Use counter of the session cache, used to find the least recently used entry.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t SessionUseCount = 0;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the session cache.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mutex_Ref_t SessionCacheMutexRef = NULL;
+#endif
+
 //--------------------------------------------------------------------------------------------------
 // Static functions
 //--------------------------------------------------------------------------------------------------
@@ -176,6 +230,141 @@ static int ReadFromStream
     return r;
 }
 
+#if SESSION_CACHE_MAX > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for the cached session of a host and port.  Must be called with the cache mutex locked.
+ *
+ * @return
+ *  - Cache entry pointer, or NULL if none
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionCacheEntry_t* FindCachedSession
+(
+    const char* hostPtr,    ///< [IN] Remote host
+    uint16_t    port        ///< [IN] Remote port
+)
+{
+    int i;
+
+    for (i = 0; i < SESSION_CACHE_MAX; i++)
+    {
+        if ((SessionCache[i].port == port) && (0 == strcmp(SessionCache[i].host, hostPtr)))
+        {
+            return &SessionCache[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the cached session of the host and port, if any, to be resumed by the next handshake.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LoadSession
+(
+    MbedtlsCtx_t* contextPtr    ///< [IN] Secure socket context pointer
+)
+{
+    SessionCacheEntry_t* entryPtr;
+
+    le_mutex_Lock(SessionCacheMutexRef);
+
+    entryPtr = FindCachedSession(contextPtr->host, contextPtr->port);
+    if (entryPtr)
+    {
+        int ret = mbedtls_ssl_set_session(&(contextPtr->sslCtx), &(entryPtr->session));
+        if (ret != 0)
+        {
+            LE_WARN("Failed! mbedtls_ssl_set_session returned -0x%x", -ret);
+        }
+        else
+        {
+            LE_DEBUG("Resuming session of %s:%d", contextPtr->host, contextPtr->port);
+            entryPtr->lastUse = ++SessionUseCount;
+            memcpy(contextPtr->offeredMaster, entryPtr->session.master, MASTER_SECRET_LEN);
+            contextPtr->isSessionOffered = true;
+        }
+    }
+
+    le_mutex_Unlock(SessionCacheMutexRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Keep the session of the last handshake in the cache, in place of the previous session of the
+ * host and port or of the least recently used one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StoreSession
+(
+    MbedtlsCtx_t* contextPtr    ///< [IN] Secure socket context pointer
+)
+{
+    SessionCacheEntry_t* entryPtr;
+    int i;
+    int ret;
+
+    le_mutex_Lock(SessionCacheMutexRef);
+
+    entryPtr = FindCachedSession(contextPtr->host, contextPtr->port);
+    if (!entryPtr)
+    {
+        entryPtr = &SessionCache[0];
+        for (i = 1; (i < SESSION_CACHE_MAX) && (entryPtr->host[0] != '\0'); i++)
+        {
+            if ((SessionCache[i].host[0] == '\0') || (SessionCache[i].lastUse < entryPtr->lastUse))
+            {
+                entryPtr = &SessionCache[i];
+            }
+        }
+    }
+
+    mbedtls_ssl_session_free(&(entryPtr->session));
+    ret = mbedtls_ssl_get_session(&(contextPtr->sslCtx), &(entryPtr->session));
+    if (ret != 0)
+    {
+        LE_WARN("Failed! mbedtls_ssl_get_session returned -0x%x", -ret);
+        mbedtls_ssl_session_free(&(entryPtr->session));
+        entryPtr->host[0] = '\0';
+    }
+    else
+    {
+        le_utf8_Copy(entryPtr->host, contextPtr->host, sizeof(entryPtr->host), NULL);
+        entryPtr->port = contextPtr->port;
+        entryPtr->lastUse = ++SessionUseCount;
+    }
+
+    le_mutex_Unlock(SessionCacheMutexRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drop the cached session of the host and port, e.g. when the handshake failed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ForgetSession
+(
+    MbedtlsCtx_t* contextPtr    ///< [IN] Secure socket context pointer
+)
+{
+    SessionCacheEntry_t* entryPtr;
+
+    le_mutex_Lock(SessionCacheMutexRef);
+
+    entryPtr = FindCachedSession(contextPtr->host, contextPtr->port);
+    if (entryPtr)
+    {
+        mbedtls_ssl_session_free(&(entryPtr->session));
+        entryPtr->host[0] = '\0';
+    }
+
+    le_mutex_Unlock(SessionCacheMutexRef);
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -205,6 +394,9 @@ le_result_t secSocket_Init
         SocketCtxPoolRef = le_mem_InitStaticPool(SocketCtxPool,
                                                  MAX_SOCKET_NB,
                                                  sizeof(MbedtlsCtx_t));
+#if SESSION_CACHE_MAX > 0
+        SessionCacheMutexRef = le_mutex_CreateNonRecursive("SecSocketSessionCache");
+#endif
     }
 
     // Alloc memory from pool
@@ -214,6 +406,10 @@ le_result_t secSocket_Init
     mbedtls_net_init(&(contextPtr->sock));
     mbedtls_ssl_init(&(contextPtr->sslCtx));
     mbedtls_ssl_config_init(&(contextPtr->sslConf));
+    contextPtr->host[0] = '\0';
+    contextPtr->isHandshakeDone = false;
+    contextPtr->isSessionOffered = false;
+    contextPtr->isSessionResumed = false;
 
     *ctxPtr = (secSocket_Ctx_t *) contextPtr;
 
@@ -358,6 +554,14 @@ le_result_t secSocket_Connect
     mbedtls_ssl_set_bio(&(contextPtr->sslCtx), &(contextPtr->sock),
                         mbedtls_net_send, NULL, mbedtls_net_recv_timeout);
 
+    le_utf8_Copy(contextPtr->host, hostPtr, sizeof(contextPtr->host), NULL);
+    contextPtr->port = port;
+    contextPtr->isSessionOffered = false;
+    contextPtr->isSessionResumed = false;
+#if SESSION_CACHE_MAX > 0
+    LoadSession(contextPtr);
+#endif
+
     // Set the timeout for the initial handshake.
     mbedtls_ssl_conf_read_timeout(&(contextPtr->sslConf), MBEDTLS_SSL_CONNECT_TIMEOUT);
 
@@ -368,6 +572,9 @@ le_result_t secSocket_Connect
         LE_ERROR("Failed! mbedtls_ssl_handshake returned -0x%x", -ret);
         if ((ret != MBEDTLS_ERR_SSL_WANT_READ) && (ret != MBEDTLS_ERR_SSL_WANT_WRITE))
         {
+#if SESSION_CACHE_MAX > 0
+            ForgetSession(contextPtr);
+#endif
             if (ret == MBEDTLS_ERR_NET_RECV_FAILED)
             {
                 return LE_TIMEOUT;
@@ -391,12 +598,21 @@ le_result_t secSocket_Connect
         }
     }
 
+    contextPtr->isHandshakeDone = true;
+
+    // A resumed session keeps the master secret of the session offered, a full handshake
+    // negotiates a new one
+    contextPtr->isSessionResumed = ((contextPtr->isSessionOffered) &&
+                                    (0 == memcmp(contextPtr->sslCtx.session->master,
+                                                 contextPtr->offeredMaster,
+                                                 MASTER_SECRET_LEN)));
     return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
  * Gracefully close the socket connection while keeping the SSL configuration.
+ * The TLS session is cached to be resumed by the next connection to the same host and port.
  *
  * @return
  *  - LE_OK            The function succeeded
@@ -411,7 +627,21 @@ le_result_t secSocket_Disconnect
     MbedtlsCtx_t *contextPtr = (MbedtlsCtx_t *) ctxPtr;
     LE_ASSERT(contextPtr != NULL);
 
+#if SESSION_CACHE_MAX > 0
+    if (contextPtr->isHandshakeDone)
+    {
+        StoreSession(contextPtr);
+    }
+#endif
+    contextPtr->isHandshakeDone = false;
+
     mbedtls_net_free(&(contextPtr->sock));
+
+    // Release the SSL context and configuration, they are set up again by the next connection
+    mbedtls_ssl_free(&(contextPtr->sslCtx));
+    mbedtls_ssl_init(&(contextPtr->sslCtx));
+    mbedtls_ssl_config_free(&(contextPtr->sslConf));
+    mbedtls_ssl_config_init(&(contextPtr->sslConf));
     return LE_OK;
 }
 
@@ -533,3 +763,22 @@ bool secSocket_IsDataAvailable
     LE_ASSERT(contextPtr != NULL);
     return (mbedtls_ssl_get_bytes_avail(&(contextPtr->sslCtx)) != 0);
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if the last handshake resumed a cached TLS session
+ *
+ * @return
+ *  - True if the session was resumed, false otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+bool secSocket_IsSessionResumed
+(
+    secSocket_Ctx_t *ctxPtr ///< [IN] Secure socket context pointer
+)
+{
+    MbedtlsCtx_t *contextPtr = (MbedtlsCtx_t *) ctxPtr;
+
+    LE_ASSERT(contextPtr != NULL);
+    return ((contextPtr->isHandshakeDone) && (contextPtr->isSessionResumed));
+}
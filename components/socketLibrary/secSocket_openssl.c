@@ -56,9 +56,27 @@ typedef struct
     BIO*                     bioPtr;    ///< I/O stream abstraction pointer
     SSL_CTX*                 sslCtxPtr; ///< SSL internal context pointer
     bool                     isInit;    ///< TRUE if the secure socket context is initialized
+    char                     host[HOST_ADDR_LEN];   ///< Host of the last connection
+    uint16_t                 port;                  ///< Port of the last connection
 }
 OpensslCtx_t;
 
+#if SESSION_CACHE_MAX > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS session cache entry
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char                     host[HOST_ADDR_LEN];   ///< Remote host
+    uint16_t                 port;                  ///< Remote port
+    uint32_t                 lastUse;               ///< Value of SessionUseCount at last use
+    SSL_SESSION*             sessionPtr;            ///< Session to resume, NULL if unused
+}
+SessionCacheEntry_t;
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Memory pool for OpenSSL sockets context.
@@ -77,6 +95,29 @@ LE_MEM_DEFINE_STATIC_POOL(SocketCtxPool, MAX_SOCKET_NB, sizeof(OpensslCtx_t));
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t SocketCtxPoolRef = NULL;
 
+#if SESSION_CACHE_MAX > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS sessions kept for resumption, shared by all the secure sockets.
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionCacheEntry_t SessionCache[SESSION_CACHE_MAX];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Use counter of the session cache, used to find the least recently used entry.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t SessionUseCount = 0;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the session cache.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mutex_Ref_t SessionCacheMutexRef = NULL;
+#endif
+
 //--------------------------------------------------------------------------------------------------
 // Static functions
 //--------------------------------------------------------------------------------------------------
@@ -112,6 +153,150 @@ static OpensslCtx_t* GetContext
     }
 }
 
+#if SESSION_CACHE_MAX > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for the cached session of a host and port.  Must be called with the cache mutex locked.
+ *
+ * @return
+ *  - Cache entry pointer, or NULL if none
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionCacheEntry_t* FindCachedSession
+(
+    const char* hostPtr,    ///< [IN] Remote host
+    uint16_t    port        ///< [IN] Remote port
+)
+{
+    int i;
+
+    for (i = 0; i < SESSION_CACHE_MAX; i++)
+    {
+        if ((SessionCache[i].sessionPtr) && (SessionCache[i].port == port) &&
+            (0 == strcmp(SessionCache[i].host, hostPtr)))
+        {
+            return &SessionCache[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the cached session of the host and port, if any, to be resumed by the next handshake.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LoadSession
+(
+    OpensslCtx_t* contextPtr,   ///< [IN] OpenSSL socket context pointer
+    SSL*          sslPtr        ///< [IN] SSL connection pointer
+)
+{
+    SessionCacheEntry_t* entryPtr;
+
+    le_mutex_Lock(SessionCacheMutexRef);
+
+    entryPtr = FindCachedSession(contextPtr->host, contextPtr->port);
+    if (entryPtr)
+    {
+        if (SSL_set_session(sslPtr, entryPtr->sessionPtr) != 1)
+        {
+            LE_WARN("Unable to set session of %s:%d", contextPtr->host, contextPtr->port);
+        }
+        else
+        {
+            LE_DEBUG("Resuming session of %s:%d", contextPtr->host, contextPtr->port);
+            entryPtr->lastUse = ++SessionUseCount;
+        }
+    }
+
+    le_mutex_Unlock(SessionCacheMutexRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Keep the session of the current connection in the cache, in place of the previous session of
+ * the host and port or of the least recently used one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StoreSession
+(
+    OpensslCtx_t* contextPtr,   ///< [IN] OpenSSL socket context pointer
+    SSL*          sslPtr        ///< [IN] SSL connection pointer
+)
+{
+    SessionCacheEntry_t* entryPtr;
+    SSL_SESSION* sessionPtr;
+    int i;
+
+    sessionPtr = SSL_get1_session(sslPtr);
+    if (!sessionPtr)
+    {
+        return;
+    }
+
+#if OPENSSL_VERSION_NUMBER >= 0x10101000L
+    if (!SSL_SESSION_is_resumable(sessionPtr))
+    {
+        SSL_SESSION_free(sessionPtr);
+        return;
+    }
+#endif
+
+    le_mutex_Lock(SessionCacheMutexRef);
+
+    entryPtr = FindCachedSession(contextPtr->host, contextPtr->port);
+    if (!entryPtr)
+    {
+        entryPtr = &SessionCache[0];
+        for (i = 1; (i < SESSION_CACHE_MAX) && (entryPtr->sessionPtr); i++)
+        {
+            if ((!SessionCache[i].sessionPtr) || (SessionCache[i].lastUse < entryPtr->lastUse))
+            {
+                entryPtr = &SessionCache[i];
+            }
+        }
+    }
+
+    if (entryPtr->sessionPtr)
+    {
+        SSL_SESSION_free(entryPtr->sessionPtr);
+    }
+
+    le_utf8_Copy(entryPtr->host, contextPtr->host, sizeof(entryPtr->host), NULL);
+    entryPtr->port = contextPtr->port;
+    entryPtr->sessionPtr = sessionPtr;
+    entryPtr->lastUse = ++SessionUseCount;
+
+    le_mutex_Unlock(SessionCacheMutexRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drop the cached session of the host and port, e.g. when the handshake failed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ForgetSession
+(
+    OpensslCtx_t* contextPtr    ///< [IN] OpenSSL socket context pointer
+)
+{
+    SessionCacheEntry_t* entryPtr;
+
+    le_mutex_Lock(SessionCacheMutexRef);
+
+    entryPtr = FindCachedSession(contextPtr->host, contextPtr->port);
+    if (entryPtr)
+    {
+        SSL_SESSION_free(entryPtr->sessionPtr);
+        entryPtr->sessionPtr = NULL;
+    }
+
+    le_mutex_Unlock(SessionCacheMutexRef);
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -144,6 +329,9 @@ le_result_t secSocket_Init
         SocketCtxPoolRef = le_mem_InitStaticPool(SocketCtxPool,
                                                  MAX_SOCKET_NB,
                                                  sizeof(OpensslCtx_t));
+#if SESSION_CACHE_MAX > 0
+        SessionCacheMutexRef = le_mutex_CreateNonRecursive("SecSocketSessionCache");
+#endif
     }
 
     // Check if the socket is already initialized
@@ -164,6 +352,8 @@ le_result_t secSocket_Init
 
     // Set the magic number
     contextPtr->magicNb = OPENSSL_MAGIC_NUMBER;
+    contextPtr->bioPtr = NULL;
+    contextPtr->host[0] = '\0';
 
     // Initialize OpenSSL library and setup SSL pointers
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
@@ -323,6 +513,16 @@ le_result_t secSocket_Connect
     snprintf(hostAndPort, sizeof(hostAndPort), "%s:%d", hostPtr, port);
     LE_INFO("Connecting to %d/%s:%d - %s...", type, hostPtr, port, hostAndPort);
 
+    // Release the BIO of a previous connection
+    if (contextPtr->bioPtr)
+    {
+        BIO_free_all(contextPtr->bioPtr);
+        contextPtr->bioPtr = NULL;
+    }
+
+    le_utf8_Copy(contextPtr->host, hostPtr, sizeof(contextPtr->host), NULL);
+    contextPtr->port = port;
+
     // Clear the current thread's OpenSSL error queue
     ERR_clear_error();
 
@@ -347,12 +547,19 @@ le_result_t secSocket_Connect
 
     BIO_set_conn_hostname(bioPtr, hostAndPort);
 
+#if SESSION_CACHE_MAX > 0
+    LoadSession(contextPtr, sslPtr);
+#endif
+
     // Attempt to connect the supplied BIO and perform the handshake.
     // This function returns 1 if the connection was successfully established and 0 or -1 if the
     // connection failed.
     if (BIO_do_connect(bioPtr) != 1)
     {
         LE_ERROR("Unable to connect BIO to %s", hostAndPort);
+#if SESSION_CACHE_MAX > 0
+        ForgetSession(contextPtr);
+#endif
         goto err;
     }
 
@@ -406,6 +613,7 @@ err:
 //--------------------------------------------------------------------------------------------------
 /**
  * Gracefully close the socket connection while keeping the SSL configuration.
+ * The TLS session is cached to be resumed by the next connection to the same host and port.
  *
  * @return
  *  - LE_OK            The function succeeded
@@ -428,7 +636,23 @@ le_result_t secSocket_Disconnect
         return LE_BAD_PARAMETER;
     }
 
+    if (!contextPtr->bioPtr)
+    {
+        return LE_OK;
+    }
+
+#if SESSION_CACHE_MAX > 0
+    SSL* sslPtr = NULL;
+    BIO_get_ssl(contextPtr->bioPtr, &sslPtr);
+    if ((sslPtr) && (SSL_is_init_finished(sslPtr)))
+    {
+        StoreSession(contextPtr, sslPtr);
+    }
+#endif
+
     BIO_ssl_shutdown(contextPtr->bioPtr);
+    BIO_free_all(contextPtr->bioPtr);
+    contextPtr->bioPtr = NULL;
     return LE_OK;
 }
 
@@ -605,6 +829,12 @@ le_result_t secSocket_Read
         {
              return LE_WOULD_BLOCK;
         }
+        else if (rv == 0)
+        {
+            // Connection closed by the peer: end of stream, as reported by the other sockets
+            *dataLenPtr = 0;
+            return LE_OK;
+        }
         else
         {
             LE_ERROR("Read failed. Error code: %d", rv);
@@ -642,3 +872,34 @@ bool secSocket_IsDataAvailable
 
     return (BIO_pending(contextPtr->bioPtr) ? true: false);
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if the last handshake resumed a cached TLS session
+ *
+ * @return
+ *  - True if the session was resumed, false otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+bool secSocket_IsSessionResumed
+(
+    secSocket_Ctx_t* ctxPtr       ///< [IN] Secure socket context pointer
+)
+{
+    SSL* sslPtr = NULL;
+
+    if (!ctxPtr)
+    {
+        return false;
+    }
+
+    OpensslCtx_t* contextPtr = GetContext(ctxPtr);
+    if ((!contextPtr) || (!contextPtr->bioPtr))
+    {
+        return false;
+    }
+
+    BIO_get_ssl(contextPtr->bioPtr, &sslPtr);
+
+    return ((sslPtr) && (SSL_session_reused(sslPtr)));
+}
@@ -404,6 +404,43 @@ void gpioSysfs_InputMonitorHandlerFunc
     short events
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the value of a group of pins, all in use by the client process of the given session.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_NOT_PERMITTED if one of the pins isn't in use by the client process
+ *  - LE_IO_ERROR if one of the pins couldn't be read
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioSysfs_ReadGroup
+(
+    const gpioSysfs_GpioRef_t* gpioRefs,  ///< [IN] GPIO objects, indexed by pin number - 1
+    uint64_t pinMask,                     ///< [IN] Pins to read (bit n-1 set for pin n)
+    le_msg_SessionRef_t sessionRef,       ///< [IN] Session of the client
+    uint64_t* valuesPtr                   ///< [OUT] Pin values (bit n-1 set if pin n is active)
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the value of a group of output pins, all in use by the client process of the given
+ * session.  The pins are written in increasing pin number order.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_NOT_PERMITTED if one of the pins isn't in use by the client process
+ *  - LE_IO_ERROR if one of the pins couldn't be written (pins before it have been written)
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioSysfs_WriteGroup
+(
+    const gpioSysfs_GpioRef_t* gpioRefs,  ///< [IN] GPIO objects, indexed by pin number - 1
+    uint64_t pinMask,                     ///< [IN] Pins to write (bit n-1 set for pin n)
+    uint64_t values,                      ///< [IN] Pin values (bit n-1 set to activate pin n)
+    le_msg_SessionRef_t sessionRef        ///< [IN] Session of the client
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function to be called when the client-server session opens. This allows the relationship
@@ -473,6 +510,8 @@ struct gpioSysfs_Gpio {
     void *callbackContextPtr;                     ///< Client context to be passed back
     le_fdMonitor_Ref_t fdMonitor;                 ///< fdMonitor Object associated to this GPIO
     le_msg_SessionRef_t currentSession;           ///< Current valid IPC session for this pin
+    int valueFd;                                  ///< "value" fd, open while the pin is in use
+    pid_t ownerPid;                               ///< Process of the current session's client
 };
 
 
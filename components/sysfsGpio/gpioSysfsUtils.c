@@ -17,9 +17,13 @@
 /**
  * GPIO signals have paths like /sys/class/gpio/gpio42/ (for GPIO #42) in Legacy GPIO design
  * and paths like /sys/class/gpio/v2/alias_exported/42/ (for GPIO #42) in GPIO design v2
+ *
+ * The root path can be overridden at build time, to run against a fake sysfs tree.
  */
 //--------------------------------------------------------------------------------------------------
+#ifndef SYSFS_GPIO_PATH
 #define SYSFS_GPIO_PATH           "/sys/class/gpio"
+#endif
 #define SYSFS_GPIO_ALIAS_PREFIX   "/v2/alias_"
 #define SYSFS_GPIO_ALIASES_PATH   "/v2/aliases_exported/"
 
@@ -296,6 +300,118 @@ static le_result_t ReadSysGpioSignalAttr
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the "value" attribute of a GPIO, and keep it open while the GPIO is in use, so that reading
+ * and writing its value doesn't require a path lookup and an open/close each time.
+ *
+ * If it can't be opened, the value is accessed through its path, as the other attributes.
+ */
+//--------------------------------------------------------------------------------------------------
+static void OpenValueFd
+(
+    gpioSysfs_GpioRef_t gpioRef         ///< [IN] GPIO object reference
+)
+{
+    char path[64];
+
+    snprintf(path, sizeof(path), "%s/%s%s/%s", SYSFS_GPIO_PATH, GpioAliasesPath,
+             gpioRef->gpioName, "value");
+
+    do
+    {
+        gpioRef->valueFd = open(path, O_RDWR | O_CLOEXEC);
+    }
+    while ((gpioRef->valueFd < 0) && (errno == EINTR));
+
+    LE_WARN_IF(gpioRef->valueFd < 0, "Unable to keep %s open. %m", path);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close the "value" attribute of a GPIO, if it is open.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CloseValueFd
+(
+    gpioSysfs_GpioRef_t gpioRef         ///< [IN] GPIO object reference
+)
+{
+    if (gpioRef->valueFd >= 0)
+    {
+        LE_WARN_IF(close(gpioRef->valueFd) == -1,
+                   "Failed to close value file descriptor for gpio %d: %m", gpioRef->pinNum);
+        gpioRef->valueFd = -1;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the value of a GPIO through its open "value" attribute.
+ *
+ * @return
+ * - LE_IO_ERROR if the value couldn't be read
+ * - LE_OK on success
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReadValueFd
+(
+    gpioSysfs_GpioRef_t gpioRef,        ///< [IN] GPIO object reference
+    gpioSysfs_Value_t* valuePtr         ///< [OUT] High or low
+)
+{
+    char c;
+    ssize_t count;
+
+    do
+    {
+        count = pread(gpioRef->valueFd, &c, 1, 0);
+    }
+    while ((count < 0) && (errno == EINTR));
+
+    if (count != 1)
+    {
+        LE_ERROR("Unable to read value for GPIO %s. %m", gpioRef->gpioName);
+        return LE_IO_ERROR;
+    }
+
+    *valuePtr = (c == '1') ? SYSFS_VALUE_HIGH : SYSFS_VALUE_LOW;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the value of a GPIO through its open "value" attribute.
+ *
+ * @return
+ * - LE_IO_ERROR if the value couldn't be written
+ * - LE_OK on success
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t WriteValueFd
+(
+    gpioSysfs_GpioRef_t gpioRef,        ///< [IN] GPIO object reference
+    gpioSysfs_Value_t level             ///< [IN] High or low
+)
+{
+    const char c = (level == SYSFS_VALUE_HIGH) ? '1' : '0';
+    ssize_t count;
+
+    do
+    {
+        count = pwrite(gpioRef->valueFd, &c, 1, 0);
+    }
+    while ((count < 0) && (errno == EINTR));
+
+    if (count != 1)
+    {
+        LE_ERROR("Failed to write %c to GPIO %s. %m", c, gpioRef->gpioName);
+        return LE_IO_ERROR;
+    }
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * write value to GPIO output, low or high
@@ -316,6 +432,11 @@ static le_result_t WriteOutputValue
         return LE_BAD_PARAMETER;
     }
 
+    if (gpioRef->valueFd >= 0)
+    {
+        return WriteValueFd(gpioRef, level);
+    }
+
     snprintf(path, sizeof(path), "%s/%s%s/%s", SYSFS_GPIO_PATH, GpioAliasesPath,
                           gpioRef->gpioName, "value");
     snprintf(attr, sizeof(attr), "%d", level);
@@ -754,6 +875,16 @@ gpioSysfs_Value_t gpioSysfs_ReadValue
         return -1;
     }
 
+    if (gpioRef->valueFd >= 0)
+    {
+        if (ReadValueFd(gpioRef, &type) != LE_OK)
+        {
+            return -1;
+        }
+
+        return type;
+    }
+
     snprintf(path, sizeof(path), "%s/%s%s/%s", SYSFS_GPIO_PATH, GpioAliasesPath,
              gpioRef->gpioName, "value");
     leResult = ReadSysGpioSignalAttr(path, sizeof(result), result);
@@ -1121,6 +1252,155 @@ void gpioSysfs_InputMonitorHandlerFunc
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that all the pins of a group are in use by the client process of a session, and have
+ * their "value" attribute open.
+ *
+ * @return
+ *  - LE_OK if they are
+ *  - LE_NOT_PERMITTED if one of them isn't
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t CheckGroup
+(
+    const gpioSysfs_GpioRef_t* gpioRefs,  ///< [IN] GPIO objects, indexed by pin number - 1
+    uint64_t pinMask,                     ///< [IN] Pins of the group (bit n-1 set for pin n)
+    le_msg_SessionRef_t sessionRef        ///< [IN] Session of the client
+)
+{
+    pid_t pid = 0;
+    int i;
+
+    if (le_msg_GetClientUserCreds(sessionRef, NULL, &pid) != LE_OK)
+    {
+        return LE_NOT_PERMITTED;
+    }
+
+    for (i = 0; i < MAX_PIN_NUMBER; i++)
+    {
+        gpioSysfs_GpioRef_t gpioRef = gpioRefs[i];
+
+        if (!(pinMask & (1ULL << i)))
+        {
+            continue;
+        }
+
+        if ((gpioRef == NULL) || (!gpioRef->inUse) || (gpioRef->ownerPid != pid))
+        {
+            LE_ERROR("GPIO %d is not in use by process %d", i + 1, pid);
+            return LE_NOT_PERMITTED;
+        }
+
+        if (gpioRef->valueFd < 0)
+        {
+            LE_ERROR("GPIO %d value is not open", i + 1);
+            return LE_NOT_PERMITTED;
+        }
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the value of a group of pins, all in use by the client process of the given session.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_NOT_PERMITTED if one of the pins isn't in use by the client process
+ *  - LE_IO_ERROR if one of the pins couldn't be read
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioSysfs_ReadGroup
+(
+    const gpioSysfs_GpioRef_t* gpioRefs,  ///< [IN] GPIO objects, indexed by pin number - 1
+    uint64_t pinMask,                     ///< [IN] Pins to read (bit n-1 set for pin n)
+    le_msg_SessionRef_t sessionRef,       ///< [IN] Session of the client
+    uint64_t* valuesPtr                   ///< [OUT] Pin values (bit n-1 set if pin n is active)
+)
+{
+    le_result_t result;
+    uint64_t values = 0;
+    int i;
+
+    result = CheckGroup(gpioRefs, pinMask, sessionRef);
+    if (result != LE_OK)
+    {
+        return result;
+    }
+
+    for (i = 0; i < MAX_PIN_NUMBER; i++)
+    {
+        gpioSysfs_Value_t value;
+
+        if (!(pinMask & (1ULL << i)))
+        {
+            continue;
+        }
+
+        result = ReadValueFd(gpioRefs[i], &value);
+        if (result != LE_OK)
+        {
+            return result;
+        }
+
+        if (value == SYSFS_VALUE_HIGH)
+        {
+            values |= (1ULL << i);
+        }
+    }
+
+    *valuesPtr = values;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the value of a group of output pins, all in use by the client process of the given
+ * session.  The pins are written in increasing pin number order.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_NOT_PERMITTED if one of the pins isn't in use by the client process
+ *  - LE_IO_ERROR if one of the pins couldn't be written (pins before it have been written)
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioSysfs_WriteGroup
+(
+    const gpioSysfs_GpioRef_t* gpioRefs,  ///< [IN] GPIO objects, indexed by pin number - 1
+    uint64_t pinMask,                     ///< [IN] Pins to write (bit n-1 set for pin n)
+    uint64_t values,                      ///< [IN] Pin values (bit n-1 set to activate pin n)
+    le_msg_SessionRef_t sessionRef        ///< [IN] Session of the client
+)
+{
+    le_result_t result;
+    int i;
+
+    result = CheckGroup(gpioRefs, pinMask, sessionRef);
+    if (result != LE_OK)
+    {
+        return result;
+    }
+
+    for (i = 0; i < MAX_PIN_NUMBER; i++)
+    {
+        if (!(pinMask & (1ULL << i)))
+        {
+            continue;
+        }
+
+        result = WriteValueFd(gpioRefs[i],
+                              (values & (1ULL << i)) ? SYSFS_VALUE_HIGH : SYSFS_VALUE_LOW);
+        if (result != LE_OK)
+        {
+            return result;
+        }
+    }
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function will be called when the client-server session opens. This allows the relationship
@@ -1174,12 +1454,17 @@ void gpioSysfs_SessionOpenHandlerFunc
         return;
     }
 
+    // Keep the value open while the pin is in use
+    OpenValueFd(gpioRef);
+
     // Mark the PIN as in use
     LE_INFO("Assigning GPIO %d", gpioRef->pinNum);
     gpioRef->inUse = true;
 
-    // Store the current, valid session ref
+    // Store the current, valid session ref, and its client process for group operations
     gpioRef->currentSession = sessionRef;
+    gpioRef->ownerPid = 0;
+    le_msg_GetClientUserCreds(sessionRef, NULL, &gpioRef->ownerPid);
 
     LE_DEBUG("gpio pin:%d, GPIO Name:%s", gpioRef->pinNum, gpioRef->gpioName);
     return;
@@ -1218,8 +1503,10 @@ void gpioSysfs_SessionCloseHandlerFunc
     gpioRef->inUse = false;
 
     RemoveChangeCallback(gpioRef);
+    CloseValueFd(gpioRef);
 
     gpioRef->currentSession = NULL;
+    gpioRef->ownerPid = 0;
 }
 
 //--------------------------------------------------------------------------------------------------
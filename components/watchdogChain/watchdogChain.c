@@ -5,6 +5,10 @@
  * watchdog.  The watchdog will be kicked when all non-stopped tasks on the chain have requested
  * a kick.
  *
+ * On Linux, once the process watchdog has been kicked through IPC, a kick slot is requested from
+ * the watchdog daemon and later kicks of the process watchdog are simple stores into that shared
+ * memory slot.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 //--------------------------------------------------------------------------------------------------
@@ -13,6 +17,10 @@
 #include "interfaces.h"
 #include "watchdogChain.h"
 
+#if LE_CONFIG_LINUX
+#   include <sys/mman.h>
+#endif
+
 #ifndef MAX_WATCHDOG_CHAINS
 //--------------------------------------------------------------------------------------------------
 /**
@@ -117,6 +125,45 @@ WatchdogObj_t* WatchdogList[MAX_WATCHDOG_CHAINS];
 le_log_TraceRef_t TraceRef;
 });
 
+#if LE_CONFIG_LINUX
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kick slot shared with the watchdog daemon, or NULL if the process watchdog is kicked through IPC.
+ */
+//--------------------------------------------------------------------------------------------------
+static volatile uint32_t* KickSlotPtr;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Should a kick slot be requested from the watchdog daemon?  Cleared if the daemon does not
+ * support kick slots.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool ShouldGetKickSlot = true;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kick slot dropped by the watchdog daemon, waiting to be unmapped, or NULL.
+ */
+//--------------------------------------------------------------------------------------------------
+static volatile uint32_t* RetiredKickSlotPtr;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of kicks in progress which may use KickSlotPtr, ORed with KICK_SLOT_RETIRED while
+ * RetiredKickSlotPtr waits for them to end.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t KickSlotUsers;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Flag of KickSlotUsers set when a kick slot is retired.
+ */
+//--------------------------------------------------------------------------------------------------
+#define KICK_SLOT_RETIRED   UINT32_C(0x80000000)
+#endif
+
 /// Macro used to generate trace output in this module.
 /// Takes the same parameters as LE_DEBUG() et. al.
 #define TRACE(...) LE_TRACE(LE_CDATA_THIS->TraceRef, ##__VA_ARGS__)
@@ -278,6 +325,147 @@ static void CheckEventLoopHandler
 }
 
 
+#if LE_CONFIG_LINUX
+//--------------------------------------------------------------------------------------------------
+/**
+ * Request a kick slot from the watchdog daemon and map it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void OpenKickSlot
+(
+    void
+)
+{
+    int fd = -1;
+    le_result_t result = le_wdog_GetKickSlot(&fd);
+
+    if (LE_OK != result)
+    {
+        // Another thread may have got the slot in the meantime; anything else won't change.
+        if (LE_DUPLICATE != result)
+        {
+            LE_INFO("No watchdog kick slot (%s); kicking through IPC", LE_RESULT_TXT(result));
+            ShouldGetKickSlot = false;
+        }
+        return;
+    }
+
+    void* slotPtr = mmap(NULL, LE_WDOG_KICK_SLOT_WORDS * sizeof(uint32_t),
+                         PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (MAP_FAILED == slotPtr)
+    {
+        LE_WARN("Failed to map watchdog kick slot: %m; kicking through IPC");
+        ShouldGetKickSlot = false;
+        return;
+    }
+
+    if (!LE_SYNC_BOOL_COMPARE_AND_SWAP(&KickSlotPtr, NULL, slotPtr))
+    {
+        munmap(slotPtr, LE_WDOG_KICK_SLOT_WORDS * sizeof(uint32_t));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Retire a kick slot dropped by the watchdog daemon: remove it from KickSlotPtr, and unmap it once
+ * the kicks which may still store into it are over.  Only one kick slot is retired at a time.
+ *
+ * Must be called while holding a use of the kick slot.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RetireKickSlot
+(
+    volatile uint32_t* slotPtr  ///< [IN] Kick slot
+)
+{
+    if (!LE_SYNC_BOOL_COMPARE_AND_SWAP(&RetiredKickSlotPtr, NULL, slotPtr))
+    {
+        // Another slot is still being retired: try again at a later kick
+        return;
+    }
+
+    if (LE_SYNC_BOOL_COMPARE_AND_SWAP(&KickSlotPtr, slotPtr, NULL))
+    {
+        LE_ATOMIC_OR_FETCH(&KickSlotUsers, KICK_SLOT_RETIRED, LE_ATOMIC_ORDER_ACQ_REL);
+    }
+    else
+    {
+        RetiredKickSlotPtr = NULL;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release a use of the kick slot.  The last use unmaps the retired kick slot, if any.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReleaseKickSlot
+(
+    void
+)
+{
+    // Kicks starting from now can't get the retired slot, so only one of them may unmap it
+    if ((KICK_SLOT_RETIRED == LE_ATOMIC_SUB_FETCH(&KickSlotUsers, 1, LE_ATOMIC_ORDER_ACQ_REL)) &&
+        LE_SYNC_BOOL_COMPARE_AND_SWAP(&KickSlotUsers, KICK_SLOT_RETIRED, 0))
+    {
+        void* slotPtr = (void*)RetiredKickSlotPtr;
+
+        RetiredKickSlotPtr = NULL;
+        munmap(slotPtr, LE_WDOG_KICK_SLOT_WORDS * sizeof(uint32_t));
+    }
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kick the process watchdog, through the kick slot if there is one which is still watched by the
+ * watchdog daemon, through IPC otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static void KickProcessWatchdog
+(
+    void
+)
+{
+#if LE_CONFIG_LINUX
+    // Hold a use of the kick slot, so that it is not unmapped while storing into it
+    LE_ATOMIC_ADD_FETCH(&KickSlotUsers, 1, LE_ATOMIC_ORDER_ACQ_REL);
+
+    volatile uint32_t* slotPtr = KickSlotPtr;
+
+    if (slotPtr != NULL)
+    {
+        if (slotPtr[LE_WDOG_KICK_SLOT_ACTIVE])
+        {
+            le_clk_Time_t now = le_clk_GetRelativeTime();
+
+            slotPtr[LE_WDOG_KICK_SLOT_TIME] = (uint32_t)((uint64_t)now.sec * 1000 +
+                                                         now.usec / 1000);
+            ReleaseKickSlot();
+            return;
+        }
+
+        // The daemon dropped our watchdog (e.g., it expired).  Go back to IPC so the kick
+        // creates a new watchdog, and get a new slot for it.  The old mapping is unmapped once
+        // the other threads are done storing into it.
+        RetireKickSlot(slotPtr);
+    }
+
+    ReleaseKickSlot();
+
+    le_wdog_Kick();
+
+    if (ShouldGetKickSlot && (KickSlotPtr == NULL))
+    {
+        OpenKickSlot();
+    }
+#else
+    le_wdog_Kick();
+#endif
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Check if the watchdog chain is all kicked, and if so kick the process watchdog.
@@ -298,7 +486,7 @@ static void CheckChain
         // a problem.
         TRACE("Complete watchdog chain kicked, kicking watchdog.");
 
-        le_wdog_Kick();
+        KickProcessWatchdog();
         MarkAllUnkicked();
     }
 }
@@ -45,6 +45,12 @@ typedef enum
     LE_SDTP_MSGID_BIND,             ///< Create one binding.  The payload is the binding details.
                                     ///  If the Service Directory runs into an error, it will
                                     ///  drop the connection to the sdir tool without responding.
+
+    LE_SDTP_MSGID_STATS,            ///< Dump the timing counters and index sizes of the Service
+                                    ///  Directory.  Payload is a file descriptor to which output
+                                    ///  should be written.
+
+    LE_SDTP_MSGID_STATS_JSON,       ///< Same as LE_SDTP_MSGID_STATS, but the output in json format.
 }
 le_sdtp_MsgType_t;
 
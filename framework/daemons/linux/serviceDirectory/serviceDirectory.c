@@ -6,6 +6,7 @@
  * @ref sd_toolService <br>
  * @ref sd_data <br>
  * @ref sd_theoryOfOperation <br>
+ * @ref sd_statistics <br>
  * @ref sd_deathDetection <br>
  * @ref sd_threading <br>
  * @ref sd_startUpSync <br>
@@ -98,26 +99,34 @@ User List ------> User --+---> Name               |        |        |
  * Each Binding object and Connection object holds a reference count on a User object.  A User
  * object will be deleted when all associated Binding objects and Connection objects are deleted.
  *
+ * Alongside the lists, two hash indices are kept so that the lookups done on every session open
+ * don't have to walk the lists:
+ *  - the Binding Index, keyed by client user ID and client-side interface name, and
+ *  - the Service Index, keyed by server user ID and service name.
+ *
+ * The Service Index holds Service objects.  A Service object exists as long as a binding points
+ * to it or a server advertises it, and keeps track of the Server Connection that currently
+ * serves it (if any) and of the list of Binding objects that point to it.  Each Binding object
+ * and each advertised Server Connection object holds a reference count on its Service object.
+ *
  *
  * @section sd_theoryOfOperation Theory of Operation
  *
  * When a client connects and makes a request to open a service, the client's UID is looked up in
- * the User List.  The client User's Binding List is searched for the interface name provided by
- * the client.  If a matching Binding object is not found, the Client Connection object is added
- * to the User object's Unbound Clients List.  If a matching Binding object is found, it will
- * specify the server User object and service name.  The server's User's Service List will be
- * searched for a matching Server Connection object.  If no matching Server Connection can be
- * found, the Client Connection is added to the Binding object's Waiting Clients List.
+ * the User List.  The Binding Index is searched for the client's UID and the interface name
+ * provided by the client.  If a matching Binding object is not found, the Client Connection object
+ * is added to the User object's Unbound Clients List.  If a matching Binding object is found, its
+ * Service object tells whether a Server Connection currently serves the service.  If not, the
+ * Client Connection is added to the Binding object's Waiting Clients List.
  *
  * When a server connects and advertises a service, the server UID is looked-up in the User List.
- * The service name is then searched for in the Service List for that User.  If a Server Connection
- * object is not found for that service name on that User, the new one is is added to the list.
- * Otherwise, the new server connection is dropped.
+ * The server UID and service name are then searched for in the Service Index.  If no Server
+ * Connection currently serves that service, the new one is added to the User's Service List and
+ * attached to the Service object.  Otherwise, the new server connection is dropped.
  *
- * When a new Server Connection is added to a Service List, all users' Binding Lists are
- * searched for matching bindings, and if any that match have non-empty Waiting Clients Lists,
- * all those Client Connections are removed from those lists and dispatched to the new Server
- * Connection.
+ * When a new Server Connection is attached to a Service object, the Bindings that point to that
+ * Service are checked, and if any have non-empty Waiting Clients Lists, all those Client
+ * Connections are removed from those lists and dispatched to the new Server Connection.
  *
  * When a Binding is added, it is added to the client's User object's Binding List.  That user's
  * Unbound Clients List will then be checked for matches to the new binding, and if any are found,
@@ -134,6 +143,13 @@ User List ------> User --+---> Name               |        |        |
  * be changed.)
  *
  *
+ * @section sd_statistics           Statistics
+ *
+ * The time spent in each phase of session opening and service advertisement is accumulated in
+ * per-phase counters (number of times, total and maximum time).  The @c sdir tool dumps them,
+ * with the sizes of the indices, using the @c stats command.
+ *
+ *
  * @section sd_deathDetection       Detection of Client or Server Death
  *
  * When a client or server process dies while it is connected to the Service Directory, the OS
@@ -220,6 +236,26 @@ User List ------> User --+---> Name               |        |        |
 #define MAX_CONNECT_REQUEST_BACKLOG 100
 
 
+//--------------------------------------------------------------------------------------------------
+/// Number of buckets in the Binding Index and the Service Index.
+//--------------------------------------------------------------------------------------------------
+#define INDEX_HASHMAP_SIZE 63
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key of the Binding Index and of the Service Index.  The name is stored in the indexed object
+ * itself.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uid_t       uid;                    ///< Unix user ID of the client (or server).
+    const char* namePtr;                ///< Client interface name (or service name).
+}
+IndexKey_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Represents a user.  Objects of this type are allocated from the User Pool and are kept on the
@@ -265,6 +301,7 @@ typedef struct
     User_t*                     userPtr;        ///< Pointer to the User object for the client uid.
     pid_t                       pid;            ///< Process ID of client process.
     svcdir_InterfaceDetails_t   interface;      ///< IPC interface details.
+    struct Service*             servicePtr;     ///< Service served (NULL if not advertised yet).
 }
 ServerConnection_t;
 
@@ -275,6 +312,35 @@ ServerConnection_t;
 static le_mem_PoolRef_t ServerConnectionPoolRef;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Represents a service offered by a given user, which is either pointed to by bindings or
+ * advertised by a server, or both.  Objects of this type are allocated from the Service Pool and
+ * are kept in the Service Index.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct Service
+{
+    IndexKey_t          key;                ///< Key in the Service Index.
+    char                name[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES]; ///< Service name.
+    ServerConnection_t* serverConnectionPtr;///< Ptr to Server Connection (NULL if service unavail.)
+    le_dls_List_t       bindingList;        ///< List of Bindings pointing to this service.
+}
+Service_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/// Pool from which Service objects are allocated.
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ServicePoolRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/// The Service Index, in which all Service objects are kept, keyed by server UID and service name.
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t ServiceIndexRef;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Represents a binding from a user's client interface to a service.  Objects of this type are
@@ -284,11 +350,13 @@ static le_mem_PoolRef_t ServerConnectionPoolRef;
 typedef struct
 {
     le_dls_Link_t       link;               ///< Used to link into the User's Binding List.
+    IndexKey_t          key;                ///< Key in the Binding Index.
     User_t*             clientUserPtr;      ///< Ptr to the client User whose Binding List I'm in.
     User_t*             serverUserPtr;      ///< Ptr to the User who serves the service.
     char                clientInterfaceName[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES];///< Client I/F name
     char                serverInterfaceName[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES];///< Service name
-    ServerConnection_t* serverConnectionPtr;///< Ptr to Server Connection (NULL if service unavail.)
+    Service_t*          servicePtr;         ///< Ptr to the Service the binding points to.
+    le_dls_Link_t       serviceLink;        ///< Used to link into the Service's Binding List.
     le_dls_List_t       waitingClientsList; ///< List of Client Connections waiting for the service.
 }
 Binding_t;
@@ -300,6 +368,12 @@ Binding_t;
 static le_mem_PoolRef_t BindingPoolRef;
 
 
+//--------------------------------------------------------------------------------------------------
+/// The Binding Index, in which all Binding objects are kept, keyed by client UID and interface name.
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t BindingIndexRef;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Enumeration of the different states that a client connection can be in.
@@ -364,12 +438,127 @@ static le_fdMonitor_Ref_t ClientSocketMonitorRef;
 static le_fdMonitor_Ref_t ServerSocketMonitorRef;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Phases of session opening and service advertisement which are timed.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    PHASE_OPEN_RECEIVE,         ///< Receiving an "Open" request from a client.
+    PHASE_OPEN_LOOKUP,          ///< Looking up the binding of a client interface.
+    PHASE_OPEN_DISPATCH,        ///< Following a binding (dispatching or queueing the client).
+    PHASE_ADVERTISE,            ///< Processing a service advertisement, incl. waiting clients.
+    PHASE_BIND,                 ///< Creating a binding, incl. unbound clients.
+    PHASE_COUNT                 ///< Number of phases.  Must be last.
+}
+Phase_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Counters accumulated for a phase.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint64_t    count;                  ///< Number of times the phase ran.
+    uint64_t    totalUsec;              ///< Total time spent in the phase (microseconds).
+    uint64_t    maxUsec;                ///< Longest time spent in the phase (microseconds).
+}
+PhaseStats_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/// Counters of each phase, indexed by Phase_t.
+//--------------------------------------------------------------------------------------------------
+static PhaseStats_t PhaseStats[PHASE_COUNT];
+
+
+//--------------------------------------------------------------------------------------------------
+/// Names of the phases, as printed by the 'sdir' tool, indexed by Phase_t.
+//--------------------------------------------------------------------------------------------------
+static const char* const PhaseNames[PHASE_COUNT] =
+{
+    [PHASE_OPEN_RECEIVE]  = "openReceive",
+    [PHASE_OPEN_LOOKUP]   = "openLookup",
+    [PHASE_OPEN_DISPATCH] = "openDispatch",
+    [PHASE_ADVERTISE]     = "advertise",
+    [PHASE_BIND]          = "bind",
+};
+
+
 
 // =======================================
 //  FUNCTIONS
 // =======================================
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key hash function for the Binding Index and the Service Index.
+ *
+ * @return  The hash value for a user ID and name (the key).
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t ComputeIndexKeyHash
+(
+    const void* keyPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const IndexKey_t* indexKeyPtr = keyPtr;
+
+    return (le_hashmap_HashString(indexKeyPtr->namePtr) * 31) + indexKeyPtr->uid;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key equality comparison function for the Binding Index and the Service Index.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool AreIndexKeysTheSame
+(
+    const void* firstKeyPtr,
+    const void* secondKeyPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const IndexKey_t* firstIndexKeyPtr = firstKeyPtr;
+    const IndexKey_t* secondIndexKeyPtr = secondKeyPtr;
+
+    return (   (firstIndexKeyPtr->uid == secondIndexKeyPtr->uid)
+            && le_hashmap_EqualsString(firstIndexKeyPtr->namePtr, secondIndexKeyPtr->namePtr) );
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds the time elapsed since a given start time to the counters of a phase.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RecordPhase
+(
+    Phase_t phase,              ///< [in] The phase that just ended.
+    le_clk_Time_t startTime     ///< [in] Relative time at which the phase started.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+    uint64_t usec = ((uint64_t)elapsed.sec * 1000000) + elapsed.usec;
+    PhaseStats_t* statsPtr = &PhaseStats[phase];
+
+    statsPtr->count++;
+    statsPtr->totalUsec += usec;
+
+    if (usec > statsPtr->maxUsec)
+    {
+        statsPtr->maxUsec = usec;
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Creates a User object for a given Unix user ID.
@@ -460,7 +649,7 @@ static void UserDestructor
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Searches a (client) User's Binding List for a particular client-side interface name.
+ * Searches the Binding Index for a particular (client) User's client-side interface name.
  *
  * @return Pointer to the Binding object or NULL if not found.
  **/
@@ -472,21 +661,9 @@ static Binding_t* FindBinding
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_dls_Link_t* linkPtr = le_dls_Peek(&userPtr->bindingList);
+    IndexKey_t key = { .uid = userPtr->uid, .namePtr = interfaceName };
 
-    while (linkPtr != NULL)
-    {
-        Binding_t* bindingPtr = CONTAINER_OF(linkPtr, Binding_t, link);
-
-        if (strcmp(bindingPtr->clientInterfaceName, interfaceName) == 0)
-        {
-            return bindingPtr;
-        }
-
-        linkPtr = le_dls_PeekNext(&userPtr->bindingList, linkPtr);
-    }
-
-    return NULL;
+    return le_hashmap_Get(BindingIndexRef, &key);
 }
 
 
@@ -597,9 +774,10 @@ static le_result_t ReceiveMessage
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Searches a User's Service List for a particular service name.
+ * Searches the Service Index for a particular User's service name.
  *
- * @return Pointer to the Server Connection object for the matching service.
+ * @return Pointer to the Server Connection object for the matching service, or NULL if the
+ *         service isn't currently served.
  **/
 //--------------------------------------------------------------------------------------------------
 static ServerConnection_t* FindService
@@ -609,21 +787,74 @@ static ServerConnection_t* FindService
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_dls_Link_t* linkPtr = le_dls_Peek(&userPtr->serviceList);
+    IndexKey_t key = { .uid = userPtr->uid, .namePtr = serviceName };
+    Service_t* servicePtr = le_hashmap_Get(ServiceIndexRef, &key);
 
-    while (linkPtr != NULL)
+    if (servicePtr == NULL)
     {
-        ServerConnection_t* serverConnectionPtr = CONTAINER_OF(linkPtr, ServerConnection_t, link);
+        return NULL;
+    }
 
-        if (strcmp(serverConnectionPtr->interface.interfaceName, serviceName) == 0)
-        {
-            return serverConnectionPtr;
-        }
+    return servicePtr->serverConnectionPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Searches the Service Index for a particular User's service name.  If found, increments the
+ * reference count on that object.  If not found, creates a new Service object.
+ *
+ * @return Pointer to the Service object.
+ **/
+//--------------------------------------------------------------------------------------------------
+static Service_t* GetService
+(
+    const User_t* userPtr,      ///< [in] Ptr to the User object serving the service.
+    const char* serviceName     ///< [in] Service name string.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    IndexKey_t key = { .uid = userPtr->uid, .namePtr = serviceName };
+    Service_t* servicePtr = le_hashmap_Get(ServiceIndexRef, &key);
 
-        linkPtr = le_dls_PeekNext(&userPtr->serviceList, linkPtr);
+    if (servicePtr != NULL)
+    {
+        le_mem_AddRef(servicePtr);
+        return servicePtr;
     }
 
-    return NULL;
+    servicePtr = le_mem_ForceAlloc(ServicePoolRef);
+
+    // Note: we know the service name is a valid length.
+    le_utf8_Copy(servicePtr->name, serviceName, sizeof(servicePtr->name), NULL);
+
+    servicePtr->key.uid = userPtr->uid;
+    servicePtr->key.namePtr = servicePtr->name;
+    servicePtr->serverConnectionPtr = NULL;
+    servicePtr->bindingList = LE_DLS_LIST_INIT;
+
+    le_hashmap_Put(ServiceIndexRef, &servicePtr->key, servicePtr);
+
+    return servicePtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor function that runs when a Service object's reference count reaches zero and
+ * the object is about to be released back into its pool.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ServiceDestructor
+(
+    void* objPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Service_t* servicePtr = objPtr;
+
+    // Remove the Service object from the Service Index.
+    le_hashmap_Remove(ServiceIndexRef, &servicePtr->key);
 }
 
 
@@ -803,9 +1034,9 @@ static void FollowBinding
     le_dls_Queue(&bindingPtr->waitingClientsList, &clientConnectionPtr->link);
 
     // If the service is available,
-    if (bindingPtr->serverConnectionPtr != NULL)
+    if (bindingPtr->servicePtr->serverConnectionPtr != NULL)
     {
-        DispatchToServer(clientConnectionPtr, bindingPtr->serverConnectionPtr);
+        DispatchToServer(clientConnectionPtr, bindingPtr->servicePtr->serverConnectionPtr);
         // Note: DispatchToServer() requires that the client connection be in the waiting state.
     }
     // If the service is not available and the client wants to wait for it, just leave the
@@ -847,6 +1078,8 @@ static void CreateBinding
 )
 //--------------------------------------------------------------------------------------------------
 {
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
     // Get references to the client and server User objects.
     // NOTE: This increments the reference counts on these objects.
     User_t* clientUserPtr = GetUser(clientUserId);
@@ -867,6 +1100,7 @@ static void CreateBinding
                     serverInterfaceName);
             le_mem_Release(clientUserPtr);
             le_mem_Release(serverUserPtr);
+            RecordPhase(PHASE_BIND, startTime);
             return;
         }
 
@@ -914,14 +1148,18 @@ static void CreateBinding
     bindingPtr->clientUserPtr = clientUserPtr;
     bindingPtr->serverUserPtr = serverUserPtr;
 
-    bindingPtr->serverConnectionPtr = NULL;
     bindingPtr->waitingClientsList = LE_DLS_LIST_INIT;
 
-    // Add the Binding to the client User's Binding List.
+    // Add the Binding to the client User's Binding List and to the Binding Index.
     le_dls_Queue(&bindingPtr->clientUserPtr->bindingList, &bindingPtr->link);
+    bindingPtr->key.uid = clientUserPtr->uid;
+    bindingPtr->key.namePtr = bindingPtr->clientInterfaceName;
+    le_hashmap_Put(BindingIndexRef, &bindingPtr->key, bindingPtr);
 
-    // Look for a server serving the binding's destination service.
-    bindingPtr->serverConnectionPtr = FindService(bindingPtr->serverUserPtr, serverInterfaceName);
+    // Attach the Binding to its destination service, which tells if a server is serving it.
+    bindingPtr->servicePtr = GetService(bindingPtr->serverUserPtr, serverInterfaceName);
+    bindingPtr->serviceLink = LE_DLS_LINK_INIT;
+    le_dls_Queue(&bindingPtr->servicePtr->bindingList, &bindingPtr->serviceLink);
 
     // Check for unbound client connections that match the new binding.
     le_dls_List_t* unboundClientsListPtr = &(bindingPtr->clientUserPtr->unboundClientsList);
@@ -944,6 +1182,8 @@ static void CreateBinding
             FollowBinding(bindingPtr, clientConnectionPtr, true /* shouldWait */ );
         }
     }
+
+    RecordPhase(PHASE_BIND, startTime);
 }
 
 
@@ -988,8 +1228,8 @@ static void CreateHardCodedBindings
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Search for and associate bindings that refer to this service and dispatch any
- * waiting clients to the new server.
+ * Dispatch the waiting clients of all the bindings that refer to a server's service to that
+ * server.
  */
 //--------------------------------------------------------------------------------------------------
 static void ResolveBindingsToServer
@@ -998,51 +1238,35 @@ static void ResolveBindingsToServer
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // For each user,
-    le_dls_Link_t* userLinkPtr = le_dls_Peek(&UserList);
+    le_dls_List_t* bindingListPtr = &connectionPtr->servicePtr->bindingList;
 
-    while (userLinkPtr != NULL)
+    // For each of the bindings pointing at the new server's service,
+    le_dls_Link_t* bindingLinkPtr = le_dls_Peek(bindingListPtr);
+    while (bindingLinkPtr != NULL)
     {
-        User_t* userPtr = CONTAINER_OF(userLinkPtr, User_t, link);
+        Binding_t* bindingPtr = CONTAINER_OF(bindingLinkPtr, Binding_t, serviceLink);
 
-        // For each of the user's bindings,
-        le_dls_Link_t* bindingLinkPtr = le_dls_Peek(&userPtr->bindingList);
-        while (bindingLinkPtr != NULL)
+        // While there's still a client connection on the Waiting Clients List, get
+        // a pointer to the first one, without removing it from the list, then try
+        // to dispatch that client to the server.
+        le_dls_Link_t* clientLinkPtr;
+        while (NULL != (clientLinkPtr = le_dls_Peek(&bindingPtr->waitingClientsList)))
         {
-            Binding_t* bindingPtr = CONTAINER_OF(bindingLinkPtr, Binding_t, link);
-
-            // If the binding is pointing at the new server's service,
-            if (   (connectionPtr->userPtr == bindingPtr->serverUserPtr)
-                && (0 == strcmp(connectionPtr->interface.interfaceName,
-                                bindingPtr->serverInterfaceName))  )
+            ClientConnection_t* clientConnectionPtr = CONTAINER_OF(clientLinkPtr,
+                                                                   ClientConnection_t,
+                                                                   link);
+            if (DispatchToServer(clientConnectionPtr, connectionPtr) == LE_CLOSED)
             {
-                bindingPtr->serverConnectionPtr = connectionPtr;
-
-                // While there's still a client connection on the Waiting Clients List, get
-                // a pointer to the first one, without removing it from the list, then try
-                // to dispatch that client to the server.
-                le_dls_Link_t* clientLinkPtr;
-                while (NULL != (clientLinkPtr = le_dls_Peek(&bindingPtr->waitingClientsList)))
-                {
-                    ClientConnection_t* clientConnectionPtr = CONTAINER_OF(clientLinkPtr,
-                                                                           ClientConnection_t,
-                                                                           link);
-                    if (DispatchToServer(clientConnectionPtr, connectionPtr) == LE_CLOSED)
-                    {
-                        // Server went down.  Client was left on the Waiting Clients List.
-                        // Server Connection destructor was run and it disconnected itself
-                        // from the Binding object.
-                        return;
-                    }
-                    // NOTE: If the server didn't go down, then the Client Connection has been
-                    // deleted and its destructor removed it from the Waiting Clients List.
-                }
+                // Server went down.  Client was left on the Waiting Clients List.
+                // Server Connection destructor was run and it detached itself
+                // from the Service object.
+                return;
             }
-
-            bindingLinkPtr = le_dls_PeekNext(&userPtr->bindingList, bindingLinkPtr);
+            // NOTE: If the server didn't go down, then the Client Connection has been
+            // deleted and its destructor removed it from the Waiting Clients List.
         }
 
-        userLinkPtr = le_dls_PeekNext(&UserList, userLinkPtr);
+        bindingLinkPtr = le_dls_PeekNext(bindingListPtr, bindingLinkPtr);
     }
 }
 
@@ -1060,6 +1284,8 @@ static void ProcessAdvertisementFromServer
 )
 //--------------------------------------------------------------------------------------------------
 {
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
     // Check for a server already serving this same service.
     if (IsDuplicateService(connectionPtr))
     {
@@ -1076,8 +1302,11 @@ static void ProcessAdvertisementFromServer
     // connection to the service list.
     else
     {
-        // Add the object to the User's Service List.
+        // Add the object to the User's Service List and attach it to the Service object.
         le_dls_Queue(&connectionPtr->userPtr->serviceList, &connectionPtr->link);
+        connectionPtr->servicePtr = GetService(connectionPtr->userPtr,
+                                               connectionPtr->interface.interfaceName);
+        connectionPtr->servicePtr->serverConnectionPtr = connectionPtr;
 
         LE_DEBUG("Server (uid %u '%s', pid %d) now serving service '%s' (%s).",
                  connectionPtr->userPtr->uid,
@@ -1086,10 +1315,11 @@ static void ProcessAdvertisementFromServer
                  connectionPtr->interface.interfaceName,
                  connectionPtr->interface.protocolId);
 
-        // Search for and associate bindings that refer to this service and dispatch any
-        // waiting clients to the new server.
+        // Dispatch any clients waiting on bindings that refer to this service to the new server.
         ResolveBindingsToServer(connectionPtr);
     }
+
+    RecordPhase(PHASE_ADVERTISE, startTime);
 }
 
 
@@ -1163,14 +1393,18 @@ static void ProcessOpenRequestFromClient
              connectionPtr->interface.interfaceName,
              connectionPtr->interface.protocolId);
 
-    // Look up the client's service name in the client User's Binding List.
+    // Look up the client's service name in the Binding Index.
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
     Binding_t* bindingPtr = FindBinding(connectionPtr->userPtr,
                                         connectionPtr->interface.interfaceName);
+    RecordPhase(PHASE_OPEN_LOOKUP, startTime);
 
     // If a matching binding was found, follow it.
     if (bindingPtr != NULL)
     {
+        startTime = le_clk_GetRelativeTime();
         FollowBinding(bindingPtr, connectionPtr, shouldWait);
+        RecordPhase(PHASE_OPEN_DISPATCH, startTime);
     }
     // If not found,
     else
@@ -1217,7 +1451,9 @@ static void ClientReadHandler
 
     // Receive the "Open" request from the client.
     svcdir_OpenRequest_t msg;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
     result = ReceiveMessage(fd, &msg, sizeof(msg));
+    RecordPhase(PHASE_OPEN_RECEIVE, startTime);
 
     // If the connection has closed or there is simply nothing left to be received
     // from the socket,
@@ -1607,6 +1843,7 @@ static void CreateServerConnection
     connectionPtr->fd = fd;
     connectionPtr->userPtr = GetUser(uid);
     connectionPtr->pid = pid;
+    connectionPtr->servicePtr = NULL;
 
     // Haven't received ID yet, so clear it out.
     memset(&connectionPtr->interface, 0, sizeof(connectionPtr->interface));
@@ -1638,31 +1875,13 @@ static void ServerConnectionDestructor
 {
     ServerConnection_t* connectionPtr = objPtr;
 
-    // Disassociate the Server Connection object from all Binding objects that refer to it...
-
-    // For each user,
-    le_dls_Link_t* userLinkPtr = le_dls_Peek(&UserList);
-
-    while (userLinkPtr != NULL)
+    // Detach the Server Connection object from the Service object (and so from all Binding objects
+    // that refer to it).
+    if (connectionPtr->servicePtr != NULL)
     {
-        User_t* userPtr = CONTAINER_OF(userLinkPtr, User_t, link);
-
-        // For each of the user's bindings,
-        le_dls_Link_t* bindingLinkPtr = le_dls_Peek(&userPtr->bindingList);
-        while (bindingLinkPtr != NULL)
-        {
-            Binding_t* bindingPtr = CONTAINER_OF(bindingLinkPtr, Binding_t, link);
-
-            // If the binding is associated with the deleted server connection,
-            if (connectionPtr == bindingPtr->serverConnectionPtr)
-            {
-                bindingPtr->serverConnectionPtr = NULL;
-            }
-
-            bindingLinkPtr = le_dls_PeekNext(&userPtr->bindingList, bindingLinkPtr);
-        }
-
-        userLinkPtr = le_dls_PeekNext(&UserList, userLinkPtr);
+        connectionPtr->servicePtr->serverConnectionPtr = NULL;
+        le_mem_Release(connectionPtr->servicePtr);
+        connectionPtr->servicePtr = NULL;
     }
 
     if (connectionPtr->interface.interfaceName[0] == '\0')
@@ -1777,8 +1996,9 @@ static void BindingDestructor
 {
     Binding_t* bindingPtr = objPtr;
 
-    // Remove the Binding object from the User's Binding List.
+    // Remove the Binding object from the User's Binding List and from the Binding Index.
     le_dls_Remove(&bindingPtr->clientUserPtr->bindingList, &bindingPtr->link);
+    le_hashmap_Remove(BindingIndexRef, &bindingPtr->key);
 
     // While the list of waiting clients is not empty, pop one off and process it.
     le_dls_Link_t* linkPtr;
@@ -1791,6 +2011,11 @@ static void BindingDestructor
         ProcessOpenRequestFromClient(clientConnectionPtr, true /* shouldWait */ );
     }
 
+    // Detach the Binding from its Service object and release the Binding's reference count on it.
+    le_dls_Remove(&bindingPtr->servicePtr->bindingList, &bindingPtr->serviceLink);
+    le_mem_Release(bindingPtr->servicePtr);
+    bindingPtr->servicePtr = NULL;
+
     // Release the Binding's reference count on the client's User object.
     le_mem_Release(bindingPtr->clientUserPtr);
     bindingPtr->clientUserPtr = NULL;
@@ -2397,6 +2622,104 @@ static void SdirToolListJson
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles the "Stats" request from the 'sdir' tool. Dumps output in human readable format.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SdirToolStats
+(
+    int fd      ///< [in] The file descriptor to write the output to.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (fd == -1)
+    {
+        LE_KILL_CLIENT("No output fd provided.");
+    }
+    else
+    {
+        int phase;
+
+        dprintf(fd, "\nPHASES\n\n");
+
+        dprintf(fd, "        %-14s %10s %14s %10s %10s\n",
+                "PHASE", "COUNT", "TOTAL (us)", "AVG (us)", "MAX (us)");
+
+        for (phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            const PhaseStats_t* statsPtr = &PhaseStats[phase];
+
+            dprintf(fd, "        %-14s %10" PRIu64 " %14" PRIu64 " %10" PRIu64 " %10" PRIu64 "\n",
+                    PhaseNames[phase],
+                    statsPtr->count,
+                    statsPtr->totalUsec,
+                    (statsPtr->count == 0) ? 0 : (statsPtr->totalUsec / statsPtr->count),
+                    statsPtr->maxUsec);
+        }
+
+        dprintf(fd, "\nINDICES\n\n");
+
+        dprintf(fd, "        bindings: %zu\n", le_hashmap_Size(BindingIndexRef));
+        dprintf(fd, "        services: %zu\n", le_hashmap_Size(ServiceIndexRef));
+
+        dprintf(fd, "\n");
+
+        fd_Close(fd);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles the "Stats" request from the 'sdir' tool. Dumps output in json format.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SdirToolStatsJson
+(
+    int fd      ///< [in] The file descriptor to write the output to.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (fd == -1)
+    {
+        LE_KILL_CLIENT("No output fd provided.");
+    }
+    else
+    {
+        int phase;
+
+        dprintf(fd, "{\"phases\":[");
+
+        for (phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            const PhaseStats_t* statsPtr = &PhaseStats[phase];
+
+            dprintf(fd, "%s{"
+                        "\"phase\":\"%s\","
+                        "\"count\":%" PRIu64 ","
+                        "\"totalUs\":%" PRIu64 ","
+                        "\"maxUs\":%" PRIu64
+                        "}",
+                        (phase == 0) ? "" : ",",
+                        PhaseNames[phase],
+                        statsPtr->count,
+                        statsPtr->totalUsec,
+                        statsPtr->maxUsec);
+        }
+
+        dprintf(fd, "],"
+                    "\"bindings\":%zu,"
+                    "\"services\":%zu"
+                    "}\n",
+                    le_hashmap_Size(BindingIndexRef),
+                    le_hashmap_Size(ServiceIndexRef));
+
+        fd_Close(fd);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Handles an "Unbind All" request from the 'sdir' tool.
@@ -2516,6 +2839,16 @@ static void SdirToolRecv
             SdirToolBind(msgPtr);
             break;
 
+        case LE_SDTP_MSGID_STATS:
+
+            SdirToolStats(le_msg_GetFd(msgRef));
+            break;
+
+        case LE_SDTP_MSGID_STATS_JSON:
+
+            SdirToolStatsJson(le_msg_GetFd(msgRef));
+            break;
+
         default:
             LE_KILL_CLIENT("Invalid message ID %d.", msgPtr->msgType);
             break;
@@ -2563,6 +2896,7 @@ COMPONENT_INIT
     ServerConnectionPoolRef = le_mem_CreatePool("Server Connection", sizeof(ServerConnection_t));
     UserPoolRef = le_mem_CreatePool("User", sizeof(User_t));
     BindingPoolRef = le_mem_CreatePool("Binding", sizeof(Binding_t));
+    ServicePoolRef = le_mem_CreatePool("Service", sizeof(Service_t));
 
     /// Expand the pools to their expected maximum sizes.
     /// @todo Make this configurable.
@@ -2570,12 +2904,24 @@ COMPONENT_INIT
     le_mem_ExpandPool(ServerConnectionPoolRef, 30);
     le_mem_ExpandPool(UserPoolRef, 30);
     le_mem_ExpandPool(BindingPoolRef, 30);
+    le_mem_ExpandPool(ServicePoolRef, 30);
 
     // Register destructor functions.
     le_mem_SetDestructor(ClientConnectionPoolRef, ClientConnectionDestructor);
     le_mem_SetDestructor(ServerConnectionPoolRef, ServerConnectionDestructor);
     le_mem_SetDestructor(UserPoolRef, UserDestructor);
     le_mem_SetDestructor(BindingPoolRef, BindingDestructor);
+    le_mem_SetDestructor(ServicePoolRef, ServiceDestructor);
+
+    // Create the indices.
+    BindingIndexRef = le_hashmap_Create("Binding Index",
+                                        INDEX_HASHMAP_SIZE,
+                                        ComputeIndexKeyHash,
+                                        AreIndexKeysTheSame);
+    ServiceIndexRef = le_hashmap_Create("Service Index",
+                                        INDEX_HASHMAP_SIZE,
+                                        ComputeIndexKeyHash,
+                                        AreIndexKeysTheSame);
 
     // Create built-in, hard-coded bindings.
     CreateHardCodedBindings();
@@ -355,6 +355,7 @@ typedef struct app_Ref
     le_sls_List_t   additionalLinks;    // List of additional links that are temporarily added to
                                         // the app.
     le_sls_List_t   reqModuleName;      // List of required kernel module names
+    bool            isAreaReady;        // true if the app area has been set up ahead of app_Start()
 }
 App_t;
 
@@ -2853,6 +2854,51 @@ static le_result_t SetupAppArea
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets up everything in the file system that the app's processes need: the app area and, for
+ * sandboxed apps, the app's /tmp and the links in it.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t PrepareAppArea
+(
+    app_Ref_t appRef                    ///< [IN] The application reference.
+)
+{
+    if (SetupAppArea(appRef) != LE_OK)
+    {
+        LE_ERROR("Failed to set up app area.");
+        return LE_FAULT;
+    }
+
+    // Create /tmp for sandboxed apps and link in /tmp files.
+    if (appRef->sandboxed)
+    {
+        // Get the SMACK label for the folders we create.
+        char appDirLabel[LIMIT_MAX_SMACK_LABEL_BYTES];
+        smack_GetAppAccessLabel(app_GetName(appRef), S_IRWXU, appDirLabel, sizeof(appDirLabel));
+
+        // Create the app's /tmp for sandboxed apps.
+        if (CreateTmpFs(appRef, appDirLabel) != LE_OK)
+        {
+            return LE_FAULT;
+        }
+
+        // Create default links.
+        if (CreateDefaultTmpLinks(appRef, appDirLabel) != LE_OK)
+        {
+            return LE_FAULT;
+        }
+    }
+
+    return LE_OK;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Checks whether the destination path conflicts with anything under the specified working
@@ -3473,6 +3519,10 @@ le_result_t app_Start
 
     bool moduleLoadFailed = false;
 
+    // An area prepared ahead of time is only good for this start attempt.
+    bool isAreaReady = appRef->isAreaReady;
+    appRef->isAreaReady = false;
+
     if (appRef->state == APP_STATE_RUNNING)
     {
         LE_ERROR("Application '%s' is already running.", appRef->name);
@@ -3497,32 +3547,16 @@ le_result_t app_Start
     appRef->state = APP_STATE_RUNNING;
 
     // Set SMACK rules for this app.
-    // Setup the runtime area in the file system.
-    if ( (SetSmackRules(appRef) != LE_OK) ||
-         (SetupAppArea(appRef) != LE_OK) )
+    if (SetSmackRules(appRef) != LE_OK)
     {
-        LE_ERROR("Failed to set Smack rules or set up app area.");
+        LE_ERROR("Failed to set Smack rules.");
         return LE_FAULT;
     }
 
-    // Create /tmp for sandboxed apps and link in /tmp files.
-    if (appRef->sandboxed)
+    // Setup the runtime area in the file system, unless app_PrepareArea() just did.
+    if (!isAreaReady && (PrepareAppArea(appRef) != LE_OK))
     {
-        // Get the SMACK label for the folders we create.
-        char appDirLabel[LIMIT_MAX_SMACK_LABEL_BYTES];
-        smack_GetAppAccessLabel(app_GetName(appRef), S_IRWXU, appDirLabel, sizeof(appDirLabel));
-
-        // Create the app's /tmp for sandboxed apps.
-        if (CreateTmpFs(appRef, appDirLabel) != LE_OK)
-        {
-            return LE_FAULT;
-        }
-
-        // Create default links.
-        if (CreateDefaultTmpLinks(appRef, appDirLabel) != LE_OK)
-        {
-            return LE_FAULT;
-        }
+        return LE_FAULT;
     }
 
     // Start all the processes in the application.
@@ -3582,6 +3616,91 @@ le_result_t app_Start
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets up an application's area in the file system ahead of app_Start(), which then only sets
+ * the SMACK rules and starts the processes.
+ *
+ * Only touches the file system, the config tree and the application object itself, so it can be
+ * called from a thread other than the Supervisor's main thread, as long as that thread is
+ * connected to the config tree and nothing else uses the application object meanwhile.
+ *
+ * Apps requiring kernel modules, directories or files are not prepared: their required devices
+ * may only appear once app_Start() has loaded the modules, and the required directories and files
+ * may be created by the apps started before them.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_UNAVAILABLE if the app area can only be set up by app_Start().
+ *      LE_FAULT if there was an error.  app_Start() will retry.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t app_PrepareArea
+(
+    app_Ref_t appRef                    ///< [IN] Reference to the application to prepare.
+)
+{
+    if (appRef->state == APP_STATE_RUNNING)
+    {
+        return LE_UNAVAILABLE;
+    }
+
+    le_cfg_IteratorRef_t iter = le_cfg_CreateReadTxn(appRef->cfgPathRoot);
+    bool isDeferred = !le_cfg_IsEmpty(iter, CFG_NODE_REQUIRES "/" CFG_NODE_KERNELMODULES) ||
+                      !le_cfg_IsEmpty(iter, CFG_NODE_REQUIRES "/" CFG_NODE_DIRS) ||
+                      !le_cfg_IsEmpty(iter, CFG_NODE_REQUIRES "/" CFG_NODE_FILES);
+    le_cfg_CancelTxn(iter);
+
+    if (isDeferred)
+    {
+        return LE_UNAVAILABLE;
+    }
+
+    if (PrepareAppArea(appRef) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    appRef->isAreaReady = true;
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calls a handler for each app the given app has a binding to (i.e., for each app serving one of
+ * its required interfaces).  An app bound several times to the same server is reported each time.
+ */
+//--------------------------------------------------------------------------------------------------
+void app_ForEachServerApp
+(
+    app_Ref_t appRef,                       ///< [IN] Reference to the application.
+    app_ServerAppHandlerFunc_t handlerFunc, ///< [IN] Handler to call for each server app.
+    void* contextPtr                        ///< [IN] Context pointer for the handler.
+)
+{
+    le_cfg_IteratorRef_t bindCfg = le_cfg_CreateReadTxn(appRef->cfgPathRoot);
+    le_cfg_GoToNode(bindCfg, CFG_NODE_BINDINGS);
+
+    if (le_cfg_GoToFirstChild(bindCfg) == LE_OK)
+    {
+        do
+        {
+            char serverName[LIMIT_MAX_APP_NAME_BYTES];
+
+            if ( (le_cfg_GetString(bindCfg, "app", serverName, sizeof(serverName), "") == LE_OK) &&
+                 (serverName[0] != '\0') )
+            {
+                handlerFunc(serverName, contextPtr);
+            }
+        }
+        while (le_cfg_GoToNextSibling(bindCfg) == LE_OK);
+    }
+
+    le_cfg_CancelTxn(bindCfg);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Stops an application.  This is an asynchronous function call that returns immediately but
@@ -156,6 +156,54 @@ void app_Delete
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for a handler that is called for each app serving an application's bindings.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*app_ServerAppHandlerFunc_t)
+(
+    const char* serverNamePtr,      ///< [IN] Name of the server app.
+    void* contextPtr                ///< [IN] Context pointer.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets up an application's area in the file system ahead of app_Start(), which then only sets
+ * the SMACK rules and starts the processes.
+ *
+ * May be called from a thread other than the Supervisor's main thread, as long as that thread is
+ * connected to the config tree and nothing else uses the application object meanwhile.
+ *
+ * Apps requiring kernel modules, directories or files are left to app_Start().
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_UNAVAILABLE if the app area can only be set up by app_Start().
+ *      LE_FAULT if there was an error.  app_Start() will retry.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t app_PrepareArea
+(
+    app_Ref_t appRef                    ///< [IN] Reference to the application to prepare.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calls a handler for each app the given app has a binding to (i.e., for each app serving one of
+ * its required interfaces).
+ */
+//--------------------------------------------------------------------------------------------------
+void app_ForEachServerApp
+(
+    app_Ref_t appRef,                       ///< [IN] Reference to the application.
+    app_ServerAppHandlerFunc_t handlerFunc, ///< [IN] Handler to call for each server app.
+    void* contextPtr                        ///< [IN] Context pointer for the handler.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Starts an application.
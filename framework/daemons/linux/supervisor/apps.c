@@ -57,6 +57,15 @@
  * the client.  These created processes are deleted as soon as the client disconnects so that when
  * the app is started normally only the configured processes are run.
  *
+ * @section c_apps_autoStart Automatic Start
+ *
+ * On start-up, apps_AutoStart() first creates the containers of all the 'auto' start apps.  Then
+ * the file system areas of these apps (bind mounts, links, tmpfs) are set up concurrently by a
+ * few worker threads while the main thread waits.  Once all the workers are done, the main thread
+ * starts the apps, an app's servers (the apps its bindings point to) before the app itself, so
+ * that clients don't have to wait for their services to be advertised.  The time taken by each
+ * app is reported in the log.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 
@@ -250,6 +259,72 @@ static le_mem_PoolRef_t AppProcContainerPool;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t AppProcMap;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Progress of an app through the automatic start sequence.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    AUTO_START_PENDING,         ///< Not started yet.
+    AUTO_START_VISITING,        ///< Starting the app's servers.
+    AUTO_START_DONE             ///< Start attempted.
+}
+AutoStartState_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * App being started by apps_AutoStart().  Only exists for the duration of apps_AutoStart().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    AppContainer_t*     appContainerPtr;    ///< The app to start.
+    le_dls_Link_t       link;               ///< Link in the list of apps to start.
+    le_dls_Link_t       setupLink;          ///< Link in the queue of app areas to set up.
+    le_sls_List_t       serverList;         ///< Apps to start before this one.
+    AutoStartState_t    state;              ///< Progress in the start sequence.
+    le_result_t         setupResult;        ///< Result of app_PrepareArea().
+    uint32_t            setupMs;            ///< Time taken by app_PrepareArea(), in ms.
+    uint32_t            startMs;            ///< Time taken by StartApp(), in ms.
+}
+AutoStartApp_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Server of an app being started by apps_AutoStart().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    AutoStartApp_t*     serverPtr;          ///< The server app.
+    le_sls_Link_t       link;               ///< Link in the client's list of servers.
+}
+AutoStartServer_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pools for apps being started by apps_AutoStart() and their servers.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t AutoStartAppPool;
+static le_mem_PoolRef_t AutoStartServerPool;
+
+
+#if LE_CONFIG_SUPERV_APP_SETUP_THREADS > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue of app areas waiting to be set up by the app setup threads, and the mutex protecting it.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t AppSetupQueue = LE_DLS_LIST_INIT;
+static le_mutex_Ref_t AppSetupQueueMutex;
+#endif
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Timeout value for waiting processes to exit for an app.
@@ -756,45 +831,285 @@ static bool IsAppBusy
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Launch an app. Create the app container if necessary and start all the app's processes.
+ * Get the container of an app about to be launched, creating it if necessary.
  *
  * @return
- *      LE_OK if successfully launched the app.
+ *      LE_OK if the app can be launched.
  *      LE_BUSY if the app cannot be launched at the moment.
  *      LE_DUPLICATE if the app is already running.
  *      LE_NOT_FOUND if the app is not installed.
- *      LE_FAULT if the app could not be launched.
+ *      LE_FAULT if the app could not be created.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t LaunchApp
+static le_result_t GetAppToLaunch
 (
-    const char* appNamePtr      ///< [IN] Name of the application to launch.
+    const char* appNamePtr,          ///< [IN] Name of the application to launch.
+    AppContainer_t** containerPtrPtr ///< [OUT] Ptr to the app container.
 )
 {
-    // Create the app.
-    AppContainer_t* appContainerPtr;
     if(IsAppBusy(appNamePtr))
     {
         return LE_BUSY;
     }
 
-    le_result_t result = CreateApp(appNamePtr, &appContainerPtr);
+    // Create the app.
+    le_result_t result = CreateApp(appNamePtr, containerPtrPtr);
     if (result != LE_OK)
     {
         return result;
     }
 
-    if (appContainerPtr->isActive)
+    if ((*containerPtrPtr)->isActive)
     {
         LE_ERROR("Application '%s' is already running.", appNamePtr);
         return LE_DUPLICATE;
     }
 
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Launch an app. Create the app container if necessary and start all the app's processes.
+ *
+ * @return
+ *      LE_OK if successfully launched the app.
+ *      LE_BUSY if the app cannot be launched at the moment.
+ *      LE_DUPLICATE if the app is already running.
+ *      LE_NOT_FOUND if the app is not installed.
+ *      LE_FAULT if the app could not be launched.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t LaunchApp
+(
+    const char* appNamePtr      ///< [IN] Name of the application to launch.
+)
+{
+    AppContainer_t* appContainerPtr;
+
+    le_result_t result = GetAppToLaunch(appNamePtr, &appContainerPtr);
+    if (result != LE_OK)
+    {
+        return result;
+    }
+
     // Start the app.
     return StartApp(appContainerPtr);
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the number of milliseconds elapsed since a given relative time.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t GetElapsedMs
+(
+    le_clk_Time_t startTime     ///< [IN] Relative time to measure from.
+)
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+
+    return (uint32_t)(elapsed.sec * 1000 + elapsed.usec / 1000);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Context for AddAutoStartServer().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    AutoStartApp_t* clientPtr;          ///< App whose bindings are being walked.
+    le_dls_List_t*  appListPtr;         ///< List of all apps being started.
+}
+AutoStartBindingCtx_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records that an app being auto-started serves one of the bindings of another.  Servers which are
+ * not auto-started, self bindings and duplicates are ignored.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AddAutoStartServer
+(
+    const char* serverNamePtr,  ///< [IN] Name of the server app.
+    void* contextPtr            ///< [IN] AutoStartBindingCtx_t.
+)
+{
+    AutoStartBindingCtx_t* ctxPtr = contextPtr;
+    le_dls_Link_t* linkPtr = le_dls_Peek(ctxPtr->appListPtr);
+
+    while (linkPtr != NULL)
+    {
+        AutoStartApp_t* serverPtr = CONTAINER_OF(linkPtr, AutoStartApp_t, link);
+
+        if (strcmp(app_GetName(serverPtr->appContainerPtr->appRef), serverNamePtr) == 0)
+        {
+            if (serverPtr == ctxPtr->clientPtr)
+            {
+                return;
+            }
+
+            le_sls_Link_t* serverLinkPtr = le_sls_Peek(&(ctxPtr->clientPtr->serverList));
+
+            while (serverLinkPtr != NULL)
+            {
+                if (CONTAINER_OF(serverLinkPtr, AutoStartServer_t, link)->serverPtr == serverPtr)
+                {
+                    return;
+                }
+
+                serverLinkPtr = le_sls_PeekNext(&(ctxPtr->clientPtr->serverList), serverLinkPtr);
+            }
+
+            AutoStartServer_t* newServerPtr = le_mem_ForceAlloc(AutoStartServerPool);
+            newServerPtr->serverPtr = serverPtr;
+            newServerPtr->link = LE_SLS_LINK_INIT;
+            le_sls_Queue(&(ctxPtr->clientPtr->serverList), &(newServerPtr->link));
+            return;
+        }
+
+        linkPtr = le_dls_PeekNext(ctxPtr->appListPtr, linkPtr);
+    }
+}
+
+
+#if LE_CONFIG_SUPERV_APP_SETUP_THREADS > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * App setup thread.  Sets up the areas of the queued apps until the queue is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* AppSetupThreadMain
+(
+    void* contextPtr            ///< [IN] Not used.
+)
+{
+    le_cfg_ConnectService();
+
+    for (;;)
+    {
+        le_mutex_Lock(AppSetupQueueMutex);
+        le_dls_Link_t* linkPtr = le_dls_Pop(&AppSetupQueue);
+        le_mutex_Unlock(AppSetupQueueMutex);
+
+        if (linkPtr == NULL)
+        {
+            break;
+        }
+
+        AutoStartApp_t* appPtr = CONTAINER_OF(linkPtr, AutoStartApp_t, setupLink);
+        le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+        appPtr->setupResult = app_PrepareArea(appPtr->appContainerPtr->appRef);
+        appPtr->setupMs = GetElapsedMs(startTime);
+    }
+
+    le_cfg_DisconnectService();
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets up the areas of the apps being auto-started using the app setup threads, and waits for
+ * them to finish.  Apps are only started afterwards, from the main thread, so the processes are
+ * never forked while other threads are running.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetupAutoStartApps
+(
+    le_dls_List_t* appListPtr,  ///< [IN] List of apps being started.
+    size_t appCount             ///< [IN] Number of apps in the list.
+)
+{
+    le_thread_Ref_t threadRefs[LE_CONFIG_SUPERV_APP_SETUP_THREADS];
+    size_t threadCount = NUM_ARRAY_MEMBERS(threadRefs);
+    size_t i;
+
+    if (threadCount > appCount)
+    {
+        threadCount = appCount;
+    }
+
+    le_dls_Link_t* linkPtr = le_dls_Peek(appListPtr);
+
+    while (linkPtr != NULL)
+    {
+        AutoStartApp_t* appPtr = CONTAINER_OF(linkPtr, AutoStartApp_t, link);
+        le_dls_Queue(&AppSetupQueue, &(appPtr->setupLink));
+
+        linkPtr = le_dls_PeekNext(appListPtr, linkPtr);
+    }
+
+    for (i = 0; i < threadCount; i++)
+    {
+        char threadName[LIMIT_MAX_THREAD_NAME_BYTES];
+
+        snprintf(threadName, sizeof(threadName), "appSetup%" PRIuS, i);
+        threadRefs[i] = le_thread_Create(threadName, AppSetupThreadMain, NULL);
+        le_thread_SetJoinable(threadRefs[i]);
+        le_thread_Start(threadRefs[i]);
+    }
+
+    for (i = 0; i < threadCount; i++)
+    {
+        LE_ASSERT(le_thread_Join(threadRefs[i], NULL) == LE_OK);
+    }
+}
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts an app being auto-started, after its servers.  Apps bound to each other in a cycle are
+ * started in the order the cycle is entered.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartAutoStartApp
+(
+    AutoStartApp_t* appPtr      ///< [IN] App to start.
+)
+{
+    const char* appNamePtr = app_GetName(appPtr->appContainerPtr->appRef);
+
+    if (appPtr->state == AUTO_START_VISITING)
+    {
+        LE_WARN("App '%s' is part of a binding cycle; its clients may start before it.",
+                appNamePtr);
+        return;
+    }
+
+    if (appPtr->state == AUTO_START_DONE)
+    {
+        return;
+    }
+
+    appPtr->state = AUTO_START_VISITING;
+
+    le_sls_Link_t* linkPtr = le_sls_Peek(&(appPtr->serverList));
+
+    while (linkPtr != NULL)
+    {
+        StartAutoStartApp(CONTAINER_OF(linkPtr, AutoStartServer_t, link)->serverPtr);
+        linkPtr = le_sls_PeekNext(&(appPtr->serverList), linkPtr);
+    }
+
+    appPtr->state = AUTO_START_DONE;
+
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    // No need to check the return code because there is nothing we can do about errors.
+    StartApp(appPtr->appContainerPtr);
+    appPtr->startMs = GetElapsedMs(startTime);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Handle application fault.  Gets the application fault action for the process that terminated
@@ -1324,6 +1639,12 @@ void apps_Init
     // Create memory pools.
     AppContainerPool = le_mem_CreatePool("appContainers", sizeof(AppContainer_t));
     AppProcContainerPool = le_mem_CreatePool("appProcContainers", sizeof(AppProcContainer_t));
+    AutoStartAppPool = le_mem_CreatePool("autoStartApps", sizeof(AutoStartApp_t));
+    AutoStartServerPool = le_mem_CreatePool("autoStartServers", sizeof(AutoStartServer_t));
+
+#if LE_CONFIG_SUPERV_APP_SETUP_THREADS > 0
+    AppSetupQueueMutex = le_mutex_CreateNonRecursive("appSetupQueue");
+#endif
 
     AppProcMap = le_ref_CreateMap("AppProcs", 5);
     AppMap = le_ref_CreateMap("App", 5);
@@ -1414,7 +1735,7 @@ void apps_SetShutdownHandler
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Start all applications marked as 'auto' start.
+ * Start all applications marked as 'auto' start.  See @ref c_apps_autoStart.
  */
 //--------------------------------------------------------------------------------------------------
 void apps_AutoStart
@@ -1422,6 +1743,10 @@ void apps_AutoStart
     void
 )
 {
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+    le_dls_List_t appList = LE_DLS_LIST_INIT;
+    size_t appCount = 0;
+
     // Read the list of applications from the config tree.
     le_cfg_IteratorRef_t appCfg = le_cfg_CreateReadTxn(CFG_NODE_APPS_LIST);
 
@@ -1450,15 +1775,83 @@ void apps_AutoStart
             }
             else
             {
-                // Launch the application now.  No need to check the return code because there is
-                // nothing we can do about errors.
-                LaunchApp(appName);
+                // Create the application now.  It is started once all apps are created.  No need
+                // to report errors because there is nothing we can do about them.
+                AppContainer_t* appContainerPtr;
+
+                if (GetAppToLaunch(appName, &appContainerPtr) == LE_OK)
+                {
+                    AutoStartApp_t* appPtr = le_mem_ForceAlloc(AutoStartAppPool);
+
+                    appPtr->appContainerPtr = appContainerPtr;
+                    appPtr->link = LE_DLS_LINK_INIT;
+                    appPtr->setupLink = LE_DLS_LINK_INIT;
+                    appPtr->serverList = LE_SLS_LIST_INIT;
+                    appPtr->state = AUTO_START_PENDING;
+                    appPtr->setupResult = LE_UNAVAILABLE;
+                    appPtr->setupMs = 0;
+                    appPtr->startMs = 0;
+
+                    le_dls_Queue(&appList, &(appPtr->link));
+                    appCount++;
+                }
             }
         }
     }
     while (le_cfg_GoToNextSibling(appCfg) == LE_OK);
 
     le_cfg_CancelTxn(appCfg);
+
+    // Find out which apps serve which.
+    le_dls_Link_t* linkPtr = le_dls_Peek(&appList);
+
+    while (linkPtr != NULL)
+    {
+        AutoStartBindingCtx_t ctx =
+        {
+            .clientPtr = CONTAINER_OF(linkPtr, AutoStartApp_t, link),
+            .appListPtr = &appList
+        };
+
+        app_ForEachServerApp(ctx.clientPtr->appContainerPtr->appRef, AddAutoStartServer, &ctx);
+        linkPtr = le_dls_PeekNext(&appList, linkPtr);
+    }
+
+#if LE_CONFIG_SUPERV_APP_SETUP_THREADS > 0
+    // Set up the app areas concurrently.
+    SetupAutoStartApps(&appList, appCount);
+#endif
+
+    // Start the apps in dependency order.
+    linkPtr = le_dls_Peek(&appList);
+
+    while (linkPtr != NULL)
+    {
+        StartAutoStartApp(CONTAINER_OF(linkPtr, AutoStartApp_t, link));
+        linkPtr = le_dls_PeekNext(&appList, linkPtr);
+    }
+
+    // Report the time taken by each app and clean up.
+    while ((linkPtr = le_dls_Pop(&appList)) != NULL)
+    {
+        AutoStartApp_t* appPtr = CONTAINER_OF(linkPtr, AutoStartApp_t, link);
+        le_sls_Link_t* serverLinkPtr;
+
+        LE_INFO("App '%s': area set up %s in %" PRIu32 " ms, started in %" PRIu32 " ms.",
+                app_GetName(appPtr->appContainerPtr->appRef),
+                (appPtr->setupResult == LE_OK) ? "ahead" : "at start",
+                appPtr->setupMs,
+                appPtr->startMs);
+
+        while ((serverLinkPtr = le_sls_Pop(&(appPtr->serverList))) != NULL)
+        {
+            le_mem_Release(CONTAINER_OF(serverLinkPtr, AutoStartServer_t, link));
+        }
+
+        le_mem_Release(appPtr);
+    }
+
+    LE_INFO("Auto-started %" PRIuS " apps in %" PRIu32 " ms.", appCount, GetElapsedMs(startTime));
 }
 
 
@@ -70,6 +70,17 @@
  *
  *
  *
+ * Kick slots
+ * Processes which kick very often can ask for a kick slot with le_wdog_GetKickSlot().  The slot is
+ * a small shared memory file, mapped by both the process and the watchdog daemon, in which the
+ * process stores the time of its last kick instead of sending a le_wdog_Kick() message.  Kicks
+ * stored in the slot are picked up:
+ *    by a coarse timer scanning all the slots (which also starts stopped watchdogs), and
+ *    when the watchdog timer expires, before treating the expiry as a timeout.
+ * A picked up kick restarts the timer for the default timeout minus the age of the kick, so the
+ * process gets the same timeout as if le_wdog_Kick() had been called at the time of the kick.
+ * The slot is released (and marked inactive for the process) when the watchdog is deleted.
+ *
  * Besides le_wdog_Kick(), a command to temporarily change the timeout is provided.
  * le_wdog_Timeout(milliseconds) will adjust the current timeout and restart the timer.
  * This timeout will be effective for one time only reverting to the default value at the next
@@ -109,6 +120,8 @@
 #include "fileDescriptor.h"
 #include "pa_wdog.h"
 
+#include <sys/mman.h>
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The name of the node in the config tree that contains the list of all apps.
@@ -203,6 +216,20 @@
 //--------------------------------------------------------------------------------------------------
 #define NO_PROC      -1
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of a kick slot in bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+#define KICK_SLOT_BYTES (LE_WDOG_KICK_SLOT_WORDS * sizeof(uint32_t))
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Template for the name of the (immediately unlinked) file backing a kick slot.
+ */
+//--------------------------------------------------------------------------------------------------
+#define KICK_SLOT_FILE_TEMPLATE "/tmp/wdogKickSlot-XXXXXX"
+
 //--------------------------------------------------------------------------------------------------
 /**
  * System framework configuration
@@ -240,6 +267,9 @@ typedef struct
                                         ///< beyond it's maximum period by being treated as a
                                         ///< non-mandatory watchdog.
     le_timer_Ref_t timer;               ///< The timer this watchdog uses
+    volatile uint32_t* kickSlotPtr;     ///< Kick slot shared with the client, or NULL if the client
+                                        ///< only kicks through IPC
+    uint32_t lastSlotKick;              ///< Kick time last picked up from the kick slot
 }
 WatchdogObj_t;
 
@@ -287,6 +317,39 @@ static le_hashmap_Ref_t MandatoryWatchdogRefs;  ///< The container used to track
 
 static le_timer_Ref_t DefaultExternalWdogTimer; ///< Default external wdog timer
 
+static le_timer_Ref_t KickSlotScanTimer;        ///< Timer picking up kicks from the kick slots
+static size_t KickSlotCount;                    ///< Number of kick slots in use
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the kick slot of a watchdog, if it has one.  The slot is marked inactive first so the
+ * client knows its kicks are no longer picked up from it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReleaseKickSlot
+(
+    WatchdogObj_t* watchDogPtr  ///< [IN] Watchdog owning the kick slot
+)
+{
+    if (watchDogPtr->kickSlotPtr == NULL)
+    {
+        return;
+    }
+
+    watchDogPtr->kickSlotPtr[LE_WDOG_KICK_SLOT_ACTIVE] = 0;
+    if (munmap((void*)watchDogPtr->kickSlotPtr, KICK_SLOT_BYTES) != 0)
+    {
+        LE_ERROR("Failed to unmap kick slot of %d: %m", watchDogPtr->procId);
+    }
+    watchDogPtr->kickSlotPtr = NULL;
+
+    LE_ASSERT(KickSlotCount > 0);
+    if (--KickSlotCount == 0)
+    {
+        le_timer_Stop(KickSlotScanTimer);
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Remove the watchdog from our container, free the timer it contains and then free the storage
@@ -303,6 +366,7 @@ static void DeleteWatchdog
     {
         // All good. The dog was in the hash
         LE_DEBUG("Cleaning up watchdog resources for %d", deadDogPtr->procId);
+        ReleaseKickSlot(deadDogPtr);
         // Give the watchdog one more kick if it hasn't had one, then release it.
         // This allows mandatory watchdogs (which still exist in the MandatoryWatchdogRefs
         // one more kick to restart before they're considered expired.
@@ -464,6 +528,150 @@ static le_result_t GetAppNameFromPid
     return le_utf8_Copy(appName, (token + 1), appNameNumElements, NULL);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Construct le_clk_Time_t object that will give an interval of the provided number
+ *  of milliseconds.
+ *
+ *      @return the constructed le_clk_Time_t
+ */
+//--------------------------------------------------------------------------------------------------
+static le_clk_Time_t MakeTimerInterval
+(
+    uint64_t milliseconds
+)
+{
+    le_clk_Time_t interval;
+
+    interval.sec = milliseconds / 1000;
+    interval.usec = (milliseconds - (interval.sec * 1000)) * 1000;
+
+    return interval;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * (Re)start the timer of a watchdog for the given timeout, minus the time already elapsed since
+ * the kick being serviced.  A timeout of LE_WDOG_TIMEOUT_NEVER leaves the timer stopped.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartWatchdogTimer
+(
+    WatchdogObj_t* watchDogPtr, ///< [IN] Watchdog to start
+    le_clk_Time_t timeoutValue, ///< [IN] Timeout from the kick
+    le_clk_Time_t elapsed       ///< [IN] Time elapsed since the kick
+)
+{
+    le_timer_Stop(watchDogPtr->timer);
+
+    if (!le_clk_Equal(timeoutValue, MakeTimerInterval(LE_WDOG_TIMEOUT_NEVER)))
+    {
+        if (le_clk_GreaterThan(timeoutValue, elapsed))
+        {
+            timeoutValue = le_clk_Sub(timeoutValue, elapsed);
+        }
+        else
+        {
+            timeoutValue = MakeTimerInterval(0);
+        }
+
+        // timer should be stopped here so this should never fail
+        LE_ASSERT(LE_OK == le_timer_SetInterval(watchDogPtr->timer, timeoutValue));
+        le_timer_Start(watchDogPtr->timer);
+    }
+    else
+    {
+        LE_DEBUG("Timeout set to NEVER!");
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the current time in the kick slot time base: milliseconds of CLOCK_MONOTONIC, truncated to
+ * 32 bits.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t GetKickSlotTime
+(
+    void
+)
+{
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+
+    return (uint32_t)((uint64_t)now.sec * 1000 + now.usec / 1000);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pick up a kick stored in the kick slot of a watchdog since the last pick up, if any, and restart
+ * the watchdog timer as if le_wdog_Kick() had been called at the time of that kick.
+ *
+ * @return true if a new kick was found in the kick slot.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool ConsumeSlotKick
+(
+    WatchdogObj_t* watchDogPtr  ///< [IN] Watchdog to check
+)
+{
+    if (watchDogPtr->kickSlotPtr == NULL)
+    {
+        return false;
+    }
+
+    uint32_t kickTime = watchDogPtr->kickSlotPtr[LE_WDOG_KICK_SLOT_TIME];
+    if (kickTime == watchDogPtr->lastSlotKick)
+    {
+        return false;
+    }
+    watchDogPtr->lastSlotKick = kickTime;
+
+    // Time arithmetic is modulo 2^32.  A kick time in the future can only come from a confused
+    // client; count it as a kick now so it can never extend the timeout.
+    uint32_t age = GetKickSlotTime() - kickTime;
+    if (age > INT32_MAX)
+    {
+        age = 0;
+    }
+
+    if (IS_TRACE_ENABLED)
+    {
+        TRACE("Kick slot of %d kicked %" PRIu32 " ms ago", watchDogPtr->procId, age);
+    }
+
+    StartWatchdogTimer(watchDogPtr, watchDogPtr->kickTimeoutInterval, MakeTimerInterval(age));
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pick up the kicks of one watchdog during the periodic kick slot scan.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool ScanKickSlot
+(
+    const void* keyPtr,
+    const void* valuePtr,
+    void* contextPtr
+)
+{
+    ConsumeSlotKick((WatchdogObj_t*)valuePtr);
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Periodic kick slot scan.  Picks up the kicks of all clients using a kick slot.
+ */
+//--------------------------------------------------------------------------------------------------
+static void KickSlotScanHandler
+(
+    le_timer_Ref_t timerRef ///< [IN] The kick slot scan timer
+)
+{
+    le_hashmap_ForEach(WatchdogRefsContainer, ScanKickSlot, NULL);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The handler for all time outs. No registered application wants to see us get here.
@@ -479,6 +687,13 @@ static void WatchdogHandleExpiry
 )
 {
     WatchdogObj_t* watchDogPtr = le_timer_GetContextPtr(timerRef);
+
+    // The client may have kicked through its kick slot since the last scan.
+    if (ConsumeSlotKick(watchDogPtr))
+    {
+        return;
+    }
+
     if (watchDogPtr->procId == NO_PROC)
     {
         // Mandatory watchdog expired without the process restarting.  Restart Legato.
@@ -525,27 +740,6 @@ static void WatchdogHandleExpiry
     }
 }
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Construct le_clk_Time_t object that will give an interval of the provided number
- *  of milliseconds.
- *
- *      @return the constructed le_clk_Time_t
- */
-//--------------------------------------------------------------------------------------------------
-static le_clk_Time_t MakeTimerInterval
-(
-    uint64_t milliseconds
-)
-{
-    le_clk_Time_t interval;
-
-    interval.sec = milliseconds / 1000;
-    interval.usec = (milliseconds - (interval.sec * 1000)) * 1000;
-
-    return interval;
-}
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Check a regular watchdog is running.
@@ -825,6 +1019,8 @@ static void InitNewWatchdog
     newDogPtr->procId = clientPid;
     newDogPtr->kickTimeoutInterval = kickTimeoutInterval;
     newDogPtr->maxKickTimeoutInterval = maxKickTimeoutInterval;
+    newDogPtr->kickSlotPtr = NULL;
+    newDogPtr->lastSlotKick = 0;
 
     if (le_clk_GreaterThan(newDogPtr->kickTimeoutInterval, newDogPtr->maxKickTimeoutInterval))
     {
@@ -981,6 +1177,8 @@ static void CleanupWdog
 {
     WatchdogObj_t* deadDogPtr = objectPtr;
 
+    ReleaseKickSlot(deadDogPtr);
+
     // If this watchdog has a timer, delete it.
     if (deadDogPtr->timer)
     {
@@ -1039,7 +1237,12 @@ static void ResetClientWatchdog
     WatchdogObj_t* watchDogPtr = GetClientWatchdogPtr();
     if (watchDogPtr != NULL)
     {
-        le_timer_Stop(watchDogPtr->timer);
+        // This kick supersedes anything stored in the kick slot so far.
+        if (watchDogPtr->kickSlotPtr != NULL)
+        {
+            watchDogPtr->lastSlotKick = watchDogPtr->kickSlotPtr[LE_WDOG_KICK_SLOT_TIME];
+        }
+
         if (timeout == TIMEOUT_KICK)
         {
             timeoutValue = watchDogPtr->kickTimeoutInterval;
@@ -1061,16 +1264,7 @@ static void ResetClientWatchdog
             }
         }
 
-        if (!le_clk_Equal(timeoutValue, MakeTimerInterval(LE_WDOG_TIMEOUT_NEVER)))
-        {
-            // timer should be stopped here so this should never fail
-            LE_ASSERT(LE_OK == le_timer_SetInterval(watchDogPtr->timer, timeoutValue));
-            le_timer_Start(watchDogPtr->timer);
-        }
-        else
-        {
-            LE_DEBUG("Timeout set to NEVER!");
-        }
+        StartWatchdogTimer(watchDogPtr, timeoutValue, MakeTimerInterval(0));
     }
 }
 
@@ -1217,6 +1411,93 @@ le_result_t le_wdog_GetMaxWatchdogTimeout
     return LE_NOT_FOUND;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a shared memory kick slot for the client process.
+ *
+ * The slot is backed by an unlinked temporary file which is mapped here and handed to the client,
+ * which maps it in turn.
+ *
+ * @return
+ *      - LE_OK            The kick slot is returned
+ *      - LE_DUPLICATE     A kick slot was already handed out for this process
+ *      - LE_FAULT         The kick slot could not be created
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_wdog_GetKickSlot
+(
+    int* fdPtr  ///< [OUT] Shared memory file holding the kick slot
+)
+{
+    if (fdPtr == NULL)
+    {
+        LE_KILL_CLIENT("fdPtr is NULL.");
+        return LE_FAULT;
+    }
+    *fdPtr = -1;
+
+    WatchdogObj_t* watchDogPtr = GetClientWatchdogPtr();
+    if (watchDogPtr == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    if (watchDogPtr->kickSlotPtr != NULL)
+    {
+        LE_WARN("Kick slot already handed out to process %d", watchDogPtr->procId);
+        return LE_DUPLICATE;
+    }
+
+    char slotPath[] = KICK_SLOT_FILE_TEMPLATE;
+    int fd;
+
+    do
+    {
+        fd = mkstemp(slotPath);
+    }
+    while ((fd == -1) && (errno == EINTR));
+
+    if (fd == -1)
+    {
+        LE_ERROR("Could not create kick slot file: %m");
+        return LE_FAULT;
+    }
+
+    // Only the file descriptors are needed from now on.
+    if (unlink(slotPath) == -1)
+    {
+        LE_WARN("Could not unlink kick slot file '%s': %m", slotPath);
+    }
+
+    void* slotPtr = MAP_FAILED;
+    if (ftruncate(fd, KICK_SLOT_BYTES) == 0)
+    {
+        slotPtr = mmap(NULL, KICK_SLOT_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+
+    if (slotPtr == MAP_FAILED)
+    {
+        LE_ERROR("Could not map kick slot for process %d: %m", watchDogPtr->procId);
+        fd_Close(fd);
+        return LE_FAULT;
+    }
+
+    watchDogPtr->kickSlotPtr = slotPtr;
+    watchDogPtr->kickSlotPtr[LE_WDOG_KICK_SLOT_ACTIVE] = 1;
+    watchDogPtr->lastSlotKick = watchDogPtr->kickSlotPtr[LE_WDOG_KICK_SLOT_TIME];
+
+    if (KickSlotCount++ == 0)
+    {
+        le_timer_Start(KickSlotScanTimer);
+    }
+
+    LE_DEBUG("Kick slot created for process %d", watchDogPtr->procId);
+
+    // The IPC layer closes our copy of the fd once it has been sent.
+    *fdPtr = fd;
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Signal to the supervisor that we are set up and ready
@@ -1506,6 +1787,13 @@ COMPONENT_INIT
 
     InitializeTimerContainer();
 
+    // Kick slot scan timer, only running while kick slots are in use.
+    KickSlotScanTimer = le_timer_Create("KickSlotScanTimer");
+    le_timer_SetMsInterval(KickSlotScanTimer, LE_CONFIG_WDOG_KICK_SLOT_SCAN_INTERVAL);
+    le_timer_SetHandler(KickSlotScanTimer, KickSlotScanHandler);
+    le_timer_SetRepeat(KickSlotScanTimer, 0); // repeat indefinitely
+    le_timer_SetWakeup(KickSlotScanTimer, false);
+
     SystemProcessNotifySupervisor();
     wdog_ConnectService();
     le_appInfo_ConnectService();
@@ -12,6 +12,7 @@
 #include "le_rpcProxyConfig.h"
 #include "le_rpcProxyEventHandler.h"
 #include "le_rpcProxyFileStream.h"
+#include "le_rpcProxyCompression.h"
 
 #ifndef RPC_PROXY_LOCAL_SERVICE
 #include <dlfcn.h>
@@ -870,6 +871,14 @@ le_result_t rpcProxy_SendMsg
             {
                 return result;
             }
+
+            // Compress the file-stream data, if negotiated for this service
+            tmpProxyMessage.commonHeader.type = proxyMessagePtr->commonHeader.type;
+            bool isCompressed =
+                rpcProxyCompression_CompressMessage(commonHeaderPtr->serviceId,
+                                                    &tmpProxyMessage,
+                                                    &networkRecordPtr->stats);
+
             // proxy message (header + message)
             byteCount = RPC_PROXY_MSG_HEADER_SIZE + tmpProxyMessage.msgSize;
 
@@ -883,6 +892,11 @@ le_result_t rpcProxy_SendMsg
             tmpProxyMessage.commonHeader.type =
                 proxyMessagePtr->commonHeader.type;
 
+            if (isCompressed)
+            {
+                tmpProxyMessage.commonHeader.type |= RPC_PROXY_COMPRESSED_MSG_FLAG;
+            }
+
             // Put msgSize into Network-Order before sending
             tmpProxyMessage.msgSize = htobe16(tmpProxyMessage.msgSize);
             // Set send pointer to the message pointer
@@ -916,6 +930,13 @@ le_result_t rpcProxy_SendMsg
             LE_LOG_DUMP(LE_LOG_INFO, tmpProxyMessage.message, tmpProxyMessage.msgSize);
 #endif
 
+            // Compress the payload, if negotiated for this service and large enough
+            tmpProxyMessage.commonHeader.type = proxyMessagePtr->commonHeader.type;
+            bool isCompressed =
+                rpcProxyCompression_CompressMessage(commonHeaderPtr->serviceId,
+                                                    &tmpProxyMessage,
+                                                    &networkRecordPtr->stats);
+
             // Calculate the total size of the repacked
             // proxy message (header + message)
             byteCount = RPC_PROXY_MSG_HEADER_SIZE + tmpProxyMessage.msgSize;
@@ -934,6 +955,11 @@ le_result_t rpcProxy_SendMsg
             tmpProxyMessage.commonHeader.type =
                 proxyMessagePtr->commonHeader.type;
 
+            if (isCompressed)
+            {
+                tmpProxyMessage.commonHeader.type |= RPC_PROXY_COMPRESSED_MSG_FLAG;
+            }
+
             // Put msgSize into Network-Order before sending
             tmpProxyMessage.msgSize = htobe16(tmpProxyMessage.msgSize);
 
@@ -957,13 +983,9 @@ le_result_t rpcProxy_SendMsg
              be32toh(commonHeaderPtr->id),
              byteCount);
 
-    // Send the Message Payload as an outgoing Proxy Message to the far-size RPC Proxy
-    result = le_comm_Send(networkRecordPtr->handle, sendMessagePtr, byteCount);
-    if (result != LE_OK)
-    {
-        // Delete the Network Communication Channel
-        rpcProxyNetwork_DeleteNetworkCommunicationChannel(systemName);
-    }
+    // Send the Message Payload as an outgoing Proxy Message to the far-size RPC Proxy.
+    // NOTE: The message may be batched with other messages sent to the same system.
+    result = rpcProxyNetwork_SendMsg(systemName, networkRecordPtr, sendMessagePtr, byteCount);
 
     // Prepare the Proxy Message Common Header
     commonHeaderPtr->id = be32toh(commonHeaderPtr->id);
@@ -986,6 +1008,73 @@ static void AdvanceRecvMsgState
     msgStatePtr->recvState = NetworkMessageNextRecvState[msgStatePtr->recvState];
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for reading data from the far side via the le_comm API.
+ *
+ * Data is read from the communication channel in chunks as large as the staging buffer, so that
+ * the messages of a batch are re-assembled out of a single read.  Fewer bytes than requested are
+ * only returned once the communication channel has no more data available.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t RecvData
+(
+    void* handle, ///< [IN] Opaque handle to the le_comm communication channel
+    NetworkMessageState_t* msgStatePtr, ///< [IN] Pointer to the Message State-Machine data
+    NetworkLinkStats_t* statsPtr, ///< [IN] Pointer to the link counters
+    char* bufferPtr, ///< [OUT] Buffer to read the data into
+    size_t* bufferSizePtr ///< [IN/OUT] Number of bytes requested, then read
+)
+{
+    size_t requested = *bufferSizePtr;
+    size_t copied = 0;
+
+    while (copied < requested)
+    {
+        if (msgStatePtr->stageOffSet == msgStatePtr->stageSize)
+        {
+            // Staging buffer is empty - refill it
+            size_t readSize = sizeof(msgStatePtr->stageBuffer);
+
+            le_result_t result = le_comm_Receive(handle, msgStatePtr->stageBuffer, &readSize);
+            if (result != LE_OK)
+            {
+                return result;
+            }
+
+            if (readSize > sizeof(msgStatePtr->stageBuffer))
+            {
+                return LE_OVERFLOW;
+            }
+
+            msgStatePtr->stageSize = readSize;
+            msgStatePtr->stageOffSet = 0;
+
+            if (readSize == 0)
+            {
+                // No more data available
+                break;
+            }
+
+            statsPtr->rxFrameCount++;
+            statsPtr->rxByteCount += readSize;
+        }
+
+        size_t chunkSize = msgStatePtr->stageSize - msgStatePtr->stageOffSet;
+        if (chunkSize > (requested - copied))
+        {
+            chunkSize = requested - copied;
+        }
+
+        memcpy(bufferPtr + copied, msgStatePtr->stageBuffer + msgStatePtr->stageOffSet, chunkSize);
+        msgStatePtr->stageOffSet += chunkSize;
+        copied += chunkSize;
+    }
+
+    *bufferSizePtr = copied;
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function for receiving Proxy Messages from the far side via the le_comm API
@@ -995,6 +1084,7 @@ static le_result_t RecvMsg
 (
     void* handle, ///< [IN] Opaque handle to the le_comm communication channel
     NetworkMessageState_t* msgStatePtr, ///< [IN] Pointer to the Message State-Machine data
+    NetworkLinkStats_t* statsPtr, ///< [IN] Pointer to the link counters
     size_t* bufferSizePtr, ///< [IN] Pointer to the size of the buffer
     le_msg_SessionRef_t* sessionRefPtr, //< [OUT] Pointer to client's session reference
 	rpcProxy_MessageMetadata_t *metaDataPtr///< [OUT] metadata of proxy message
@@ -1025,7 +1115,16 @@ static le_result_t RecvMsg
             rpcProxy_CommonHeader_t *commonHeaderPtr =
                 (rpcProxy_CommonHeader_t*) msgStatePtr->buffer;
 
-            switch(commonHeaderPtr->type)
+            // Only variable-length messages may carry a compressed payload
+            uint8_t type = commonHeaderPtr->type & ~RPC_PROXY_COMPRESSED_MSG_FLAG;
+            if ((type != commonHeaderPtr->type) && !IsVariableLengthType(type))
+            {
+                LE_ERROR("Unexpected compressed Proxy Message, type [0x%x]",
+                         commonHeaderPtr->type);
+                return LE_COMM_ERROR;
+            }
+
+            switch(type)
             {
                 case RPC_PROXY_CONNECT_SERVICE_REQUEST:
                 case RPC_PROXY_CONNECT_SERVICE_RESPONSE:
@@ -1055,7 +1154,7 @@ static le_result_t RecvMsg
                     break;
             }
             msgStatePtr->recvSize = 0;
-            msgStatePtr->type = commonHeaderPtr->type;
+            msgStatePtr->type = type;
         }
         else if (msgStatePtr->recvState == NETWORK_MSG_MESSAGE) // MESSAGE State
         {
@@ -1104,8 +1203,10 @@ static le_result_t RecvMsg
         LE_DEBUG("Looking for %" PRIuS " bytes", *bufferSizePtr);
 
         // Read the Message buffer
-        result = le_comm_Receive(
+        result = RecvData(
                      handle,
+                     msgStatePtr,
+                     statsPtr,
                      msgStatePtr->buffer + msgStatePtr->offSet,
                      bufferSizePtr);
 
@@ -1154,6 +1255,18 @@ static le_result_t RecvMsg
 
     } // While-loop
 
+    // Inflate the payload, if compressed by the far side
+    if (((rpcProxy_CommonHeader_t*) msgStatePtr->buffer)->type & RPC_PROXY_COMPRESSED_MSG_FLAG)
+    {
+        result = rpcProxyCompression_DecompressMessage((rpcProxy_Message_t*) msgStatePtr->buffer,
+                                                       bufferSizePtr,
+                                                       statsPtr);
+        if (result != LE_OK)
+        {
+            return result;
+        }
+    }
+
     // Pre-process the buffer before processing the message payload
     result = PreProcessResponse(msgStatePtr->buffer, bufferSizePtr, sessionRefPtr, metaDataPtr);
     return result;
@@ -2801,8 +2914,9 @@ static le_result_t ProcessConnectServiceResponse
     // Sanity Check - Verify Message Type
     LE_ASSERT(proxyMessagePtr->commonHeader.type == RPC_PROXY_CONNECT_SERVICE_RESPONSE);
 
-    // Check if service has been established successfully on the far-side
-    if (proxyMessagePtr->serviceCode != LE_OK)
+    // Check if service has been established successfully on the far-side.
+    // NOTE: A positive service-code holds the capabilities accepted by the far-side.
+    if (proxyMessagePtr->serviceCode < LE_OK)
     {
         // Remote-side failed to set-up service
         LE_INFO("%s failed, serviceId "
@@ -2817,6 +2931,11 @@ static le_result_t ProcessConnectServiceResponse
     // Delete and clean-up the Connect-Service-Request timer
     DeleteConnectServiceRequestTimer(proxyMessagePtr->commonHeader.serviceId);
 
+    // Apply the capabilities accepted by the far-side
+    rpcProxyCompression_SetServiceCompression(
+        proxyMessagePtr->commonHeader.serviceId,
+        (proxyMessagePtr->serviceCode & RPC_PROXY_CAPABILITY_COMPRESSION) != 0);
+
     // Traverse all Service Reference entries in the Service Reference array and
     // search for matching service-name
     for (uint32_t index = 0; rpcProxyConfig_GetServerReferenceArray(index); index++)
@@ -2973,6 +3092,13 @@ static le_result_t ProcessConnectServiceRequest
     LE_INFO("======= Starting RPC Proxy client for '%s' service, '%s' protocol ========",
             proxyMessagePtr->serviceName, proxyMessagePtr->protocolIdStr);
 
+    // Capabilities offered by the far-side, if any
+    int32_t capabilities = 0;
+    if (proxyMessagePtr->serviceCode > 0)
+    {
+        capabilities = proxyMessagePtr->serviceCode & rpcProxyCompression_GetCapabilities();
+    }
+
     // Generate Do-Connect-Service call on behalf of the remote client
     result = DoConnectService(proxyMessagePtr->serviceName,
                               proxyMessagePtr->commonHeader.serviceId,
@@ -2984,8 +3110,17 @@ static le_result_t ProcessConnectServiceRequest
     // Set the Proxy Message type to CONNECT_SERVICE_RESPONSE
     proxyMessagePtr->commonHeader.type = RPC_PROXY_CONNECT_SERVICE_RESPONSE;
 
-    // Set the service-code with the DoConnectService result-code
+    // Set the service-code with the DoConnectService result-code, or with the accepted
+    // capabilities if the service has been connected
     proxyMessagePtr->serviceCode = result;
+    if (result == LE_OK)
+    {
+        proxyMessagePtr->serviceCode = capabilities;
+
+        rpcProxyCompression_SetServiceCompression(
+            proxyMessagePtr->commonHeader.serviceId,
+            (capabilities & RPC_PROXY_CAPABILITY_COMPRESSION) != 0);
+    }
 
     // Send Proxy Message to far-side
     result = rpcProxy_SendMsg(systemName, proxyMessagePtr, NULL);
@@ -3031,6 +3166,7 @@ static void DeleteService
 
             // Remove sessionRef from hash-map
             le_hashmap_Remove(ServiceRefMapByID, (void*)(uintptr_t) *serviceIdCopyPtr);
+            rpcProxyCompression_SetServiceCompression(*serviceIdCopyPtr, false);
 
             LE_INFO("======= Service '%s' stopped ========", serviceName);
         }
@@ -3181,7 +3317,12 @@ void rpcProxy_AsyncRecvHandler
         while (!done)
         {
             // Receive Proxy Message from far-side
-            result = RecvMsg(handle, &(networkRecordPtr->messageState), &bufferSize, &sessionRef, &metaData);
+            result = RecvMsg(handle,
+                             &(networkRecordPtr->messageState),
+                             &(networkRecordPtr->stats),
+                             &bufferSize,
+                             &sessionRef,
+                             &metaData);
 
             if (result != LE_OK)
             {
@@ -3194,9 +3335,12 @@ void rpcProxy_AsyncRecvHandler
 
                     // Delete the Network Communication Channel, using the communication handle
                     rpcProxyNetwork_DeleteNetworkCommunicationChannelByHandle(handle);
+                    return;
                 }
-                // Do not proceed any further - return
-                return;
+
+                // The message has been dropped - carry on with the rest of the batch, as data
+                // already staged would not trigger another POLLIN event
+                continue;
             }
 
             if (bufferSize == 0)
@@ -3206,6 +3350,8 @@ void rpcProxy_AsyncRecvHandler
                 continue;
             }
 
+            networkRecordPtr->stats.rxMsgCount++;
+
             // Set a pointer to the State-Machine Message Buffer
             char* buffer = networkRecordPtr->messageState.buffer;
 
@@ -3617,8 +3763,8 @@ static void SendSessionConnectRequest
                  sizeof(proxyMessagePtr->protocolIdStr),
                  NULL);
 
-    // Initialize the service-code to LE_OK
-    proxyMessagePtr->serviceCode = LE_OK;
+    // Offer the optional capabilities supported by this system
+    proxyMessagePtr->serviceCode = rpcProxyCompression_GetCapabilities();
 
     // Send Proxy Message to far-side
     result = rpcProxy_SendMsg(systemName, proxyMessagePtr, NULL);
@@ -3995,6 +4141,7 @@ void rpcProxy_DisconnectSessions
 
                 // Remove sessionRef from hash-map
                 le_hashmap_Remove(SessionRefMapByID, (void*)(uintptr_t) *serviceIdCopyPtr);
+                rpcProxyCompression_SetServiceCompression(*serviceIdCopyPtr, false);
             }
 
             // Traverse the RequestResponseRefByProxyId map
@@ -4100,6 +4247,54 @@ le_result_t le_rpcProxy_InitializeOnce
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Log the usage of a memory pool.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogPoolStats
+(
+    le_mem_PoolRef_t poolRef ///< [IN] Memory pool
+)
+{
+    le_mem_PoolStats_t stats;
+    char poolName[LE_MEM_LIMIT_MAX_MEM_POOL_NAME_BYTES] = "";
+
+    if (poolRef == NULL)
+    {
+        return;
+    }
+
+    le_mem_GetStats(poolRef, &stats);
+    le_mem_GetName(poolRef, poolName, sizeof(poolName));
+
+    LE_INFO("Pool [%s]: in use %zu, high-water mark %zu, overflows %zu, allocs %" PRIu64,
+            poolName,
+            stats.numBlocksInUse,
+            stats.maxNumBlocksUsed,
+            stats.numOverflows,
+            stats.numAllocs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Log the usage of the memory pools on the message (and Repack) paths.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcProxy_LogPoolStats
+(
+    void
+)
+{
+    LogPoolStats(ProxyMessagesPoolRef);
+    LogPoolStats(ProxyClientRequestResponseRecordPoolRef);
+#ifdef RPC_PROXY_LOCAL_SERVICE
+    LogPoolStats(MessageDataPtrPoolRef);
+    LogPoolStats(LocalMessagePoolRef);
+    LogPoolStats(ResponseParameterArrayPoolRef);
+#endif
+}
+
 
 #ifndef LE_CONFIG_RPC_PROXY_LIBRARY
 //--------------------------------------------------------------------------------------------------
@@ -4158,6 +4353,7 @@ le_result_t le_rpcProxy_Initialize
                                                   sizeof(rpcProxy_ClientRequestResponseRecord_t));
 
     rpcFStream_InitFileStreamPool();
+    rpcProxyCompression_Init();
 
 #ifdef RPC_PROXY_LOCAL_SERVICE
     MessageDataPtrPoolRef = le_mem_InitStaticPool(MessageDataPtrPool,
@@ -388,6 +388,16 @@ le_result_t rpcProxy_SendMsg
     rpcProxy_MessageMetadata_t *metaDataPtr ///< [IN] metadata of proxy message
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Log the usage of the memory pools on the message (and Repack) paths.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcProxy_LogPoolStats
+(
+    void
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Handler function for Expired Proxy Message Timers
@@ -0,0 +1,315 @@
+/**
+ * @file le_rpcProxyCompression.c
+ *
+ * This file contains the source code for the RPC Proxy payload compression feature.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "le_rpcProxy.h"
+#include "le_rpcProxyNetwork.h"
+#include "le_rpcProxyCompression.h"
+
+#if LE_CONFIG_RPC_PROXY_COMPRESSION
+#include <zlib.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the deflate window, as a power of two.  A 4 kB window covers the largest RPC message.
+ */
+//--------------------------------------------------------------------------------------------------
+#define COMPRESSION_WINDOW_BITS         12
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the inflate window, as a power of two.  The largest window is accepted so that the far
+ * side is free to use any window size.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DECOMPRESSION_WINDOW_BITS       15
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory used by the deflate internal state (1 to 9).
+ */
+//--------------------------------------------------------------------------------------------------
+#define COMPRESSION_MEM_LEVEL           4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deflate stream, re-used for every message.
+ */
+//--------------------------------------------------------------------------------------------------
+static z_stream Deflater;
+static bool IsDeflaterReady = false;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Inflate stream, re-used for every message.
+ */
+//--------------------------------------------------------------------------------------------------
+static z_stream Inflater;
+static bool IsInflaterReady = false;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Scratch buffer for compressing and decompressing payloads.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t ScratchBuffer[RPC_PROXY_MAX_MESSAGE];
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hash Map to track the bindings using compression, using the Service-ID as a key.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_HASHMAP_DEFINE_STATIC(CompressedServiceHashMap, RPC_PROXY_MSG_REFERENCE_MAX_NUM);
+static le_hashmap_Ref_t CompressedServiceMapByID = NULL;
+
+
+#if LE_CONFIG_RPC_PROXY_COMPRESSION
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the time elapsed since a given relative time, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetElapsedUs
+(
+    le_clk_Time_t startTime  ///< [IN] Relative start time
+)
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+
+    return ((uint64_t) elapsed.sec * 1000000) + (uint64_t) elapsed.usec;
+}
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the Connect-Service capabilities supported by this system.
+ *
+ * @return
+ *      Bit-mask of RPC_PROXY_CAPABILITY_xxx flags.
+ */
+//--------------------------------------------------------------------------------------------------
+int32_t rpcProxyCompression_GetCapabilities
+(
+    void
+)
+{
+#if LE_CONFIG_RPC_PROXY_COMPRESSION
+    return RPC_PROXY_CAPABILITY_COMPRESSION;
+#else
+    return 0;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enable or disable payload compression for the messages of a binding.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcProxyCompression_SetServiceCompression
+(
+    uint32_t serviceId,  ///< [IN] Service-ID of the binding
+    bool isEnabled       ///< [IN] Whether messages of the binding are compressed
+)
+{
+    if (isEnabled)
+    {
+        // The Service-ID is never zero, so it is also used as the (non-NULL) value
+        le_hashmap_Put(CompressedServiceMapByID,
+                       (void*)(uintptr_t) serviceId,
+                       (void*)(uintptr_t) serviceId);
+
+        LE_INFO("Payload compression enabled, service-id [%" PRIu32 "]", serviceId);
+    }
+    else
+    {
+        le_hashmap_Remove(CompressedServiceMapByID, (void*)(uintptr_t) serviceId);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compress the payload of a Proxy Message, if compression is enabled for its binding and the
+ * payload gets smaller.
+ *
+ * @note msgSize must be in Host-Order.  The common header is left untouched.
+ *
+ * @return
+ *      - true, if the payload has been compressed,
+ *      - false, if the message must be sent uncompressed.
+ */
+//--------------------------------------------------------------------------------------------------
+bool rpcProxyCompression_CompressMessage
+(
+    uint32_t serviceId,                   ///< [IN] Service-ID of the binding (Host-Order)
+    rpcProxy_Message_t* proxyMessagePtr,  ///< [IN/OUT] Proxy Message
+    NetworkLinkStats_t* statsPtr          ///< [IN] Counters of the link
+)
+{
+#if LE_CONFIG_RPC_PROXY_COMPRESSION
+    // File-Stream data is always worth a try, other messages only above the threshold
+    if ((proxyMessagePtr->msgSize == 0) ||
+        ((proxyMessagePtr->commonHeader.type != RPC_PROXY_FILESTREAM_MESSAGE) &&
+         (proxyMessagePtr->msgSize < LE_CONFIG_RPC_PROXY_COMPRESSION_THRESHOLD)))
+    {
+        return false;
+    }
+
+    if (!le_hashmap_ContainsKey(CompressedServiceMapByID, (void*)(uintptr_t) serviceId))
+    {
+        return false;
+    }
+
+    if (!IsDeflaterReady)
+    {
+        memset(&Deflater, 0, sizeof(Deflater));
+        if (deflateInit2(&Deflater,
+                         LE_CONFIG_RPC_PROXY_COMPRESSION_LEVEL,
+                         Z_DEFLATED,
+                         -COMPRESSION_WINDOW_BITS,
+                         COMPRESSION_MEM_LEVEL,
+                         Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            LE_ERROR("Unable to initialize deflate stream");
+            return false;
+        }
+        IsDeflaterReady = true;
+    }
+
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    // Only accept an output strictly smaller than the payload
+    deflateReset(&Deflater);
+    Deflater.next_in = proxyMessagePtr->message;
+    Deflater.avail_in = proxyMessagePtr->msgSize;
+    Deflater.next_out = ScratchBuffer;
+    Deflater.avail_out = proxyMessagePtr->msgSize - 1;
+
+    int zResult = deflate(&Deflater, Z_FINISH);
+
+    statsPtr->txCompressUs += GetElapsedUs(startTime);
+
+    if (zResult != Z_STREAM_END)
+    {
+        statsPtr->txCompressSkipCount++;
+        return false;
+    }
+
+    statsPtr->txCompressedCount++;
+    statsPtr->txCompressInBytes += proxyMessagePtr->msgSize;
+    statsPtr->txCompressOutBytes += Deflater.total_out;
+
+    LE_DEBUG("Compressed payload, service-id [%" PRIu32 "], size [%" PRIu16 "] -> [%lu]",
+             serviceId,
+             proxyMessagePtr->msgSize,
+             Deflater.total_out);
+
+    memcpy(proxyMessagePtr->message, ScratchBuffer, Deflater.total_out);
+    proxyMessagePtr->msgSize = (uint16_t) Deflater.total_out;
+
+    return true;
+#else
+    LE_UNUSED(serviceId);
+    LE_UNUSED(proxyMessagePtr);
+    LE_UNUSED(statsPtr);
+
+    return false;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Inflate the payload of a compressed Proxy Message received from the far side, and clear the
+ * compressed flag from its type.
+ *
+ * @note msgSize is in Network-Order, as received.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_FORMAT_ERROR, if the payload can't be inflated.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyCompression_DecompressMessage
+(
+    rpcProxy_Message_t* proxyMessagePtr,  ///< [IN/OUT] Proxy Message
+    size_t* bufferSizePtr,                ///< [IN/OUT] Size of the Proxy Message
+    NetworkLinkStats_t* statsPtr          ///< [IN] Counters of the link
+)
+{
+#if LE_CONFIG_RPC_PROXY_COMPRESSION
+    uint16_t msgSize = be16toh(proxyMessagePtr->msgSize);
+
+    if (!IsInflaterReady)
+    {
+        memset(&Inflater, 0, sizeof(Inflater));
+        if (inflateInit2(&Inflater, -DECOMPRESSION_WINDOW_BITS) != Z_OK)
+        {
+            LE_ERROR("Unable to initialize inflate stream");
+            return LE_FORMAT_ERROR;
+        }
+        IsInflaterReady = true;
+    }
+
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    inflateReset(&Inflater);
+    Inflater.next_in = proxyMessagePtr->message;
+    Inflater.avail_in = msgSize;
+    Inflater.next_out = ScratchBuffer;
+    Inflater.avail_out = sizeof(ScratchBuffer);
+
+    int zResult = inflate(&Inflater, Z_FINISH);
+
+    statsPtr->rxDecompressUs += GetElapsedUs(startTime);
+
+    if (zResult != Z_STREAM_END)
+    {
+        LE_ERROR("Unable to inflate payload, proxy id [%" PRIu32 "], result [%d]; "
+                 "Dropping packet",
+                 be32toh(proxyMessagePtr->commonHeader.id),
+                 zResult);
+        return LE_FORMAT_ERROR;
+    }
+
+    statsPtr->rxCompressedCount++;
+    statsPtr->rxCompressInBytes += msgSize;
+    statsPtr->rxCompressOutBytes += Inflater.total_out;
+
+    memcpy(proxyMessagePtr->message, ScratchBuffer, Inflater.total_out);
+    proxyMessagePtr->msgSize = htobe16((uint16_t) Inflater.total_out);
+    proxyMessagePtr->commonHeader.type &= ~RPC_PROXY_COMPRESSED_MSG_FLAG;
+    *bufferSizePtr = RPC_PROXY_MSG_HEADER_SIZE + Inflater.total_out;
+
+    return LE_OK;
+#else
+    LE_UNUSED(bufferSizePtr);
+    LE_UNUSED(statsPtr);
+
+    LE_ERROR("Compressed payload not supported, proxy id [%" PRIu32 "]; Dropping packet",
+             be32toh(proxyMessagePtr->commonHeader.id));
+    return LE_FORMAT_ERROR;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the RPC Proxy payload compression.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcProxyCompression_Init
+(
+    void
+)
+{
+    // Create hash map for the bindings using compression, using Service-ID as key.
+    CompressedServiceMapByID = le_hashmap_InitStatic(CompressedServiceHashMap,
+                                                     RPC_PROXY_MSG_REFERENCE_MAX_NUM,
+                                                     le_hashmap_HashVoidPointer,
+                                                     le_hashmap_EqualsVoidPointer);
+}
@@ -0,0 +1,117 @@
+/**
+ * @file le_rpcProxyCompression.h
+ *
+ * Header for the RPC Proxy payload compression feature.
+ *
+ * Compression is negotiated per binding during the Connect-Service handshake:
+ *
+ *  - The Connect-Service-Request carries the capabilities offered by the requesting system in its
+ *    service-code, which is otherwise unused in a request.
+ *  - A successful Connect-Service-Response carries the subset of these capabilities accepted by the
+ *    far side in its service-code.
+ *
+ * Result codes are never positive, so a system that doesn't support compression neither offers nor
+ * accepts it, and the link falls back to uncompressed messages.
+ *
+ * Once negotiated, the payload of Client-Request, Server-Response, Server-Event and File-Stream
+ * messages of the binding is compressed (raw deflate) when it is worth it, and the message type is
+ * flagged with RPC_PROXY_COMPRESSED_MSG_FLAG.  The receiver inflates flagged messages before any
+ * other processing.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LE_RPC_PROXY_COMPRESSION_H_INCLUDE_GUARD
+#define LE_RPC_PROXY_COMPRESSION_H_INCLUDE_GUARD
+
+#include "legato.h"
+#include "le_rpcProxy.h"
+#include "le_rpcProxyNetwork.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Connect-Service capability flag for payload compression.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_CAPABILITY_COMPRESSION        0x00000001
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Message type flag marking a compressed payload.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_COMPRESSED_MSG_FLAG           0x80
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the Connect-Service capabilities supported by this system.
+ *
+ * @return
+ *      Bit-mask of RPC_PROXY_CAPABILITY_xxx flags.
+ */
+//--------------------------------------------------------------------------------------------------
+int32_t rpcProxyCompression_GetCapabilities
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enable or disable payload compression for the messages of a binding.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcProxyCompression_SetServiceCompression
+(
+    uint32_t serviceId,  ///< [IN] Service-ID of the binding
+    bool isEnabled       ///< [IN] Whether messages of the binding are compressed
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compress the payload of a Proxy Message, if compression is enabled for its binding and the
+ * payload gets smaller.
+ *
+ * @note msgSize must be in Host-Order.  The common header is left untouched.
+ *
+ * @return
+ *      - true, if the payload has been compressed,
+ *      - false, if the message must be sent uncompressed.
+ */
+//--------------------------------------------------------------------------------------------------
+bool rpcProxyCompression_CompressMessage
+(
+    uint32_t serviceId,                   ///< [IN] Service-ID of the binding (Host-Order)
+    rpcProxy_Message_t* proxyMessagePtr,  ///< [IN/OUT] Proxy Message
+    NetworkLinkStats_t* statsPtr          ///< [IN] Counters of the link
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Inflate the payload of a compressed Proxy Message received from the far side, and clear the
+ * compressed flag from its type.
+ *
+ * @note msgSize is in Network-Order, as received.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_FORMAT_ERROR, if the payload can't be inflated.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyCompression_DecompressMessage
+(
+    rpcProxy_Message_t* proxyMessagePtr,  ///< [IN/OUT] Proxy Message
+    size_t* bufferSizePtr,                ///< [IN/OUT] Size of the Proxy Message
+    NetworkLinkStats_t* statsPtr          ///< [IN] Counters of the link
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the RPC Proxy payload compression.
+ */
+//--------------------------------------------------------------------------------------------------
+void rpcProxyCompression_Init
+(
+    void
+);
+
+#endif /* LE_RPC_PROXY_COMPRESSION_H_INCLUDE_GUARD */
@@ -546,6 +546,302 @@ le_hashmap_Ref_t rpcProxyNetwork_GetNetworkRecordHashMapByName
     return NetworkRecordHashMapByName;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the relative time, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetRelativeTimeUs
+(
+    void
+)
+{
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+
+    return ((uint64_t) now.sec * 1000000) + (uint64_t) now.usec;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Log the counters of the link to a system.  Only done when the link goes down, as the counters
+ * and the pool usage would flood the log if dumped on every keep-alive.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogLinkStats
+(
+    const char* systemName, ///< System name
+    NetworkRecord_t* networkRecordPtr ///< Network Record of the system
+)
+{
+    NetworkLinkStats_t* statsPtr = &networkRecordPtr->stats;
+
+    LE_INFO("Link statistics, system-name [%s]: "
+            "tx %" PRIu64 " msgs in %" PRIu64 " frames (%" PRIu64 " bytes), "
+            "queueing delay total %" PRIu64 " us, max %" PRIu64 " us; "
+            "rx %" PRIu64 " msgs in %" PRIu64 " frames (%" PRIu64 " bytes)",
+            systemName,
+            statsPtr->txMsgCount,
+            statsPtr->txFrameCount,
+            statsPtr->txByteCount,
+            statsPtr->txQueueDelayUs,
+            statsPtr->txQueueDelayMaxUs,
+            statsPtr->rxMsgCount,
+            statsPtr->rxFrameCount,
+            statsPtr->rxByteCount);
+
+    rpcProxy_LogPoolStats();
+
+    if ((statsPtr->txCompressedCount == 0) &&
+        (statsPtr->txCompressSkipCount == 0) &&
+        (statsPtr->rxCompressedCount == 0))
+    {
+        return;
+    }
+
+    // Compression ratios are expressed as the percentage of the original payload size
+    LE_INFO("Link compression, system-name [%s]: "
+            "tx %" PRIu64 " msgs compressed to %" PRIu64 "%% in %" PRIu64 " us, "
+            "%" PRIu64 " msgs not compressible; "
+            "rx %" PRIu64 " msgs inflated from %" PRIu64 "%% in %" PRIu64 " us",
+            systemName,
+            statsPtr->txCompressedCount,
+            (statsPtr->txCompressInBytes != 0) ?
+                (statsPtr->txCompressOutBytes * 100) / statsPtr->txCompressInBytes : 0,
+            statsPtr->txCompressUs,
+            statsPtr->txCompressSkipCount,
+            statsPtr->rxCompressedCount,
+            (statsPtr->rxCompressOutBytes != 0) ?
+                (statsPtr->rxCompressInBytes * 100) / statsPtr->rxCompressOutBytes : 0,
+            statsPtr->rxDecompressUs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a frame to the link to a system.
+ *
+ * @note If the link fails, the Network Communication Channel is deleted.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - otherwise failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SendFrame
+(
+    const char* systemName, ///< System name
+    NetworkRecord_t* networkRecordPtr, ///< Network Record of the system
+    const void* bufferPtr, ///< Frame to write
+    size_t bufferSize ///< Size of the frame
+)
+{
+    le_result_t result = le_comm_Send(networkRecordPtr->handle, bufferPtr, bufferSize);
+    if (result != LE_OK)
+    {
+        // Delete the Network Communication Channel
+        rpcProxyNetwork_DeleteNetworkCommunicationChannel(systemName);
+        return result;
+    }
+
+    networkRecordPtr->stats.txFrameCount++;
+    networkRecordPtr->stats.txByteCount += bufferSize;
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send the messages queued in the send batch of a link as a single frame.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - otherwise failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FlushSendBatch
+(
+    const char* systemName, ///< System name
+    NetworkRecord_t* networkRecordPtr ///< Network Record of the system
+)
+{
+    NetworkSendBatch_t* batchPtr = &networkRecordPtr->sendBatch;
+    NetworkLinkStats_t* statsPtr = &networkRecordPtr->stats;
+
+    if (batchPtr->size == 0)
+    {
+        return LE_OK;
+    }
+
+    // Account for the time the messages spent in the batch
+    uint64_t nowUs = GetRelativeTimeUs();
+    uint64_t maxDelayUs = nowUs - batchPtr->firstQueuedUs;
+
+    statsPtr->txQueueDelayUs += (nowUs * batchPtr->msgCount) - batchPtr->queuedUsSum;
+    if (maxDelayUs > statsPtr->txQueueDelayMaxUs)
+    {
+        statsPtr->txQueueDelayMaxUs = maxDelayUs;
+    }
+
+    LE_DEBUG("Sending batch of %" PRIu32 " Proxy Messages, system-name [%s], size [%" PRIuS "]",
+             batchPtr->msgCount,
+             systemName,
+             batchPtr->size);
+
+    // Empty the batch before sending, as a failure deletes the channel
+    size_t size = batchPtr->size;
+    batchPtr->size = 0;
+    batchPtr->msgCount = 0;
+    batchPtr->queuedUsSum = 0;
+
+    return SendFrame(systemName, networkRecordPtr, batchPtr->buffer, size);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler function for the expiry of the batching window of a link.
+ *
+ * The batch is sent and, if it wasn't empty, a new window is opened to keep coalescing messages
+ * while the link is busy.  Otherwise the window stays closed until the next message is sent.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendBatchTimerExpiryHandler
+(
+    le_timer_Ref_t timerRef    ///< This timer has expired
+)
+{
+    NetworkRecord_t* networkRecordPtr = le_timer_GetContextPtr(timerRef);
+
+    if ((networkRecordPtr->state == NETWORK_DOWN) ||
+        (networkRecordPtr->sendBatch.size == 0))
+    {
+        return;
+    }
+
+    char* systemName = rpcProxyNetwork_GetSystemNameByHandle(networkRecordPtr->handle);
+    if (systemName == NULL)
+    {
+        LE_ERROR("Unable to retrieve system-name, handle [%d] - unknown system",
+                 le_comm_GetId(networkRecordPtr->handle));
+        return;
+    }
+
+    if (FlushSendBatch(systemName, networkRecordPtr) == LE_OK)
+    {
+        le_timer_Start(timerRef);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drop the messages queued in the send batch of a link and close its batching window.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResetSendBatch
+(
+    NetworkRecord_t* networkRecordPtr ///< Network Record of the system
+)
+{
+    NetworkSendBatch_t* batchPtr = &networkRecordPtr->sendBatch;
+
+    if (batchPtr->msgCount != 0)
+    {
+        LE_WARN("Dropping %" PRIu32 " queued Proxy Messages", batchPtr->msgCount);
+    }
+
+    batchPtr->size = 0;
+    batchPtr->msgCount = 0;
+    batchPtr->queuedUsSum = 0;
+
+    if (batchPtr->windowTimerRef != NULL)
+    {
+        le_timer_Stop(batchPtr->windowTimerRef);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for sending a serialized Proxy Message on the link to a system.
+ *
+ * If the batching window of the link is closed, the message is sent right away and the window is
+ * opened.  Otherwise the message is queued and sent with the other messages of the batch when the
+ * window closes or when the batch buffer is full.
+ *
+ * @note If the link fails, the Network Communication Channel is deleted.
+ *
+ * @return
+ *      - LE_OK, if successfully sent or queued,
+ *      - otherwise failure.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyNetwork_SendMsg
+(
+    const char* systemName, ///< System name
+    NetworkRecord_t* networkRecordPtr, ///< Network Record of the system
+    const void* bufferPtr, ///< Serialized Proxy Message
+    size_t bufferSize ///< Size of the serialized Proxy Message
+)
+{
+    NetworkSendBatch_t* batchPtr = &networkRecordPtr->sendBatch;
+    le_result_t result;
+
+    networkRecordPtr->stats.txMsgCount++;
+
+#if RPC_PROXY_BATCH_WINDOW_MS > 0
+    if (batchPtr->windowTimerRef == NULL)
+    {
+        le_clk_Time_t timerInterval = { .sec = RPC_PROXY_BATCH_WINDOW_MS / 1000,
+                                        .usec = (RPC_PROXY_BATCH_WINDOW_MS % 1000) * 1000 };
+
+        batchPtr->windowTimerRef = le_timer_Create("Network-Batch timer");
+        le_timer_SetInterval(batchPtr->windowTimerRef, timerInterval);
+        le_timer_SetHandler(batchPtr->windowTimerRef, SendBatchTimerExpiryHandler);
+        le_timer_SetWakeup(batchPtr->windowTimerRef, false);
+        le_timer_SetContextPtr(batchPtr->windowTimerRef, networkRecordPtr);
+    }
+#endif
+
+    if ((batchPtr->windowTimerRef == NULL) || !le_timer_IsRunning(batchPtr->windowTimerRef))
+    {
+        // Window is closed (or batching is disabled) - send right away and open a new window
+        result = SendFrame(systemName, networkRecordPtr, bufferPtr, bufferSize);
+        if ((result == LE_OK) && (batchPtr->windowTimerRef != NULL))
+        {
+            le_timer_Start(batchPtr->windowTimerRef);
+        }
+        return result;
+    }
+
+    // Make room for the message in the batch
+    if ((batchPtr->size + bufferSize) > sizeof(batchPtr->buffer))
+    {
+        result = FlushSendBatch(systemName, networkRecordPtr);
+        if (result != LE_OK)
+        {
+            return result;
+        }
+
+        if (bufferSize > sizeof(batchPtr->buffer))
+        {
+            // Message can't be batched at all
+            return SendFrame(systemName, networkRecordPtr, bufferPtr, bufferSize);
+        }
+    }
+
+    // Queue the message
+    uint64_t nowUs = GetRelativeTimeUs();
+
+    if (batchPtr->msgCount == 0)
+    {
+        batchPtr->firstQueuedUs = nowUs;
+    }
+
+    memcpy(batchPtr->buffer + batchPtr->size, bufferPtr, bufferSize);
+    batchPtr->size += bufferSize;
+    batchPtr->msgCount++;
+    batchPtr->queuedUsSum += nowUs;
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function for creating and connecting a Network Communication Channel.
@@ -575,6 +871,13 @@ le_result_t rpcProxyNetwork_CreateNetworkCommunicationChannel
         networkRecordPtr->handle = NULL;
         networkRecordPtr->keepAliveTimerRef = NULL;
 
+        // Initialize the Send Batch and the link counters
+        networkRecordPtr->sendBatch.size = 0;
+        networkRecordPtr->sendBatch.msgCount = 0;
+        networkRecordPtr->sendBatch.queuedUsSum = 0;
+        networkRecordPtr->sendBatch.windowTimerRef = NULL;
+        memset(&networkRecordPtr->stats, 0, sizeof(networkRecordPtr->stats));
+
         le_hashmap_Put(NetworkRecordHashMapByName, systemName, networkRecordPtr);
     }
 
@@ -584,6 +887,8 @@ le_result_t rpcProxyNetwork_CreateNetworkCommunicationChannel
 
     // Reset Network Message Re-assembly State-Machine
     networkRecordPtr->messageState.recvState = NETWORK_MSG_IDLE;
+    networkRecordPtr->messageState.stageSize = 0;
+    networkRecordPtr->messageState.stageOffSet = 0;
 
     LE_ASSERT(networkRecordPtr->handle == NULL);
 
@@ -760,6 +1065,12 @@ void rpcProxyNetwork_DeleteNetworkCommunicationChannel
 
     // Reset Network Message Re-assembly State-Machine
     networkRecordPtr->messageState.recvState = NETWORK_MSG_IDLE;
+    networkRecordPtr->messageState.stageSize = 0;
+    networkRecordPtr->messageState.stageOffSet = 0;
+
+    // Drop any message still waiting to be sent
+    ResetSendBatch(networkRecordPtr);
+    LogLinkStats(systemName, networkRecordPtr);
 
     // Stop Network Keep-Alive service
     StopNetworkKeepAliveService(systemName, networkRecordPtr);
@@ -33,6 +33,23 @@
 #define RPC_PROXY_RECV_BUFFER_MAX               (RPC_PROXY_MAX_MESSAGE + RPC_PROXY_MSG_HEADER_SIZE)
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the per-link buffers used to batch outgoing messages and to stage incoming data.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_LINK_BUFFER_MAX               LE_CONFIG_RPC_PROXY_LINK_BUFFER_SIZE
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Length of the window (in milliseconds) during which outgoing messages are coalesced into a single
+ * frame.  Zero disables send batching.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_BATCH_WINDOW_MS               LE_CONFIG_RPC_PROXY_BATCH_WINDOW
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * RPC Proxy Network Operational State definition
@@ -89,9 +106,59 @@ typedef struct NetworkMessageState
     size_t   offSet;       ///< Offset into the receive buffer where new data should be written
     uint8_t  type;         ///< Message Type (RPC_PROXY_CONNECT_SERVICE_REQUEST,
                            ///< RPC_PROXY_CONNECT_SERVICE_RESPONSE, etc.)
+    char     stageBuffer[RPC_PROXY_LINK_BUFFER_MAX]; ///< Data read from the link, not parsed yet
+    size_t   stageSize;    ///< Number of bytes in the staging buffer
+    size_t   stageOffSet;  ///< Offset of the first unparsed byte in the staging buffer
 }
 NetworkMessageState_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * RPC Proxy Network Send Batch structure
+ *
+ * Messages sent while the batching window of a link is open are serialized back-to-back into the
+ * batch buffer and written to the link as a single frame when the window closes.  As the links are
+ * byte streams, the far side parses a batch exactly like messages sent one by one.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct NetworkSendBatch
+{
+    uint8_t         buffer[RPC_PROXY_LINK_BUFFER_MAX]; ///< Serialized messages waiting to be sent
+    size_t          size;           ///< Number of bytes in the batch buffer
+    uint32_t        msgCount;       ///< Number of messages in the batch buffer
+    uint64_t        firstQueuedUs;  ///< Time the oldest message was queued (relative, usec)
+    uint64_t        queuedUsSum;    ///< Sum of the times the messages were queued (relative, usec)
+    le_timer_Ref_t  windowTimerRef; ///< Batching window timer
+}
+NetworkSendBatch_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * RPC Proxy Network Link counters
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct NetworkLinkStats
+{
+    uint64_t txMsgCount;      ///< Number of messages sent
+    uint64_t txFrameCount;    ///< Number of writes to the link
+    uint64_t txByteCount;     ///< Number of bytes written to the link
+    uint64_t txQueueDelayUs;  ///< Total time messages waited in the send batch (usec)
+    uint64_t txQueueDelayMaxUs; ///< Longest time a message waited in the send batch (usec)
+    uint64_t rxMsgCount;      ///< Number of messages received
+    uint64_t rxFrameCount;    ///< Number of reads returning data from the link
+    uint64_t rxByteCount;     ///< Number of bytes read from the link
+    uint64_t txCompressedCount; ///< Number of messages sent compressed
+    uint64_t txCompressSkipCount; ///< Number of messages sent uncompressed as deflating didn't pay
+    uint64_t txCompressInBytes; ///< Payload bytes before compression
+    uint64_t txCompressOutBytes; ///< Payload bytes after compression
+    uint64_t txCompressUs;    ///< Time spent compressing payloads (usec)
+    uint64_t rxCompressedCount; ///< Number of compressed messages received
+    uint64_t rxCompressInBytes; ///< Payload bytes before decompression
+    uint64_t rxCompressOutBytes; ///< Payload bytes after decompression
+    uint64_t rxDecompressUs;  ///< Time spent decompressing payloads (usec)
+}
+NetworkLinkStats_t;
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -105,6 +172,8 @@ typedef struct NetworkRecord
     NetworkConnectionType_t  type;      ///< Type of network connection
     le_timer_Ref_t           keepAliveTimerRef; ///< Keep-Alive Timer Ref
     NetworkMessageState_t    messageState; ///< Message Re-assembly State-Machine
+    NetworkSendBatch_t       sendBatch; ///< Outgoing messages waiting to be sent
+    NetworkLinkStats_t       stats;     ///< Link counters
 }
 NetworkRecord_t;
 
@@ -177,6 +246,29 @@ le_result_t rpcProxyNetwork_CreateNetworkCommunicationChannel
     const char* systemName ///< System name
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for sending a serialized Proxy Message on the link to a system.
+ *
+ * If the batching window of the link is closed, the message is sent right away and the window is
+ * opened.  Otherwise the message is queued and sent with the other messages of the batch when the
+ * window closes or when the batch buffer is full.
+ *
+ * @note If the link fails, the Network Communication Channel is deleted.
+ *
+ * @return
+ *      - LE_OK, if successfully sent or queued,
+ *      - otherwise failure.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyNetwork_SendMsg
+(
+    const char* systemName, ///< System name
+    NetworkRecord_t* networkRecordPtr, ///< Network Record of the system
+    const void* bufferPtr, ///< Serialized Proxy Message
+    size_t bufferSize ///< Size of the serialized Proxy Message
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function for deleting a Network Communication Channel, using system-name.
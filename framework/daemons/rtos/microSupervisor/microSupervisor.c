@@ -24,6 +24,7 @@
 #include "safeRef.h"
 #include "test.h"
 #include "thread.h"
+#include "threadPool.h"
 #include "timer.h"
 #include "fa/atomFile.h"
 
@@ -114,6 +115,7 @@ static void InitLegatoFramework
     event_Init();       // Uses memory pools.
     timer_Init();       // Uses event loop.
     thread_Init();      // Uses event loop, memory pools and safe references.
+    threadPool_Init();  // Uses memory pools.
     test_Init();        // Uses mutexes.
     msg_Init();         // Uses event loop.
     atomFile_Init();    // Uses memory pools.
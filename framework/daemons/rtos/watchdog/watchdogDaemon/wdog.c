@@ -329,6 +329,27 @@ le_result_t le_wdog_GetMaxWatchdogTimeout
     return LE_NOT_FOUND;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a shared memory kick slot for this process.
+ *
+ * @return
+ *      - LE_NOT_IMPLEMENTED Kick slots are not supported on this platform
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_wdog_GetKickSlot
+(
+    int* fdPtr ///< [OUT] Shared memory file holding the kick slot
+)
+{
+    if (fdPtr != NULL)
+    {
+        *fdPtr = -1;
+    }
+
+    return LE_NOT_IMPLEMENTED;
+}
+
 COMPONENT_INIT
 {
     // Initialize hashmaps for storing watchdog information
@@ -12,6 +12,7 @@
  * @section Crc32 Computing a CRC32
  *
  *   - @c le_crc_Crc32() - Compute the CRC32 of a memory buffer
+ *   - @c le_crc_Crc32c() - Compute the CRC32C (Castagnoli polynomial) of a memory buffer
  *
  * The CRC32 is computed by the function @ref le_crc_Crc32. It takes a base buffer address, a length
  * and a CRC32. When the CRC32 is expected to be first computed, the value @ref LE_CRC_START_CRC32
@@ -52,6 +53,13 @@
  * }
  * @endcode
  *
+ * @ref le_crc_Crc32c works the same way, with the Castagnoli polynomial used by iSCSI, SCTP or
+ * ext4, and also starts with @ref LE_CRC_START_CRC32.
+ *
+ * Both functions use the CRC instructions of the CPU when they are available (see the
+ * @c CRC_HW_ACCEL and @c CRC_SLICING_BY_8 configuration options), and always give the same
+ * results whatever the size of the blocks the data is split into.
+ *
  * <HR>
  *
  * Copyright (C) Sierra Wireless Inc.
@@ -96,4 +104,19 @@ uint32_t le_crc_Crc32
     uint32_t crc        ///< [IN] Starting CRC seed
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to calculate a CRC-32C (Castagnoli)
+ *
+ * @return
+ *      - 32-bit CRC
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t le_crc_Crc32c
+(
+    uint8_t* addressPtr,///< [IN] Input buffer
+    size_t   size,      ///< [IN] Number of bytes to read
+    uint32_t crc        ///< [IN] Starting CRC seed
+);
+
 #endif // LEGATO_CRC_INCLUDE_GUARD
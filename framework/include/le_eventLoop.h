@@ -25,6 +25,7 @@
  * @ref c_event_dispatchingToOtherThreads <br>
  * @ref c_event_publishSubscribe <br>
  * @ref c_event_layeredPublishSubscribe <br>
+ * @ref c_event_coalescing <br>
  *
  * Other Legato C Runtime Library APIs using the event loop include:
  *
@@ -437,6 +438,52 @@
  *
  * @endcode
  *
+ * @section c_event_coalescing Coalescing Event Reports
+ *
+ * By default, every call to le_event_Report() queues a new report to each handler of the event.
+ * If an event is reported faster than a handler can process it (e.g., signal strength or position
+ * updates), the handler's Event Queue keeps growing with reports that are stale by the time they
+ * are handled.
+ *
+ * le_event_SetCoalescing() makes an Event ID coalesce its reports instead.  While a report is
+ * still waiting in the Event Queue of a handler, a new report doesn't get queued for that
+ * handler, but updates the waiting report in place:
+ *  - @c LE_EVENT_COALESCE_LATEST replaces the payload of the waiting report with the new one, so
+ *    the handler only sees the latest value.
+ *  - @c LE_EVENT_COALESCE_MERGE calls a merge function to fold the new payload into the waiting
+ *    one (e.g., to keep a minimum and maximum, or to OR together change flags).
+ *
+ * This way, at most one report per handler is queued for the event, and the handler always gets
+ * the freshest data.  The ordering with respect to other events is the one of the first of the
+ * coalesced reports.
+ *
+ * @code
+ * static void MergeSignal
+ * (
+ *     void*       pendingReportPtr,
+ *     const void* newReportPtr,
+ *     size_t      newReportSize
+ * )
+ * {
+ *     Signal_t* pendingPtr = pendingReportPtr;
+ *     const Signal_t* newPtr = newReportPtr;
+ *
+ *     pendingPtr->minRssi = MIN(pendingPtr->minRssi, newPtr->minRssi);
+ *     pendingPtr->rssi = newPtr->rssi;
+ * }
+ *
+ * COMPONENT_INIT
+ * {
+ *     SignalEventId = le_event_CreateId("Signal", sizeof(Signal_t));
+ *     le_event_SetCoalescing(SignalEventId, LE_EVENT_COALESCE_MERGE, MergeSignal);
+ * }
+ * @endcode
+ *
+ * le_event_GetCoalescedCount() returns the number of reports of an event that have been
+ * coalesced into a waiting report, rather than queued.
+ *
+ * Event IDs created using le_event_CreateIdWithRefCounting() can't coalesce their reports.
+ *
  * @section c_event_miscThreadingTopics Miscellaneous Multithreading Topics
  *
  * All functions in this API are thread safe.
@@ -487,8 +534,13 @@
  * For example, the keyword "P/T/events" controls logging for a thread named "T" running inside
  * a process named "P".
  *
- * @todo Add a reference to the Process Inspector and its capabilities for inspecting Event Queues,
- * Event Loops, Handlers and Event Report statistics.
+ * When the framework is built with @c LE_CONFIG_EVENT_LOOP_STATS, each thread's Event Loop times
+ * every queued function, event handler, file descriptor handler and timer expiry handler it
+ * calls.  The @ref toolsTarget_inspect tool displays the number of calls and the cumulative and
+ * longest run times of each handler (<c>inspect handlers</c>), and the depth of each thread's
+ * Event Queue and the longest time a report waited in it (<c>inspect threads</c>).  A warning is
+ * logged whenever a single handler runs for longer than @c LE_CONFIG_EVENT_LOOP_DISPATCH_BUDGET_MS
+ * milliseconds.
 
  * <HR>
  *
@@ -633,6 +685,40 @@ typedef void (*le_event_DeferredFunc_t)
 typedef struct le_event_Handler* le_event_HandlerRef_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Coalescing of the reports of an event.  See @ref c_event_coalescing for more information.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    LE_EVENT_COALESCE_NONE,     ///< Every report is queued (default).
+    LE_EVENT_COALESCE_LATEST,   ///< A new report replaces the report waiting to be handled.
+    LE_EVENT_COALESCE_MERGE     ///< A new report is merged into the report waiting to be handled.
+}
+le_event_Coalesce_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for functions merging a new event report into a report waiting to be handled:
+ *
+ * @param pendingReportPtr [in,out] Pointer to the payload of the report waiting to be handled.
+ * @param newReportPtr [in] Pointer to the payload passed to le_event_Report().
+ * @param newReportSize [in] Size of the payload passed to le_event_Report().
+ *
+ * @warning Merge functions are called by the reporting thread, with the Event Loop API's lock
+ *          held.  They must be short, and must not call any Legato API function.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_event_MergeFunc_t)
+(
+    void*       pendingReportPtr,
+    const void* newReportPtr,
+    size_t      newReportSize
+);
+
+
 #if LE_CONFIG_EVENT_NAMES_ENABLED
 //--------------------------------------------------------------------------------------------------
 /**
@@ -924,6 +1010,39 @@ void le_event_ReportWithRefCounting
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets how the reports of an event are coalesced while they wait to be handled.  See
+ * @ref c_event_coalescing for more information.
+ *
+ * @note Terminates the process if the Event ID was created using
+ *       le_event_CreateIdWithRefCounting(), or if no merge function is given for
+ *       @c LE_EVENT_COALESCE_MERGE.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_event_SetCoalescing
+(
+    le_event_Id_t           eventId,    ///< [in] Event ID created using le_event_CreateId().
+    le_event_Coalesce_t     coalesce,   ///< [in] How reports are to be coalesced.
+    le_event_MergeFunc_t    mergeFunc   ///< [in] Merge function for LE_EVENT_COALESCE_MERGE,
+                                        ///<      or NULL.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the number of reports of an event that were coalesced into a report waiting to be handled,
+ * instead of being queued.
+ *
+ * @return The number of coalesced reports.
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_event_GetCoalescedCount
+(
+    le_event_Id_t   eventId     ///< [in] Event ID.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets the context pointer for a given event handler.
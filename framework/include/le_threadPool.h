@@ -0,0 +1,229 @@
+/** @page c_threadPool Thread Pool API
+ *
+ * @subpage le_threadPool.h "API Reference"
+ *
+ * <HR>
+ *
+ * A thread pool runs blocking or CPU-heavy work (compression, hashing, decoding, etc.) on a set
+ * of worker threads, so that the thread submitting the work can keep servicing its Event Loop.
+ * When a piece of work is done, its completion function is called back by the Event Loop of the
+ * thread that submitted it, so the result can be processed without any locking.
+ *
+ * @section threadPool_create Creating a Thread Pool
+ *
+ * le_threadPool_Create() creates a thread pool, returning a reference to it (of type
+ * le_threadPool_Ref_t).
+ *
+ * A thread pool has between @c minWorkers and @c maxWorkers worker threads:
+ *  - @c minWorkers workers are started when the pool is created, and run until it is deleted.
+ *  - Additional workers are started, up to @c maxWorkers, when work is submitted while all the
+ *    running workers are busy.  They stop after they have been idle for a while.
+ *
+ * A pool with @c minWorkers equal to @c maxWorkers has a fixed set of workers.  A pool with
+ * @c minWorkers set to zero has no threads at all when there is no work to do.
+ *
+ * All thread pools have names.  This is required for diagnostic purposes.  See
+ * @ref threadPool_diagnostics below.
+ *
+ * @section threadPool_submit Submitting Work
+ *
+ * le_threadPool_Submit() queues a work function to be called by one of the workers of a pool,
+ * and optionally a completion function to be called afterwards by the submitting thread.  Both
+ * functions are passed the same two parameters, which usually point to the request and to the
+ * storage for its result:
+ *
+ * @code
+ * static void ComputeDigest
+ * (
+ *     void* param1Ptr,
+ *     void* param2Ptr
+ * )
+ * {
+ *     Request_t* requestPtr = param1Ptr;
+ *
+ *     // Runs in a worker thread.
+ *     requestPtr->result = HashFile(requestPtr->path, requestPtr->digest);
+ * }
+ *
+ * static void ReportDigest
+ * (
+ *     void* param1Ptr,
+ *     void* param2Ptr
+ * )
+ * {
+ *     Request_t* requestPtr = param1Ptr;
+ *
+ *     // Runs in the thread that called le_threadPool_Submit().
+ *     SendDigest(requestPtr->clientRef, requestPtr->result, requestPtr->digest);
+ *     le_mem_Release(requestPtr);
+ * }
+ *
+ *     ...
+ *     le_threadPool_Submit(HashPool, ComputeDigest, ReportDigest, requestPtr, NULL);
+ * @endcode
+ *
+ * The completion function is queued to the Event Loop of the submitting thread, in the same way
+ * as le_event_QueueFunctionToThread() does.  If that thread isn't running its Event Loop, the
+ * completion function will never be called.  Work functions themselves may submit more work, but
+ * only without a completion function, as workers don't run an Event Loop.
+ *
+ * Each worker has its own queue of work.  Work submitted by a worker is queued to its own queue,
+ * and run by it next (most recent first), as this is the work most likely to use data still in
+ * its cache.  Work submitted by other threads is queued to a queue shared by all the workers.
+ * A worker that runs out of work steals the oldest work from the queue of another worker.
+ * The order in which work items are run is therefore not guaranteed.
+ *
+ * @section threadPool_delete Deleting a Thread Pool
+ *
+ * le_threadPool_Delete() runs all the work already submitted to the pool, stops its workers and
+ * deletes it.  No work may be submitted to the pool once its deletion has started.  The
+ * completion functions of the work run before the deletion are still called.
+ *
+ * @section threadPool_diagnostics Diagnostics
+ *
+ * le_threadPool_GetStats() retrieves the worker and work counters of a thread pool.
+ *
+ * The command-line @ref toolsTarget_inspect tool (<c>inspect threadpools</c>) can be used to list
+ * the thread pools that currently exist inside a given process, with the same counters.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+//--------------------------------------------------------------------------------------------------
+/** @file le_threadPool.h
+ *
+ * Legato @ref c_threadPool include file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_THREAD_POOL_INCLUDE_GUARD
+#define LEGATO_THREAD_POOL_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a thread pool.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_threadPool* le_threadPool_Ref_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for work functions, called by a worker thread of the pool.
+ *
+ * @param param1Ptr Value passed in as param1Ptr to le_threadPool_Submit().
+ * @param param2Ptr Value passed in as param2Ptr to le_threadPool_Submit().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_threadPool_WorkFunc_t)
+(
+    void* param1Ptr,
+    void* param2Ptr
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for completion functions, called by the Event Loop of the thread that submitted the
+ * work, once the work function has returned.
+ *
+ * @param param1Ptr Value passed in as param1Ptr to le_threadPool_Submit().
+ * @param param2Ptr Value passed in as param2Ptr to le_threadPool_Submit().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_threadPool_CompletionFunc_t)
+(
+    void* param1Ptr,
+    void* param2Ptr
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread pool statistics.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    size_t      workerCount;        ///< Number of running workers.
+    size_t      maxWorkerCount;     ///< Highest number of running workers.
+    size_t      idleCount;          ///< Number of workers waiting for work.
+    size_t      queuedCount;        ///< Number of work items waiting for a worker.
+    size_t      maxQueuedCount;     ///< Highest number of work items waiting for a worker.
+    uint64_t    submitCount;        ///< Number of work items submitted.
+    uint64_t    completeCount;      ///< Number of work items run.
+    uint64_t    stealCount;         ///< Number of work items stolen from another worker's queue.
+}
+le_threadPool_Stats_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a thread pool, and start its first @c minWorkers workers.
+ *
+ * @return Reference to the thread pool.
+ *
+ * @note Terminates the process on failure, no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_threadPool_Ref_t le_threadPool_Create
+(
+    const char* name,       ///< [IN] Name of the thread pool; also used to name its workers.
+    size_t      minWorkers, ///< [IN] Number of workers running at all times.
+    size_t      maxWorkers  ///< [IN] Maximum number of workers; between 1 and
+                            ///       LE_CONFIG_THREAD_POOL_MAX_WORKERS, and at least minWorkers.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Submit work to a thread pool.
+ *
+ * The work function will be called by one of the workers of the pool.  If a completion function
+ * is given, it will then be queued to the Event Loop of the calling thread.
+ *
+ * @note Terminates the process on failure, no need to check for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Submit
+(
+    le_threadPool_Ref_t             poolRef,        ///< [IN] Thread pool.
+    le_threadPool_WorkFunc_t        workFunc,       ///< [IN] Work function.
+    le_threadPool_CompletionFunc_t  completionFunc, ///< [IN] Completion function, or NULL.
+    void*                           param1Ptr,      ///< [IN] Passed to both functions.
+    void*                           param2Ptr       ///< [IN] Passed to both functions.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the statistics of a thread pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_GetStats
+(
+    le_threadPool_Ref_t     poolRef,    ///< [IN] Thread pool.
+    le_threadPool_Stats_t*  statsPtr    ///< [OUT] Statistics.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a thread pool.
+ *
+ * Blocks until all the work submitted to the pool has been run, and its workers have stopped.
+ *
+ * @warning Must not be called by a worker of the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Delete
+(
+    le_threadPool_Ref_t poolRef     ///< [IN] Thread pool.
+);
+
+
+#endif // LEGATO_THREAD_POOL_INCLUDE_GUARD
@@ -49,6 +49,7 @@
  * | @subpage c_singlyLinkedList  | @ref le_singlyLinkedList.h  | @c le_singlyLinkedList.h | Provides a data structure consisting of a group of nodes linked together linearly                                         |
  * | @subpage c_test              | @ref le_test.h              | @c le_test.h             | Provides macros that are used to simplify unit testing                                                                    |
  * | @subpage c_threading         | @ref le_thread.h            | @c le_thread.h           | Provides controls for creating, ending and joining threads                                                                |
+ * | @subpage c_threadPool        | @ref le_threadPool.h        | @c le_threadPool.h       | Provides pools of worker threads running work submitted by event-driven threads                                           |
  * | @subpage c_timer             | @ref le_timer.h             | @c le_timer.h            | Provides functions for managing and using timers                                                                          |
  * | @subpage c_tty               | @ref le_tty.h               | @c le_tty.h              | Provides routines to configure serial ports                                                                               |
  * | @subpage c_utf8              | @ref le_utf8.h              | @c le_utf8.h             | Provides safe and easy to use string handling functions for null-terminated strings with UTF-8 encoding                   |
@@ -220,6 +221,7 @@ extern "C" {
 #include "le_singlyLinkedList.h"
 #include "le_test.h"
 #include "le_thread.h"
+#include "le_threadPool.h"
 #include "le_timer.h"
 #include "le_tty.h"
 #include "le_utf8.h"
@@ -3,12 +3,364 @@
  *
  * This module contains functions perform base64 encoding/decoding.
  *
+ * When LE_CONFIG_STRING_SIMD is set, long runs of data are processed with SIMD instructions when
+ * available: SSSE3 on x86, selected at run time according to the CPU features, and NEON on ARM
+ * when the target is built for it.  They give the same results as the byte by byte processing.
+ *
  * Copyright (C) Sierra Wireless Inc.
  *
  */
 
 #include "legato.h"
 
+#if LE_CONFIG_STRING_SIMD && (defined(__x86_64__) || defined(__i386__))
+#   define BASE64_SIMD_X86  1
+#   include <immintrin.h>
+#elif LE_CONFIG_STRING_SIMD && defined(__ARM_NEON)
+#   define BASE64_SIMD_NEON 1
+#   include <arm_neon.h>
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of characters decoded per step by the SIMD instructions.
+ */
+//--------------------------------------------------------------------------------------------------
+#if BASE64_SIMD_X86
+#   define DECODE_BLOCK_SIZE    16
+#elif BASE64_SIMD_NEON
+#   define DECODE_BLOCK_SIZE    64
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Base64 alphabet
+ */
+//--------------------------------------------------------------------------------------------------
+static const char EncodeTable[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#if BASE64_SIMD_X86
+//--------------------------------------------------------------------------------------------------
+/**
+ * Encode groups of 12 bytes with SSSE3 instructions, as long as 16 bytes can be read.
+ *
+ * @return
+ *      - Number of bytes encoded, multiple of 3
+ */
+//--------------------------------------------------------------------------------------------------
+__attribute__((target("ssse3")))
+static size_t EncodeSsse3
+(
+    const uint8_t*  srcPtr, ///< [IN] Data to be encoded
+    size_t          srcLen, ///< [IN] Data length
+    char*           dstPtr  ///< [OUT] Base64-encoded characters
+)
+{
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    size_t x;
+
+    for (x = 0; (x + 16) <= srcLen; x += 12, dstPtr += 16)
+    {
+        // Each 32-bit lane gets 3 bytes, then their four 6-bit indexes, one per byte
+        __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(srcPtr + x)), shuffle);
+        __m128i indexes = _mm_or_si128(
+            _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)),
+                            _mm_set1_epi32(0x04000040)),
+            _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)),
+                            _mm_set1_epi32(0x01000010)));
+
+        // Select the offset from the index to its character: 13 for [0, 25], 0 for [26, 51]
+        // and 1 to 12 for [52, 63]
+        __m128i select = _mm_subs_epu8(indexes, _mm_set1_epi8(51));
+        select = _mm_or_si128(select, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indexes),
+                                                    _mm_set1_epi8(13)));
+
+        _mm_storeu_si128((__m128i*)dstPtr,
+                         _mm_add_epi8(indexes, _mm_shuffle_epi8(offsets, select)));
+    }
+
+    return x;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decode groups of 16 characters with SSSE3 instructions, up to the first group holding a
+ * character out of the base64 alphabet, or padding, or whitespace.
+ *
+ * @return
+ *      - Number of characters decoded, multiple of 16
+ */
+//--------------------------------------------------------------------------------------------------
+__attribute__((target("ssse3")))
+static size_t DecodeSsse3
+(
+    const char* srcPtr, ///< [IN] Encoded characters
+    size_t      srcLen, ///< [IN] Number of characters
+    uint8_t*    dstPtr, ///< [OUT] Binary data buffer
+    size_t      dstLen  ///< [IN] Binary data buffer size
+)
+{
+    // Characters out of the alphabet have a common bit set in the entries of their low and high
+    // nibbles
+    const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    // Offsets from the characters to their values, per high nibble, '/' being moved to entry 1
+    const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                          0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    uint8_t block[16];
+    size_t x;
+
+    for (x = 0; ((x + 16) <= srcLen) && (dstLen >= 12); x += 16, dstPtr += 12, dstLen -= 12)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i*)(srcPtr + x));
+        __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), nibbleMask);
+        __m128i check = _mm_and_si128(_mm_shuffle_epi8(lutLo, _mm_and_si128(in, nibbleMask)),
+                                      _mm_shuffle_epi8(lutHi, hiNibbles));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(check, _mm_setzero_si128())) != 0xFFFF)
+        {
+            break;
+        }
+
+        __m128i roll = _mm_add_epi8(_mm_cmpeq_epi8(in, _mm_set1_epi8('/')), hiNibbles);
+        __m128i values = _mm_add_epi8(in, _mm_shuffle_epi8(lutRoll, roll));
+
+        // Merge the 6-bit values in pairs, then the pairs in 24-bit values, one per 32-bit lane
+        __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)),
+                                        _mm_set1_epi32(0x00011000));
+
+        _mm_storeu_si128((__m128i*)block, _mm_shuffle_epi8(merged, pack));
+        memcpy(dstPtr, block, 12);
+    }
+
+    return x;
+}
+
+#elif BASE64_SIMD_NEON
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert 6-bit indexes into characters of the base64 alphabet with NEON instructions.
+ *
+ * @return
+ *      - Characters
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint8x16_t IndexToCharNeon
+(
+    uint8x16_t indexes  ///< [IN] Indexes in [0, 63]
+)
+{
+    // Offset from 'A', then corrected at the start of the next ranges: 'a' - 26, '0' - 52,
+    // '+' - 62 and '/' - 63
+    uint8x16_t offsets = vdupq_n_u8('A');
+
+    offsets = vaddq_u8(offsets, vandq_u8(vcgeq_u8(indexes, vdupq_n_u8(26)), vdupq_n_u8(6)));
+    offsets = vsubq_u8(offsets, vandq_u8(vcgeq_u8(indexes, vdupq_n_u8(52)), vdupq_n_u8(75)));
+    offsets = vsubq_u8(offsets, vandq_u8(vcgeq_u8(indexes, vdupq_n_u8(62)), vdupq_n_u8(15)));
+    offsets = vaddq_u8(offsets, vandq_u8(vceqq_u8(indexes, vdupq_n_u8(63)), vdupq_n_u8(3)));
+
+    return vaddq_u8(indexes, offsets);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert characters of the base64 alphabet into their 6-bit values with NEON instructions.
+ *
+ * @return
+ *      - Values, meaningless for the characters flagged as invalid
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint8x16_t CharToIndexNeon
+(
+    uint8x16_t  chars,          ///< [IN] Characters
+    uint8x16_t* invalidPtr      ///< [INOUT] Non-zero bytes set for characters out of the alphabet
+)
+{
+    uint8x16_t upper = vcltq_u8(vsubq_u8(chars, vdupq_n_u8('A')), vdupq_n_u8(26));
+    uint8x16_t lower = vcltq_u8(vsubq_u8(chars, vdupq_n_u8('a')), vdupq_n_u8(26));
+    uint8x16_t digit = vcltq_u8(vsubq_u8(chars, vdupq_n_u8('0')), vdupq_n_u8(10));
+    uint8x16_t plus = vceqq_u8(chars, vdupq_n_u8('+'));
+    uint8x16_t slash = vceqq_u8(chars, vdupq_n_u8('/'));
+    uint8x16_t offsets;
+
+    offsets = vandq_u8(upper, vdupq_n_u8((uint8_t)(0 - 'A')));
+    offsets = vorrq_u8(offsets, vandq_u8(lower, vdupq_n_u8((uint8_t)(26 - 'a'))));
+    offsets = vorrq_u8(offsets, vandq_u8(digit, vdupq_n_u8((uint8_t)(52 - '0'))));
+    offsets = vorrq_u8(offsets, vandq_u8(plus, vdupq_n_u8((uint8_t)(62 - '+'))));
+    offsets = vorrq_u8(offsets, vandq_u8(slash, vdupq_n_u8((uint8_t)(63 - '/'))));
+
+    *invalidPtr = vorrq_u8(*invalidPtr,
+                           vmvnq_u8(vorrq_u8(vorrq_u8(upper, lower),
+                                             vorrq_u8(digit, vorrq_u8(plus, slash)))));
+
+    return vaddq_u8(chars, offsets);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Encode groups of 48 bytes with NEON instructions.
+ *
+ * @return
+ *      - Number of bytes encoded, multiple of 3
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t EncodeNeon
+(
+    const uint8_t*  srcPtr, ///< [IN] Data to be encoded
+    size_t          srcLen, ///< [IN] Data length
+    char*           dstPtr  ///< [OUT] Base64-encoded characters
+)
+{
+    const uint8x16_t mask = vdupq_n_u8(63);
+    size_t x;
+
+    for (x = 0; (x + 48) <= srcLen; x += 48, dstPtr += 64)
+    {
+        // Bytes are loaded de-interleaved, one vector per byte of the groups of 3
+        uint8x16x3_t in = vld3q_u8(srcPtr + x);
+        uint8x16x4_t out;
+
+        out.val[0] = vshrq_n_u8(in.val[0], 2);
+        out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+        out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+        out.val[3] = vandq_u8(in.val[2], mask);
+
+        out.val[0] = IndexToCharNeon(out.val[0]);
+        out.val[1] = IndexToCharNeon(out.val[1]);
+        out.val[2] = IndexToCharNeon(out.val[2]);
+        out.val[3] = IndexToCharNeon(out.val[3]);
+
+        vst4q_u8((uint8_t*)dstPtr, out);
+    }
+
+    return x;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decode groups of 64 characters with NEON instructions, up to the first group holding a
+ * character out of the base64 alphabet, or padding, or whitespace.
+ *
+ * @return
+ *      - Number of characters decoded, multiple of 64
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t DecodeNeon
+(
+    const char* srcPtr, ///< [IN] Encoded characters
+    size_t      srcLen, ///< [IN] Number of characters
+    uint8_t*    dstPtr, ///< [OUT] Binary data buffer
+    size_t      dstLen  ///< [IN] Binary data buffer size
+)
+{
+    size_t x;
+
+    for (x = 0; ((x + 64) <= srcLen) && (dstLen >= 48); x += 64, dstPtr += 48, dstLen -= 48)
+    {
+        // Characters are loaded de-interleaved, one vector per character of the groups of 4
+        uint8x16x4_t in = vld4q_u8((const uint8_t*)srcPtr + x);
+        uint8x16_t invalid = vdupq_n_u8(0);
+        uint8x16_t a = CharToIndexNeon(in.val[0], &invalid);
+        uint8x16_t b = CharToIndexNeon(in.val[1], &invalid);
+        uint8x16_t c = CharToIndexNeon(in.val[2], &invalid);
+        uint8x16_t d = CharToIndexNeon(in.val[3], &invalid);
+        uint8x8_t folded = vorr_u8(vget_low_u8(invalid), vget_high_u8(invalid));
+        uint8x16x3_t out;
+
+        if (vget_lane_u64(vreinterpret_u64_u8(folded), 0) != 0)
+        {
+            break;
+        }
+
+        out.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+
+        vst3q_u8(dstPtr, out);
+    }
+
+    return x;
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Encode the complete groups of 3 bytes, without checking the space left in the string buffer.
+ *
+ * @return
+ *      - Number of bytes encoded, multiple of 3
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t EncodeGroups
+(
+    const uint8_t*  srcPtr, ///< [IN] Data to be encoded
+    size_t          srcLen, ///< [IN] Data length
+    char*           dstPtr  ///< [OUT] Base64-encoded characters, 4 per group of 3 bytes
+)
+{
+    size_t x = 0;
+    uint32_t n;
+
+#if BASE64_SIMD_X86
+    if (__builtin_cpu_supports("ssse3"))
+    {
+        x = EncodeSsse3(srcPtr, srcLen, dstPtr);
+    }
+#elif BASE64_SIMD_NEON
+    x = EncodeNeon(srcPtr, srcLen, dstPtr);
+#endif
+
+    for (dstPtr += x / 3 * 4; (x + 3) <= srcLen; x += 3, dstPtr += 4)
+    {
+        n = ((uint32_t)srcPtr[x] << 16) | ((uint32_t)srcPtr[x + 1] << 8) | srcPtr[x + 2];
+
+        dstPtr[0] = EncodeTable[n >> 18];
+        dstPtr[1] = EncodeTable[(n >> 12) & 63];
+        dstPtr[2] = EncodeTable[(n >> 6) & 63];
+        dstPtr[3] = EncodeTable[n & 63];
+    }
+
+    return x;
+}
+
+#if BASE64_SIMD_X86 || BASE64_SIMD_NEON
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decode the groups of characters with SIMD instructions, up to the first group holding a
+ * character out of the base64 alphabet, or padding, or whitespace.
+ *
+ * @return
+ *      - Number of characters decoded, multiple of 4
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t DecodeBlocks
+(
+    const char* srcPtr, ///< [IN] Encoded characters
+    size_t      srcLen, ///< [IN] Number of characters
+    uint8_t*    dstPtr, ///< [OUT] Binary data buffer
+    size_t      dstLen  ///< [IN] Binary data buffer size
+)
+{
+#if BASE64_SIMD_X86
+    if (__builtin_cpu_supports("ssse3"))
+    {
+        return DecodeSsse3(srcPtr, srcLen, dstPtr, dstLen);
+    }
+    return 0;
+#else
+    return DecodeNeon(srcPtr, srcLen, dstPtr, dstLen);
+#endif
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Perform base64 data encoding.
@@ -28,10 +380,9 @@ le_result_t le_base64_Encode
     size_t *dstLenPtr       ///< [INOUT] Length of the base64-encoded string buffer
 )
 {
-    const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     const uint8_t *data = (const uint8_t *) srcPtr;
     size_t resultIndex = 0;
-    size_t x;
+    size_t x = 0;
     uint32_t n = 0;
     int padCount = srcLen % 3;
     uint8_t n0, n1, n2, n3;
@@ -43,8 +394,18 @@ le_result_t le_base64_Encode
     }
     resultSize = *dstLenPtr;
 
+    /*
+     * when the whole result fits in the buffer, the complete groups of three characters are
+     * encoded at once
+     */
+    if (resultSize > LE_BASE64_ENCODED_SIZE(srcLen))
+    {
+        x = EncodeGroups(data, srcLen, dstPtr);
+        resultIndex = x / 3 * 4;
+    }
+
     /* increment over the length of the string, three characters at a time */
-    for (x = 0; x < srcLen; x += 3)
+    for (; x < srcLen; x += 3)
     {
         /* these three 8-bit (ASCII) characters become one 24-bit number */
         n = ((uint32_t) data[x]) << 16;
@@ -72,12 +433,12 @@ le_result_t le_base64_Encode
         {
             return LE_OVERFLOW;
         }
-        dstPtr[resultIndex++] = base64Chars[n0];
+        dstPtr[resultIndex++] = EncodeTable[n0];
         if(resultIndex >= resultSize)
         {
             return LE_OVERFLOW;
         }
-        dstPtr[resultIndex++] = base64Chars[n1];
+        dstPtr[resultIndex++] = EncodeTable[n1];
 
         /*
          * if we have only two bytes available, then their encoding is
@@ -89,7 +450,7 @@ le_result_t le_base64_Encode
             {
                 return LE_OVERFLOW;
             }
-            dstPtr[resultIndex++] = base64Chars[n2];
+            dstPtr[resultIndex++] = EncodeTable[n2];
         }
 
         /*
@@ -102,7 +463,7 @@ le_result_t le_base64_Encode
             {
                 return LE_OVERFLOW;
             }
-            dstPtr[resultIndex++] = base64Chars[n3];
+            dstPtr[resultIndex++] = EncodeTable[n3];
         }
     }
 
@@ -197,7 +558,26 @@ le_result_t le_base64_Decode
 
     while (in < end)
     {
-        unsigned char c = DecodeTable[(int)(*in++)];
+#if BASE64_SIMD_X86 || BASE64_SIMD_NEON
+        /*
+         * complete groups of characters are decoded at once, up to the first whitespace, padding
+         * or invalid character, which is left to the byte by byte decoding
+         */
+        if ((0 == iter) && ((size_t)(end - in) >= DECODE_BLOCK_SIZE))
+        {
+            size_t count = DecodeBlocks(in, end - in, out, outLen - len);
+
+            if (count > 0)
+            {
+                in += count;
+                out += count / 4 * 3;
+                len += count / 4 * 3;
+                continue;
+            }
+        }
+#endif
+
+        unsigned char c = DecodeTable[(unsigned char)(*in++)];
 
         switch (c)
         {
@@ -3,7 +3,18 @@
  *
  * This module contains functions to compute CRC.
  *
- * @note Only CRC32 is supported in this API
+ * @note Only CRC32 (IEEE 802.3) and CRC32C (Castagnoli) are supported in this API
+ *
+ * Both CRCs are computed by a table-driven engine, which processes one byte per step with a
+ * constant table. When LE_CONFIG_CRC_SLICING_BY_8 is set, it processes 8 bytes per step with
+ * slicing-by-8 tables, built at first use by one thread while the others use the byte table.
+ *
+ * When LE_CONFIG_CRC_HW_ACCEL is set, the CPU instructions are used instead when available:
+ *  - x86: carry-less multiplication (PCLMULQDQ) for CRC32, and the SSE4.2 crc32 instruction for
+ *    CRC32C, selected at run time according to the CPU features,
+ *  - ARMv8: the crc32 and crc32c instructions, when the target supports them.
+ *
+ * All the engines give the same results.
  *
  * Copyright (C) Sierra Wireless Inc.
  *
@@ -13,16 +24,61 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
+#include "le_config.h"
 #include "le_basics.h"
 #include "le_crc.h"
 
+#if LE_CONFIG_CRC_HW_ACCEL && (defined(__x86_64__) || defined(__i386__))
+#   define CRC_HW_X86   1
+#   include <immintrin.h>
+#elif LE_CONFIG_CRC_HW_ACCEL && defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#   define CRC_HW_ARM64 1
+#   include <arm_acle.h>
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of tables, i.e. number of bytes processed per step by the table-driven engine.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_CRC_SLICING_BY_8
+#   define CRC_SLICES   8
+#else
+#   define CRC_SLICES   1
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Polynomials, in reflected bit order.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CRC32_POLY      0xEDB88320U
+#define CRC32C_POLY     0x82F63B78U
+
 //--------------------------------------------------------------------------------------------------
 /**
- * CRC table
+ * Minimum buffer size handled by the CPU instructions: shorter buffers are faster with tables.
  */
 //--------------------------------------------------------------------------------------------------
-static const unsigned int Crc32Table[256] =
+#define CRC_HW_MIN_SIZE 64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * States of a CRC engine.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CRC_ENGINE_UNINIT       0   ///< Nothing built nor selected yet
+#define CRC_ENGINE_INIT_ONGOING 1   ///< A thread is building the tables
+#define CRC_ENGINE_READY        2   ///< Tables built and hwFunc selected
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * CRC32 table
+ */
+//--------------------------------------------------------------------------------------------------
+static const uint32_t Crc32Table[256] =
 {
     0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA,     /* 0x00 */
     0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,     /* 0x04 */
@@ -92,24 +148,525 @@ static const unsigned int Crc32Table[256] =
 
 //--------------------------------------------------------------------------------------------------
 /**
- * This function is used to calculate a CRC-32
+ * CRC32C table
+ */
+//--------------------------------------------------------------------------------------------------
+static const uint32_t Crc32cTable[256] =
+{
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4,     /* 0x00 */
+    0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,     /* 0x04 */
+    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B,     /* 0x08 */
+    0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,     /* 0x0C */
+    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B,     /* 0x10 */
+    0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,     /* 0x14 */
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54,     /* 0x18 */
+    0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,     /* 0x1C */
+    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A,     /* 0x20 */
+    0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,     /* 0x24 */
+    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5,     /* 0x28 */
+    0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,     /* 0x2C */
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45,     /* 0x30 */
+    0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,     /* 0x34 */
+    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A,     /* 0x38 */
+    0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,     /* 0x3C */
+    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48,     /* 0x40 */
+    0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,     /* 0x44 */
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687,     /* 0x48 */
+    0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,     /* 0x4C */
+    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927,     /* 0x50 */
+    0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,     /* 0x54 */
+    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8,     /* 0x58 */
+    0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,     /* 0x5C */
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096,     /* 0x60 */
+    0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,     /* 0x64 */
+    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859,     /* 0x68 */
+    0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,     /* 0x6C */
+    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9,     /* 0x70 */
+    0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,     /* 0x74 */
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36,     /* 0x78 */
+    0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,     /* 0x7C */
+    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C,     /* 0x80 */
+    0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,     /* 0x84 */
+    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043,     /* 0x88 */
+    0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,     /* 0x8C */
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3,     /* 0x90 */
+    0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,     /* 0x94 */
+    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C,     /* 0x98 */
+    0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,     /* 0x9C */
+    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652,     /* 0xA0 */
+    0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,     /* 0xA4 */
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D,     /* 0xA8 */
+    0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,     /* 0xAC */
+    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D,     /* 0xB0 */
+    0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,     /* 0xB4 */
+    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2,     /* 0xB8 */
+    0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,     /* 0xBC */
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530,     /* 0xC0 */
+    0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,     /* 0xC4 */
+    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF,     /* 0xC8 */
+    0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,     /* 0xCC */
+    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F,     /* 0xD0 */
+    0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,     /* 0xD4 */
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90,     /* 0xD8 */
+    0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,     /* 0xDC */
+    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE,     /* 0xE0 */
+    0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,     /* 0xE4 */
+    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321,     /* 0xE8 */
+    0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,     /* 0xEC */
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81,     /* 0xF0 */
+    0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,     /* 0xF4 */
+    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E,     /* 0xF8 */
+    0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351      /* 0xFC */
+};
+
+struct CrcEngine;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function computing a CRC with CPU instructions.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef uint32_t (*CrcHwFunc_t)
+(
+    const struct CrcEngine* enginePtr,  ///< [IN] CRC engine
+    const uint8_t*          addressPtr, ///< [IN] Input buffer
+    size_t                  size,       ///< [IN] Number of bytes to read
+    uint32_t                crc         ///< [IN] Starting CRC seed
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * CRC engine of a polynomial.
+ *
+ * The slicing tables and hwFunc are only used once the state is CRC_ENGINE_READY.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct CrcEngine
+{
+    uint32_t        poly;                           ///< Polynomial, in reflected bit order
+    const uint32_t* byteTable;                      ///< Table giving the CRC of a byte
+    int             state;                          ///< CRC_ENGINE_UNINIT, _INIT_ONGOING or
+                                                    ///< _READY
+    CrcHwFunc_t     hwFunc;                         ///< Function using CPU instructions, if
+                                                    ///< available
+#if CRC_SLICES > 1
+    uint32_t      (*sliceTable)[256];               ///< Table k - 1 gives the CRC of a byte
+                                                    ///< followed by k zero bytes
+#endif
+}
+CrcEngine_t;
+
+#if CRC_SLICES > 1
+//--------------------------------------------------------------------------------------------------
+/**
+ * Slicing tables, built at first use.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t Crc32SliceTable[CRC_SLICES - 1][256];
+static uint32_t Crc32cSliceTable[CRC_SLICES - 1][256];
+
+static CrcEngine_t Crc32Engine =
+{
+    .poly = CRC32_POLY, .byteTable = Crc32Table, .sliceTable = Crc32SliceTable
+};
+static CrcEngine_t Crc32cEngine =
+{
+    .poly = CRC32C_POLY, .byteTable = Crc32cTable, .sliceTable = Crc32cSliceTable
+};
+#else
+static CrcEngine_t Crc32Engine = { .poly = CRC32_POLY, .byteTable = Crc32Table };
+static CrcEngine_t Crc32cEngine = { .poly = CRC32C_POLY, .byteTable = Crc32cTable };
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a CRC one byte per step with a byte table.
  *
  * @return
  *      - 32-bit CRC
  */
 //--------------------------------------------------------------------------------------------------
-uint32_t le_crc_Crc32
+static uint32_t ComputeWithByteTable
 (
-    uint8_t* addressPtr,///< [IN] Input buffer
-    size_t   size,      ///< [IN] Number of bytes to read
-    uint32_t crc        ///< [IN] Starting CRC seed
+    const uint32_t* table,      ///< [IN] Byte table
+    const uint8_t*  addressPtr, ///< [IN] Input buffer
+    size_t          size,       ///< [IN] Number of bytes to read
+    uint32_t        crc         ///< [IN] Starting CRC seed
 )
 {
     for (; size > 0 ; size--)
     {
         // byte loop
-        crc = (((crc >> 8) & 0x00FFFFFF) ^ Crc32Table[(crc ^ *addressPtr++) & 0x000000FF]);
+        crc = (((crc >> 8) & 0x00FFFFFF) ^ table[(crc ^ *addressPtr++) & 0x000000FF]);
+    }
+    return crc;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a CRC with all the tables of a ready engine.
+ *
+ * @return
+ *      - 32-bit CRC
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t ComputeWithTables
+(
+    const CrcEngine_t*  enginePtr,  ///< [IN] CRC engine
+    const uint8_t*      addressPtr, ///< [IN] Input buffer
+    size_t              size,       ///< [IN] Number of bytes to read
+    uint32_t            crc         ///< [IN] Starting CRC seed
+)
+{
+#if CRC_SLICES == 8
+    const uint32_t* table = enginePtr->byteTable;
+    const uint32_t (*slices)[256] = enginePtr->sliceTable;
+
+    for (; size >= 8; size -= 8, addressPtr += 8)
+    {
+        // The first 4 bytes are merged with the CRC, whatever the byte order of the CPU
+        uint32_t word = crc ^ ((uint32_t)addressPtr[0] |
+                               ((uint32_t)addressPtr[1] << 8) |
+                               ((uint32_t)addressPtr[2] << 16) |
+                               ((uint32_t)addressPtr[3] << 24));
+
+        crc = slices[6][word & 0xFF] ^
+              slices[5][(word >> 8) & 0xFF] ^
+              slices[4][(word >> 16) & 0xFF] ^
+              slices[3][word >> 24] ^
+              slices[2][addressPtr[4]] ^
+              slices[1][addressPtr[5]] ^
+              slices[0][addressPtr[6]] ^
+              table[addressPtr[7]];
+    }
+#endif
+
+    return ComputeWithByteTable(enginePtr->byteTable, addressPtr, size, crc);
+}
+
+#if CRC_HW_X86
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fold a 128-bit value over the next 128 bits of data.
+ */
+//--------------------------------------------------------------------------------------------------
+__attribute__((target("pclmul,sse4.1")))
+static inline __m128i Fold128
+(
+    __m128i value,      ///< [IN] Value to fold
+    __m128i constants,  ///< [IN] Folding constants, for the distance to the data
+    __m128i data        ///< [IN] Data
+)
+{
+    __m128i low = _mm_clmulepi64_si128(value, constants, 0x00);
+    __m128i high = _mm_clmulepi64_si128(value, constants, 0x11);
+
+    return _mm_xor_si128(_mm_xor_si128(low, high), data);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a CRC32 with carry-less multiplications, by folding the buffer by blocks of 64 bytes,
+ * then reducing the result with a Barrett reduction.
+ *
+ * See "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction", Intel, 2009.
+ * The constants are those of the reflected CRC32 polynomial.
+ *
+ * @return
+ *      - 32-bit CRC
+ */
+//--------------------------------------------------------------------------------------------------
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t Crc32Pclmul
+(
+    const CrcEngine_t*  enginePtr,  ///< [IN] CRC engine
+    const uint8_t*      addressPtr, ///< [IN] Input buffer
+    size_t              size,       ///< [IN] Number of bytes to read
+    uint32_t            crc         ///< [IN] Starting CRC seed
+)
+{
+    const __m128i mask32 = _mm_set_epi32(0, 0, 0, ~0);
+    __m128i constants;
+    __m128i x1, x2, x3, x4;
+
+    if (size < CRC_HW_MIN_SIZE)
+    {
+        return ComputeWithTables(enginePtr, addressPtr, size, crc);
+    }
+
+    x1 = _mm_loadu_si128((const __m128i*)addressPtr);
+    x2 = _mm_loadu_si128((const __m128i*)(addressPtr + 16));
+    x3 = _mm_loadu_si128((const __m128i*)(addressPtr + 32));
+    x4 = _mm_loadu_si128((const __m128i*)(addressPtr + 48));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    addressPtr += 64;
+    size -= 64;
+
+    // Fold 4 x 128 bits over the next 64 bytes
+    constants = _mm_set_epi64x(0x1C6E41596LL, 0x154442BD4LL);
+    for (; size >= 64; size -= 64, addressPtr += 64)
+    {
+        x1 = Fold128(x1, constants, _mm_loadu_si128((const __m128i*)addressPtr));
+        x2 = Fold128(x2, constants, _mm_loadu_si128((const __m128i*)(addressPtr + 16)));
+        x3 = Fold128(x3, constants, _mm_loadu_si128((const __m128i*)(addressPtr + 32)));
+        x4 = Fold128(x4, constants, _mm_loadu_si128((const __m128i*)(addressPtr + 48)));
+    }
+
+    // Fold 4 x 128 bits into 128 bits, then over the remaining 16-byte blocks
+    constants = _mm_set_epi64x(0x0CCAA009ELL, 0x1751997D0LL);
+    x1 = Fold128(x1, constants, x2);
+    x1 = Fold128(x1, constants, x3);
+    x1 = Fold128(x1, constants, x4);
+    for (; size >= 16; size -= 16, addressPtr += 16)
+    {
+        x1 = Fold128(x1, constants, _mm_loadu_si128((const __m128i*)addressPtr));
+    }
+
+    // Fold 128 bits into 64 bits
+    x2 = _mm_clmulepi64_si128(constants, x1, 0x01);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    // Fold 64 bits into 32 bits
+    constants = _mm_set_epi64x(0, 0x163CD6124LL);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), constants, 0x00);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 4), x2);
+
+    // Barrett reduction
+    constants = _mm_set_epi64x(0x1F7011641LL, 0x1DB710641LL);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), constants, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), constants, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    crc = (uint32_t)_mm_extract_epi32(x1, 1);
+
+    // Remaining bytes, fewer than 16
+    return ComputeWithTables(enginePtr, addressPtr, size, crc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a CRC32C with the SSE4.2 crc32 instruction.
+ *
+ * @return
+ *      - 32-bit CRC
+ */
+//--------------------------------------------------------------------------------------------------
+__attribute__((target("sse4.2")))
+static uint32_t Crc32cSse42
+(
+    const CrcEngine_t*  enginePtr,  ///< [IN] CRC engine
+    const uint8_t*      addressPtr, ///< [IN] Input buffer
+    size_t              size,       ///< [IN] Number of bytes to read
+    uint32_t            crc         ///< [IN] Starting CRC seed
+)
+{
+#if defined(__x86_64__)
+    uint64_t crc64 = crc;
+
+    for (; size >= 8; size -= 8, addressPtr += 8)
+    {
+        uint64_t word;
+
+        memcpy(&word, addressPtr, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = (uint32_t)crc64;
+#endif
+
+    for (; size >= 4; size -= 4, addressPtr += 4)
+    {
+        uint32_t word;
+
+        memcpy(&word, addressPtr, sizeof(word));
+        crc = _mm_crc32_u32(crc, word);
+    }
+
+    for (; size > 0; size--)
+    {
+        crc = _mm_crc32_u8(crc, *addressPtr++);
+    }
+    return crc;
+}
+#endif /* CRC_HW_X86 */
+
+#if CRC_HW_ARM64
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a CRC32 with the ARMv8 crc32 instructions.
+ *
+ * @return
+ *      - 32-bit CRC
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t Crc32Arm64
+(
+    const CrcEngine_t*  enginePtr,  ///< [IN] CRC engine
+    const uint8_t*      addressPtr, ///< [IN] Input buffer
+    size_t              size,       ///< [IN] Number of bytes to read
+    uint32_t            crc         ///< [IN] Starting CRC seed
+)
+{
+    for (; size >= 8; size -= 8, addressPtr += 8)
+    {
+        uint64_t word;
+
+        memcpy(&word, addressPtr, sizeof(word));
+        crc = __crc32d(crc, word);
+    }
+
+    for (; size > 0; size--)
+    {
+        crc = __crc32b(crc, *addressPtr++);
     }
     return crc;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a CRC32C with the ARMv8 crc32c instructions.
+ *
+ * @return
+ *      - 32-bit CRC
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t Crc32cArm64
+(
+    const CrcEngine_t*  enginePtr,  ///< [IN] CRC engine
+    const uint8_t*      addressPtr, ///< [IN] Input buffer
+    size_t              size,       ///< [IN] Number of bytes to read
+    uint32_t            crc         ///< [IN] Starting CRC seed
+)
+{
+    for (; size >= 8; size -= 8, addressPtr += 8)
+    {
+        uint64_t word;
+
+        memcpy(&word, addressPtr, sizeof(word));
+        crc = __crc32cd(crc, word);
+    }
+
+    for (; size > 0; size--)
+    {
+        crc = __crc32cb(crc, *addressPtr++);
+    }
+    return crc;
+}
+#endif /* CRC_HW_ARM64 */
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build the slicing tables of an engine, and select the CPU instructions to use.
+ *
+ * Only called by the thread which moved the engine to CRC_ENGINE_INIT_ONGOING.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InitEngine
+(
+    CrcEngine_t*    enginePtr   ///< [IN] CRC engine
+)
+{
+#if CRC_SLICES > 1
+    int i;
+    int k;
+
+    for (k = 0; k < (CRC_SLICES - 1); k++)
+    {
+        const uint32_t* prevTable = (0 == k) ? enginePtr->byteTable : enginePtr->sliceTable[k - 1];
+
+        for (i = 0; i < 256; i++)
+        {
+            uint32_t crc = prevTable[i];
+
+            enginePtr->sliceTable[k][i] = (crc >> 8) ^ enginePtr->byteTable[crc & 0xFF];
+        }
+    }
+#endif
+
+#if CRC_HW_X86
+    if ((CRC32_POLY == enginePtr->poly) &&
+        __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1"))
+    {
+        enginePtr->hwFunc = Crc32Pclmul;
+    }
+    else if ((CRC32C_POLY == enginePtr->poly) && __builtin_cpu_supports("sse4.2"))
+    {
+        enginePtr->hwFunc = Crc32cSse42;
+    }
+#elif CRC_HW_ARM64
+    enginePtr->hwFunc = (CRC32_POLY == enginePtr->poly) ? Crc32Arm64 : Crc32cArm64;
+#endif
+
+    __atomic_store_n(&enginePtr->state, CRC_ENGINE_READY, __ATOMIC_RELEASE);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a CRC with the fastest method available for an engine.
+ *
+ * @return
+ *      - 32-bit CRC
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t Compute
+(
+    CrcEngine_t*    enginePtr,  ///< [IN] CRC engine
+    const uint8_t*  addressPtr, ///< [IN] Input buffer
+    size_t          size,       ///< [IN] Number of bytes to read
+    uint32_t        crc         ///< [IN] Starting CRC seed
+)
+{
+    if (CRC_ENGINE_READY != __atomic_load_n(&enginePtr->state, __ATOMIC_ACQUIRE))
+    {
+        int state = CRC_ENGINE_UNINIT;
+
+        // Only one thread initializes the engine: the others use the byte table meanwhile
+        if (!__atomic_compare_exchange_n(&enginePtr->state, &state, CRC_ENGINE_INIT_ONGOING,
+                                         false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+        {
+            return ComputeWithByteTable(enginePtr->byteTable, addressPtr, size, crc);
+        }
+
+        InitEngine(enginePtr);
+    }
+
+    if (enginePtr->hwFunc && (size >= CRC_HW_MIN_SIZE))
+    {
+        return enginePtr->hwFunc(enginePtr, addressPtr, size, crc);
+    }
+    return ComputeWithTables(enginePtr, addressPtr, size, crc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to calculate a CRC-32
+ *
+ * @return
+ *      - 32-bit CRC
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t le_crc_Crc32
+(
+    uint8_t* addressPtr,///< [IN] Input buffer
+    size_t   size,      ///< [IN] Number of bytes to read
+    uint32_t crc        ///< [IN] Starting CRC seed
+)
+{
+    return Compute(&Crc32Engine, addressPtr, size, crc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to calculate a CRC-32C (Castagnoli)
+ *
+ * @return
+ *      - 32-bit CRC
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t le_crc_Crc32c
+(
+    uint8_t* addressPtr,///< [IN] Input buffer
+    size_t   size,      ///< [IN] Number of bytes to read
+    uint32_t crc        ///< [IN] Starting CRC seed
+)
+{
+    return Compute(&Crc32cEngine, addressPtr, size, crc);
+}
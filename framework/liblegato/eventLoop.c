@@ -59,6 +59,17 @@
  * and unlocked using the functions event_Lock() and event_Unlock().  Framework adaptor
  * functions which end in _NoLock are called with the lock held so should not lock.
  *
+ * The exception is queuing a report to a thread, which does not need the Mutex: reports are
+ * pushed with an atomic compare-and-swap onto the thread's incoming reports (a LIFO list, most
+ * recent first), so that producer threads feeding a busy thread don't serialize on the Mutex.
+ * The push which finds the incoming reports empty is the one which wakes the thread, with
+ * fa_event_TriggerEvent_NoLock(); the others know that the thread is already awake or about to
+ * be.  The thread acknowledges its wake-ups with fa_event_WaitForEvent() first, then swaps its
+ * incoming reports for an empty list and appends them to its Event Queue in reverse, which
+ * restores the order they were queued in.  The Event Queue itself, and taking the incoming
+ * reports, remain under the Mutex, so that le_event_QueueFunctionToThreadUnique() can look
+ * through both.
+ *
  * ----
  *
  * Copyright (C) Sierra Wireless Inc.
@@ -157,6 +168,9 @@ typedef struct
     le_mem_PoolRef_t    reportPoolRef;          ///< Pool for this event's Report objects.
     size_t              payloadSize;            ///< Size of the Report payload, in bytes.
     bool                isRefCounted;           ///< true = payload is a ref-counted object pointer.
+    le_event_Coalesce_t coalesce;               ///< How reports waiting to be handled are updated.
+    le_event_MergeFunc_t mergeFunc;             ///< Merge function, for LE_EVENT_COALESCE_MERGE.
+    uint64_t            coalescedCount;         ///< Number of reports coalesced instead of queued.
 }
 Event_t;
 
@@ -206,7 +220,7 @@ static le_sls_List_t EventList = LE_SLS_LIST_DECL_INIT;
  *          these objects (use the Mutex).
  *
  * @note    The lifecycle of these objects is such that once they have been created, only their
- *          list links can be changed, until they are deleted.
+ *          list links and pending report pointer can be changed, until they are deleted.
  */
 //--------------------------------------------------------------------------------------------------
 typedef struct
@@ -223,6 +237,10 @@ typedef struct
 
     le_event_LayeredHandlerFunc_t   firstLayerFunc;     ///< First-layer handler function.
     void*                           secondLayerFunc;    ///< Second-layer handler function.
+
+    /// Report of a coalescing event queued to this handler and not yet popped from the Event
+    /// Queue, or NULL.
+    struct PubSubEventReport*       pendingReportPtr;
 }
 Handler_t;
 
@@ -283,6 +301,9 @@ typedef struct
 {
     le_sls_Link_t           link;       ///< Used to link onto an Event Queue.
     EventReportType_t       type;       ///< Indicates what type of event report this is.
+#if LE_CONFIG_EVENT_LOOP_STATS
+    uint64_t                queueTime;  ///< Time the report was queued (microseconds).
+#endif
 }
 Report_t;
 
@@ -294,7 +315,7 @@ Report_t;
  * Each Handler has its own pool from which these types of Event Reports are allocated.
  */
 //--------------------------------------------------------------------------------------------------
-typedef struct
+typedef struct PubSubEventReport
 {
     Report_t                baseClass;  ///< Part that is common to all types of report.
     le_event_HandlerRef_t   handlerRef; ///< Safe Reference to the handler for this event.
@@ -375,7 +396,8 @@ static le_ref_MapRef_t HandlerRefMap;
 /**
  * Mutex is used to protect all data structures, other than the Init Handler List, from
  * multithreaded race conditions.  Threads wishing to access anything under the Event List or
- * the Per-Thread Records must hold this lock while doing so.
+ * the Per-Thread Records must hold this lock while doing so, except to queue a report to a thread
+ * (see @ref eventLoop_Multithreading).
  */
 //--------------------------------------------------------------------------------------------------
 static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;   // POSIX "Fast" mutex.
@@ -383,12 +405,12 @@ static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;   // POSIX "Fast" mute
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Guards against thread cancellation and locks the mutex.
+ * Guards against thread cancellation.
  *
  * @return Old state of cancelability.
  **/
 //--------------------------------------------------------------------------------------------------
-int event_Lock
+static int DisableCancel
 (
     void
 )
@@ -400,6 +422,43 @@ int event_Lock
 
     LE_FATAL_IF(err != 0, "pthread_setcancelstate() failed (%s)", LE_ERRNO_TXT(err));
 
+    return oldState;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Releases the thread cancellation guard created by DisableCancel().
+ **/
+//--------------------------------------------------------------------------------------------------
+static void RestoreCancel
+(
+    int restoreTo   ///< Old state of cancellability to be restored.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    int junk;
+
+    int err = pthread_setcancelstate(restoreTo, &junk);
+    LE_FATAL_IF(err != 0, "pthread_setcancelstate() failed (%s)", LE_ERRNO_TXT(err));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Guards against thread cancellation and locks the mutex.
+ *
+ * @return Old state of cancelability.
+ **/
+//--------------------------------------------------------------------------------------------------
+int event_Lock
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    int oldState = DisableCancel();
+
     LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
 
     return oldState;
@@ -417,12 +476,9 @@ void event_Unlock
 )
 //--------------------------------------------------------------------------------------------------
 {
-    int junk;
-
     LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
 
-    int err = pthread_setcancelstate(restoreTo, &junk);
-    LE_FATAL_IF(err != 0, "pthread_setcancelstate() failed (%s)", LE_ERRNO_TXT(err));
+    RestoreCancel(restoreTo);
 }
 
 
@@ -442,6 +498,125 @@ static le_log_TraceRef_t TraceRef;
 //  PRIVATE FUNCTIONS
 // ==============================================
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the current relative time, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetTimeUs
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+
+    return ((uint64_t)now.sec * 1000000) + now.usec;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Update the queue statistics of a thread when a report is queued to its Event Queue.
+ *
+ * @note The Mutex may not be held, so the queue depth is updated atomically.  The maximum depth
+ *       may miss a concurrent update, which is fine for a statistic.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CountQueuedReport
+(
+    event_PerThreadRec_t*   perThreadRecPtr,    ///< [in] Ptr to the thread's per-thread record.
+    Report_t*               reportPtr           ///< [in] Report being queued.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    event_LoopStats_t* statsPtr = &perThreadRecPtr->stats;
+    size_t queueDepth;
+
+    reportPtr->queueTime = GetTimeUs();
+
+    queueDepth = __atomic_add_fetch(&statsPtr->queueDepth, 1, __ATOMIC_RELAXED);
+    if (queueDepth > __atomic_load_n(&statsPtr->maxQueueDepth, __ATOMIC_RELAXED))
+    {
+        __atomic_store_n(&statsPtr->maxQueueDepth, queueDepth, __ATOMIC_RELAXED);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Update the queue statistics of a thread when a report is popped from its Event Queue.
+ *
+ * @warning Assumes that the Mutex lock is already held.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CountDequeuedReport_NoLock
+(
+    event_PerThreadRec_t*   perThreadRecPtr,    ///< [in] Ptr to the thread's per-thread record.
+    Report_t*               reportPtr           ///< [in] Report popped.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    event_LoopStats_t* statsPtr = &perThreadRecPtr->stats;
+    uint64_t queueTime = GetTimeUs() - reportPtr->queueTime;
+
+    __atomic_sub_fetch(&statsPtr->queueDepth, 1, __ATOMIC_RELAXED);
+
+    if (queueTime > statsPtr->maxQueueTime)
+    {
+        statsPtr->maxQueueTime = queueTime;
+    }
+}
+#else
+#   define CountQueuedReport(perThreadRecPtr, reportPtr)
+#   define CountDequeuedReport_NoLock(perThreadRecPtr, reportPtr)
+#endif /* end LE_CONFIG_EVENT_LOOP_STATS */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a report to a thread (could be the calling thread or some other thread), and wake that
+ * thread if it has no other incoming report.
+ *
+ * The report is pushed onto the thread's incoming reports, from which the thread moves it onto
+ * its Event Queue (see event_TakeQueuedReports()).  The Mutex need not be held.
+ *
+ * @warning Assumes the thread is protected from cancellation, as the thread would never wake up if
+ *          this was cancelled between pushing the report and triggering the thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void QueueReport
+(
+    event_PerThreadRec_t*   perThreadRecPtr,    ///< [in] Ptr to the thread's per-thread record.
+    Report_t*               reportPtr           ///< [in] Report to queue.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    CountQueuedReport(perThreadRecPtr, reportPtr);
+
+    // The report is published by the release, along with its content.
+    le_sls_Link_t* headPtr = __atomic_load_n(&perThreadRecPtr->incomingPtr, __ATOMIC_RELAXED);
+    do
+    {
+        reportPtr->link.nextPtr = headPtr;
+    }
+    while (!__atomic_compare_exchange_n(&perThreadRecPtr->incomingPtr,
+                                        &headPtr,
+                                        &reportPtr->link,
+                                        true,
+                                        __ATOMIC_RELEASE,
+                                        __ATOMIC_RELAXED));
+
+    // Only the report which found the incoming reports empty wakes the thread.  If there were
+    // others, the thread is already woken for them, and will take this one along.
+    if (headPtr == NULL)
+    {
+        fa_event_TriggerEvent_NoLock(perThreadRecPtr);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Create a new Event object.
@@ -480,6 +655,9 @@ static Event_t* CreateEvent
 
     eventPtr->payloadSize = payloadSize;
     eventPtr->isRefCounted = isRefCounted;
+    eventPtr->coalesce = LE_EVENT_COALESCE_NONE;
+    eventPtr->mergeFunc = NULL;
+    eventPtr->coalescedCount = 0;
 
     // Create the memory pool from which reports for this event are to be allocated.
     // Note: We can't delete pools, so we don't allow Event Ids to be deleted.
@@ -546,6 +724,159 @@ static void DeleteHandler
 }
 
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start timing a handler function about to be called by the calling thread's Event Loop.
+ */
+//--------------------------------------------------------------------------------------------------
+void event_StartDispatch
+(
+    event_PerThreadRec_t*   perThreadRecPtr,    ///< [in] Ptr to the calling thread's per-thread
+                                                ///<      record.
+    event_Dispatch_t*       dispatchPtr,        ///< [out] Dispatch to be passed to
+                                                ///<       event_EndDispatch().
+    event_DispatchType_t    type,               ///< [in] Kind of handler function.
+    const void*             funcPtr,            ///< [in] Address of the handler function.
+    const char*             name                ///< [in] Name of the handler, or NULL.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    event_LoopStats_t* statsPtr = &perThreadRecPtr->stats;
+    event_HandlerStats_t* handlerStatsPtr = NULL;
+    size_t i;
+
+    // Only this thread writes its handler table, so no lock is needed.
+    for (i = 0; i < statsPtr->handlerCount; i++)
+    {
+        if ((statsPtr->handlers[i].funcPtr == funcPtr) && (statsPtr->handlers[i].type == type))
+        {
+            handlerStatsPtr = &statsPtr->handlers[i];
+            break;
+        }
+    }
+
+    if ((handlerStatsPtr == NULL) &&
+        (statsPtr->handlerCount < NUM_ARRAY_MEMBERS(statsPtr->handlers)))
+    {
+        handlerStatsPtr = &statsPtr->handlers[statsPtr->handlerCount];
+        handlerStatsPtr->type = type;
+        handlerStatsPtr->funcPtr = funcPtr;
+        le_utf8_Copy(handlerStatsPtr->name, (name != NULL) ? name : "",
+                     sizeof(handlerStatsPtr->name), NULL);
+
+        // Make the entry visible only once it has been filled in.
+        LE_ATOMIC_ADD_FETCH(&statsPtr->handlerCount, 1, LE_ATOMIC_ORDER_RELEASE);
+    }
+
+    if (statsPtr->dispatchDepth++ == 0)
+    {
+        statsPtr->isOverBudgetLogged = false;
+    }
+
+    dispatchPtr->statsPtr = handlerStatsPtr;
+    dispatchPtr->funcPtr = funcPtr;
+    dispatchPtr->startTime = GetTimeUs();
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stop timing a handler function, once it has returned, and record its run time.
+ */
+//--------------------------------------------------------------------------------------------------
+void event_EndDispatch
+(
+    event_PerThreadRec_t*   perThreadRecPtr,    ///< [in] Ptr to the calling thread's per-thread
+                                                ///<      record.
+    event_Dispatch_t*       dispatchPtr         ///< [in] Dispatch started by event_StartDispatch().
+)
+//--------------------------------------------------------------------------------------------------
+{
+    event_LoopStats_t* statsPtr = &perThreadRecPtr->stats;
+    event_HandlerStats_t* handlerStatsPtr = dispatchPtr->statsPtr;
+    uint64_t runTime = GetTimeUs() - dispatchPtr->startTime;
+    bool isOverBudget = (LE_CONFIG_EVENT_LOOP_DISPATCH_BUDGET_MS > 0) &&
+                        (runTime > (uint64_t)LE_CONFIG_EVENT_LOOP_DISPATCH_BUDGET_MS * 1000);
+
+    statsPtr->dispatchDepth--;
+
+    if (handlerStatsPtr == NULL)
+    {
+        statsPtr->untrackedCount++;
+    }
+    else
+    {
+        handlerStatsPtr->callCount++;
+        handlerStatsPtr->totalTime += runTime;
+        if (runTime > handlerStatsPtr->maxTime)
+        {
+            handlerStatsPtr->maxTime = runTime;
+        }
+        if (isOverBudget)
+        {
+            handlerStatsPtr->overBudgetCount++;
+        }
+    }
+
+    // Nested dispatches end first, so only the innermost handler over budget gets logged.
+    if (isOverBudget && !statsPtr->isOverBudgetLogged)
+    {
+        LE_WARN("Handler '%s' (%p) held up the event loop for %" PRIu64 " ms (budget %d ms).",
+                ((handlerStatsPtr != NULL) ? handlerStatsPtr->name : ""),
+                dispatchPtr->funcPtr,
+                runTime / 1000,
+                LE_CONFIG_EVENT_LOOP_DISPATCH_BUDGET_MS);
+        statsPtr->isOverBudgetLogged = true;
+    }
+}
+#endif /* end LE_CONFIG_EVENT_LOOP_STATS */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move the reports queued to the calling thread since the last call onto its Event Queue, in the
+ * order they were queued.
+ *
+ * This must be called after fa_event_WaitForEvent(), so that reports queued afterwards wake the
+ * thread again.
+ *
+ * @return The number of reports moved.
+ **/
+//--------------------------------------------------------------------------------------------------
+uint64_t event_TakeQueuedReports
+(
+    event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_sls_Link_t* linkPtr;
+    le_sls_Link_t* nextLinkPtr;
+    le_sls_Link_t* tailLinkPtr;
+    uint64_t numReports = 0;
+
+    int oldState = event_Lock();
+
+    // From now on, the next report queued finds the incoming reports empty and wakes the thread.
+    linkPtr = __atomic_exchange_n(&perThreadRecPtr->incomingPtr, NULL, __ATOMIC_ACQUIRE);
+
+    // The incoming reports are most recent first, so inserting each of them right after the
+    // current tail of the Event Queue (or at its head, if it is empty) puts them back in order.
+    tailLinkPtr = le_sls_PeekTail(&perThreadRecPtr->eventQueue);
+    for (; linkPtr != NULL; linkPtr = nextLinkPtr)
+    {
+        nextLinkPtr = linkPtr->nextPtr;
+        linkPtr->nextPtr = NULL;
+        le_sls_AddAfter(&perThreadRecPtr->eventQueue, tailLinkPtr, linkPtr);
+        numReports++;
+    }
+
+    event_Unlock(oldState);
+
+    return numReports;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Process one event report from the calling thread's Event Queue.
@@ -566,16 +897,19 @@ void event_ProcessOneEventReport
     // Pop an Event Report off the head of the Event Queue (inside a critical section).
     linkPtr = le_sls_Pop(&perThreadRecPtr->eventQueue);
 
-    event_Unlock(oldState);
-
     if (linkPtr == NULL)
     {
+        event_Unlock(oldState);
         return;
     }
 
     // Convert the link pointer into a pointer to the Report base class.
     reportObjPtr = CONTAINER_OF(linkPtr, Report_t, link);
 
+    CountDequeuedReport_NoLock(perThreadRecPtr, reportObjPtr);
+
+    event_Unlock(oldState);
+
     // Hold on to the current event to release it in destructor in case thread is terminated
     // before event processing finishes.
     perThreadRecPtr->currentEvent = reportObjPtr;
@@ -587,10 +921,20 @@ void event_ProcessOneEventReport
         QueuedFunctionReport_t* queuedFuncReportPtr;
         queuedFuncReportPtr = CONTAINER_OF(reportObjPtr, QueuedFunctionReport_t, baseClass);
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+        event_Dispatch_t dispatch;
+        event_StartDispatch(perThreadRecPtr, &dispatch, EVENT_DISPATCH_QUEUED_FUNC,
+                            queuedFuncReportPtr->function, NULL);
+#endif
+
         // Call the function.
         queuedFuncReportPtr->function(queuedFuncReportPtr->param1Ptr,
                                       queuedFuncReportPtr->param2Ptr);
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+        event_EndDispatch(perThreadRecPtr, &dispatch);
+#endif
+
     }
     // If it's a publish-subscribe event report,
     else
@@ -618,6 +962,13 @@ void event_ProcessOneEventReport
         }
         else
         {
+            // From now on, reports of a coalescing event must be queued again for this handler,
+            // as this one is about to be handled.
+            if (handlerPtr->pendingReportPtr == pubSubReportPtr)
+            {
+                handlerPtr->pendingReportPtr = NULL;
+            }
+
             // The handler still exists, so grab the info we need from it and call
             // the first-layer handler function.
             perThreadRecPtr->contextPtr = handlerPtr->contextPtr;
@@ -637,10 +988,22 @@ void event_ProcessOneEventReport
                 reportPtr = pubSubReportPtr->payload;
             }
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+            // Time the client's handler function, rather than the first layer that wraps it.
+            event_Dispatch_t dispatch;
+            event_StartDispatch(perThreadRecPtr, &dispatch, EVENT_DISPATCH_EVENT_HANDLER,
+                                (secondLayerFunc != NULL) ? secondLayerFunc : firstLayerFunc,
+                                EVENT_NAME(handlerPtr->name));
+#endif
+
             event_Unlock(oldState);  // Unlock the mutex before calling the handler function.
                                // Don't access the Handler object anymore after this.
 
             firstLayerFunc(reportPtr, secondLayerFunc);
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+            event_EndDispatch(perThreadRecPtr, &dispatch);
+#endif
         }
     }
 
@@ -663,9 +1026,10 @@ void event_ProcessEventReports
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // Read the eventfd to fetch the number of Reports on the Event Queue and reset the count
-    // to zero.
-    uint64_t numReports = fa_event_WaitForEvent(perThreadRecPtr);
+    // Acknowledge the wake-ups, then fetch the Reports queued until now.  The wake-ups are not
+    // counted: a thread is only woken for the first of the reports queued to it.
+    fa_event_WaitForEvent(perThreadRecPtr);
+    uint64_t numReports = event_TakeQueuedReports(perThreadRecPtr);
 
     // Process only those event reports that are already on the queue.  Anything reported by the
     // event handlers will have to wait until next time ProcessEventReports() is called.
@@ -707,10 +1071,10 @@ static void PubSubHandlerFunc
  * Queue a function onto a specific thread's Event Queue (could belong to the calling thread or
  * could belong to some other thread).
  *
- * @warning Assumes the mutex is locked and the thread is protected from cancellation.
+ * @warning Assumes the thread is protected from cancellation.  The mutex need not be locked.
  */
 //--------------------------------------------------------------------------------------------------
-static void QueueFunction_NoLock
+static void QueueFunction
 (
     event_PerThreadRec_t*   perThreadRecPtr, ///< [in] Pointer to the thread's event data record.
     le_event_DeferredFunc_t func,       ///< [in] The function to be called later.
@@ -729,11 +1093,8 @@ static void QueueFunction_NoLock
     reportPtr->param1Ptr = param1Ptr;
     reportPtr->param2Ptr = param2Ptr;
 
-    // Queue it to the Event Queue.
-    le_sls_Queue(&perThreadRecPtr->eventQueue, &reportPtr->baseClass.link);
-
-    // Write to the eventfd to notify the Event Loop that there is something on the queue.
-    fa_event_TriggerEvent_NoLock(perThreadRecPtr);
+    // Queue it to the thread, which notifies its Event Loop if there was nothing else queued.
+    QueueReport(perThreadRecPtr, &reportPtr->baseClass);
 }
 
 
@@ -830,6 +1191,7 @@ event_PerThreadRec_t* event_CreatePerThreadInfo
 
     // Initialize the various thread-specific lists and queues.
     recPtr->eventQueue = LE_SLS_LIST_INIT;
+    recPtr->incomingPtr = NULL;
     recPtr->handlerList = LE_DLS_LIST_INIT;
     recPtr->fdMonitorList = LE_DLS_LIST_INIT;
 
@@ -842,6 +1204,10 @@ event_PerThreadRec_t* event_CreatePerThreadInfo
     // Initialize the current event member:
     recPtr->currentEvent = NULL;
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+    memset(&recPtr->stats, 0, sizeof(recPtr->stats));
+#endif
+
     // Take note of the fact that the Event Loop for this thread has been initialized, but
     // not started.
     recPtr->state = LE_EVENT_LOOP_INITIALIZED;
@@ -922,7 +1288,8 @@ void event_DestructThread
     // Delete all the FD Monitors for this thread.
     fdMon_DestructThread(perThreadRecPtr);
 
-    // Discard everything on the Event Queue.
+    // Discard everything on the Event Queue, including the reports not taken yet.
+    event_TakeQueuedReports(perThreadRecPtr);
     while (NULL != (singleLinkPtr = le_sls_Pop(&perThreadRecPtr->eventQueue)))
     {
         Report_t* reportPtr = CONTAINER_OF(singleLinkPtr, Report_t, link);
@@ -1135,6 +1502,7 @@ le_event_HandlerRef_t _le_event_AddLayeredHandler
     handlerPtr->contextPtr = NULL;
     handlerPtr->firstLayerFunc = firstLayerFunc;
     handlerPtr->secondLayerFunc = secondLayerFunc;
+    handlerPtr->pendingReportPtr = NULL;
 #if LE_CONFIG_EVENT_NAMES_ENABLED
     if (le_utf8_Copy(handlerPtr->name, name, sizeof(handlerPtr->name), NULL) == LE_OVERFLOW)
     {
@@ -1239,6 +1607,25 @@ void le_event_Report
         TRACE("  ...to handler '%s'.",
             EVENT_NAME(handlerPtr->name));
 
+        // If a report is still waiting to be handled, update it instead of queuing another one.
+        PubSubEventReport_t* pendingReportPtr = handlerPtr->pendingReportPtr;
+        if ((pendingReportPtr != NULL) && (eventPtr->coalesce != LE_EVENT_COALESCE_NONE))
+        {
+            if (eventPtr->coalesce == LE_EVENT_COALESCE_MERGE)
+            {
+                eventPtr->mergeFunc(pendingReportPtr->payload, payloadPtr, payloadSize);
+            }
+            else
+            {
+                memset(pendingReportPtr->payload, 0, eventPtr->payloadSize);
+                memcpy(pendingReportPtr->payload, payloadPtr, payloadSize);
+            }
+            eventPtr->coalescedCount++;
+
+            linkPtr = le_dls_PeekNext(&eventPtr->handlerList, linkPtr);
+            continue;
+        }
+
         // Queue a report to the handler's thread's Event Queue.
         PubSubEventReport_t* reportObjPtr = le_mem_ForceAlloc(eventPtr->reportPoolRef);
         reportObjPtr->baseClass.link = LE_SLS_LINK_INIT;
@@ -1246,11 +1633,15 @@ void le_event_Report
         reportObjPtr->handlerRef = handlerPtr->safeRef;
         memset(reportObjPtr->payload, 0, eventPtr->payloadSize);
         memcpy(reportObjPtr->payload, payloadPtr, payloadSize);
-        le_sls_Queue(&perThreadRecPtr->eventQueue, &reportObjPtr->baseClass.link);
 
-        // Increment the eventfd for the handler's thread's Event Queue.
-        // This will wake up the thread and tell it that it has something on its Event Queue.
-        fa_event_TriggerEvent_NoLock(perThreadRecPtr);
+        if (eventPtr->coalesce != LE_EVENT_COALESCE_NONE)
+        {
+            handlerPtr->pendingReportPtr = reportObjPtr;
+        }
+
+        // This will wake up the thread, if needed, and tell it that it has something on its
+        // Event Queue.
+        QueueReport(perThreadRecPtr, &reportObjPtr->baseClass);
 
         linkPtr = le_dls_PeekNext(&eventPtr->handlerList, linkPtr);
     }
@@ -1307,11 +1698,10 @@ void le_event_ReportWithRefCounting
         reportObjPtr->handlerRef = handlerPtr->safeRef;
         reportObjPtr->payload[0] = objectPtr;
         le_mem_AddRef(objectPtr);
-        le_sls_Queue(&perThreadRecPtr->eventQueue, &reportObjPtr->baseClass.link);
 
-        // Increment the eventfd for the handler's thread's Event Queue.
-        // This will wake up the thread and tell it that it has something on its Event Queue.
-        fa_event_TriggerEvent_NoLock(perThreadRecPtr);
+        // This will wake up the thread, if needed, and tell it that it has something on its
+        // Event Queue.
+        QueueReport(perThreadRecPtr, &reportObjPtr->baseClass);
 
         linkPtr = le_dls_PeekNext(&eventPtr->handlerList, linkPtr);
     }
@@ -1326,6 +1716,73 @@ void le_event_ReportWithRefCounting
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets how the reports of an event are coalesced while they wait to be handled.
+ *
+ * @note Terminates the process if the Event ID was created using
+ *       le_event_CreateIdWithRefCounting(), or if no merge function is given for
+ *       LE_EVENT_COALESCE_MERGE.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_event_SetCoalescing
+(
+    le_event_Id_t           eventId,    ///< [in] Event ID created using le_event_CreateId().
+    le_event_Coalesce_t     coalesce,   ///< [in] How reports are to be coalesced.
+    le_event_MergeFunc_t    mergeFunc   ///< [in] Merge function for LE_EVENT_COALESCE_MERGE,
+                                        ///<      or NULL.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_FATAL_IF((coalesce == LE_EVENT_COALESCE_MERGE) && (mergeFunc == NULL),
+                "No merge function given to merge event reports.");
+
+    int oldState = event_Lock();
+
+    Event_t* eventPtr = le_ref_Lookup(EventRefMap, eventId);
+
+    LE_FATAL_IF(eventPtr == NULL, "No such event %p.", eventId);
+
+    LE_FATAL_IF(eventPtr->isRefCounted,
+                "Attempt to coalesce reports of Event ID (%s) created using "
+                "le_event_CreateIdWithRefCounting().",
+                EVENT_NAME(eventPtr->name));
+
+    eventPtr->coalesce = coalesce;
+    eventPtr->mergeFunc = mergeFunc;
+
+    event_Unlock(oldState);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the number of reports of an event that were coalesced into a report waiting to be handled,
+ * instead of being queued.
+ *
+ * @return The number of coalesced reports.
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_event_GetCoalescedCount
+(
+    le_event_Id_t   eventId     ///< [in] Event ID.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    int oldState = event_Lock();
+
+    Event_t* eventPtr = le_ref_Lookup(EventRefMap, eventId);
+
+    LE_FATAL_IF(eventPtr == NULL, "No such event %p.", eventId);
+
+    uint64_t count = eventPtr->coalescedCount;
+
+    event_Unlock(oldState);
+
+    return count;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets the context pointer for a given event handler.
@@ -1417,11 +1874,11 @@ void le_event_QueueFunction
 )
 //--------------------------------------------------------------------------------------------------
 {
-    int oldState = event_Lock();
+    int oldState = DisableCancel();
 
-    QueueFunction_NoLock(thread_GetEventRecPtr(), func, param1Ptr, param2Ptr);
+    QueueFunction(thread_GetEventRecPtr(), func, param1Ptr, param2Ptr);
 
-    event_Unlock(oldState);
+    RestoreCancel(oldState);
 }
 
 
@@ -1440,11 +1897,11 @@ void le_event_QueueFunctionToThread
 )
 //--------------------------------------------------------------------------------------------------
 {
-    int oldState = event_Lock();
+    int oldState = DisableCancel();
 
-    QueueFunction_NoLock(thread_GetOtherEventRecPtr(thread), func, param1Ptr, param2Ptr);
+    QueueFunction(thread_GetOtherEventRecPtr(thread), func, param1Ptr, param2Ptr);
 
-    event_Unlock(oldState);
+    RestoreCancel(oldState);
 }
 
 
@@ -1471,6 +1928,7 @@ le_result_t le_event_QueueFunctionToThreadUnique
 )
 {
     QueuedFunctionReport_t* reportPtr = NULL;
+    le_sls_Link_t* linkPtr;
 
     int oldState = event_Lock();
 
@@ -1490,7 +1948,25 @@ le_result_t le_event_QueueFunctionToThreadUnique
         }
     }
 
-    QueueFunction_NoLock(thread_GetOtherEventRecPtr(thread), func, param1Ptr, param2Ptr);
+    // Also look through the reports not taken by the thread yet.  Other threads may still push
+    // onto them, but only the thread itself removes them, with the mutex locked.
+    for (linkPtr = __atomic_load_n(&perThreadRecPtr->incomingPtr, __ATOMIC_ACQUIRE);
+         linkPtr != NULL;
+         linkPtr = linkPtr->nextPtr)
+    {
+        reportPtr = CONTAINER_OF(linkPtr, QueuedFunctionReport_t, baseClass.link);
+        if (reportPtr->baseClass.type == LE_EVENT_REPORT_QUEUED_FUNC &&
+            reportPtr->function == func &&
+            reportPtr->param1Ptr == param1Ptr &&
+            reportPtr->param2Ptr == param2Ptr)
+        {
+            event_Unlock(oldState);
+
+            return LE_DUPLICATE;
+        }
+    }
+
+    QueueFunction(perThreadRecPtr, func, param1Ptr, param2Ptr);
 
     event_Unlock(oldState);
 
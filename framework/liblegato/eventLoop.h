@@ -89,6 +89,23 @@ void event_SetCurrentContextPtr
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move the reports queued to the calling thread since the last call onto its Event Queue, in the
+ * order they were queued.
+ *
+ * This must be called after fa_event_WaitForEvent(), so that reports queued afterwards wake the
+ * thread again.
+ *
+ * @return The number of reports moved.
+ **/
+//--------------------------------------------------------------------------------------------------
+uint64_t event_TakeQueuedReports
+(
+    event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Process one event report from the calling thread's Event Queue.
@@ -117,6 +134,56 @@ void event_ProcessEventReports
     event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
 );
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Dispatch in progress, used to time a handler function.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    event_HandlerStats_t*   statsPtr;   ///< Statistics of the handler, or NULL if not tracked.
+    const void*             funcPtr;    ///< Address of the handler function.
+    uint64_t                startTime;  ///< Time the handler was called (microseconds).
+}
+event_Dispatch_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start timing a handler function about to be called by the calling thread's Event Loop.
+ *
+ * The handler's statistics are looked up (or added to the thread's handler table) here, before the
+ * call, as the handler may delete the object holding its name.
+ */
+//--------------------------------------------------------------------------------------------------
+void event_StartDispatch
+(
+    event_PerThreadRec_t*   perThreadRecPtr,    ///< [in] Ptr to the calling thread's per-thread
+                                                ///<      record.
+    event_Dispatch_t*       dispatchPtr,        ///< [out] Dispatch to be passed to
+                                                ///<       event_EndDispatch().
+    event_DispatchType_t    type,               ///< [in] Kind of handler function.
+    const void*             funcPtr,            ///< [in] Address of the handler function.
+    const char*             name                ///< [in] Name of the handler, or NULL.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stop timing a handler function, once it has returned, and record its run time.
+ *
+ * Logs a warning if the handler ran for longer than LE_CONFIG_EVENT_LOOP_DISPATCH_BUDGET_MS.
+ */
+//--------------------------------------------------------------------------------------------------
+void event_EndDispatch
+(
+    event_PerThreadRec_t*   perThreadRecPtr,    ///< [in] Ptr to the calling thread's per-thread
+                                                ///<      record.
+    event_Dispatch_t*       dispatchPtr         ///< [in] Dispatch started by event_StartDispatch().
+);
+#endif /* end LE_CONFIG_EVENT_LOOP_STATS */
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Guards against thread cancellation and locks the mutex.
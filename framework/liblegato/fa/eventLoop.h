@@ -10,6 +10,7 @@
 #define FA_EVENTLOOP_H_INCLUDE_GUARD
 
 #include "legato.h"
+#include "limit.h"
 
 
 // File Descriptor Monitor
@@ -28,6 +29,68 @@ typedef enum
 }
 event_LoopState_t;
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kinds of functions dispatched by an Event Loop, as recorded in its statistics.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    EVENT_DISPATCH_QUEUED_FUNC,     ///< Queued function.
+    EVENT_DISPATCH_EVENT_HANDLER,   ///< Publish-Subscribe event handler.
+    EVENT_DISPATCH_FD_HANDLER,      ///< File descriptor monitor handler.
+    EVENT_DISPATCH_TIMER_HANDLER,   ///< Timer expiry handler.
+}
+event_DispatchType_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Statistics of one handler function, called by one thread's Event Loop.
+ *
+ * Run times include the run time of any handler dispatched from within this one (e.g., timer
+ * expiry handlers are called from within a file descriptor handler).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    event_DispatchType_t type;              ///< Kind of function.
+    const void          *funcPtr;           ///< Address of the function.
+    char                 name[LIMIT_MAX_EVENT_HANDLER_NAME_BYTES]; ///< Name of the handler, FD
+                                                                   ///< monitor or timer, if any.
+    uint64_t             callCount;         ///< Number of calls.
+    uint64_t             totalTime;         ///< Cumulative run time (microseconds).
+    uint64_t             maxTime;           ///< Longest run time (microseconds).
+    uint64_t             overBudgetCount;   ///< Number of calls over the dispatch budget.
+}
+event_HandlerStats_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Statistics of one thread's Event Loop.
+ *
+ * The handler statistics are only written by the thread itself, without locking.  The queue
+ * statistics are updated atomically, as reports may be queued by other threads without holding
+ * the Event Loop mutex.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    size_t               queueDepth;        ///< Number of reports in the Event Queue.
+    size_t               maxQueueDepth;     ///< Highest number of reports in the Event Queue.
+    uint64_t             maxQueueTime;      ///< Longest time a report waited in the Event Queue
+                                            ///< (microseconds).
+    uint64_t             untrackedCount;    ///< Number of calls to handlers which didn't fit in
+                                            ///< the handler table.
+    size_t               dispatchDepth;     ///< Number of nested dispatches in progress.
+    bool                 isOverBudgetLogged;///< true = the current dispatch was logged as over
+                                            ///< budget by a nested one.
+    size_t               handlerCount;      ///< Number of entries used in the handler table.
+    event_HandlerStats_t handlers[LE_CONFIG_EVENT_LOOP_STATS_MAX_HANDLERS]; ///< Handler table.
+}
+event_LoopStats_t;
+#endif /* end LE_CONFIG_EVENT_LOOP_STATS */
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Event Loop's per-thread record.
@@ -42,6 +105,9 @@ event_LoopState_t;
 typedef struct
 {
     le_sls_List_t        eventQueue;        ///< The thread's event queue.
+    le_sls_Link_t       *incomingPtr;       ///< Reports queued since the thread last took them,
+                                            ///< most recent first.  Pushed to without locking;
+                                            ///< NULL when empty (the next push wakes the thread).
     le_dls_List_t        handlerList;       ///< List of handlers registered with this thread.
     le_dls_List_t        fdMonitorList;     ///< List of FD Monitors created by this thread.
     void                *contextPtr;        ///< Context pointer from last Handler called.
@@ -50,6 +116,9 @@ typedef struct
                                             ///< balance between queued events and monitored fds
                                             ///< in le_event_ServiceLoop().
     void*                currentEvent;      ///< Pointer to the current event report being processed
+#if LE_CONFIG_EVENT_LOOP_STATS
+    event_LoopStats_t    stats;             ///< Dispatch statistics, mainly for the Inspect tool.
+#endif
 }
 event_PerThreadRec_t;
 
@@ -102,6 +171,9 @@ void fa_event_ThreadInit
 //--------------------------------------------------------------------------------------------------
 /**
  * Inform event loop an event has fired.  Wakes the event loop if it is asleep.
+ *
+ * This is only called when the thread's incoming reports go from empty to non-empty, so a single
+ * wake-up may stand for many reports.  It may be called with or without the Event Loop mutex held.
  */
 //--------------------------------------------------------------------------------------------------
 void fa_event_TriggerEvent_NoLock
@@ -111,10 +183,13 @@ void fa_event_TriggerEvent_NoLock
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Wait for an event to trigger.  This fetches the value of the Event FD (which is
- * the number of event reports on the Event Queue) and resets the Event FD value to zero.
+ * Acknowledge the wake-ups of the event loop.  This fetches the number of times
+ * fa_event_TriggerEvent_NoLock() was called since the last call, and resets it to zero.
+ *
+ * This must be called before taking the incoming reports, so that a report queued after they
+ * were taken triggers the event loop again.
  *
- * @return The number of Event Reports on the thread's Event Queue.
+ * @return The number of wake-ups, which may be zero.
  */
 //--------------------------------------------------------------------------------------------------
 uint64_t fa_event_WaitForEvent
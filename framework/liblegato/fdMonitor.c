@@ -135,8 +135,18 @@ static void DispatchToHandler
     // Set the thread's event loop Context Pointer.
     event_SetCurrentContextPtr(fdMonitorPtr->contextPtr);
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+    event_Dispatch_t dispatch;
+    event_StartDispatch(fdMonitorPtr->threadRecPtr, &dispatch, EVENT_DISPATCH_FD_HANDLER,
+                        fdMonitorPtr->handlerFunc, FDMON_NAME(fdMonitorPtr->name));
+#endif
+
     fa_fdMon_DispatchToHandler(fdMonitorPtr, flags);
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+    event_EndDispatch(fdMonitorPtr->threadRecPtr, &dispatch);
+#endif
+
     // Clear the thread-specific pointer to the FD Monitor.
     LE_ASSERT(pthread_setspecific(FDMonitorPtrKey, NULL) == 0);
 
@@ -5,11 +5,23 @@
 
 
 /** @file hex.c
+ *
+ * When LE_CONFIG_STRING_SIMD is set, the conversions between byte arrays and hexadecimal strings
+ * process 16 bytes at a time with SIMD instructions when available: SSE2 on x86, and NEON on ARM
+ * when the target is built for it.  They give the same results as the byte by byte processing.
  *
  * Copyright (C) Sierra Wireless Inc.
  */
 #include "legato.h"
 
+#if LE_CONFIG_STRING_SIMD && defined(__SSE2__)
+#   define HEX_SIMD_SSE2    1
+#   include <emmintrin.h>
+#elif LE_CONFIG_STRING_SIMD && defined(__ARM_NEON)
+#   define HEX_SIMD_NEON    1
+#   include <arm_neon.h>
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Number of HexDump Columns
@@ -76,6 +88,251 @@ static char DecToHex(uint8_t hex)
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert a hexadecimal character [0-9a-fA-F] into its numeric value.
+ *
+ * @return Value in the range [0-15] or -1 if the character is not hexadecimal
+ */
+//--------------------------------------------------------------------------------------------------
+static int HexToDec(char hex)
+{
+    if (hex >= '0' && hex <= '9') {
+        return hex - '0';
+    }
+    else if (hex >= 'A' && hex <= 'F') {
+        return hex - 'A' + 10;
+    }
+    else if (hex >= 'a' && hex <= 'f') {
+        return hex - 'a' + 10;
+    }
+    else {
+        return -1;
+    }
+}
+
+#if HEX_SIMD_SSE2
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert nibbles into uppercase hexadecimal characters with SSE2 instructions.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline __m128i NibbleToCharSse2
+(
+    __m128i nibbles     ///< [IN] Values in the range [0-15]
+)
+{
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+                                    _mm_set1_epi8('A' - '0' - 10));
+
+    return _mm_add_epi8(nibbles, _mm_add_epi8(letters, _mm_set1_epi8('0')));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert hexadecimal characters into nibbles with SSE2 instructions.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline __m128i CharToNibbleSse2
+(
+    __m128i  chars,     ///< [IN] Characters
+    __m128i* validPtr   ///< [INOUT] Cleared for the characters which are not hexadecimal
+)
+{
+    // Out of range values wrap around, and are too large to be digits or letters
+    __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    __m128i letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+    __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+
+    *validPtr = _mm_and_si128(*validPtr, _mm_or_si128(isDigit, isLetter));
+
+    return _mm_or_si128(_mm_and_si128(isDigit, digits),
+                        _mm_and_si128(isLetter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert blocks of 16 bytes into hexadecimal characters with SSE2 instructions.
+ *
+ * @return number of bytes converted
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t BinaryToStringBlocks
+(
+    const uint8_t *binaryPtr,  ///< [IN] binary array to convert
+    uint32_t       binarySize, ///< [IN] size of binary array
+    char          *stringPtr   ///< [OUT] hex string array
+)
+{
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    uint32_t idxBinary;
+
+    for (idxBinary = 0; idxBinary + 16 <= binarySize; idxBinary += 16, stringPtr += 32)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i*)(binaryPtr + idxBinary));
+        __m128i hi = NibbleToCharSse2(_mm_and_si128(_mm_srli_epi16(in, 4), mask));
+        __m128i lo = NibbleToCharSse2(_mm_and_si128(in, mask));
+
+        _mm_storeu_si128((__m128i*)stringPtr, _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i*)(stringPtr + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+
+    return idxBinary;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert blocks of 32 hexadecimal characters into bytes with SSE2 instructions, up to the first
+ * block holding a character which is not hexadecimal.
+ *
+ * @return number of characters converted
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t StringToBinaryBlocks
+(
+    const char *stringPtr,     ///< [IN] string to convert
+    uint32_t    stringLength,  ///< [IN] string length
+    uint8_t    *binaryPtr      ///< [OUT] binary result
+)
+{
+    const __m128i lowByte = _mm_set1_epi16(0x00FF);
+    uint32_t idxString;
+
+    for (idxString = 0; idxString + 32 <= stringLength; idxString += 32, binaryPtr += 16)
+    {
+        __m128i valid = _mm_set1_epi8(-1);
+        __m128i first = CharToNibbleSse2(
+                            _mm_loadu_si128((const __m128i*)(stringPtr + idxString)), &valid);
+        __m128i second = CharToNibbleSse2(
+                            _mm_loadu_si128((const __m128i*)(stringPtr + idxString + 16)), &valid);
+
+        if (_mm_movemask_epi8(valid) != 0xFFFF)
+        {
+            break;
+        }
+
+        // Each 16-bit lane holds the high nibble of a byte in its low byte, and the low nibble in
+        // its high byte
+        first = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(first, 4), lowByte),
+                             _mm_srli_epi16(first, 8));
+        second = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(second, 4), lowByte),
+                              _mm_srli_epi16(second, 8));
+
+        _mm_storeu_si128((__m128i*)binaryPtr, _mm_packus_epi16(first, second));
+    }
+
+    return idxString;
+}
+
+#elif HEX_SIMD_NEON
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert nibbles into uppercase hexadecimal characters with NEON instructions.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint8x16_t NibbleToCharNeon
+(
+    uint8x16_t nibbles  ///< [IN] Values in the range [0-15]
+)
+{
+    uint8x16_t letters = vandq_u8(vcgtq_u8(nibbles, vdupq_n_u8(9)), vdupq_n_u8('A' - '0' - 10));
+
+    return vaddq_u8(nibbles, vaddq_u8(letters, vdupq_n_u8('0')));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert hexadecimal characters into nibbles with NEON instructions.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint8x16_t CharToNibbleNeon
+(
+    uint8x16_t  chars,      ///< [IN] Characters
+    uint8x16_t* validPtr    ///< [INOUT] Cleared for the characters which are not hexadecimal
+)
+{
+    // Out of range values wrap around, and are too large to be digits or letters
+    uint8x16_t digits = vsubq_u8(chars, vdupq_n_u8('0'));
+    uint8x16_t letters = vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    uint8x16_t isDigit = vcleq_u8(digits, vdupq_n_u8(9));
+    uint8x16_t isLetter = vcleq_u8(letters, vdupq_n_u8(5));
+
+    *validPtr = vandq_u8(*validPtr, vorrq_u8(isDigit, isLetter));
+
+    return vorrq_u8(vandq_u8(isDigit, digits),
+                    vandq_u8(isLetter, vaddq_u8(letters, vdupq_n_u8(10))));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert blocks of 16 bytes into hexadecimal characters with NEON instructions.
+ *
+ * @return number of bytes converted
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t BinaryToStringBlocks
+(
+    const uint8_t *binaryPtr,  ///< [IN] binary array to convert
+    uint32_t       binarySize, ///< [IN] size of binary array
+    char          *stringPtr   ///< [OUT] hex string array
+)
+{
+    uint32_t idxBinary;
+
+    for (idxBinary = 0; idxBinary + 16 <= binarySize; idxBinary += 16, stringPtr += 32)
+    {
+        uint8x16_t in = vld1q_u8(binaryPtr + idxBinary);
+        uint8x16x2_t out;
+
+        out.val[0] = NibbleToCharNeon(vshrq_n_u8(in, 4));
+        out.val[1] = NibbleToCharNeon(vandq_u8(in, vdupq_n_u8(0x0F)));
+
+        // Stored interleaved: high nibble character, then low nibble character
+        vst2q_u8((uint8_t*)stringPtr, out);
+    }
+
+    return idxBinary;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert blocks of 32 hexadecimal characters into bytes with NEON instructions, up to the first
+ * block holding a character which is not hexadecimal.
+ *
+ * @return number of characters converted
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t StringToBinaryBlocks
+(
+    const char *stringPtr,     ///< [IN] string to convert
+    uint32_t    stringLength,  ///< [IN] string length
+    uint8_t    *binaryPtr      ///< [OUT] binary result
+)
+{
+    uint32_t idxString;
+
+    for (idxString = 0; idxString + 32 <= stringLength; idxString += 32, binaryPtr += 16)
+    {
+        // Loaded de-interleaved: high nibble characters, then low nibble characters
+        uint8x16x2_t in = vld2q_u8((const uint8_t*)stringPtr + idxString);
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+        uint8x16_t hi = CharToNibbleNeon(in.val[0], &valid);
+        uint8x16_t lo = CharToNibbleNeon(in.val[1], &valid);
+        uint8x8_t folded = vand_u8(vget_low_u8(valid), vget_high_u8(valid));
+
+        if (vget_lane_u64(vreinterpret_u64_u8(folded), 0) != UINT64_MAX)
+        {
+            break;
+        }
+
+        vst1q_u8(binaryPtr, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+    }
+
+    return idxString;
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Convert a string of valid hexadecimal characters [0-9a-fA-F] into a byte array where each
@@ -97,9 +354,8 @@ int32_t le_hex_StringToBinary
     uint32_t    binarySize     ///< [IN] size of the binary table.  Must be >= stringLength / 2
 )
 {
-    uint32_t idxString;
-    uint32_t idxBinary;
-    char*    refStrPtr = "0123456789ABCDEF";
+    uint32_t idxString = 0;
+    uint32_t idxBinary = 0;
 
     if (stringLength > strlen(stringPtr))
     {
@@ -124,15 +380,19 @@ int32_t le_hex_StringToBinary
         return -1;
     }
 
-    for (idxString=0,idxBinary=0 ; idxString<stringLength ; idxString+=2,idxBinary++)
+#if HEX_SIMD_SSE2 || HEX_SIMD_NEON
+    idxString = StringToBinaryBlocks(stringPtr, stringLength, binaryPtr);
+    idxBinary = idxString / 2;
+#endif
+
+    for ( ; idxString<stringLength ; idxString+=2,idxBinary++)
     {
-        char* ch1Ptr = strchr(refStrPtr, toupper(stringPtr[idxString]));
-        char* ch2Ptr = strchr(refStrPtr, toupper((int)stringPtr[idxString+1]));
+        int hi = HexToDec(stringPtr[idxString]);
+        int lo = HexToDec(stringPtr[idxString+1]);
 
-        if ( (ch1Ptr && *ch1Ptr) && (ch2Ptr && *ch2Ptr) )
+        if ( (hi >= 0) && (lo >= 0) )
         {
-            binaryPtr[idxBinary] = ((ch2Ptr - refStrPtr) & 0x0F) |
-                                   (((ch1Ptr - refStrPtr)<<4) & 0xF0);
+            binaryPtr[idxBinary] = (uint8_t)((hi << 4) | lo);
         }
         else
         {
@@ -162,7 +422,8 @@ int32_t le_hex_BinaryToString
     uint32_t       stringSize  ///< [IN] size of string array.  Must be >= (2 * binarySize) + 1
 )
 {
-    uint32_t idxString,idxBinary;
+    uint32_t idxString = 0;
+    uint32_t idxBinary = 0;
 
     if (stringSize < (2 * binarySize) + 1)
     {
@@ -173,7 +434,12 @@ int32_t le_hex_BinaryToString
         return -1;
     }
 
-    for(idxBinary=0,idxString=0;
+#if HEX_SIMD_SSE2 || HEX_SIMD_NEON
+    idxBinary = BinaryToStringBlocks(binaryPtr, binarySize, stringPtr);
+    idxString = idxBinary * 2;
+#endif
+
+    for(;
         idxBinary<binarySize;
         idxBinary++,idxString=idxString+2)
     {
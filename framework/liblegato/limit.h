@@ -128,6 +128,15 @@
 #define LIMIT_MAX_SEMAPHORE_NAME_BYTES          (LIMIT_MAX_SEMAPHORE_NAME_LEN + 1)
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum string length and byte storage size of thread pool names.
+ */
+//--------------------------------------------------------------------------------------------------
+#define LIMIT_MAX_THREAD_POOL_NAME_LEN          31
+#define LIMIT_MAX_THREAD_POOL_NAME_BYTES        (LIMIT_MAX_THREAD_POOL_NAME_LEN + 1)
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Maximum string length and byte storage size of timer names.
@@ -19,10 +19,12 @@
  * Included in the set of file descriptors that are being monitored by epoll is an eventfd
  * (see 'man eventfd') monitored in "level-triggered" mode.
  *
- * Whenever an Event Report is added to the Event Queue for a thread, the number 1 is written to
- * that thread's eventfd.  When Event Reports are popped off a thread's Event Queue, that thread's
- * eventfd is read to decrement it.  As long as the eventfd's value is greater than 0, epoll_wait()
- * will return immediately, reporting that there is something to read from that fd.
+ * Whenever an Event Report is queued to a thread which had no other Event Report waiting to be
+ * taken onto its Event Queue, the number 1 is written to that thread's eventfd.  Reports queued
+ * while others are waiting don't write to it, as the thread is already being woken up.  Before
+ * the thread takes the waiting Event Reports onto its Event Queue, it reads its eventfd to reset
+ * it to 0.  As long as the eventfd's value is greater than 0, epoll_wait() will return
+ * immediately, reporting that there is something to read from that fd.
  *
  * The Event Loop is an infinite loop that calls epoll_wait() and then responds to any fd events
  * that epoll_wait() reports.  If epoll_wait() reports an event on the eventfd, then an Event Report
@@ -153,8 +155,9 @@ event_PerThreadRec_t* fa_event_CreatePerThreadInfo
     LE_FATAL_IF(recPtr->epollFd < 0, "epoll_create1(0) failed with errno %d.", errno);
 
     // Open an eventfd for this thread.  This will be uses to signal to the epoll fd that there
-    // are Event Reports on the Event Queue.
-    recPtr->eventQueueFd = eventfd(0, 0);
+    // are Event Reports on the Event Queue.  It is non-blocking, as the thread may take the
+    // reports it is woken up for before the wake-up is written.
+    recPtr->eventQueueFd = eventfd(0, EFD_NONBLOCK);
     LE_FATAL_IF(recPtr->eventQueueFd < 0, "eventfd() failed with errno %d.", errno);
 
     // Add the eventfd to the list of file descriptors to wait for using epoll_wait().
@@ -219,7 +222,7 @@ void fa_event_DestructThread
 /**
  * Write to a thread's Event File Descriptor.  This increments it by one.
  *
- * This must be done exactly once for each Event Report pushed onto the thread's Event Queue.
+ * This is done for the first Event Report queued to the thread after it took the previous ones.
  */
 //--------------------------------------------------------------------------------------------------
 void fa_event_TriggerEvent_NoLock
@@ -260,9 +263,9 @@ void fa_event_TriggerEvent_NoLock
 //--------------------------------------------------------------------------------------------------
 /**
  * Read a thread's Event File Descriptor.  This fetches the value of the Event FD (which is
- * the number of event reports on the Event Queue) and resets the Event FD value to zero.
+ * the number of wake-ups since the last read) and resets the Event FD value to zero.
  *
- * @return The number of Event Reports on the thread's Event Queue.
+ * @return The number of wake-ups, which is zero if the Event FD wasn't written.
  */
 //--------------------------------------------------------------------------------------------------
 uint64_t fa_event_WaitForEvent
@@ -284,6 +287,10 @@ uint64_t fa_event_WaitForEvent
         {
             return readBuff;
         }
+        else if ((readSize == -1) && (errno == EAGAIN))
+        {
+            return 0;
+        }
         else
         {
             if ((readSize == -1) && (errno != EINTR))
@@ -514,8 +521,9 @@ le_result_t le_event_ServiceLoop
     }
 
     // Read the eventfd to reset it to zero so epoll stops telling us about it until more
-    // are added.
-    perThreadRecPtr->liveEventCount = fa_event_WaitForEvent(perThreadRecPtr);
+    // are added, then take the Event Reports queued until now.
+    fa_event_WaitForEvent(perThreadRecPtr);
+    perThreadRecPtr->liveEventCount = event_TakeQueuedReports(perThreadRecPtr);
 
     LE_DEBUG("perThreadRecPtr->liveEventCount is" "%" PRIu64, perThreadRecPtr->liveEventCount);
 
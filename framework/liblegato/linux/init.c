@@ -24,6 +24,7 @@
 #include "signals.h"
 #include "test.h"
 #include "thread.h"
+#include "threadPool.h"
 #include "timer.h"
 
 
@@ -64,6 +65,7 @@ __attribute__((constructor)) void _legato_InitFramework
     event_Init();       // Uses memory pools.
     timer_Init();       // Uses event loop.
     thread_Init();      // Uses event loop, memory pools and safe references.
+    threadPool_Init();  // Uses memory pools.
     arg_Init();         // Uses memory pools.
     msg_Init();         // Uses event loop.
     kill_Init();        // Uses memory pools and timers.
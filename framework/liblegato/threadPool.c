@@ -0,0 +1,688 @@
+/**
+ * @file threadPool.c
+ *
+ * Legato @ref c_threadPool implementation.
+ *
+ * Each thread pool is represented by a <b> Thread Pool object </b>.  They are allocated from the
+ * <b> Thread Pool Pool </b> and are stored on the <b> Thread Pool List </b> until they are deleted,
+ * so that the Inspect tool can find them.
+ *
+ * Each piece of submitted work is a <b> Work object </b>, allocated from the process-wide
+ * <b> Work Pool </b>, and queued either to the <b> shared queue </b> of the pool (when submitted
+ * from outside the pool) or to the <b> local queue </b> of the submitting worker.  A worker takes
+ * work from its local queue first (newest first), then from the shared queue (oldest first), and
+ * finally steals from the local queues of the other workers (oldest first).
+ *
+ * The pool's work semaphore is posted once for each queued Work object, so that a waiting worker
+ * wakes up for it.  As a worker can take work without waiting on the semaphore, the semaphore count
+ * may exceed the number of queued Work objects; the workers then only wake up to find nothing to
+ * do, which is harmless.
+ *
+ * Once a Work object has been run, it is queued back to the Event Loop of the submitting thread if
+ * it has a completion function, or released right away.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "thread.h"
+#include "threadPool.h"
+
+// ==============================
+//  PRIVATE DATA
+// ==============================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time after which an idle worker stops, if the pool has more than its minimum number of workers.
+ */
+//--------------------------------------------------------------------------------------------------
+#define IDLE_WORKER_TIMEOUT     10
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Work object.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t                   link;           ///< Used to link onto a work queue.
+    le_threadPool_WorkFunc_t        workFunc;       ///< Work function.
+    le_threadPool_CompletionFunc_t  completionFunc; ///< Completion function, or NULL.
+    void*                           param1Ptr;      ///< First parameter of both functions.
+    void*                           param2Ptr;      ///< Second parameter of both functions.
+    le_thread_Ref_t                 threadRef;      ///< Thread to run the completion function.
+}
+Work_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Static pool for thread pools.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(ThreadPoolObjs, LE_CONFIG_MAX_THREAD_POOLS, sizeof(threadPool_Pool_t));
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread Pool Pool.
+ *
+ * Memory pool from which Thread Pool objects are allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t PoolPoolRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Static pool for work.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(ThreadPoolWork, LE_CONFIG_MAX_THREAD_POOL_WORK_POOL_SIZE, sizeof(Work_t));
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Work Pool.
+ *
+ * Memory pool from which Work objects are allocated, for all the thread pools of the process.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t WorkPoolRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread Pool List.
+ *
+ * List on which all Thread Pool objects in the process are kept.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t PoolList = LE_DLS_LIST_DECL_INIT;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A counter that increments every time a change is made to the Thread Pool List.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t PoolListChangeCount = 0;
+static size_t* PoolListChangeCountRef = &PoolListChangeCount;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Basic pthreads mutex used to protect the Thread Pool List.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_mutex_t PoolListMutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key used to store a pointer to its worker slot in the thread-local storage of each worker.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_key_t WorkerKey;
+
+
+// ==============================
+//  PRIVATE FUNCTIONS
+// ==============================
+
+/// Lock the Thread Pool List Mutex.
+#define LOCK_POOL_LIST()        LE_ASSERT(pthread_mutex_lock(&PoolListMutex) == 0)
+
+/// Unlock the Thread Pool List Mutex.
+#define UNLOCK_POOL_LIST()      LE_ASSERT(pthread_mutex_unlock(&PoolListMutex) == 0)
+
+/// Lock a Thread Pool object's mutex.
+#define LOCK_POOL(poolPtr)      LE_ASSERT(pthread_mutex_lock(&(poolPtr)->mutex) == 0)
+
+/// Unlock a Thread Pool object's mutex.
+#define UNLOCK_POOL(poolPtr)    LE_ASSERT(pthread_mutex_unlock(&(poolPtr)->mutex) == 0)
+
+/// Lock a worker's local queue.
+#define LOCK_QUEUE(workerPtr)   LE_ASSERT(pthread_mutex_lock(&(workerPtr)->queueMutex) == 0)
+
+/// Unlock a worker's local queue.
+#define UNLOCK_QUEUE(workerPtr) LE_ASSERT(pthread_mutex_unlock(&(workerPtr)->queueMutex) == 0)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Update the work counters of a pool after a Work object has been queued.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CountQueuedWork
+(
+    threadPool_Pool_t* poolPtr
+)
+{
+    size_t queuedCount = LE_ATOMIC_ADD_FETCH(&poolPtr->queuedCount, 1, LE_ATOMIC_ORDER_RELAXED);
+
+    // Statistics only, so a lost update of the maximum is acceptable.
+    if (queuedCount > poolPtr->maxQueuedCount)
+    {
+        poolPtr->maxQueuedCount = queuedCount;
+    }
+
+    LE_ATOMIC_ADD_FETCH(&poolPtr->submitCount, 1, LE_ATOMIC_ORDER_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take the next Work object for a worker: from its own local queue, from the shared queue, or from
+ * the local queue of another worker.
+ *
+ * @return
+ *      The Work object, or NULL if there is no work queued.
+ */
+//--------------------------------------------------------------------------------------------------
+static Work_t* TakeWork
+(
+    threadPool_Worker_t* workerPtr
+)
+{
+    threadPool_Pool_t* poolPtr = workerPtr->poolPtr;
+    le_dls_Link_t* linkPtr;
+
+    // Own queue, most recent first.
+    LOCK_QUEUE(workerPtr);
+    linkPtr = le_dls_Pop(&workerPtr->queue);
+    UNLOCK_QUEUE(workerPtr);
+
+    // Shared queue, oldest first.
+    if (linkPtr == NULL)
+    {
+        LOCK_POOL(poolPtr);
+        linkPtr = le_dls_Pop(&poolPtr->sharedQueue);
+        if (linkPtr != NULL)
+        {
+            poolPtr->sharedCount--;
+        }
+        UNLOCK_POOL(poolPtr);
+    }
+
+    // The other workers' queues, oldest first, starting from the next slot so that the victims
+    // are spread across the workers.
+    if (linkPtr == NULL)
+    {
+        size_t selfIndex = workerPtr - poolPtr->workers;
+
+        for (size_t i = 1; (i < poolPtr->maxWorkers) && (linkPtr == NULL); i++)
+        {
+            threadPool_Worker_t* victimPtr =
+                &poolPtr->workers[(selfIndex + i) % poolPtr->maxWorkers];
+
+            LOCK_QUEUE(victimPtr);
+            linkPtr = le_dls_PopTail(&victimPtr->queue);
+            UNLOCK_QUEUE(victimPtr);
+        }
+
+        if (linkPtr != NULL)
+        {
+            LE_ATOMIC_ADD_FETCH(&poolPtr->stealCount, 1, LE_ATOMIC_ORDER_RELAXED);
+        }
+    }
+
+    if (linkPtr == NULL)
+    {
+        return NULL;
+    }
+
+    LE_ATOMIC_SUB_FETCH(&poolPtr->queuedCount, 1, LE_ATOMIC_ORDER_RELAXED);
+
+    return CONTAINER_OF(linkPtr, Work_t, link);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Call the completion function of a Work object, and release it.  Queued to the Event Loop of the
+ * thread that submitted the work.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CompleteWork
+(
+    void* param1Ptr,    ///< [IN] Work object.
+    void* param2Ptr     ///< [IN] Unused.
+)
+{
+    Work_t* workPtr = param1Ptr;
+
+    LE_UNUSED(param2Ptr);
+
+    workPtr->completionFunc(workPtr->param1Ptr, workPtr->param2Ptr);
+
+    le_mem_Release(workPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run a Work object, and hand it over to the submitting thread for completion.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunWork
+(
+    threadPool_Pool_t* poolPtr,
+    Work_t* workPtr
+)
+{
+    workPtr->workFunc(workPtr->param1Ptr, workPtr->param2Ptr);
+
+    LE_ATOMIC_ADD_FETCH(&poolPtr->completeCount, 1, LE_ATOMIC_ORDER_RELAXED);
+
+    if (workPtr->completionFunc != NULL)
+    {
+        le_event_QueueFunctionToThread(workPtr->threadRef, CompleteWork, workPtr, NULL);
+    }
+    else
+    {
+        le_mem_Release(workPtr);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of the workers.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* WorkerMain
+(
+    void* contextPtr    ///< [IN] Worker slot.
+)
+{
+    threadPool_Worker_t* workerPtr = contextPtr;
+    threadPool_Pool_t* poolPtr = workerPtr->poolPtr;
+    bool isElastic = (poolPtr->maxWorkers > poolPtr->minWorkers);
+
+    LE_ASSERT(pthread_setspecific(WorkerKey, workerPtr) == 0);
+
+    for (;;)
+    {
+        Work_t* workPtr = TakeWork(workerPtr);
+
+        if (workPtr != NULL)
+        {
+            RunWork(poolPtr, workPtr);
+            continue;
+        }
+
+        LOCK_POOL(poolPtr);
+        if (poolPtr->isDeleting)
+        {
+            break;
+        }
+        poolPtr->idleCount++;
+        UNLOCK_POOL(poolPtr);
+
+        le_result_t result = LE_OK;
+        if (isElastic)
+        {
+            le_clk_Time_t timeout = { .sec = IDLE_WORKER_TIMEOUT, .usec = 0 };
+            result = le_sem_WaitWithTimeOut(poolPtr->workSem, timeout);
+        }
+        else
+        {
+            le_sem_Wait(poolPtr->workSem);
+        }
+
+        LOCK_POOL(poolPtr);
+        poolPtr->idleCount--;
+        if ((result == LE_TIMEOUT) &&
+            (poolPtr->workerCount > poolPtr->minWorkers) &&
+            (poolPtr->sharedCount == 0))
+        {
+            // Idle for too long, and not needed to keep the minimum number of workers.  The
+            // local queue is empty, as only this worker adds to it.
+            break;
+        }
+        UNLOCK_POOL(poolPtr);
+    }
+
+    // Still holding the pool mutex: free the slot.  The last worker signals the deleting thread
+    // before unlocking, as le_threadPool_Delete() takes the mutex before freeing the pool: nothing
+    // of the pool may be touched once it is unlocked.
+    workerPtr->threadRef = NULL;
+    poolPtr->workerCount--;
+    if (poolPtr->isDeleting && (poolPtr->workerCount == 0))
+    {
+        le_sem_Post(poolPtr->stoppedSem);
+    }
+    UNLOCK_POOL(poolPtr);
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start a worker in a free slot of a pool.  Must be called with the pool mutex locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartWorker
+(
+    threadPool_Pool_t* poolPtr
+)
+{
+    size_t index;
+
+    for (index = 0; index < poolPtr->maxWorkers; index++)
+    {
+        if (poolPtr->workers[index].threadRef == NULL)
+        {
+            break;
+        }
+    }
+
+    // The caller checked that the pool has fewer than maxWorkers workers.
+    LE_ASSERT(index < poolPtr->maxWorkers);
+
+    threadPool_Worker_t* workerPtr = &poolPtr->workers[index];
+    char threadName[MAX_THREAD_NAME_SIZE];
+
+    // Shorten the pool name if needed, so that the '-', the largest worker index and the null
+    // terminator always fit in the thread name.
+    int indexLen = snprintf(NULL, 0, "%" PRIuS, poolPtr->maxWorkers - 1);
+    int nameLen = (int)sizeof(threadName) - 2 - indexLen;
+
+    snprintf(threadName, sizeof(threadName), "%.*s-%" PRIuS, nameLen, poolPtr->name, index);
+
+    workerPtr->threadRef = le_thread_Create(threadName, WorkerMain, workerPtr);
+    le_thread_Start(workerPtr->threadRef);
+
+    poolPtr->workerCount++;
+    if (poolPtr->workerCount > poolPtr->maxWorkerCount)
+    {
+        poolPtr->maxWorkerCount = poolPtr->workerCount;
+    }
+}
+
+
+// ==============================
+//  INTRA-FRAMEWORK FUNCTIONS
+// ==============================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Exposing the thread pool list; mainly for the Inspect tool.
+ */
+//--------------------------------------------------------------------------------------------------
+le_dls_List_t* threadPool_GetPoolList
+(
+    void
+)
+{
+    return (&PoolList);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Exposing the thread pool list change counter; mainly for the Inspect tool.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t** threadPool_GetPoolListChgCntRef
+(
+    void
+)
+{
+    return (&PoolListChangeCountRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the Thread Pool module.
+ *
+ * This function must be called exactly once at process start-up, after the thread module has been
+ * initialized, and before any other thread pool module functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void threadPool_Init
+(
+    void
+)
+{
+    PoolPoolRef = le_mem_InitStaticPool(ThreadPoolObjs, LE_CONFIG_MAX_THREAD_POOLS,
+                                        sizeof(threadPool_Pool_t));
+    WorkPoolRef = le_mem_InitStaticPool(ThreadPoolWork, LE_CONFIG_MAX_THREAD_POOL_WORK_POOL_SIZE,
+                                        sizeof(Work_t));
+
+    LE_ASSERT(pthread_key_create(&WorkerKey, NULL) == 0);
+}
+
+
+// ==============================
+//  PUBLIC API FUNCTIONS
+// ==============================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a thread pool, and start its first @c minWorkers workers.
+ *
+ * @return Reference to the thread pool.
+ *
+ * @note Terminates the process on failure, no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_threadPool_Ref_t le_threadPool_Create
+(
+    const char* name,       ///< [IN] Name of the thread pool; also used to name its workers.
+    size_t      minWorkers, ///< [IN] Number of workers running at all times.
+    size_t      maxWorkers  ///< [IN] Maximum number of workers; between 1 and
+                            ///       LE_CONFIG_THREAD_POOL_MAX_WORKERS, and at least minWorkers.
+)
+{
+    LE_FATAL_IF((maxWorkers == 0) || (maxWorkers > LE_CONFIG_THREAD_POOL_MAX_WORKERS) ||
+                (minWorkers > maxWorkers),
+                "Invalid worker counts for thread pool '%s' (min %" PRIuS ", max %" PRIuS ").",
+                name, minWorkers, maxWorkers);
+
+    threadPool_Pool_t* poolPtr = le_mem_ForceAlloc(PoolPoolRef);
+
+    memset(poolPtr, 0, sizeof(*poolPtr));
+    poolPtr->poolListLink = LE_DLS_LINK_INIT;
+    LE_WARN_IF(le_utf8_Copy(poolPtr->name, name, sizeof(poolPtr->name), NULL) == LE_OVERFLOW,
+               "Thread pool name '%s' has been truncated to '%s'.",
+               name,
+               poolPtr->name);
+    poolPtr->minWorkers = minWorkers;
+    poolPtr->maxWorkers = maxWorkers;
+    LE_ASSERT(pthread_mutex_init(&poolPtr->mutex, NULL) == 0);
+    poolPtr->workSem = le_sem_Create(poolPtr->name, 0);
+    poolPtr->stoppedSem = le_sem_Create(poolPtr->name, 0);
+    poolPtr->sharedQueue = LE_DLS_LIST_INIT;
+
+    for (size_t i = 0; i < maxWorkers; i++)
+    {
+        poolPtr->workers[i].poolPtr = poolPtr;
+        poolPtr->workers[i].threadRef = NULL;
+        LE_ASSERT(pthread_mutex_init(&poolPtr->workers[i].queueMutex, NULL) == 0);
+        poolPtr->workers[i].queue = LE_DLS_LIST_INIT;
+    }
+
+    LOCK_POOL_LIST();
+    PoolListChangeCount++;
+    le_dls_Queue(&PoolList, &poolPtr->poolListLink);
+    UNLOCK_POOL_LIST();
+
+    LOCK_POOL(poolPtr);
+    while (poolPtr->workerCount < minWorkers)
+    {
+        StartWorker(poolPtr);
+    }
+    UNLOCK_POOL(poolPtr);
+
+    return poolPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Submit work to a thread pool.
+ *
+ * The work function will be called by one of the workers of the pool.  If a completion function
+ * is given, it will then be queued to the Event Loop of the calling thread.
+ *
+ * @note Terminates the process on failure, no need to check for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Submit
+(
+    le_threadPool_Ref_t             poolRef,        ///< [IN] Thread pool.
+    le_threadPool_WorkFunc_t        workFunc,       ///< [IN] Work function.
+    le_threadPool_CompletionFunc_t  completionFunc, ///< [IN] Completion function, or NULL.
+    void*                           param1Ptr,      ///< [IN] Passed to both functions.
+    void*                           param2Ptr       ///< [IN] Passed to both functions.
+)
+{
+    threadPool_Pool_t* poolPtr = poolRef;
+    threadPool_Worker_t* workerPtr = pthread_getspecific(WorkerKey);
+
+    LE_ASSERT(poolPtr != NULL);
+    LE_ASSERT(workFunc != NULL);
+    LE_FATAL_IF((workerPtr != NULL) && (completionFunc != NULL),
+                "Work submitted by a worker can't have a completion function.");
+
+    Work_t* workPtr = le_mem_ForceAlloc(WorkPoolRef);
+
+    workPtr->link = LE_DLS_LINK_INIT;
+    workPtr->workFunc = workFunc;
+    workPtr->completionFunc = completionFunc;
+    workPtr->param1Ptr = param1Ptr;
+    workPtr->param2Ptr = param2Ptr;
+    workPtr->threadRef = (completionFunc != NULL) ? le_thread_GetCurrent() : NULL;
+
+    if ((workerPtr != NULL) && (workerPtr->poolPtr == poolPtr))
+    {
+        // Submitted by one of the pool's own workers: keep it local, the worker will most likely
+        // run it next unless an idle worker steals it first.
+        LOCK_QUEUE(workerPtr);
+        le_dls_Stack(&workerPtr->queue, &workPtr->link);
+        UNLOCK_QUEUE(workerPtr);
+        CountQueuedWork(poolPtr);
+    }
+    else
+    {
+        LOCK_POOL(poolPtr);
+        LE_FATAL_IF(poolPtr->isDeleting, "Work submitted to thread pool '%s' being deleted.",
+                    poolPtr->name);
+        le_dls_Queue(&poolPtr->sharedQueue, &workPtr->link);
+        poolPtr->sharedCount++;
+        CountQueuedWork(poolPtr);
+
+        // Start another worker if the idle ones can't take all the shared work.
+        if ((poolPtr->sharedCount > poolPtr->idleCount) &&
+            (poolPtr->workerCount < poolPtr->maxWorkers))
+        {
+            StartWorker(poolPtr);
+        }
+        UNLOCK_POOL(poolPtr);
+    }
+
+    le_sem_Post(poolPtr->workSem);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the statistics of a thread pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_GetStats
+(
+    le_threadPool_Ref_t     poolRef,    ///< [IN] Thread pool.
+    le_threadPool_Stats_t*  statsPtr    ///< [OUT] Statistics.
+)
+{
+    threadPool_Pool_t* poolPtr = poolRef;
+
+    LE_ASSERT(poolPtr != NULL);
+    LE_ASSERT(statsPtr != NULL);
+
+    LOCK_POOL(poolPtr);
+    statsPtr->workerCount = poolPtr->workerCount;
+    statsPtr->maxWorkerCount = poolPtr->maxWorkerCount;
+    statsPtr->idleCount = poolPtr->idleCount;
+    statsPtr->queuedCount = poolPtr->queuedCount;
+    statsPtr->maxQueuedCount = poolPtr->maxQueuedCount;
+    statsPtr->submitCount = poolPtr->submitCount;
+    statsPtr->completeCount = poolPtr->completeCount;
+    statsPtr->stealCount = poolPtr->stealCount;
+    UNLOCK_POOL(poolPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a thread pool.
+ *
+ * Blocks until all the work submitted to the pool has been run, and its workers have stopped.
+ *
+ * @warning Must not be called by a worker of the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Delete
+(
+    le_threadPool_Ref_t poolRef     ///< [IN] Thread pool.
+)
+{
+    threadPool_Pool_t* poolPtr = poolRef;
+    threadPool_Worker_t* workerPtr = pthread_getspecific(WorkerKey);
+
+    LE_ASSERT(poolPtr != NULL);
+    LE_FATAL_IF((workerPtr != NULL) && (workerPtr->poolPtr == poolPtr),
+                "Thread pool '%s' deleted by one of its workers.", poolPtr->name);
+
+    LOCK_POOL(poolPtr);
+    LE_FATAL_IF(poolPtr->isDeleting, "Thread pool '%s' deleted twice.", poolPtr->name);
+    poolPtr->isDeleting = true;
+
+    // Work may still be queued with no worker left to run it, if the pool has no minimum workers.
+    if ((poolPtr->workerCount == 0) && (poolPtr->sharedCount > 0))
+    {
+        StartWorker(poolPtr);
+    }
+    size_t workerCount = poolPtr->workerCount;
+    UNLOCK_POOL(poolPtr);
+
+    if (workerCount > 0)
+    {
+        // Wake up the idle workers: they run the remaining work, then stop.
+        for (size_t i = 0; i < workerCount; i++)
+        {
+            le_sem_Post(poolPtr->workSem);
+        }
+
+        le_sem_Wait(poolPtr->stoppedSem);
+
+        // Wait for the last worker to release the mutex, after which it doesn't use the pool.
+        LOCK_POOL(poolPtr);
+        UNLOCK_POOL(poolPtr);
+    }
+
+    LOCK_POOL_LIST();
+    PoolListChangeCount++;
+    le_dls_Remove(&PoolList, &poolPtr->poolListLink);
+    UNLOCK_POOL_LIST();
+
+    for (size_t i = 0; i < poolPtr->maxWorkers; i++)
+    {
+        LE_ASSERT(le_dls_IsEmpty(&poolPtr->workers[i].queue));
+        LE_ASSERT(pthread_mutex_destroy(&poolPtr->workers[i].queueMutex) == 0);
+    }
+    LE_ASSERT(le_dls_IsEmpty(&poolPtr->sharedQueue));
+
+    le_sem_Delete(poolPtr->workSem);
+    le_sem_Delete(poolPtr->stoppedSem);
+    LE_ASSERT(pthread_mutex_destroy(&poolPtr->mutex) == 0);
+
+    le_mem_Release(poolPtr);
+}
@@ -0,0 +1,98 @@
+/**
+ * @file threadPool.h
+ *
+ * Thread Pool module's intra-framework header file.  This file exposes type definitions and
+ * function interfaces to other modules inside the framework implementation.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LEGATO_SRC_THREAD_POOL_H_INCLUDE_GUARD
+#define LEGATO_SRC_THREAD_POOL_H_INCLUDE_GUARD
+
+#include "limit.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Worker slot of a thread pool.
+ *
+ * A slot is free when its threadRef is NULL.  The local queue of a free slot is always empty.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    struct le_threadPool*   poolPtr;        ///< Thread pool the slot belongs to.
+    le_thread_Ref_t         threadRef;      ///< Worker thread, or NULL if the slot is free.
+    pthread_mutex_t         queueMutex;     ///< Pthreads mutex used to protect the local queue.
+    le_dls_List_t           queue;          ///< Local queue of work submitted by this worker.
+}
+threadPool_Worker_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread Pool object.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_threadPool
+{
+    le_dls_Link_t       poolListLink;   ///< Used to link onto the process's Thread Pool List.
+    char                name[LIMIT_MAX_THREAD_POOL_NAME_BYTES]; ///< Name of the pool.
+    size_t              minWorkers;     ///< Number of workers running at all times.
+    size_t              maxWorkers;     ///< Maximum number of workers.
+    pthread_mutex_t     mutex;          ///< Protects the shared queue, slots and worker counts.
+    le_sem_Ref_t        workSem;        ///< Posted each time work is queued.
+    le_sem_Ref_t        stoppedSem;     ///< Posted by the last worker stopped on deletion.
+    le_dls_List_t       sharedQueue;    ///< Work submitted from outside the pool.
+    size_t              sharedCount;    ///< Number of work items in the shared queue.
+    bool                isDeleting;     ///< true = the pool is being deleted.
+    size_t              workerCount;    ///< Number of running workers.
+    size_t              maxWorkerCount; ///< Highest number of running workers.
+    size_t              idleCount;      ///< Number of workers waiting for work.
+    size_t              queuedCount;    ///< Number of work items, in all the queues.
+    size_t              maxQueuedCount; ///< Highest number of work items in all the queues.
+    uint64_t            submitCount;    ///< Number of work items submitted.
+    uint64_t            completeCount;  ///< Number of work items run.
+    uint64_t            stealCount;     ///< Number of work items stolen from a local queue.
+    threadPool_Worker_t workers[LE_CONFIG_THREAD_POOL_MAX_WORKERS]; ///< Worker slots.
+}
+threadPool_Pool_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Exposing the thread pool list; mainly for the Inspect tool.
+ */
+//--------------------------------------------------------------------------------------------------
+le_dls_List_t* threadPool_GetPoolList
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Exposing the thread pool list change counter; mainly for the Inspect tool.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t** threadPool_GetPoolListChgCntRef
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the Thread Pool module.
+ *
+ * This function must be called exactly once at process start-up, after the thread module has been
+ * initialized, and before any other thread pool module functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void threadPool_Init
+(
+    void
+);
+
+
+#endif /* LEGATO_SRC_THREAD_POOL_H_INCLUDE_GUARD */
@@ -413,7 +413,19 @@ static void ProcessExpiredTimer
     // call the optional expiry handler function
     if ( expiredTimer->handlerRef != NULL )
     {
+#if LE_CONFIG_EVENT_LOOP_STATS
+        // The handler may delete the timer, so its name is recorded before the call.
+        event_PerThreadRec_t* eventRecPtr = thread_GetEventRecPtr();
+        event_Dispatch_t dispatch;
+        event_StartDispatch(eventRecPtr, &dispatch, EVENT_DISPATCH_TIMER_HANDLER,
+                            expiredTimer->handlerRef, TIMER_NAME(expiredTimer->name));
+#endif
+
         expiredTimer->handlerRef(expiredTimer->safeRef);
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+        event_EndDispatch(eventRecPtr, &dispatch);
+#endif
     }
 }
 
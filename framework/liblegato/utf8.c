@@ -1,11 +1,23 @@
 //--------------------------------------------------------------------------------------------------
 /** @file utf8.c
+ *
+ * Runs of single byte characters are checked several bytes at a time, with SIMD instructions when
+ * LE_CONFIG_STRING_SIMD is set and they are available: SSE2 on x86, and NEON on ARM when the
+ * target is built for it.
  *
  * Copyright (C) Sierra Wireless Inc.
  */
 
 #include "legato.h"
 
+#if LE_CONFIG_STRING_SIMD && defined(__SSE2__)
+#   define UTF8_SIMD_SSE2   1
+#   include <emmintrin.h>
+#elif LE_CONFIG_STRING_SIMD && defined(__ARM_NEON)
+#   define UTF8_SIMD_NEON   1
+#   include <arm_neon.h>
+#endif
+
 
 //--------------------------------------------------------------------------------------------------
 // Local definitions.
@@ -16,6 +28,68 @@
 #define IS_THREE_BYTE_CHAR(leadByte)            ( (leadByte & 0xF0) == 0xE0 )
 #define IS_FOUR_BYTE_CHAR(leadByte)             ( (leadByte & 0xF8) == 0xF0 )
 
+// Most significant bit of each byte of a 64-bit word, set in all but single byte characters.
+#define MULTI_BYTE_MASK_64                      UINT64_C(0x8080808080808080)
+
+// Number of bytes gone through character by character after a run of single byte characters,
+// before looking for the next run.
+#define CHAR_BY_CHAR_LEN                        16
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Returns the number of single byte characters at the start of a buffer, counted by blocks of 8
+ * bytes: shorter runs are left to the character by character processing.  Null characters are
+ * counted as any other single byte character, so the length of the buffer must be known.
+ *
+ * @return
+ *      Number of bytes, multiple of 8, before the block holding the first byte of a multi-byte
+ *      character or the end of the buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline size_t SingleByteCharsLen
+(
+    const char* string,     ///< [IN] Pointer to the buffer.
+    size_t len              ///< [IN] Number of bytes in the buffer.
+)
+{
+    size_t i = 0;
+
+#if UTF8_SIMD_SSE2
+    for (; i + 16 <= len; i += 16)
+    {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(string + i))) != 0)
+        {
+            break;
+        }
+    }
+#elif UTF8_SIMD_NEON
+    for (; i + 16 <= len; i += 16)
+    {
+        uint8x16_t bytes = vld1q_u8((const uint8_t*)string + i);
+        uint8x8_t folded = vorr_u8(vget_low_u8(bytes), vget_high_u8(bytes));
+
+        if (vget_lane_u64(vreinterpret_u64_u8(folded), 0) & MULTI_BYTE_MASK_64)
+        {
+            break;
+        }
+    }
+#endif
+
+    for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+
+        memcpy(&word, string + i, sizeof(word));
+        if (word & MULTI_BYTE_MASK_64)
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -38,6 +112,8 @@ ssize_t le_utf8_NumChars
     size_t numBytes;
     size_t strIndex = 0;
     size_t numChars = 0;
+    size_t blockEnd;
+    size_t len;
 
     // Check parameters.
     if (string == NULL)
@@ -45,29 +121,42 @@ ssize_t le_utf8_NumChars
         return 0;
     }
 
+    len = strlen(string);
+
     while (string[strIndex] != '\0')
     {
-        numBytes = le_utf8_NumBytesInChar(string[strIndex]);
-
-        if (numBytes == 0)
+        // Skip the run of single byte characters at once, then go through the next bytes one
+        // character at a time.
+        numBytes = SingleByteCharsLen(string + strIndex, len - strIndex);
+        strIndex += numBytes;
+        numChars += numBytes;
+        blockEnd = strIndex + CHAR_BY_CHAR_LEN;
+
+        while ( (string[strIndex] != '\0') && (strIndex < blockEnd) )
         {
-            return LE_FORMAT_ERROR;
-        }
+            numBytes = le_utf8_NumBytesInChar(string[strIndex]);
 
-        // Go through the bytes in this character to make sure all bytes are formatted correctly.
-        for (i = 1; i < numBytes; i++)
-        {
-            if ( !le_utf8_IsContinuationByte(string[++strIndex]) )
+            if (numBytes == 0)
             {
                 return LE_FORMAT_ERROR;
             }
-        }
 
-        // This character is correct.
-        numChars++;
+            // Go through the bytes in this character to make sure all bytes are formatted
+            // correctly.
+            for (i = 1; i < numBytes; i++)
+            {
+                if ( !le_utf8_IsContinuationByte(string[++strIndex]) )
+                {
+                    return LE_FORMAT_ERROR;
+                }
+            }
+
+            // This character is correct.
+            numChars++;
 
-        // Move on.
-        strIndex++;
+            // Move on.
+            strIndex++;
+        }
     }
 
     return numChars;
@@ -175,57 +264,78 @@ le_result_t le_utf8_Copy
     LE_ASSERT(srcStr != NULL);
     LE_ASSERT(destSize > 0);
 
-    // Go through the string copying one character at a time.
+    // Only the bytes before the null-character, and leaving room for it, can be copied.
+    const char* nullCharPtr = memchr(srcStr, '\0', destSize - 1);
+    size_t copyLen = (nullCharPtr != NULL) ? (size_t)(nullCharPtr - srcStr) : destSize - 1;
+
+    // Go through the string copying one run of single byte characters at a time, then the next
+    // bytes one character at a time.
     size_t i = 0;
+    size_t blockEnd;
     while (1)
     {
-        if (srcStr[i] == '\0')
+        if (i < copyLen)
         {
-            // NULL character found.  Complete the copy and return.
-            destStr[i] = '\0';
+            size_t runLen = SingleByteCharsLen(srcStr + i, copyLen - i);
 
-            if (numBytesPtr)
+            if (runLen > 0)
             {
-                *numBytesPtr = i;
+                memcpy(destStr + i, srcStr + i, runLen);
+                i += runLen;
             }
-
-            return LE_OK;
         }
-        else
-        {
-            size_t charLength = le_utf8_NumBytesInChar(srcStr[i]);
+        blockEnd = i + CHAR_BY_CHAR_LEN;
 
-            if (charLength == 0)
+        while (i < blockEnd)
+        {
+            if (srcStr[i] == '\0')
             {
-                // This is an error in the string format.  Zero out the destStr and return.
-                destStr[0] = '\0';
+                // NULL character found.  Complete the copy and return.
+                destStr[i] = '\0';
 
                 if (numBytesPtr)
                 {
-                    *numBytesPtr = 0;
+                    *numBytesPtr = i;
                 }
 
                 return LE_OK;
             }
-            else if (charLength + i >= destSize)
+            else
             {
-                // This character will not fit in the available space so stop.
-                destStr[i] = '\0';
+                size_t charLength = le_utf8_NumBytesInChar(srcStr[i]);
 
-                if (numBytesPtr)
+                if (charLength == 0)
                 {
-                    *numBytesPtr = i;
+                    // This is an error in the string format.  Zero out the destStr and return.
+                    destStr[0] = '\0';
+
+                    if (numBytesPtr)
+                    {
+                        *numBytesPtr = 0;
+                    }
+
+                    return LE_OK;
                 }
+                else if (charLength + i >= destSize)
+                {
+                    // This character will not fit in the available space so stop.
+                    destStr[i] = '\0';
 
-                return LE_OVERFLOW;
-            }
-            else
-            {
-                // Copy the character.
-                for (; charLength > 0; charLength--)
+                    if (numBytesPtr)
+                    {
+                        *numBytesPtr = i;
+                    }
+
+                    return LE_OVERFLOW;
+                }
+                else
                 {
-                    destStr[i] = srcStr[i];
-                    i++;
+                    // Copy the character.
+                    for (; charLength > 0; charLength--)
+                    {
+                        destStr[i] = srcStr[i];
+                        i++;
+                    }
                 }
             }
         }
@@ -407,6 +517,8 @@ bool le_utf8_IsFormatCorrect
     size_t i;
     size_t numBytes = 0;
     size_t strIndex = 0;
+    size_t blockEnd;
+    size_t len;
 
     // Check parameters.
     if (string == NULL)
@@ -414,26 +526,37 @@ bool le_utf8_IsFormatCorrect
         return false;
     }
 
+    len = strlen(string);
+
     while (string[strIndex] != '\0')
     {
-        numBytes = le_utf8_NumBytesInChar(string[strIndex]);
+        // Skip the run of single byte characters at once, then go through the next bytes one
+        // character at a time.
+        strIndex += SingleByteCharsLen(string + strIndex, len - strIndex);
+        blockEnd = strIndex + CHAR_BY_CHAR_LEN;
 
-        if (numBytes == 0)
+        while ( (string[strIndex] != '\0') && (strIndex < blockEnd) )
         {
-            return false;
-        }
+            numBytes = le_utf8_NumBytesInChar(string[strIndex]);
 
-        // Go through the bytes in this character to make sure all bytes are formatted correctly.
-        for (i = 1; i < numBytes; i++)
-        {
-            if ( !le_utf8_IsContinuationByte(string[++strIndex]) )
+            if (numBytes == 0)
             {
                 return false;
             }
-        }
 
-        // Move on.
-        strIndex++;
+            // Go through the bytes in this character to make sure all bytes are formatted
+            // correctly.
+            for (i = 1; i < numBytes; i++)
+            {
+                if ( !le_utf8_IsContinuationByte(string[++strIndex]) )
+                {
+                    return false;
+                }
+            }
+
+            // Move on.
+            strIndex++;
+        }
     }
 
     return true;
@@ -0,0 +1,487 @@
+/**
+ * Test of the base64, hexadecimal and UTF-8 conversions of the Legato runtime library, on short
+ * and long inputs.
+ *
+ * The results are checked against simple byte by byte conversions over data of various sizes and
+ * alignments, and the throughput of each conversion is logged.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the long inputs, and number of times they are converted for the throughput.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_LINUX
+#define LONG_SIZE           (64 * 1024)
+#else
+#define LONG_SIZE           (2 * 1024)
+#endif
+#define LONG_ITERATIONS     256
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the short inputs, and number of times they are converted for the throughput.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SHORT_SIZE          24
+#define SHORT_ITERATIONS    (LONG_ITERATIONS * (LONG_SIZE / SHORT_SIZE))
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of random sizes and alignments compared.
+ */
+//--------------------------------------------------------------------------------------------------
+#define COMPARISON_COUNT    500
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Length of the lines of the base64-encoded text with line breaks.
+ */
+//--------------------------------------------------------------------------------------------------
+#define BASE64_LINE_LEN     76
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Buffers: random data, and the results of the conversions and of the references.  Some room is
+ * left for the alignments, and for the line breaks of the base64-encoded text.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t Data[LONG_SIZE + 64];
+static char Text[4 * LONG_SIZE];
+static char RefText[4 * LONG_SIZE];
+static uint8_t Result[LONG_SIZE + 64];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Encode in base64 byte by byte, as a reference.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReferenceBase64
+(
+    const uint8_t*  dataPtr,
+    size_t          size,
+    char*           textPtr
+)
+{
+    static const char alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    uint32_t bits = 0;
+    int bitCount = 0;
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        bits = (bits << 8) | dataPtr[i];
+        bitCount += 8;
+        while (bitCount >= 6)
+        {
+            bitCount -= 6;
+            *textPtr++ = alphabet[(bits >> bitCount) & 63];
+        }
+    }
+
+    if (bitCount > 0)
+    {
+        *textPtr++ = alphabet[(bits << (6 - bitCount)) & 63];
+        *textPtr++ = '=';
+        if (bitCount == 2)
+        {
+            *textPtr++ = '=';
+        }
+    }
+    *textPtr = '\0';
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check the base64 test vectors of RFC 4648.
+ *
+ * @return the number of errors.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CheckBase64Vectors
+(
+    void
+)
+{
+    static const char* const vectors[][2] =
+    {
+        { "", "" },
+        { "f", "Zg==" },
+        { "fo", "Zm8=" },
+        { "foo", "Zm9v" },
+        { "foob", "Zm9vYg==" },
+        { "fooba", "Zm9vYmE=" },
+        { "foobar", "Zm9vYmFy" },
+    };
+    int errors = 0;
+    size_t i;
+
+    for (i = 0; i < NUM_ARRAY_MEMBERS(vectors); i++)
+    {
+        size_t dataLen = strlen(vectors[i][0]);
+        size_t textLen = sizeof(Text);
+        size_t resultLen = sizeof(Result);
+
+        if ((le_base64_Encode((const uint8_t*)vectors[i][0], dataLen, Text, &textLen) != LE_OK) ||
+            (strcmp(Text, vectors[i][1]) != 0) ||
+            (le_base64_Decode(Text, textLen - 1, Result, &resultLen) != LE_OK) ||
+            (resultLen != dataLen) || (memcmp(Result, vectors[i][0], dataLen) != 0))
+        {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare base64 encoding with the reference, and decoding of the result with or without line
+ * breaks, over random sizes and alignments.
+ *
+ * @return the number of differences.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareBase64
+(
+    void
+)
+{
+    int differences = 0;
+    int i;
+
+    for (i = 0; i < COMPARISON_COUNT; i++)
+    {
+        size_t offset = rand() % 64;
+        // Mostly short inputs, with some long ones
+        size_t size = rand() % ((i % 16) ? 256 : LONG_SIZE);
+        size_t textLen = sizeof(Text);
+        size_t resultLen = sizeof(Result);
+        size_t len;
+        size_t j;
+
+        ReferenceBase64(Data + offset, size, RefText);
+        if ((le_base64_Encode(Data + offset, size, Text, &textLen) != LE_OK) ||
+            (strcmp(Text, RefText) != 0) ||
+            (le_base64_Decode(Text, textLen - 1, Result, &resultLen) != LE_OK) ||
+            (resultLen != size) || (memcmp(Result, Data + offset, size) != 0))
+        {
+            differences++;
+            continue;
+        }
+
+        // Same text, split in lines
+        for (j = 0, len = 0; RefText[j] != '\0'; j++)
+        {
+            Text[len++] = RefText[j];
+            if ((j % BASE64_LINE_LEN) == (BASE64_LINE_LEN - 1))
+            {
+                Text[len++] = '\n';
+            }
+        }
+        resultLen = sizeof(Result);
+        if ((le_base64_Decode(Text, len, Result, &resultLen) != LE_OK) ||
+            (resultLen != size) || (memcmp(Result, Data + offset, size) != 0))
+        {
+            differences++;
+            continue;
+        }
+
+        // Any character out of the alphabet before the padding is rejected
+        if (size > 0)
+        {
+            Text[rand() % strcspn(RefText, "=")] = '*';
+            resultLen = sizeof(Result);
+            if (le_base64_Decode(Text, len, Result, &resultLen) != LE_FORMAT_ERROR)
+            {
+                differences++;
+            }
+        }
+    }
+    return differences;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare conversions to and from hexadecimal strings with snprintf(), over random sizes and
+ * alignments.
+ *
+ * @return the number of differences.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareHex
+(
+    void
+)
+{
+    int differences = 0;
+    int i;
+
+    for (i = 0; i < COMPARISON_COUNT; i++)
+    {
+        size_t offset = rand() % 64;
+        size_t size = rand() % ((i % 16) ? 256 : LONG_SIZE);
+        size_t j;
+
+        for (j = 0; j < size; j++)
+        {
+            snprintf(RefText + 2 * j, 3, "%02X", Data[offset + j]);
+        }
+        RefText[2 * size] = '\0';
+
+        if ((le_hex_BinaryToString(Data + offset, size, Text, sizeof(Text)) !=
+             (int32_t)(2 * size)) ||
+            (strcmp(Text, RefText) != 0))
+        {
+            differences++;
+            continue;
+        }
+
+        // Both cases are accepted
+        for (j = 0; j < 2 * size; j += 3)
+        {
+            Text[j] = tolower((int)Text[j]);
+        }
+        if ((le_hex_StringToBinary(Text, 2 * size, Result, sizeof(Result)) != (int32_t)size) ||
+            (memcmp(Result, Data + offset, size) != 0))
+        {
+            differences++;
+            continue;
+        }
+
+        // Any character which is not hexadecimal is rejected
+        if (size > 0)
+        {
+            Text[rand() % (2 * size)] = 'g';
+            if (le_hex_StringToBinary(Text, 2 * size, Result, sizeof(Result)) != -1)
+            {
+                differences++;
+            }
+        }
+    }
+    return differences;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build a UTF-8 string of random characters, single byte ones being the most frequent.
+ *
+ * @return the number of characters.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t BuildUtf8String
+(
+    char*   strPtr,
+    size_t  size        ///< Number of bytes, without the null-terminator
+)
+{
+    size_t numChars = 0;
+    size_t len = 0;
+
+    while (len < size)
+    {
+        // Code points of the 4 sizes of characters, up to what fits
+        uint32_t codePoint = 1 + (rand() % 0x7E);
+        size_t charLen = 4;
+
+        switch (rand() % 16)
+        {
+            case 0:
+                codePoint = 0x80 + (rand() % 0x780);
+                break;
+            case 1:
+                codePoint = 0x800 + (rand() % 0xF800);
+                break;
+            case 2:
+                codePoint = 0x10000 + (rand() % 0x100000);
+                break;
+        }
+        if ((le_utf8_EncodeUnicodeCodePoint(codePoint, strPtr + len, &charLen) != LE_OK) ||
+            (len + charLen > size))
+        {
+            strPtr[len++] = 'a';
+        }
+        else
+        {
+            len += charLen;
+        }
+        numChars++;
+    }
+    strPtr[len] = '\0';
+    return numChars;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check the UTF-8 functions on random strings: number of characters, format check, and copy into
+ * buffers of random sizes, which must not split any character.
+ *
+ * @return the number of differences.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareUtf8
+(
+    void
+)
+{
+    int differences = 0;
+    int i;
+
+    for (i = 0; i < COMPARISON_COUNT; i++)
+    {
+        size_t size = rand() % ((i % 16) ? 256 : LONG_SIZE);
+        size_t numChars = BuildUtf8String(RefText, size);
+        size_t destSize = 1 + rand() % (size + 1);
+        size_t numBytes;
+        le_result_t result;
+
+        if ((le_utf8_NumChars(RefText) != (ssize_t)numChars) ||
+            !le_utf8_IsFormatCorrect(RefText))
+        {
+            differences++;
+            continue;
+        }
+
+        result = le_utf8_Copy(Text, RefText, destSize, &numBytes);
+        if ((result != ((destSize > size) ? LE_OK : LE_OVERFLOW)) ||
+            (numBytes >= destSize) || (Text[numBytes] != '\0') ||
+            (memcmp(Text, RefText, numBytes) != 0) ||
+            ((RefText[numBytes] & 0xC0) == 0x80))
+        {
+            differences++;
+            continue;
+        }
+
+        // A continuation byte without lead byte is a format error
+        if (size > 0)
+        {
+            size_t j = rand() % size;
+
+            while ((RefText[j] & 0xC0) == 0x80)
+            {
+                j--;
+            }
+            RefText[j] = (char)0x80;
+            if (le_utf8_IsFormatCorrect(RefText) ||
+                (le_utf8_NumChars(RefText) != LE_FORMAT_ERROR))
+            {
+                differences++;
+            }
+        }
+    }
+    return differences;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Log the throughput of a conversion.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogThroughput
+(
+    const char* name,
+    size_t      size,
+    le_clk_Time_t start,
+    int         iterations
+)
+{
+    le_clk_Time_t duration = le_clk_Sub(le_clk_GetRelativeTime(), start);
+    uint64_t durationUs = (uint64_t)duration.sec * 1000000 + duration.usec;
+
+    LE_TEST_INFO("%-18s %5" PRIuS " bytes: %8" PRIu64 " us, %6" PRIu64 " MB/s",
+                 name, size, durationUs,
+                 (uint64_t)iterations * size / (durationUs ? durationUs : 1));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Log the throughput of the conversions of inputs of a given size.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunThroughput
+(
+    size_t  size,
+    int     iterations
+)
+{
+    le_clk_Time_t start;
+    size_t len;
+    int i;
+
+    start = le_clk_GetRelativeTime();
+    for (i = 0; i < iterations; i++)
+    {
+        len = sizeof(Text);
+        LE_ASSERT_OK(le_base64_Encode(Data, size, Text, &len));
+    }
+    LogThroughput("base64 encode", size, start, iterations);
+
+    len = sizeof(Text);
+    LE_ASSERT_OK(le_base64_Encode(Data, size, Text, &len));
+    start = le_clk_GetRelativeTime();
+    for (i = 0; i < iterations; i++)
+    {
+        size_t resultLen = sizeof(Result);
+        LE_ASSERT_OK(le_base64_Decode(Text, len - 1, Result, &resultLen));
+    }
+    LogThroughput("base64 decode", size, start, iterations);
+
+    start = le_clk_GetRelativeTime();
+    for (i = 0; i < iterations; i++)
+    {
+        LE_ASSERT(le_hex_BinaryToString(Data, size, Text, sizeof(Text)) == (int32_t)(2 * size));
+    }
+    LogThroughput("hex encode", size, start, iterations);
+
+    start = le_clk_GetRelativeTime();
+    for (i = 0; i < iterations; i++)
+    {
+        LE_ASSERT(le_hex_StringToBinary(Text, 2 * size, Result, sizeof(Result)) == (int32_t)size);
+    }
+    LogThroughput("hex decode", size, start, iterations);
+
+    // Mostly single byte characters, as in most of the strings handled
+    BuildUtf8String(RefText, size);
+    start = le_clk_GetRelativeTime();
+    for (i = 0; i < iterations; i++)
+    {
+        LE_ASSERT(le_utf8_IsFormatCorrect(RefText));
+    }
+    LogThroughput("UTF-8 check", size, start, iterations);
+
+    start = le_clk_GetRelativeTime();
+    for (i = 0; i < iterations; i++)
+    {
+        LE_ASSERT_OK(le_utf8_Copy(Text, RefText, sizeof(Text), NULL));
+    }
+    LogThroughput("UTF-8 copy", size, start, iterations);
+}
+
+COMPONENT_INIT
+{
+    size_t i;
+
+    LE_TEST_PLAN(4);
+
+    srand(1);
+    for (i = 0; i < sizeof(Data); i++)
+    {
+        Data[i] = (uint8_t)rand();
+    }
+
+    LE_TEST_OK(CheckBase64Vectors() == 0, "Verified base64 test vectors");
+    LE_TEST_OK(CompareBase64() == 0,
+        "Verified base64 conversions of data of various sizes and alignments");
+    LE_TEST_OK(CompareHex() == 0,
+        "Verified hexadecimal conversions of data of various sizes and alignments");
+    LE_TEST_OK(CompareUtf8() == 0, "Verified UTF-8 strings of various sizes");
+
+    RunThroughput(SHORT_SIZE, SHORT_ITERATIONS);
+    RunThroughput(LONG_SIZE, LONG_ITERATIONS);
+
+    LE_TEST_EXIT;
+}
@@ -1,11 +1,135 @@
 /**
  * Simple test of Legato CRC API.
  *
+ * The results are also checked against a bit-by-bit computation over buffers of various sizes and
+ * alignments, and the throughput of each CRC is logged.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 
 #include "legato.h"
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the buffer used for the comparisons and the throughput, and number of times the
+ * throughput buffer is processed.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_LINUX
+#define BUFFER_SIZE         (1024 * 1024)
+#else
+#define BUFFER_SIZE         (16 * 1024)
+#endif
+#define ITERATION_COUNT     64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of random sizes and alignments compared.
+ */
+//--------------------------------------------------------------------------------------------------
+#define COMPARISON_COUNT    2000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Polynomials, in reflected bit order.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CRC32_POLY          0xEDB88320U
+#define CRC32C_POLY         0x82F63B78U
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Buffer used for the comparisons and the throughput.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t Buffer[BUFFER_SIZE];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a CRC bit by bit, as a reference.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t ReferenceCrc
+(
+    uint32_t        poly,
+    const uint8_t*  addressPtr,
+    size_t          size,
+    uint32_t        crc
+)
+{
+    int i;
+
+    for (; size > 0; size--)
+    {
+        crc ^= *addressPtr++;
+        for (i = 0; i < 8; i++)
+        {
+            crc = (crc >> 1) ^ ((crc & 1) ? poly : 0);
+        }
+    }
+    return crc;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare a CRC function with the reference over random sizes, alignments and seeds.
+ *
+ * @return the number of differences.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareWithReference
+(
+    uint32_t (*crcFunc)(uint8_t*, size_t, uint32_t),
+    uint32_t poly
+)
+{
+    int differences = 0;
+    int i;
+
+    for (i = 0; i < COMPARISON_COUNT; i++)
+    {
+        size_t offset = rand() % 64;
+        // Mostly short buffers, with some covering the whole buffer
+        size_t size = rand() % ((i % 16) ? 512 : (BUFFER_SIZE - offset));
+        uint32_t seed = (uint32_t)rand();
+
+        if (crcFunc(Buffer + offset, size, seed) !=
+            ReferenceCrc(poly, Buffer + offset, size, seed))
+        {
+            differences++;
+        }
+    }
+    return differences;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Log the throughput of a CRC function.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogThroughput
+(
+    const char* name,
+    uint32_t (*crcFunc)(uint8_t*, size_t, uint32_t)
+)
+{
+    le_clk_Time_t start = le_clk_GetRelativeTime();
+    uint32_t crc = LE_CRC_START_CRC32;
+    int i;
+
+    for (i = 0; i < ITERATION_COUNT; i++)
+    {
+        crc = crcFunc(Buffer, sizeof(Buffer), crc);
+    }
+
+    le_clk_Time_t duration = le_clk_Sub(le_clk_GetRelativeTime(), start);
+    uint64_t durationUs = (uint64_t)duration.sec * 1000000 + duration.usec;
+
+    LE_TEST_INFO("%-7s %8" PRIu64 " us for %d x %d bytes, %6" PRIu64 " MB/s (0x%08" PRIX32 ")",
+                 name, durationUs, ITERATION_COUNT, BUFFER_SIZE,
+                 (uint64_t)ITERATION_COUNT * BUFFER_SIZE / (durationUs ? durationUs : 1), crc);
+}
+
 COMPONENT_INIT
 {
     uint32_t    crc;
@@ -20,9 +144,12 @@ COMPONENT_INIT
                 };
     uint8_t     data3[2] = { 0x00, 0x00 };
 
-    LE_TEST_PLAN(3); // Indicate that there are 3 test cases in this app.
+    uint8_t     check[] = "123456789";
+    size_t      i;
+
+    LE_TEST_PLAN(6); // Indicate that there are 6 test cases in this app.
 
-    // Execute the 3 test cases.
+    // Execute the 6 test cases.
     crc = le_crc_Crc32(data1, sizeof(data1), LE_CRC_START_CRC32);
     expected = ~0x7F34014E;
     LE_TEST_OK(crc == expected, "Verified initial CRC (0x%08" PRIX32 ") is valid (0x%08" PRIX32 ")",
@@ -38,6 +165,25 @@ COMPONENT_INIT
     LE_TEST_OK(crc == expected, "Verified final CRC (0x%08" PRIX32 ") is valid (0x%08" PRIX32 ")",
         crc, expected);
 
+    crc = le_crc_Crc32c(check, sizeof(check) - 1, LE_CRC_START_CRC32);
+    expected = ~0xE3069283;
+    LE_TEST_OK(crc == expected, "Verified CRC32C (0x%08" PRIX32 ") is valid (0x%08" PRIX32 ")",
+        crc, expected);
+
+    srand(1);
+    for (i = 0; i < sizeof(Buffer); i++)
+    {
+        Buffer[i] = (uint8_t)rand();
+    }
+
+    LE_TEST_OK(CompareWithReference(le_crc_Crc32, CRC32_POLY) == 0,
+        "Verified CRC32 of buffers of various sizes and alignments");
+    LE_TEST_OK(CompareWithReference(le_crc_Crc32c, CRC32C_POLY) == 0,
+        "Verified CRC32C of buffers of various sizes and alignments");
+
+    LogThroughput("CRC32:", le_crc_Crc32);
+    LogThroughput("CRC32C:", le_crc_Crc32c);
+
     // End the test sequence.
     LE_TEST_EXIT;
 }
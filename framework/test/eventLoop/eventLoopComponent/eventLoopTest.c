@@ -12,8 +12,31 @@ static le_event_Id_t EventIdA;
 static le_event_Id_t EventIdB;
 static le_event_Id_t EventIdC;
 
+static le_event_Id_t LatestEventId;
+static le_event_Id_t MergeEventId;
+
+static int LatestValue;
+static int LatestCallCount;
+static int MergeValue;
+static int MergeCallCount;
+
 static char EventContextA[] = "Context A";
 
+// Threads queuing functions to the main thread concurrently, and the number of functions each of
+// them queues.
+#define PRODUCER_COUNT      4
+#if LE_CONFIG_LINUX
+#   define PRODUCER_REPORTS 2000
+#else
+#   define PRODUCER_REPORTS 100
+#endif
+
+static le_thread_Ref_t MainThread;
+static uint32_t NextSequence[PRODUCER_COUNT];
+static uint32_t ReceivedCount;
+static bool IsFifo = true;
+static le_clk_Time_t ProducerStartTime;
+
 typedef struct
 {
     char str[10];
@@ -84,6 +107,108 @@ static void Destructor
 }
 
 
+static void LatestHandler
+(
+    void* reportPtr
+)
+{
+    LatestValue = *(int*)reportPtr;
+    LatestCallCount++;
+}
+
+
+static void MergeHandler
+(
+    void* reportPtr
+)
+{
+    MergeValue = *(int*)reportPtr;
+    MergeCallCount++;
+}
+
+
+static void SumReports
+(
+    void*       pendingReportPtr,
+    const void* newReportPtr,
+    size_t      newReportSize
+)
+{
+    LE_ASSERT(newReportSize == sizeof(int));
+
+    *(int*)pendingReportPtr += *(const int*)newReportPtr;
+}
+
+
+static void CheckProducerResults
+(
+    void
+)
+{
+    le_clk_Time_t duration = le_clk_Sub(le_clk_GetRelativeTime(), ProducerStartTime);
+    uint64_t durationUs = (uint64_t)duration.sec * 1000000 + duration.usec;
+    int i;
+
+    LE_TEST_OK(IsFifo, "Functions queued by each thread called in order.");
+
+    for (i = 0; i < PRODUCER_COUNT; i++)
+    {
+        if (NextSequence[i] != PRODUCER_REPORTS)
+        {
+            break;
+        }
+    }
+    LE_TEST_OK(i == PRODUCER_COUNT, "All functions queued by %d threads called.", PRODUCER_COUNT);
+
+    LE_TEST_INFO("%d functions queued from %d threads in %" PRIu64 " us.",
+                 PRODUCER_COUNT * PRODUCER_REPORTS, PRODUCER_COUNT, durationUs);
+
+    LE_INFO("======== EVENT LOOP TEST COMPLETE (PASSED) ========");
+    LE_TEST_EXIT;
+}
+
+
+static void ProducerReport
+(
+    void* param1Ptr,    // Producer index.
+    void* param2Ptr     // Sequence number, within the producer.
+)
+{
+    size_t producer = (size_t)param1Ptr;
+    uint32_t sequence = (uint32_t)(uintptr_t)param2Ptr;
+
+    if (sequence != NextSequence[producer])
+    {
+        LE_ERROR("Producer %" PRIuS " function %u called instead of %u.",
+                 producer, sequence, NextSequence[producer]);
+        IsFifo = false;
+    }
+    NextSequence[producer] = sequence + 1;
+
+    if (++ReceivedCount == PRODUCER_COUNT * PRODUCER_REPORTS)
+    {
+        CheckProducerResults();
+    }
+}
+
+
+static void* ProducerThread
+(
+    void* contextPtr    // Producer index.
+)
+{
+    uint32_t i;
+
+    for (i = 0; i < PRODUCER_REPORTS; i++)
+    {
+        le_event_QueueFunctionToThread(MainThread, ProducerReport, contextPtr,
+                                       (void*)(uintptr_t)i);
+    }
+
+    return NULL;
+}
+
+
 static void CheckTestResults
 (
     void* param1Ptr,
@@ -97,8 +222,21 @@ static void CheckTestResults
     LE_TEST_OK(TestAPassed, "Test Event B passed");
     LE_TEST_OK(TestAPassed, "Test Event C passed");
 
-    LE_INFO("======== EVENT LOOP TEST COMPLETE (PASSED) ========");
-    LE_TEST_EXIT;
+    LE_TEST_OK(LatestCallCount == 1, "Coalesced reports handled once (%d).", LatestCallCount);
+    LE_TEST_OK(LatestValue == 5, "Latest report value handled (%d).", LatestValue);
+    LE_TEST_OK(le_event_GetCoalescedCount(LatestEventId) == 4, "Four reports coalesced.");
+    LE_TEST_OK(MergeCallCount == 1, "Merged reports handled once (%d).", MergeCallCount);
+    LE_TEST_OK(MergeValue == 15, "Merged report value handled (%d).", MergeValue);
+    LE_TEST_OK(le_event_GetCoalescedCount(MergeEventId) == 4, "Four reports merged.");
+
+    // Then have several threads queue functions to this one at the same time.
+    size_t i;
+    MainThread = le_thread_GetCurrent();
+    ProducerStartTime = le_clk_GetRelativeTime();
+    for (i = 0; i < PRODUCER_COUNT; i++)
+    {
+        le_thread_Start(le_thread_Create("Producer", ProducerThread, (void*)i));
+    }
 }
 
 
@@ -114,7 +252,7 @@ COMPONENT_INIT
 
     LE_INFO("%s called!", __func__);
 
-    LE_TEST_PLAN(22);
+    LE_TEST_PLAN(30);
 
     EventIdA = le_event_CreateId("Event A", sizeof(ReportA));
     LE_TEST_OK(true, "Created event ID A.");
@@ -152,6 +290,21 @@ COMPONENT_INIT
     le_event_ReportWithRefCounting(EventIdC, reportPtr);
     LE_TEST_OK(true, "Reporting event C with ref counting...");
 
+    LatestEventId = le_event_CreateId("Latest", sizeof(int));
+    le_event_SetCoalescing(LatestEventId, LE_EVENT_COALESCE_LATEST, NULL);
+    le_event_AddHandler("Latest", LatestEventId, LatestHandler);
+
+    MergeEventId = le_event_CreateId("Merge", sizeof(int));
+    le_event_SetCoalescing(MergeEventId, LE_EVENT_COALESCE_MERGE, SumReports);
+    le_event_AddHandler("Merge", MergeEventId, MergeHandler);
+
+    int i;
+    for (i = 1; i <= 5; i++)
+    {
+        le_event_Report(LatestEventId, &i, sizeof(i));
+        le_event_Report(MergeEventId, &i, sizeof(i));
+    }
+
     le_event_QueueFunction(CheckTestResults, &ReportA, &ReportB);
     LE_TEST_OK(true, "Queuing function to check test results for events A and B...");
 }
@@ -0,0 +1,232 @@
+/**
+ * Test of the Legato thread pool API.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+#include "legato.h"
+
+#define WORK_COUNT          20
+#define NESTED_WORK_COUNT   10
+#define FIXED_WORKERS       2
+#define ELASTIC_MAX_WORKERS 4
+
+static le_thread_Ref_t MainThreadRef;
+
+static le_threadPool_Ref_t FixedPoolRef;
+static le_threadPool_Ref_t ElasticPoolRef;
+
+static int WorkCount;
+static int CompletionCount;
+static int NestedWorkCount;
+static bool IsCompletedOnMainThread = true;
+
+static le_sem_Ref_t GateSemRef;
+
+
+static void ElasticWorkDone(void* param1Ptr, void* param2Ptr);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Work run by the workers of the pools.  Doubles the value pointed to by the first parameter.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DoubleWork
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    int* valuePtr = param1Ptr;
+    le_sem_Ref_t gateRef = param2Ptr;
+
+    if (gateRef != NULL)
+    {
+        le_sem_Wait(gateRef);
+    }
+
+    *valuePtr *= 2;
+    LE_ATOMIC_ADD_FETCH(&WorkCount, 1, LE_ATOMIC_ORDER_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Nested work, submitted by a worker.
+ */
+//--------------------------------------------------------------------------------------------------
+static void NestedWork
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    LE_UNUSED(param1Ptr);
+    LE_UNUSED(param2Ptr);
+
+    LE_ATOMIC_ADD_FETCH(&NestedWorkCount, 1, LE_ATOMIC_ORDER_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Work submitting more work to its own pool.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SubmitNestedWork
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    le_threadPool_Ref_t poolRef = param1Ptr;
+    int i;
+
+    LE_UNUSED(param2Ptr);
+
+    for (i = 0; i < NESTED_WORK_COUNT; i++)
+    {
+        le_threadPool_Submit(poolRef, NestedWork, NULL, NULL, NULL);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Completion of the fixed pool work; checks the result and the calling thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FixedWorkDone
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    int* valuePtr = param1Ptr;
+
+    LE_UNUSED(param2Ptr);
+
+    if (le_thread_GetCurrent() != MainThreadRef)
+    {
+        IsCompletedOnMainThread = false;
+    }
+
+    CompletionCount++;
+    LE_TEST_OK(*valuePtr % 2 == 0, "work %d doubled its value", CompletionCount);
+
+    if (CompletionCount < WORK_COUNT)
+    {
+        return;
+    }
+
+    LE_TEST_OK(IsCompletedOnMainThread, "completions called by the submitting thread");
+    LE_TEST_OK(WorkCount == WORK_COUNT, "all the work was run before its completion");
+
+    le_threadPool_Stats_t stats;
+    le_threadPool_GetStats(FixedPoolRef, &stats);
+    LE_TEST_OK(stats.workerCount == FIXED_WORKERS, "fixed pool has %zu workers",
+               stats.workerCount);
+    LE_TEST_OK(stats.submitCount == WORK_COUNT, "fixed pool counted %"PRIu64" submissions",
+               stats.submitCount);
+    LE_TEST_OK(stats.completeCount == WORK_COUNT, "fixed pool counted %"PRIu64" completions",
+               stats.completeCount);
+    LE_TEST_OK(stats.queuedCount == 0, "fixed pool has no queued work");
+    LE_TEST_OK(stats.maxQueuedCount >= 1 && stats.maxQueuedCount <= WORK_COUNT,
+               "fixed pool had at most %zu queued work items", stats.maxQueuedCount);
+
+    LE_TEST_INFO("-------- Testing nested work --------");
+    le_threadPool_Submit(FixedPoolRef, SubmitNestedWork, NULL, FixedPoolRef, NULL);
+
+    // Deletion runs the nested work before returning.
+    le_threadPool_Delete(FixedPoolRef);
+    LE_TEST_OK(NestedWorkCount == NESTED_WORK_COUNT, "nested work run before deletion");
+
+    LE_TEST_INFO("-------- Testing elastic pool --------");
+    static int ElasticValues[ELASTIC_MAX_WORKERS * 2];
+    int i;
+
+    WorkCount = 0;
+    CompletionCount = 0;
+    GateSemRef = le_sem_Create("ThreadPoolGate", 0);
+    ElasticPoolRef = le_threadPool_Create("ElasticPool", 0, ELASTIC_MAX_WORKERS);
+
+    le_threadPool_GetStats(ElasticPoolRef, &stats);
+    LE_TEST_OK(stats.workerCount == 0, "elastic pool starts without workers");
+
+    for (i = 0; i < (int)NUM_ARRAY_MEMBERS(ElasticValues); i++)
+    {
+        ElasticValues[i] = i + 1;
+        le_threadPool_Submit(ElasticPoolRef, DoubleWork, ElasticWorkDone, &ElasticValues[i],
+                             GateSemRef);
+    }
+
+    le_threadPool_GetStats(ElasticPoolRef, &stats);
+    LE_TEST_OK(stats.workerCount >= 1 && stats.workerCount <= ELASTIC_MAX_WORKERS,
+               "elastic pool started %zu workers", stats.workerCount);
+
+    for (i = 0; i < (int)NUM_ARRAY_MEMBERS(ElasticValues); i++)
+    {
+        le_sem_Post(GateSemRef);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Completion of the elastic pool work.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ElasticWorkDone
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    le_threadPool_Stats_t stats;
+
+    LE_UNUSED(param1Ptr);
+    LE_UNUSED(param2Ptr);
+
+    if (++CompletionCount < ELASTIC_MAX_WORKERS * 2)
+    {
+        return;
+    }
+
+    LE_TEST_OK(WorkCount == ELASTIC_MAX_WORKERS * 2, "all the elastic pool work was run");
+
+    le_threadPool_GetStats(ElasticPoolRef, &stats);
+    LE_TEST_OK(stats.maxWorkerCount <= ELASTIC_MAX_WORKERS,
+               "elastic pool used at most %zu workers", stats.maxWorkerCount);
+    LE_TEST_OK(stats.completeCount == ELASTIC_MAX_WORKERS * 2,
+               "elastic pool counted %"PRIu64" completions", stats.completeCount);
+
+    le_threadPool_Delete(ElasticPoolRef);
+    le_sem_Delete(GateSemRef);
+    LE_TEST_OK(true, "elastic pool deleted");
+
+    LE_TEST_INFO("======== THREAD POOL TEST COMPLETE ========");
+    LE_TEST_EXIT;
+}
+
+
+COMPONENT_INIT
+{
+    static int Values[WORK_COUNT];
+    int i;
+
+    LE_TEST_INFO("======== BEGIN THREAD POOL TEST ========");
+
+    LE_TEST_PLAN(WORK_COUNT + 15);
+
+    MainThreadRef = le_thread_GetCurrent();
+
+    LE_TEST_INFO("-------- Testing fixed pool --------");
+    FixedPoolRef = le_threadPool_Create("FixedPool", FIXED_WORKERS, FIXED_WORKERS);
+    LE_TEST_ASSERT(FixedPoolRef != NULL, "fixed pool created");
+
+    for (i = 0; i < WORK_COUNT; i++)
+    {
+        Values[i] = i + 1;
+        le_threadPool_Submit(FixedPoolRef, DoubleWork, FixedWorkDone, &Values[i], NULL);
+    }
+}
@@ -15,6 +15,7 @@
 #include "mem.h"
 #include "thread.h"
 #include "safeRef.h"
+#include "threadPool.h"
 #include "messagingInterface.h"
 #include "messagingProtocol.h"
 #include "messagingSession.h"
@@ -74,6 +75,8 @@ typedef struct MutexIter*           MutexIter_Ref_t;
 typedef struct SemaphoreIter*       SemaphoreIter_Ref_t;
 typedef struct ThreadMemberObjIter* ThreadMemberObjIter_Ref_t;
 typedef struct RefMapIter*          RefMapIter_Ref_t;
+typedef struct ThreadPoolIter*      ThreadPoolIter_Ref_t;
+typedef struct HandlerStatsIter*    HandlerStatsIter_Ref_t;
 typedef struct ServiceObjIter*      ServiceObjIter_Ref_t;
 typedef struct ClientObjIter*       ClientObjIter_Ref_t;
 typedef struct SessionObjIter*      SessionObjIter_Ref_t;
@@ -93,6 +96,8 @@ typedef enum
     INSPECT_INSP_TYPE_MUTEX,
     INSPECT_INSP_TYPE_SEMAPHORE,
     INSPECT_INSP_TYPE_SAFE_REF,
+    INSPECT_INSP_TYPE_THREAD_POOL,
+    INSPECT_INSP_TYPE_HANDLER_STATS,
     INSPECT_INSP_TYPE_IPC_SERVERS,
     INSPECT_INSP_TYPE_IPC_CLIENTS,
     INSPECT_INSP_TYPE_IPC_SERVERS_SESSIONS,
@@ -219,6 +224,24 @@ typedef struct RefMapIter
 }
 RefMapIter_t;
 
+typedef struct ThreadPoolIter
+{
+    RemoteDlsListAccess_t threadPoolList; ///< Thread pool list in the remote process.
+    threadPool_Pool_t currThreadPool;     ///< Current thread pool from the list.
+}
+ThreadPoolIter_t;
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+typedef struct HandlerStatsIter
+{
+    RemoteDlsListAccess_t threadObjList; ///< Thread object list in the remote process.
+    thread_Obj_t currThreadObj;          ///< Current thread object from the list.
+    event_LoopStats_t currStats;         ///< Event Loop statistics of the current thread.
+    size_t handlerIndex;                 ///< Index of the current handler in currStats.
+}
+HandlerStatsIter_t;
+#endif
+
 typedef struct ServiceObjIter
 {
     RemoteHashmapAccess_t serviceObjMap; ///< Service object map in the remote process.
@@ -946,6 +969,50 @@ static RefMapIter_Ref_t CreateRefMapIter
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an iterator that can be used to iterate over the list of thread pools for a specific
+ * process.  See the comment block for CreateMemPoolIter for additional detail.
+ *
+ * @return
+ *      An iterator to the list of thread pools for the specified process.
+ */
+//--------------------------------------------------------------------------------------------------
+static ThreadPoolIter_Ref_t CreateThreadPoolIter
+(
+    void
+)
+{
+    // Get the address offset of the thread pool list for the process to inspect.
+    uintptr_t listAddrOffset = GetRemoteAddress(PidToInspect, threadPool_GetPoolList());
+
+    // Get the address offset of the thread pool list change counter for the process to inspect.
+    uintptr_t listChgCntAddrOffset = GetRemoteAddress(PidToInspect,
+                                                      threadPool_GetPoolListChgCntRef());
+
+    // Create the iterator
+    ThreadPoolIter_t* iteratorPtr = le_mem_ForceAlloc(IteratorPool);
+    InitRemoteDlsListAccessObj(&iteratorPtr->threadPoolList);
+
+    // Get the List for the process-under-inspection
+    if (TargetReadAddress(PidToInspect, listAddrOffset, &(iteratorPtr->threadPoolList.List),
+                          sizeof(iteratorPtr->threadPoolList.List)) != LE_OK)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("thread pool list"));
+    }
+
+    // Get the ListChgCntRef for the process-under-inspection.
+    if (TargetReadAddress(PidToInspect, listChgCntAddrOffset,
+                          &(iteratorPtr->threadPoolList.ListChgCntRef),
+                          sizeof(iteratorPtr->threadPoolList.ListChgCntRef)) != LE_OK)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("thread pool list change counter ref"));
+    }
+
+    return iteratorPtr;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Creates an iterator that can be used to iterate over the map of interface objects. See the
@@ -1224,6 +1291,27 @@ static size_t GetRefMapListChgCnt
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the thread pool list change counter from the specified iterator.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t GetThreadPoolListChgCnt
+(
+    ThreadPoolIter_Ref_t iterator ///< [IN] The iterator to get the list change counter from.
+)
+{
+    size_t threadPoolListChgCnt;
+    if (TargetReadAddress(PidToInspect, (uintptr_t)(iterator->threadPoolList.ListChgCntRef),
+                          &threadPoolListChgCnt, sizeof(threadPoolListChgCnt)) != LE_OK)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("thread pool list change counter"));
+    }
+
+    return threadPoolListChgCnt;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets the interface object map change counter from the specified iterator.
@@ -1859,6 +1947,197 @@ static void* GetNextRefMap
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the pointer to the next thread pool object.  For other details see GetNextMemPool.
+ *
+ * @return
+ *     A pointer to a thread pool object.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* GetNextThreadPool
+(
+    ThreadPoolIter_Ref_t threadPoolIterRef ///< [IN] The iterator to get the next thread pool from.
+)
+{
+    le_dls_Link_t* linkPtr = GetNextDlsLink(&(threadPoolIterRef->threadPoolList),
+                                            &(threadPoolIterRef->currThreadPool.poolListLink));
+
+    if (linkPtr == NULL)
+    {
+        return NULL;
+    }
+
+    // Get the address of the thread pool.
+    threadPool_Pool_t* poolPtr = CONTAINER_OF(linkPtr, threadPool_Pool_t, poolListLink);
+
+    // Read the thread pool into our own memory.
+    if (TargetReadAddress(PidToInspect, (uintptr_t)poolPtr, &(threadPoolIterRef->currThreadPool),
+                          sizeof(threadPoolIterRef->currThreadPool)) != LE_OK)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("thread pool object"));
+    }
+
+    return &(threadPoolIterRef->currThreadPool);
+}
+
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the Event Loop statistics of a thread of the process under inspection.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReadEventLoopStats
+(
+    thread_Obj_t* threadObjRef,     ///< [IN] Local copy of the thread object.
+    event_LoopStats_t* statsPtr     ///< [OUT] Event Loop statistics of the thread.
+)
+{
+    if (threadObjRef->eventRecPtr == NULL)
+    {
+        memset(statsPtr, 0, sizeof(*statsPtr));
+        return;
+    }
+
+    if (TargetReadAddress(PidToInspect,
+                          (uintptr_t)threadObjRef->eventRecPtr +
+                              offsetof(event_PerThreadRec_t, stats),
+                          statsPtr, sizeof(*statsPtr)) != LE_OK)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("event loop statistics"));
+    }
+
+    // The handler table may be written while it's being read; never trust its count.
+    if (statsPtr->handlerCount > NUM_ARRAY_MEMBERS(statsPtr->handlers))
+    {
+        statsPtr->handlerCount = NUM_ARRAY_MEMBERS(statsPtr->handlers);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an iterator that can be used to iterate over the handler statistics of all the threads
+ * of a specific process.  See the comment block for CreateMemPoolIter for additional detail.
+ *
+ * @return
+ *      An iterator to the handler statistics of the specified process.
+ */
+//--------------------------------------------------------------------------------------------------
+static HandlerStatsIter_Ref_t CreateHandlerStatsIter
+(
+    void
+)
+{
+    // The handler statistics are kept by each thread, so this iterates over the thread list.
+    uintptr_t listAddrOffset = GetRemoteAddress(PidToInspect, thread_GetThreadObjList());
+    uintptr_t listChgCntAddrOffset = GetRemoteAddress(PidToInspect,
+                                                      thread_GetThreadObjListChgCntRef());
+
+    // Create the iterator
+    HandlerStatsIter_t* iteratorPtr = le_mem_ForceAlloc(IteratorPool);
+    InitRemoteDlsListAccessObj(&iteratorPtr->threadObjList);
+    iteratorPtr->handlerIndex = 0;
+    iteratorPtr->currStats.handlerCount = 0;
+
+    // Get the List for the process-under-inspection
+    if (TargetReadAddress(PidToInspect, listAddrOffset, &(iteratorPtr->threadObjList.List),
+                          sizeof(iteratorPtr->threadObjList.List)) != LE_OK)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("thread obj list"));
+    }
+
+    // Get the ListChgCntRef for the process-under-inspection.
+    if (TargetReadAddress(PidToInspect, listChgCntAddrOffset,
+                          &(iteratorPtr->threadObjList.ListChgCntRef),
+                          sizeof(iteratorPtr->threadObjList.ListChgCntRef)) != LE_OK)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("thread obj list change counter ref"));
+    }
+
+    return iteratorPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the thread obj list change counter from the specified handler statistics iterator.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t GetHandlerStatsListChgCnt
+(
+    HandlerStatsIter_Ref_t iterator ///< [IN] The iterator to get the list change counter from.
+)
+{
+    size_t threadObjListChgCnt;
+    if (TargetReadAddress(PidToInspect, (uintptr_t)(iterator->threadObjList.ListChgCntRef),
+                          &threadObjListChgCnt, sizeof(threadObjListChgCnt)) != LE_OK)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("thread obj list change counter"));
+    }
+
+    return threadObjListChgCnt;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move the iterator to the next handler statistics entry, moving on to the next thread once all
+ * the handlers of the current thread have been visited.  For other details see GetNextMemPool.
+ *
+ * @return
+ *     The iterator itself, with handlerIndex set to the current entry of currStats, or NULL if
+ *     there are no more entries.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* GetNextHandlerStats
+(
+    HandlerStatsIter_Ref_t handlerStatsIterRef ///< [IN] The iterator to get the next entry from.
+)
+{
+    // Move on to the next entry of the current thread, if any.
+    if (handlerStatsIterRef->handlerIndex + 1 < handlerStatsIterRef->currStats.handlerCount)
+    {
+        handlerStatsIterRef->handlerIndex++;
+        return handlerStatsIterRef;
+    }
+
+    // Otherwise, move on to the next thread with at least one entry.
+    for (;;)
+    {
+        le_dls_Link_t* linkPtr = GetNextDlsLink(&(handlerStatsIterRef->threadObjList),
+                                                &(handlerStatsIterRef->currThreadObj.link));
+
+        if (linkPtr == NULL)
+        {
+            return NULL;
+        }
+
+        // Get the address of thread obj.
+        thread_Obj_t* threadObjPtr = CONTAINER_OF(linkPtr, thread_Obj_t, link);
+
+        // Read the thread obj into our own memory.
+        if (TargetReadAddress(PidToInspect, (uintptr_t)threadObjPtr,
+                              &(handlerStatsIterRef->currThreadObj),
+                              sizeof(handlerStatsIterRef->currThreadObj)) != LE_OK)
+        {
+            INTERNAL_ERR(REMOTE_READ_ERR("thread obj"));
+        }
+
+        ReadEventLoopStats(&(handlerStatsIterRef->currThreadObj),
+                           &(handlerStatsIterRef->currStats));
+
+        if (handlerStatsIterRef->currStats.handlerCount > 0)
+        {
+            handlerStatsIterRef->handlerIndex = 0;
+            return handlerStatsIterRef;
+        }
+    }
+}
+#endif /* end LE_CONFIG_EVENT_LOOP_STATS */
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets the pointer to the next interface instance object. For other detail see GetNextMemPool.
@@ -2075,13 +2354,19 @@ static void PrintHelp
         "              Legato process.\n"
         "\n"
         "SYNOPSIS:\n"
-        "    inspect <pools|saferefs|threads|timers|mutexes|semaphores> [OPTIONS] PID\n"
+        "    inspect <pools|saferefs|threads|threadpools|handlers|timers|mutexes|semaphores>"
+                                                                                " [OPTIONS] PID\n"
         "    inspect ipc <servers|clients [sessions]> [OPTIONS] PID\n"
         "\n"
         "DESCRIPTION:\n"
         "    inspect pools              Prints the memory pools usage for the specified process.\n"
         "    inspect saferefs           Prints the current safe references usage.\n"
         "    inspect threads            Prints the info of threads for the specified process.\n"
+        "    inspect threadpools        Prints the worker thread pools usage for the specified"
+                                        " process.\n"
+        "    inspect handlers           Prints the calls and run times of the event loop handlers\n"
+        "                               of all threads for the specified process (requires\n"
+        "                               LE_CONFIG_EVENT_LOOP_STATS).\n"
         "    inspect timers             Prints the info of timers in all threads for the"
                                         " specified process.\n"
         "    inspect mutexes            Prints the info of mutexes in all threads for the"
@@ -2196,7 +2481,12 @@ static ColumnInfo_t ThreadObjTableInfo[] =
     {"CONTENTION SCOPE", "%*s", NULL, "%*s",  0,                    true,  0, true},
     {"GUARD SIZE",       "%*s", NULL, "%*zu", sizeof(size_t),       false, 0, true},
     {"STACK ADDR",       "%*s", NULL, "%*X",  sizeof(uint64_t),     false, 0, true},
-    {"STACK SIZE",       "%*s", NULL, "%*zu", sizeof(size_t),       false, 0, true}
+    {"STACK SIZE",       "%*s", NULL, "%*zu", sizeof(size_t),       false, 0, true},
+#if LE_CONFIG_EVENT_LOOP_STATS
+    {"QUEUED",           "%*s", NULL, "%*zu", sizeof(size_t),       false, 0, true},
+    {"MAX QUEUED",       "%*s", NULL, "%*zu", sizeof(size_t),       false, 0, true},
+    {"MAX QUEUE US",     "%*s", NULL, "%*"PRIu64"", sizeof(uint64_t), false, 0, true},
+#endif
 };
 static size_t ThreadObjTableInfoSize = NUM_ARRAY_MEMBERS(ThreadObjTableInfo);
 
@@ -2236,6 +2526,46 @@ static ColumnInfo_t RefMapTableInfo[] =
 };
 static size_t RefMapTableInfoSize = NUM_ARRAY_MEMBERS(RefMapTableInfo);
 
+static ColumnInfo_t ThreadPoolTableInfo[] =
+{
+    {"NAME",        "%*s", NULL, "%*s",       LIMIT_MAX_THREAD_POOL_NAME_BYTES, true,  0, true},
+    {"WORKERS",     "%*s", NULL, "%*zu",      sizeof(size_t),                   false, 0, true},
+    {"MAX USED",    "%*s", NULL, "%*zu",      sizeof(size_t),                   false, 0, true},
+    {"MIN",         "%*s", NULL, "%*zu",      sizeof(size_t),                   false, 0, false},
+    {"MAX",         "%*s", NULL, "%*zu",      sizeof(size_t),                   false, 0, false},
+    {"IDLE",        "%*s", NULL, "%*zu",      sizeof(size_t),                   false, 0, true},
+    {"QUEUED",      "%*s", NULL, "%*zu",      sizeof(size_t),                   false, 0, true},
+    {"MAX QUEUED",  "%*s", NULL, "%*zu",      sizeof(size_t),                   false, 0, true},
+    {"SUBMITTED",   "%*s", NULL, "%*"PRIu64"", sizeof(uint64_t),                false, 0, true},
+    {"COMPLETED",   "%*s", NULL, "%*"PRIu64"", sizeof(uint64_t),                false, 0, true},
+    {"STOLEN",      "%*s", NULL, "%*"PRIu64"", sizeof(uint64_t),                false, 0, true}
+};
+static size_t ThreadPoolTableInfoSize = NUM_ARRAY_MEMBERS(ThreadPoolTableInfo);
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+static ColumnInfo_t HandlerStatsTableInfo[] =
+{
+    {"THREAD",      "%*s", NULL, "%*s",       MAX_THREAD_NAME_SIZE,               true,  0, true},
+    {"TYPE",        "%*s", NULL, "%*s",       6,                                  true,  0, true},
+    {"NAME",        "%*s", NULL, "%*s",       LIMIT_MAX_EVENT_HANDLER_NAME_BYTES, true,  0, true},
+    {"FUNCTION",    "%*s", NULL, "%*s",       2 + (2 * sizeof(void*)),            true,  0, true},
+    {"CALLS",       "%*s", NULL, "%*"PRIu64"", sizeof(uint64_t),                  false, 0, true},
+    {"TOTAL US",    "%*s", NULL, "%*"PRIu64"", sizeof(uint64_t),                  false, 0, true},
+    {"MAX US",      "%*s", NULL, "%*"PRIu64"", sizeof(uint64_t),                  false, 0, true},
+    {"OVER BUDGET", "%*s", NULL, "%*"PRIu64"", sizeof(uint64_t),                  false, 0, true}
+};
+static size_t HandlerStatsTableInfoSize = NUM_ARRAY_MEMBERS(HandlerStatsTableInfo);
+
+// Names of the kinds of handler, indexed by event_DispatchType_t.
+static char* HandlerStatsTypeStr[] =
+{
+    "queued",
+    "event",
+    "fd",
+    "timer"
+};
+#endif
+
 static ColumnInfo_t ServiceObjTableInfo[] =
 {
     {"INTERFACE NAME", "%*s", NULL, "%*s",  LIMIT_MAX_IPC_INTERFACE_NAME_BYTES, true,  0, true},
@@ -2588,6 +2918,16 @@ static void InitDisplay
             InitDisplayTable(RefMapTableInfo, RefMapTableInfoSize);
             break;
 
+        case INSPECT_INSP_TYPE_THREAD_POOL:
+            InitDisplayTable(ThreadPoolTableInfo, ThreadPoolTableInfoSize);
+            break;
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+        case INSPECT_INSP_TYPE_HANDLER_STATS:
+            InitDisplayTable(HandlerStatsTableInfo, HandlerStatsTableInfoSize);
+            break;
+#endif
+
         case INSPECT_INSP_TYPE_IPC_SERVERS:
             InitDisplayTable(ServiceObjTableInfo, ServiceObjTableInfoSize);
             break;
@@ -2789,6 +3129,20 @@ static int PrintInspectHeader
             tableSize = RefMapTableInfoSize;
             break;
 
+        case INSPECT_INSP_TYPE_THREAD_POOL:
+            strncpy(inspectTypeString, "Thread Pools", inspectTypeStringSize);
+            table = ThreadPoolTableInfo;
+            tableSize = ThreadPoolTableInfoSize;
+            break;
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+        case INSPECT_INSP_TYPE_HANDLER_STATS:
+            strncpy(inspectTypeString, "Event Loop Handlers", inspectTypeStringSize);
+            table = HandlerStatsTableInfo;
+            tableSize = HandlerStatsTableInfoSize;
+            break;
+#endif
+
         case INSPECT_INSP_TYPE_IPC_SERVERS:
             strncpy(inspectTypeString, "IPC Server Interface", inspectTypeStringSize);
             table = ServiceObjTableInfo;
@@ -3412,6 +3766,13 @@ static int PrintThreadObjInfo
         INTERNAL_ERR("pthread_attr_getstack failed.");
     }
 
+#if LE_CONFIG_EVENT_LOOP_STATS
+    // Only the queue statistics are displayed here; see "inspect handlers" for the rest.
+    event_LoopStats_t loopStats;
+    event_LoopStats_t* loopStatsPtr = &loopStats;
+    ReadEventLoopStats(threadObjRef, loopStatsPtr);
+#endif
+
     // Output thread object info
     int index = 0;
 
@@ -3439,6 +3800,14 @@ static int PrintThreadObjInfo
                                                                     ThreadObjTableInfoSize, &index);
         FillSizeTColField (stackSize,                               ThreadObjTableInfo,
                                                                     ThreadObjTableInfoSize, &index);
+#if LE_CONFIG_EVENT_LOOP_STATS
+        FillSizeTColField (loopStatsPtr->queueDepth,                ThreadObjTableInfo,
+                                                                    ThreadObjTableInfoSize, &index);
+        FillSizeTColField (loopStatsPtr->maxQueueDepth,             ThreadObjTableInfo,
+                                                                    ThreadObjTableInfoSize, &index);
+        FillUint64ColField(loopStatsPtr->maxQueueTime,              ThreadObjTableInfo,
+                                                                    ThreadObjTableInfoSize, &index);
+#endif
 
         PrintInfo(ThreadObjTableInfo, ThreadObjTableInfoSize);
         lineCount++;
@@ -3481,6 +3850,14 @@ static int PrintThreadObjInfo
                                                           ThreadObjTableInfoSize, &index, &printed);
         ExportSizeTToJson (stackSize,                     ThreadObjTableInfo,
                                                           ThreadObjTableInfoSize, &index, &printed);
+#if LE_CONFIG_EVENT_LOOP_STATS
+        ExportSizeTToJson (loopStatsPtr->queueDepth,      ThreadObjTableInfo,
+                                                          ThreadObjTableInfoSize, &index, &printed);
+        ExportSizeTToJson (loopStatsPtr->maxQueueDepth,   ThreadObjTableInfo,
+                                                          ThreadObjTableInfoSize, &index, &printed);
+        ExportUint64ToJson(loopStatsPtr->maxQueueTime,    ThreadObjTableInfo,
+                                                          ThreadObjTableInfoSize, &index, &printed);
+#endif
 
         printf("]");
     }
@@ -4046,6 +4423,176 @@ static int PrintRefMapInfo
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print thread pool information to stdout.
+ */
+//--------------------------------------------------------------------------------------------------
+static int PrintThreadPoolInfo
+(
+    threadPool_Pool_t* poolPtr  ///< [IN] ref to thread pool to be printed.
+)
+{
+    int lineCount = 0;
+
+    int index = 0;
+
+    if (!IsOutputJson)
+    {
+        FillStrColField   (poolPtr->name,           ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillSizeTColField (poolPtr->workerCount,    ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillSizeTColField (poolPtr->maxWorkerCount, ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillSizeTColField (poolPtr->minWorkers,     ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillSizeTColField (poolPtr->maxWorkers,     ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillSizeTColField (poolPtr->idleCount,      ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillSizeTColField (poolPtr->queuedCount,    ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillSizeTColField (poolPtr->maxQueuedCount, ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillUint64ColField(poolPtr->submitCount,    ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillUint64ColField(poolPtr->completeCount,  ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+        FillUint64ColField(poolPtr->stealCount,     ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index);
+
+        PrintInfo(ThreadPoolTableInfo, ThreadPoolTableInfoSize);
+        lineCount++;
+    }
+    else
+    {
+        if (!IsPrintedNodeFirst)
+        {
+            printf(",");
+        }
+        else
+        {
+            IsPrintedNodeFirst = false;
+        }
+
+        bool printed = false;
+        printf("[");
+
+        ExportStrToJson   (poolPtr->name,           ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolPtr->workerCount,    ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolPtr->maxWorkerCount, ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolPtr->minWorkers,     ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolPtr->maxWorkers,     ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolPtr->idleCount,      ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolPtr->queuedCount,    ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolPtr->maxQueuedCount, ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportUint64ToJson(poolPtr->submitCount,    ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportUint64ToJson(poolPtr->completeCount,  ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        ExportUint64ToJson(poolPtr->stealCount,     ThreadPoolTableInfo,
+                                                    ThreadPoolTableInfoSize, &index, &printed);
+        printf("]");
+    }
+
+    return lineCount;
+}
+
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print the statistics of an event loop handler to stdout.
+ */
+//--------------------------------------------------------------------------------------------------
+static int PrintHandlerStatsInfo
+(
+    HandlerStatsIter_t* iterRef ///< [IN] Iterator positioned on the handler to be printed.
+)
+{
+    int lineCount = 0;
+
+    event_HandlerStats_t* statsPtr = &iterRef->currStats.handlers[iterRef->handlerIndex];
+
+    char* typeStr = (statsPtr->type < NUM_ARRAY_MEMBERS(HandlerStatsTypeStr)) ?
+                    HandlerStatsTypeStr[statsPtr->type] : "?";
+
+    char funcStr[2 + (2 * sizeof(void*)) + 1];
+    snprintf(funcStr, sizeof(funcStr), "0x%" PRIxPTR, (uintptr_t)statsPtr->funcPtr);
+
+    // The name is copied from the remote process; make sure it's terminated.
+    statsPtr->name[sizeof(statsPtr->name) - 1] = '\0';
+
+    int index = 0;
+
+    if (!IsOutputJson)
+    {
+        FillStrColField   (THREAD_NAME(iterRef->currThreadObj.name), HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index);
+        FillStrColField   (typeStr,                   HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index);
+        FillStrColField   (statsPtr->name,            HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index);
+        FillStrColField   (funcStr,                   HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index);
+        FillUint64ColField(statsPtr->callCount,       HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index);
+        FillUint64ColField(statsPtr->totalTime,       HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index);
+        FillUint64ColField(statsPtr->maxTime,         HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index);
+        FillUint64ColField(statsPtr->overBudgetCount, HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index);
+
+        PrintInfo(HandlerStatsTableInfo, HandlerStatsTableInfoSize);
+        lineCount++;
+    }
+    else
+    {
+        if (!IsPrintedNodeFirst)
+        {
+            printf(",");
+        }
+        else
+        {
+            IsPrintedNodeFirst = false;
+        }
+
+        bool printed = false;
+        printf("[");
+
+        ExportStrToJson   (THREAD_NAME(iterRef->currThreadObj.name), HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index, &printed);
+        ExportStrToJson   (typeStr,                   HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index, &printed);
+        ExportStrToJson   (statsPtr->name,            HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index, &printed);
+        ExportStrToJson   (funcStr,                   HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index, &printed);
+        ExportUint64ToJson(statsPtr->callCount,       HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index, &printed);
+        ExportUint64ToJson(statsPtr->totalTime,       HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index, &printed);
+        ExportUint64ToJson(statsPtr->maxTime,         HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index, &printed);
+        ExportUint64ToJson(statsPtr->overBudgetCount, HandlerStatsTableInfo,
+                                                    HandlerStatsTableInfoSize, &index, &printed);
+        printf("]");
+    }
+
+    return lineCount;
+}
+#endif /* end LE_CONFIG_EVENT_LOOP_STATS */
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -4440,6 +4987,22 @@ static void InspectFunc
             printNodeInfoFunc = (PrintNodeInfoFunc_t) PrintRefMapInfo;
             break;
 
+        case INSPECT_INSP_TYPE_THREAD_POOL:
+            createIterFunc    = (CreateIterFunc_t)    CreateThreadPoolIter;
+            getListChgCntFunc = (GetListChgCntFunc_t) GetThreadPoolListChgCnt;
+            getNextNodeFunc   = (GetNextNodeFunc_t)   GetNextThreadPool;
+            printNodeInfoFunc = (PrintNodeInfoFunc_t) PrintThreadPoolInfo;
+            break;
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+        case INSPECT_INSP_TYPE_HANDLER_STATS:
+            createIterFunc    = (CreateIterFunc_t)    CreateHandlerStatsIter;
+            getListChgCntFunc = (GetListChgCntFunc_t) GetHandlerStatsListChgCnt;
+            getNextNodeFunc   = (GetNextNodeFunc_t)   GetNextHandlerStats;
+            printNodeInfoFunc = (PrintNodeInfoFunc_t) PrintHandlerStatsInfo;
+            break;
+#endif
+
         case INSPECT_INSP_TYPE_IPC_SERVERS:
             createIterFunc    = (CreateIterFunc_t)    CreateServiceObjIter;
             getListChgCntFunc = (GetListChgCntFunc_t) GetInterfaceObjMapChgCnt;
@@ -4683,6 +5246,19 @@ static void CommandArgHandler
     {
         InspectType = INSPECT_INSP_TYPE_SAFE_REF;
     }
+    else if (strcmp(command, "threadpools") == 0)
+    {
+        InspectType = INSPECT_INSP_TYPE_THREAD_POOL;
+    }
+    else if (strcmp(command, "handlers") == 0)
+    {
+#if LE_CONFIG_EVENT_LOOP_STATS
+        InspectType = INSPECT_INSP_TYPE_HANDLER_STATS;
+#else
+        fprintf(stderr, "Event loop statistics are not enabled (LE_CONFIG_EVENT_LOOP_STATS).\n");
+        exit(EXIT_FAILURE);
+#endif
+    }
     else if (strcmp(command, "ipc") == 0)
     {
         le_arg_AddPositionalCallback(IpcInterfaceTypeHandler);
@@ -4786,6 +5362,16 @@ static void InitIteratorPool
             size = sizeof(RefMapIter_t);
             break;
 
+        case INSPECT_INSP_TYPE_THREAD_POOL:
+            size = sizeof(ThreadPoolIter_t);
+            break;
+
+#if LE_CONFIG_EVENT_LOOP_STATS
+        case INSPECT_INSP_TYPE_HANDLER_STATS:
+            size = sizeof(HandlerStatsIter_t);
+            break;
+#endif
+
         case INSPECT_INSP_TYPE_IPC_SERVERS:
             // Make the block size big enough to accomodate either one.
             // Technically a little wasteful.
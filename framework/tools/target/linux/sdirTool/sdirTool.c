@@ -75,6 +75,8 @@ static void PrintHelpAndExit
         "SYNOPSIS:\n"
         "    sdir list\n"
         "    sdir list --format=json\n"
+        "    sdir stats\n"
+        "    sdir stats --format=json\n"
         "    sdir load\n"
         "    sdir bind CLIENT_IF SERVER_IF\n"
         "    sdir help\n"
@@ -88,6 +90,14 @@ static void PrintHelpAndExit
         "    sdir list --format=json\n"
         "            Lists bindings, services, and waiting clients in json format.\n"
         "\n"
+        "    sdir stats\n"
+        "            Prints the number of times, the total time and the longest time\n"
+        "            spent by the Service Directory in each phase of opening sessions\n"
+        "            and advertising services, and the sizes of its lookup indices.\n"
+        "\n"
+        "    sdir stats --format=json\n"
+        "            Same as 'sdir stats', in json format.\n"
+        "\n"
         "    sdir load\n"
         "            Updates the Service Directory's bindings with the current state\n"
         "            of the binding configuration settings in the configuration tree.\n"
@@ -234,12 +244,13 @@ static void PrintList
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Execute a 'list' command.
+ * Execute a command which dumps output from the Service Directory ('list' or 'stats').
  */
 //--------------------------------------------------------------------------------------------------
-static void List
+static void Dump
 (
-    void
+    le_sdtp_MsgType_t msgType,      ///< Message type to request the human readable output.
+    le_sdtp_MsgType_t jsonMsgType   ///< Message type to request the json output.
 )
 //--------------------------------------------------------------------------------------------------
 {
@@ -258,12 +269,12 @@ static void List
 
     if (FormatPtr == NULL)
     {
-        msgPtr->msgType = LE_SDTP_MSGID_LIST;
+        msgPtr->msgType = msgType;
     }
     else
     {
         // Currently only json format is accepted.
-        msgPtr->msgType = LE_SDTP_MSGID_LIST_JSON;
+        msgPtr->msgType = jsonMsgType;
     }
 
     msgRef = le_msg_RequestSyncResponse(msgRef);
@@ -939,9 +950,13 @@ COMPONENT_INIT
 
     if (strcmp(CommandPtr, "list") == 0)
     {
-        List();
+        Dump(LE_SDTP_MSGID_LIST, LE_SDTP_MSGID_LIST_JSON);
+    }
+    else if (strcmp(CommandPtr, "stats") == 0)
+    {
+        Dump(LE_SDTP_MSGID_STATS, LE_SDTP_MSGID_STATS_JSON);
     }
-    // --format= option is not valid for any commands other than 'list'.
+    // --format= option is not valid for any commands other than 'list' and 'stats'.
     else if (FormatPtr != NULL)
     {
         char errorMsg[255];